@@ -90,7 +90,7 @@ ExternalProject_Add(
         -DEMBREE_STATIC_LIB=ON
         -DEMBREE_GEOMETRY_CURVE=OFF
         -DEMBREE_GEOMETRY_GRID=OFF
-        -DEMBREE_GEOMETRY_INSTANCE=OFF
+        -DEMBREE_GEOMETRY_INSTANCE=ON
         -DEMBREE_GEOMETRY_QUAD=OFF
         -DEMBREE_GEOMETRY_SUBDIVISION=OFF
         -DEMBREE_TASKING_SYSTEM=INTERNAL
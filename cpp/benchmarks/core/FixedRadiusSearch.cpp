@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "open3d/core/nns/FixedRadiusSearchImpl.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+class VectorAllocator {
+public:
+    void AllocIndices(int32_t** ptr, size_t num) {
+        indices_.resize(num);
+        *ptr = indices_.data();
+    }
+
+    void AllocDistances(float** ptr, size_t num) {
+        distances_.resize(num);
+        *ptr = distances_.data();
+    }
+
+    std::vector<int32_t> indices_;
+    std::vector<float> distances_;
+};
+
+// Uniformly distributed points in the unit cube with the spatial hash table
+// for a radius search of all points.
+class RadiusSearchData {
+public:
+    RadiusSearchData(int num_points, float radius) : radius_(radius) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> dist(0.f, 1.f);
+        points_.resize(num_points * 3);
+        for (float& v : points_) v = dist(rng);
+
+        row_splits_ = {0, num_points};
+        // Same hash table size factor as FixedRadiusIndex.
+        hash_table_splits_ = {0, uint32_t(std::max(1, num_points / 32))};
+        hash_table_cell_splits_.resize(hash_table_splits_.back() + 1);
+        hash_table_index_.resize(num_points);
+        nns::impl::BuildSpatialHashTableCPU(
+                num_points, points_.data(), radius_, row_splits_.size(),
+                row_splits_.data(), hash_table_splits_.data(),
+                hash_table_cell_splits_.size(), hash_table_cell_splits_.data(),
+                hash_table_index_.data());
+    }
+
+    void Search(int max_neighbors, bool single_pass) const {
+        const size_t num_points = points_.size() / 3;
+        std::vector<int64_t> neighbors_row_splits(num_points + 1);
+        VectorAllocator allocator;
+        nns::impl::FixedRadiusSearchCPU<float, int32_t>(
+                neighbors_row_splits.data(), num_points, points_.data(),
+                num_points, points_.data(), radius_, row_splits_.size(),
+                row_splits_.data(), row_splits_.size(), row_splits_.data(),
+                hash_table_splits_.data(), hash_table_cell_splits_.size(),
+                hash_table_cell_splits_.data(), hash_table_index_.data(),
+                nns::L2, false, true, allocator, max_neighbors, single_pass);
+        benchmark::DoNotOptimize(allocator.indices_.data());
+    }
+
+private:
+    float radius_;
+    std::vector<float> points_;
+    std::vector<int64_t> row_splits_;
+    std::vector<uint32_t> hash_table_splits_;
+    std::vector<uint32_t> hash_table_cell_splits_;
+    std::vector<uint32_t> hash_table_index_;
+};
+
+}  // namespace
+
+// With the radius 0.05 there are about 34 neighbors per point for 2^16
+// points and about 137 for 2^18 points.
+void FixedRadiusSearch(benchmark::State& state,
+                       int max_neighbors,
+                       bool single_pass) {
+    const RadiusSearchData data(state.range(0), 0.05f);
+    data.Search(max_neighbors, single_pass);
+    for (auto _ : state) {
+        data.Search(max_neighbors, single_pass);
+    }
+}
+
+BENCHMARK_CAPTURE(FixedRadiusSearch, TwoPass, 0, false)
+        ->Arg(1 << 16)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearch, SinglePass, 0, true)
+        ->Arg(1 << 16)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearch, SinglePassMaxNeighbors16, 16, true)
+        ->Arg(1 << 16)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
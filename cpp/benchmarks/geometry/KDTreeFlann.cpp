@@ -77,5 +77,54 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+static geometry::PointCloud MakeRandomPointCloud(int size) {
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    for (auto& p : pc.points_) {
+        p = Eigen::Vector3d::Random();
+    }
+    return pc;
+}
+
+static void BM_KDTreeFlannSearchHybridLoop(benchmark::State& state) {
+    const geometry::PointCloud pc = MakeRandomPointCloud(state.range(0));
+    geometry::KDTreeFlann kdtree(pc);
+    for (auto _ : state) {
+        std::vector<size_t> counts(pc.points_.size());
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < (int)pc.points_.size(); ++i) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            counts[i] = kdtree.SearchHybrid(pc.points_[i], 0.05, 30, indices,
+                                            distance2);
+        }
+        benchmark::DoNotOptimize(counts.data());
+    }
+}
+
+static void BM_KDTreeFlannBatchSearchHybrid(benchmark::State& state) {
+    const geometry::PointCloud pc = MakeRandomPointCloud(state.range(0));
+    geometry::KDTreeFlann kdtree(pc);
+    Eigen::Map<const Eigen::MatrixXd> queries(
+            (const double*)pc.points_.data(), 3, pc.points_.size());
+    for (auto _ : state) {
+        std::vector<size_t> offsets;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.BatchSearchHybrid(queries, 0.05, 30, offsets, indices,
+                                 distance2);
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+BENCHMARK(BM_KDTreeFlannSearchHybridLoop)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KDTreeFlannBatchSearchHybrid)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -307,6 +307,67 @@ void LegacyRemoveRadiusOutliers(benchmark::State& state,
     }
 }
 
+void ClusterDBSCAN(benchmark::State& state,
+                   const core::Device& device,
+                   const core::Dtype& dtype,
+                   const double eps,
+                   const size_t min_points) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+    pcd.SetPointPositions(pcd.GetPointPositions().To(dtype));
+
+    // Warm up.
+    pcd.ClusterDBSCAN(eps, min_points);
+
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, min_points);
+    }
+}
+
+void LegacyClusterDBSCAN(benchmark::State& state,
+                         const double eps,
+                         const size_t min_points) {
+    open3d::geometry::PointCloud pcd;
+    open3d::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    // Warm up.
+    pcd.ClusterDBSCAN(eps, min_points);
+
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, min_points);
+    }
+}
+
+void SegmentPlane(benchmark::State& state,
+                  const core::Device& device,
+                  const core::Dtype& dtype,
+                  const int num_iterations) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+    pcd.SetPointPositions(pcd.GetPointPositions().To(dtype));
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, 3, num_iterations);
+
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, 3, num_iterations);
+    }
+}
+
+void LegacySegmentPlane(benchmark::State& state, const int num_iterations) {
+    open3d::geometry::PointCloud pcd;
+    open3d::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, 3, num_iterations);
+
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, 3, num_iterations);
+    }
+}
+
 void CropByAxisAlignedBox(benchmark::State& state, const core::Device& device) {
     t::geometry::PointCloud pcd;
     t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
@@ -617,6 +678,32 @@ BENCHMARK_CAPTURE(ComputeBoundaryPoints,
                   30,
                   0.02)
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN,
+                  CPU Float32[0.02 | 10],
+                  core::Device("CPU:0"),
+                  core::Float32,
+                  0.02,
+                  10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN,
+                  CPU Float64[0.02 | 10],
+                  core::Device("CPU:0"),
+                  core::Float64,
+                  0.02,
+                  10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane,
+                  CPU Float32[1000],
+                  core::Device("CPU:0"),
+                  core::Float32,
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane,
+                  CPU Float64[1000],
+                  core::Device("CPU:0"),
+                  core::Float64,
+                  1000)
+        ->Unit(benchmark::kMillisecond);
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(
         RemoveRadiusOutliers, CUDA[50 | 0.05], core::Device("CUDA:0"), 50, 0.03)
@@ -644,8 +731,19 @@ BENCHMARK_CAPTURE(ComputeBoundaryPoints,
                   30,
                   0.02)
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN,
+                  CUDA Float32[0.02 | 10],
+                  core::Device("CUDA:0"),
+                  core::Float32,
+                  0.02,
+                  10)
+        ->Unit(benchmark::kMillisecond);
 #endif
 
+BENCHMARK_CAPTURE(LegacyClusterDBSCAN, Legacy[0.02 | 10], 0.02, 10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacySegmentPlane, Legacy[1000], 1000)
+        ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyRemoveRadiusOutliers, Legacy[50 | 0.05], 50, 0.03)
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyRemoveStatisticalOutliers, Legacy[30], 30)
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// About 1M triangles.
+static TriangleMesh CreateMesh() {
+    return TriangleMesh::CreateSphere(1.0, 500);
+}
+
+// Queries force the lazy commit of the scene.
+static core::Tensor CreateRays() {
+    return RaycastingScene::CreateRaysPinhole(
+            60, core::Tensor::Init<float>({0, 0, 0}),
+            core::Tensor::Init<float>({0, 0, 5}),
+            core::Tensor::Init<float>({0, 1, 0}), 64, 48);
+}
+
+// Deforms the mesh every iteration and refits the BVH.
+void RefitVertexPositions(benchmark::State& state) {
+    const TriangleMesh mesh = CreateMesh();
+    const core::Tensor rays = CreateRays();
+    const core::Tensor positions[2] = {mesh.GetVertexPositions(),
+                                       mesh.GetVertexPositions() * 1.01f};
+    RaycastingScene scene;
+    const uint32_t geom_id = scene.AddTriangles(mesh, true);
+    scene.CastRays(rays);
+
+    int i = 0;
+    for (auto _ : state) {
+        scene.UpdateVertexPositions(geom_id, positions[++i % 2]);
+        scene.CastRays(rays);
+    }
+}
+
+// Deforms the mesh every iteration and rebuilds the BVH.
+void RebuildVertexPositions(benchmark::State& state) {
+    const TriangleMesh mesh = CreateMesh();
+    const core::Tensor rays = CreateRays();
+    const core::Tensor indices = mesh.GetTriangleIndices().To(core::UInt32);
+    const core::Tensor positions[2] = {mesh.GetVertexPositions(),
+                                       mesh.GetVertexPositions() * 1.01f};
+    RaycastingScene scene;
+    uint32_t geom_id = scene.AddTriangles(mesh);
+    scene.CastRays(rays);
+
+    int i = 0;
+    for (auto _ : state) {
+        scene.RemoveGeometry(geom_id);
+        geom_id = scene.AddTriangles(positions[++i % 2], indices);
+        scene.CastRays(rays);
+    }
+}
+
+// Moves the mesh every iteration with a rigid transformation.
+void SetGeometryTransform(benchmark::State& state) {
+    const TriangleMesh mesh = CreateMesh();
+    const core::Tensor rays = CreateRays();
+    core::Tensor transformation =
+            core::Tensor::Eye(4, core::Float32, core::Device("CPU:0"));
+    RaycastingScene scene;
+    const uint32_t geom_id = scene.AddTriangles(mesh, true);
+    scene.CastRays(rays);
+
+    int i = 0;
+    for (auto _ : state) {
+        transformation[0][3] = 0.01f * (++i % 2);
+        scene.SetGeometryTransform(geom_id, transformation);
+        scene.CastRays(rays);
+    }
+}
+
+// Renders 8 depth images of 640x480 px by casting the rays of each camera.
+static const int kNumCameras = 8;
+
+static core::Tensor CreateIntrinsics() {
+    return core::Tensor::Init<double>(
+            {{500, 0, 320}, {0, 500, 240}, {0, 0, 1}});
+}
+
+static core::Tensor CreateExtrinsics() {
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4})
+                    .Expand({kNumCameras, 4, 4})
+                    .Contiguous();
+    for (int i = 0; i < kNumCameras; ++i) {
+        extrinsics[i][0][3] = 0.05 * i;
+        extrinsics[i][2][3] = 3.0;
+    }
+    return extrinsics;
+}
+
+// Dynamic meshes are instanced, which makes the queries slower.
+void CastRaysPinholeBatch(benchmark::State& state, bool dynamic) {
+    const core::Tensor intrinsics = CreateIntrinsics();
+    const core::Tensor extrinsics = CreateExtrinsics();
+    RaycastingScene scene;
+    scene.AddTriangles(CreateMesh(), dynamic);
+    scene.CastRays(CreateRays());
+
+    for (auto _ : state) {
+        for (int i = 0; i < kNumCameras; ++i) {
+            const core::Tensor rays = RaycastingScene::CreateRaysPinhole(
+                    intrinsics, extrinsics[i], 640, 480);
+            scene.CastRays(rays);
+        }
+    }
+}
+
+// Renders the same images with the tiled ray packets of RenderDepthBatch.
+void RenderDepthBatch(benchmark::State& state) {
+    const core::Tensor intrinsics = CreateIntrinsics();
+    const core::Tensor extrinsics = CreateExtrinsics();
+    RaycastingScene scene;
+    scene.AddTriangles(CreateMesh());
+    scene.CastRays(CreateRays());
+
+    std::unordered_map<std::string, core::Tensor> outputs = {
+            {"t_hit", core::Tensor()}};
+    for (auto _ : state) {
+        scene.RenderDepthBatch(intrinsics, extrinsics, 640, 480, outputs);
+    }
+}
+
+BENCHMARK(RefitVertexPositions)->Unit(benchmark::kMillisecond);
+BENCHMARK(RebuildVertexPositions)->Unit(benchmark::kMillisecond);
+BENCHMARK(SetGeometryTransform)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRaysPinholeBatch, Static, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRaysPinholeBatch, Dynamic, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(RenderDepthBatch)->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
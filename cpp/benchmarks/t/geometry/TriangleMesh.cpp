@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TriangleMesh.h"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void SimplifyQuadricDecimation(benchmark::State& state,
+                               int max_partition_triangles) {
+    // About 1M triangles.
+    const TriangleMesh mesh = TriangleMesh::CreateSphere(1.0, 500);
+
+    // Warm up.
+    TriangleMesh simplified =
+            mesh.SimplifyQuadricDecimation(0.9, false, max_partition_triangles);
+    (void)simplified;
+
+    for (auto _ : state) {
+        simplified = mesh.SimplifyQuadricDecimation(0.9, false,
+                                                    max_partition_triangles);
+    }
+}
+
+void LegacySimplifyQuadricDecimation(benchmark::State& state) {
+    const auto mesh = open3d::geometry::TriangleMesh::CreateSphere(1.0, 500);
+    const int target = int(mesh->triangles_.size() / 10);
+
+    // Warm up.
+    auto simplified = mesh->SimplifyQuadricDecimation(
+            target, std::numeric_limits<double>::infinity(), 1.0);
+    (void)simplified;
+
+    for (auto _ : state) {
+        simplified = mesh->SimplifyQuadricDecimation(
+                target, std::numeric_limits<double>::infinity(), 1.0);
+    }
+}
+
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation, Partitions, 65536)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation,
+                  Single partition,
+                  std::numeric_limits<int>::max())
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(LegacySimplifyQuadricDecimation)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
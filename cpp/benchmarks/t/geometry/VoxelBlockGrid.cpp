@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const int kWidth = 320;
+static const int kHeight = 240;
+// Distance between the camera positions of the integrated frames.
+static const double kStep = 0.5;
+
+static core::Tensor CreateIntrinsic() {
+    return core::Tensor::Init<double>(
+            {{200, 0, kWidth / 2.0}, {0, 200, kHeight / 2.0}, {0, 0, 1}});
+}
+
+// Camera at (x, 0, 0) looking along +z.
+static core::Tensor CreateExtrinsic(double x) {
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device());
+    extrinsic[0][3] = -x;
+    return extrinsic;
+}
+
+// A wavy wall at about 1.5m seen from (x, 0, 0).
+static Image CreateDepth(double x, const core::Device& device) {
+    std::vector<float> depth(kWidth * kHeight);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            const double x_w = (u - kWidth / 2.0) / 200.0 * 1.5 + x;
+            depth[v * kWidth + u] = float(
+                    1.5 + 0.1 * std::sin(5 * x_w) * std::cos(0.05 * v));
+        }
+    }
+    return Image(core::Tensor(depth, {kHeight, kWidth, 1}, core::Float32,
+                              device));
+}
+
+// Renders the first frame of a map integrated from the frames of a camera
+// moving along the wall. The blocks outside of the frustum of the first frame
+// only grow the map.
+void RayCast(benchmark::State& state, const core::Device& device) {
+    const int num_frames = state.range(0);
+    const core::Tensor intrinsic = CreateIntrinsic();
+
+    VoxelBlockGrid vbg({"tsdf", "weight"}, {core::Float32, core::Float32},
+                       {{1}, {1}}, 0.01, 8, 10000, device);
+    core::Tensor frustum_block_coords;
+    for (int i = 0; i < num_frames; ++i) {
+        const Image depth = CreateDepth(i * kStep, device);
+        const core::Tensor extrinsic = CreateExtrinsic(i * kStep);
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, 1.0f, 3.0f);
+        vbg.Integrate(block_coords, depth, intrinsic, extrinsic, 1.0f, 3.0f);
+        if (i == 0) {
+            frustum_block_coords = block_coords;
+        }
+    }
+    state.counters["blocks"] = double(vbg.GetHashMap().Size());
+
+    const core::Tensor extrinsic = CreateExtrinsic(0);
+    // Warm up.
+    vbg.RayCast(frustum_block_coords, intrinsic, extrinsic, kWidth, kHeight,
+                {"depth", "normal"}, 1.0f, 0.1f, 3.0f, 1.0f);
+
+    for (auto _ : state) {
+        vbg.RayCast(frustum_block_coords, intrinsic, extrinsic, kWidth,
+                    kHeight, {"depth", "normal"}, 1.0f, 0.1f, 3.0f, 1.0f);
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK_CAPTURE(RayCast, CPU, core::Device("CPU:0"))
+        ->Arg(1)
+        ->Arg(16)
+        ->Arg(128)
+        ->Arg(512)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RayCast, CUDA, core::Device("CUDA:0"))
+        ->Arg(1)
+        ->Arg(16)
+        ->Arg(128)
+        ->Arg(512)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -116,17 +116,27 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius, bool sort) const {
+    return SearchRadius(query_points, radius, sort, 0);
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
+        const Tensor &query_points,
+        double radius,
+        bool sort,
+        int max_neighbors) const {
     const int64_t num_query_points = query_points.GetShape()[0];
     Tensor queries_row_splits(std::vector<int64_t>({0, num_query_points}), {2},
                               Int64);
-    return SearchRadius(query_points, queries_row_splits, radius, sort);
+    return SearchRadius(query_points, queries_row_splits, radius, sort,
+                        max_neighbors);
 }
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points,
         const Tensor &queries_row_splits,
         double radius,
-        bool sort) const {
+        bool sort,
+        int max_neighbors) const {
     const Dtype dtype = GetDtype();
     const Dtype index_dtype = GetIndexDtype();
     const Device device = GetDevice();
@@ -152,6 +162,15 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         utility::LogError("radius should be positive.");
     }
 
+    // The CUDA search has no neighbor cap, but the hybrid search returns the
+    // nearest neighbors within the radius.
+    if (max_neighbors > 0 && device.IsCUDA()) {
+        Tensor indices, distances, counts;
+        std::tie(indices, distances, counts) = SearchHybrid(
+                query_points, queries_row_splits, radius, max_neighbors);
+        return HybridToRadiusSearchResult(indices, distances, counts);
+    }
+
     Tensor query_points_ = query_points.Contiguous();
     Tensor queries_row_splits_ = queries_row_splits.Contiguous();
 
@@ -176,7 +195,8 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 #endif
     } else {
         DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
-            FixedRadiusSearchCPU<scalar_t, int_t>(RADIUS_PARAMETERS);
+            FixedRadiusSearchCPU<scalar_t, int_t>(RADIUS_PARAMETERS,
+                                                  max_neighbors);
         });
     }
 
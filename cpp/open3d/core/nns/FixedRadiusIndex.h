@@ -114,6 +114,10 @@ void BuildSpatialHashTableCPU(const Tensor& points,
 /// \param neighbors_distance   The output tensor that saves the resulting
 ///        neighbor distances.
 ///
+/// \param max_neighbors    If positive, only the \p max_neighbors nearest
+///        neighbors of each query are returned, sorted in ascending order of
+///        distance. Use a value <= 0 to return all neighbors.
+///
 template <class T, class TIndex>
 void FixedRadiusSearchCPU(const Tensor& points,
                           const Tensor& queries,
@@ -129,7 +133,8 @@ void FixedRadiusSearchCPU(const Tensor& points,
                           const bool sort,
                           Tensor& neighbors_index,
                           Tensor& neighbors_row_splits,
-                          Tensor& neighbors_distance);
+                          Tensor& neighbors_distance,
+                          const int max_neighbors = 0);
 
 /// Hybrid search. This function computes a list of neighbor indices
 /// for each query point. The lists are stored linearly and if there is less
@@ -430,11 +435,21 @@ public:
             const Tensor& query_points,
             double radius,
             bool sort = true) const override;
+
+    /// Perform radius search that returns at most \p max_neighbors neighbors
+    /// per query. If \p max_neighbors is positive, the nearest neighbors
+    /// within the radius are returned, sorted by distance. Otherwise all
+    /// neighbors are returned.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor& query_points,
+                                                    double radius,
+                                                    bool sort,
+                                                    int max_neighbors) const;
     std::tuple<Tensor, Tensor, Tensor> SearchRadius(
             const Tensor& query_points,
             const Tensor& queries_row_splits,
             double radius,
-            bool sort = true) const;
+            bool sort = true,
+            int max_neighbors = 0) const;
 
     std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor& query_points,
                                                     double radius,
@@ -7,9 +7,13 @@
 
 #pragma once
 
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
 
-#include <set>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
@@ -170,6 +174,198 @@ Eigen::Array<typename TDerived::Scalar, VECSIZE, 1> NeighborsDist(
     return dist;
 }
 
+/// Computes the hash table cells that have to be visited to find all
+/// neighbors of \p pos. The cells are written to \p bins in ascending order
+/// without duplicates.
+///
+/// \return The number of cells written to \p bins.
+template <class T>
+int ComputeBinsToVisit(const utility::MiniVec<T, 3>& pos,
+                       const T radius,
+                       const T inv_voxel_size,
+                       const size_t hash_table_size,
+                       const size_t first_cell_idx,
+                       size_t bins[9]) {
+    typedef utility::MiniVec<T, 3> Vec3_t;
+
+    int num_bins = 0;
+    bins[num_bins++] =
+            first_cell_idx +
+            SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                    hash_table_size;
+    for (int dz = -1; dz <= 1; dz += 2)
+        for (int dy = -1; dy <= 1; dy += 2)
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3_t p = pos + radius * Vec3_t(T(dx), T(dy), T(dz));
+                bins[num_bins++] =
+                        first_cell_idx +
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                                hash_table_size;
+            }
+
+    // Sorting a fixed size array is much cheaper than maintaining a std::set
+    // for every query and gives the same visiting order.
+    std::sort(bins, bins + num_bins);
+    return int(std::unique(bins, bins + num_bins) - bins);
+}
+
+/// Calls \p fn(idx, dist) for all points in the cells \p bins that are within
+/// \p threshold of \p pos. The distances are computed VECSIZE points at a
+/// time. \p fn may lower \p threshold to skip the points that are farther.
+template <int METRIC, bool IGNORE_QUERY_POINT, int VECSIZE, class T, class FN>
+void ForEachNeighbor(const utility::MiniVec<T, 3>& pos,
+                     const T* const points,
+                     const T& threshold,
+                     const size_t* const bins,
+                     const int num_bins,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     FN fn) {
+    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
+    typedef Eigen::Array<int64_t, VECSIZE, 1> Veci_t;
+    typedef Eigen::Array<T, 3, 1> Pos_t;
+    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
+
+    const Pos_t pos_arr(pos[0], pos[1], pos[2]);
+    Poslist_t xyz;
+    Veci_t idx_vec;
+    int vec_i = 0;
+
+    // Tests the gathered points and passes the neighbors to fn.
+    auto flush = [&]() {
+        Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(pos_arr, xyz);
+        for (int k = 0; k < vec_i; ++k) {
+            // fn may have lowered the threshold.
+            if (dist(k) <= threshold) {
+                fn(idx_vec(k), dist(k));
+            }
+        }
+        vec_i = 0;
+    };
+
+    for (int b = 0; b < num_bins; ++b) {
+        const size_t begin_idx = hash_table_cell_splits[bins[b]];
+        const size_t end_idx = hash_table_cell_splits[bins[b] + 1];
+
+        for (size_t j = begin_idx; j < end_idx; ++j) {
+            const int64_t idx = hash_table_index[j];
+            if (IGNORE_QUERY_POINT) {
+                if (points[idx * 3 + 0] == pos[0] &&
+                    points[idx * 3 + 1] == pos[1] &&
+                    points[idx * 3 + 2] == pos[2])
+                    continue;
+            }
+            xyz(vec_i, 0) = points[idx * 3 + 0];
+            xyz(vec_i, 1) = points[idx * 3 + 1];
+            xyz(vec_i, 2) = points[idx * 3 + 2];
+            idx_vec(vec_i) = idx;
+            ++vec_i;
+            if (VECSIZE == vec_i) {
+                flush();
+            }
+        }
+    }
+    // process the tail
+    if (vec_i) {
+        flush();
+    }
+}
+
+/// Keeps the \p k nearest of the neighbors passed to Add() in a max-heap,
+/// such that a query never stores more than \p k neighbors. Ties in the
+/// distance are broken by the index.
+template <class T>
+class NearestNeighborHeap {
+public:
+    /// Empties the heap. Add() must only be called for neighbors within
+    /// \p threshold.
+    void Reset(int k, T threshold) {
+        k_ = k;
+        heap_.clear();
+        threshold_ = threshold;
+    }
+
+    void Add(int64_t idx, T dist) {
+        const std::pair<T, int64_t> neighbor(dist, idx);
+        if (int(heap_.size()) < k_) {
+            // The heap is only built once it is full.
+            heap_.push_back(neighbor);
+            if (int(heap_.size()) == k_) {
+                std::make_heap(heap_.begin(), heap_.end());
+                threshold_ = heap_.front().first;
+            }
+            return;
+        }
+        if (!(neighbor < heap_.front())) {
+            return;
+        }
+        // Replace the farthest neighbor and sift it down.
+        size_t i = 0;
+        for (size_t child = 1; child < heap_.size(); child = 2 * i + 1) {
+            if (child + 1 < heap_.size() && heap_[child] < heap_[child + 1]) {
+                ++child;
+            }
+            if (!(neighbor < heap_[child])) {
+                break;
+            }
+            heap_[i] = heap_[child];
+            i = child;
+        }
+        heap_[i] = neighbor;
+        threshold_ = heap_.front().first;
+    }
+
+    /// Distance of the farthest neighbor if the heap is full, the threshold
+    /// passed to Reset() otherwise. Farther points cannot be among the \p k
+    /// nearest.
+    const T& Threshold() const { return threshold_; }
+
+    /// Sorts the neighbors by distance. Invalidates the heap.
+    const std::vector<std::pair<T, int64_t>>& Sort() {
+        std::sort(heap_.begin(), heap_.end());
+        return heap_;
+    }
+
+private:
+    int k_ = 0;
+    std::vector<std::pair<T, int64_t>> heap_;
+    T threshold_ = std::numeric_limits<T>::infinity();
+};
+
+/// A contiguous range of queries of one batch item. This is the unit of work
+/// of the single pass search.
+struct QueryChunk {
+    size_t begin;
+    size_t end;
+    size_t hash_table_size;
+    size_t first_cell_idx;
+    /// Offset of the first result of the chunk in the thread local buffer.
+    size_t buffer_offset;
+};
+
+/// Splits the queries of all batch items into chunks of at most
+/// \p chunk_size queries.
+inline std::vector<QueryChunk> MakeQueryChunks(
+        const int batch_size,
+        const int64_t* const queries_row_splits,
+        const uint32_t* const hash_table_splits,
+        const size_t chunk_size) {
+    std::vector<QueryChunk> chunks;
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        for (int64_t begin = queries_row_splits[i];
+             begin < queries_row_splits[i + 1]; begin += chunk_size) {
+            const size_t end = std::min<int64_t>(begin + chunk_size,
+                                                 queries_row_splits[i + 1]);
+            chunks.push_back(
+                    {size_t(begin), end, hash_table_size, first_cell_idx, 0});
+        }
+    }
+    return chunks;
+}
+
 /// Implementation of FixedRadiusSearchCPU with template params for metrics
 /// and boolean options.
 template <class T,
@@ -192,18 +388,14 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                            const size_t hash_table_cell_splits_size,
                            const uint32_t* const hash_table_cell_splits,
                            const uint32_t* const hash_table_index,
-                           OUTPUT_ALLOCATOR& output_allocator) {
+                           OUTPUT_ALLOCATOR& output_allocator,
+                           const int max_neighbors,
+                           const bool single_pass) {
     using namespace open3d::utility;
 
 // number of elements for vectorization
 #define VECSIZE 8
     typedef MiniVec<T, 3> Vec3_t;
-    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
-    typedef Eigen::Array<TIndex, VECSIZE, 1> Veci_t;
-
-    typedef Eigen::Array<T, 3, 1> Pos_t;
-    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
-    typedef Eigen::Array<bool, VECSIZE, 1> Result_t;
 
     const int batch_size = points_row_splits_size - 1;
 
@@ -226,13 +418,122 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
     const T voxel_size = 2 * radius;
     const T inv_voxel_size = 1 / voxel_size;
 
-    // counts the number of indices we have to return. This is the number of all
-    // neighbors we find.
-    size_t num_indices = 0;
+    // With max_neighbors the nearest neighbors of a query are kept in a
+    // bounded heap.
+    tbb::enumerable_thread_specific<NearestNeighborHeap<T>> heaps;
+
+    // calls fn(idx, dist) for the neighbors of query i
+    auto search_query = [&](size_t i, size_t hash_table_size,
+                            size_t first_cell_idx, auto fn) {
+        Vec3_t pos(queries + i * 3);
+        size_t bins[9];
+        const int num_bins =
+                ComputeBinsToVisit(pos, radius, inv_voxel_size,
+                                   hash_table_size, first_cell_idx, bins);
+        if (max_neighbors <= 0) {
+            ForEachNeighbor<METRIC, IGNORE_QUERY_POINT, VECSIZE>(
+                    pos, points, threshold, bins, num_bins,
+                    hash_table_cell_splits, hash_table_index, fn);
+            return;
+        }
+        // Once the heap is full, points farther than its top are skipped.
+        NearestNeighborHeap<T>& heap = heaps.local();
+        heap.Reset(max_neighbors, threshold);
+        ForEachNeighbor<METRIC, IGNORE_QUERY_POINT, VECSIZE>(
+                pos, points, heap.Threshold(), bins, num_bins,
+                hash_table_cell_splits, hash_table_index,
+                [&](int64_t idx, T dist) { heap.Add(idx, dist); });
+        for (const auto& neighbor : heap.Sort()) {
+            fn(neighbor.second, neighbor.first);
+        }
+    };
+
+    TIndex* indices_ptr;
+    T* distances_ptr;
+
+    if (single_pass) {
+        // Each chunk of queries appends its neighbors to the growable buffer
+        // of the thread that processes it. After the prefix sum over the
+        // neighbor counts the buffers are copied to the output arrays, which
+        // avoids searching every query twice.
+        struct NeighborBuffer {
+            std::vector<TIndex> indices;
+            std::vector<T> distances;
+        };
+        std::vector<QueryChunk> chunks = MakeQueryChunks(
+                batch_size, queries_row_splits, hash_table_splits, 512);
+        // the buffer of each chunk. Elements of enumerable_thread_specific
+        // do not move when other threads add their buffers.
+        tbb::enumerable_thread_specific<NeighborBuffer> buffers;
+        std::vector<const NeighborBuffer*> chunk_buffers(chunks.size());
 
-    // count the number of neighbors for all query points and update num_indices
-    // and populate query_neighbors_row_splits with the number of neighbors
-    // for each query point
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, chunks.size(), 1),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    NeighborBuffer* buffer = &buffers.local();
+                    for (size_t c = r.begin(); c != r.end(); ++c) {
+                        QueryChunk& chunk = chunks[c];
+                        chunk_buffers[c] = buffer;
+                        chunk.buffer_offset = buffer->indices.size();
+                        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+                            size_t neighbors_count = 0;
+                            search_query(
+                                    i, chunk.hash_table_size,
+                                    chunk.first_cell_idx,
+                                    [&](int64_t idx, T dist) {
+                                        buffer->indices.push_back(TIndex(idx));
+                                        if (RETURN_DISTANCES) {
+                                            buffer->distances.push_back(dist);
+                                        }
+                                        ++neighbors_count;
+                                    });
+                            // note the +1
+                            query_neighbors_row_splits[i + 1] =
+                                    neighbors_count;
+                        }
+                    }
+                });
+
+        query_neighbors_row_splits[0] = 0;
+        InclusivePrefixSum(query_neighbors_row_splits + 1,
+                           query_neighbors_row_splits + num_queries + 1,
+                           query_neighbors_row_splits + 1);
+        const size_t num_indices = query_neighbors_row_splits[num_queries];
+
+        output_allocator.AllocIndices(&indices_ptr, num_indices);
+        if (RETURN_DISTANCES)
+            output_allocator.AllocDistances(&distances_ptr, num_indices);
+        else
+            output_allocator.AllocDistances(&distances_ptr, 0);
+
+        // merge the thread local buffers
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, chunks.size()),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    for (size_t c = r.begin(); c != r.end(); ++c) {
+                        const QueryChunk& chunk = chunks[c];
+                        const NeighborBuffer& buffer = *chunk_buffers[c];
+                        const size_t out_offset =
+                                query_neighbors_row_splits[chunk.begin];
+                        const size_t count =
+                                query_neighbors_row_splits[chunk.end] -
+                                out_offset;
+                        std::copy_n(buffer.indices.begin() +
+                                            chunk.buffer_offset,
+                                    count, indices_ptr + out_offset);
+                        if (RETURN_DISTANCES) {
+                            std::copy_n(buffer.distances.begin() +
+                                                chunk.buffer_offset,
+                                        count, distances_ptr + out_offset);
+                        }
+                    }
+                });
+        return;
+    }
+
+    // count the number of neighbors for all query points and populate
+    // query_neighbors_row_splits with the number of neighbors for each query
+    // point
     for (int i = 0; i < batch_size; ++i) {
         const size_t hash_table_size =
                 hash_table_splits[i + 1] - hash_table_splits[i];
@@ -241,102 +542,34 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                 tbb::blocked_range<size_t>(queries_row_splits[i],
                                            queries_row_splits[i + 1]),
                 [&](const tbb::blocked_range<size_t>& r) {
-                    size_t num_indices_local = 0;
                     for (size_t i = r.begin(); i != r.end(); ++i) {
                         size_t neighbors_count = 0;
-
-                        Vec3_t pos(queries + i * 3);
-
-                        std::set<size_t> bins_to_visit;
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                uint32_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    neighbors_count += test_result.count();
-                                    vec_i = 0;
-                                }
-                            }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
-                        }
-                        num_indices_local += neighbors_count;
+                        search_query(i, hash_table_size, first_cell_idx,
+                                     [&](int64_t, T) { ++neighbors_count; });
                         // note the +1
                         query_neighbors_row_splits[i + 1] = neighbors_count;
                     }
-
-                    core::AtomicFetchAddRelaxed((uint64_t*)&num_indices,
-                                                num_indices_local);
                 });
     }
 
+    query_neighbors_row_splits[0] = 0;
+    InclusivePrefixSum(query_neighbors_row_splits + 1,
+                       query_neighbors_row_splits + num_queries + 1,
+                       query_neighbors_row_splits + 1);
+    // counts the number of indices we have to return. This is the number of
+    // all neighbors we find.
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+
     // Allocate output arrays
     // output for the indices to the neighbors
-    TIndex* indices_ptr;
     output_allocator.AllocIndices(&indices_ptr, num_indices);
 
     // output for the distances
-    T* distances_ptr;
     if (RETURN_DISTANCES)
         output_allocator.AllocDistances(&distances_ptr, num_indices);
     else
         output_allocator.AllocDistances(&distances_ptr, 0);
 
-    query_neighbors_row_splits[0] = 0;
-    InclusivePrefixSum(query_neighbors_row_splits + 1,
-                       query_neighbors_row_splits + num_queries + 1,
-                       query_neighbors_row_splits + 1);
-
     // now populate the indices_ptr and distances_ptr array
     for (int i = 0; i < batch_size; ++i) {
         const size_t hash_table_size =
@@ -348,102 +581,107 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                 [&](const tbb::blocked_range<size_t>& r) {
                     for (size_t i = r.begin(); i != r.end(); ++i) {
                         size_t neighbors_count = 0;
+                        const size_t indices_offset =
+                                query_neighbors_row_splits[i];
+                        search_query(
+                                i, hash_table_size, first_cell_idx,
+                                [&](int64_t idx, T dist) {
+                                    indices_ptr[indices_offset +
+                                                neighbors_count] = TIndex(idx);
+                                    if (RETURN_DISTANCES) {
+                                        distances_ptr[indices_offset +
+                                                      neighbors_count] = dist;
+                                    }
+                                    ++neighbors_count;
+                                });
+                    }
+                });
+    }
+#undef VECSIZE
+}
 
-                        size_t indices_offset = query_neighbors_row_splits[i];
+/// Implementation of HybridSearchCPU with template params for metrics.
+template <class T, class TIndex, class OUTPUT_ALLOCATOR, int METRIC>
+void _HybridSearchCPU(size_t num_points,
+                      const T* const points,
+                      size_t num_queries,
+                      const T* const queries,
+                      const T radius,
+                      const int max_knn,
+                      const size_t points_row_splits_size,
+                      const int64_t* const points_row_splits,
+                      const size_t queries_row_splits_size,
+                      const int64_t* const queries_row_splits,
+                      const uint32_t* const hash_table_splits,
+                      const size_t hash_table_cell_splits_size,
+                      const uint32_t* const hash_table_cell_splits,
+                      const uint32_t* const hash_table_index,
+                      OUTPUT_ALLOCATOR& output_allocator) {
+    using namespace open3d::utility;
+    typedef MiniVec<T, 3> Vec3_t;
 
-                        Vec3_t pos(queries[i * 3 + 0], queries[i * 3 + 1],
-                                   queries[i * 3 + 2]);
+    // return empty output arrays if there are no points
+    if (num_points == 0 || num_queries == 0) {
+        TIndex* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
 
-                        std::set<size_t> bins_to_visit;
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
 
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
+        TIndex* counts_ptr;
+        output_allocator.AllocCounts(&counts_ptr, 0, 0);
+        return;
+    }
 
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        Veci_t idx_vec;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                int64_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                idx_vec(vec_i) = idx;
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    for (int k = 0; k < vec_i; ++k) {
-                                        if (test_result(k)) {
-                                            indices_ptr[indices_offset +
-                                                        neighbors_count] =
-                                                    idx_vec[k];
-                                            if (RETURN_DISTANCES) {
-                                                distances_ptr[indices_offset +
-                                                              neighbors_count] =
-                                                        dist[k];
-                                            }
-                                        }
-                                        neighbors_count += int(test_result(k));
-                                    }
-                                    vec_i = 0;
-                                }
-                            }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                if (test_result(k)) {
-                                    indices_ptr[indices_offset +
-                                                neighbors_count] = idx_vec[k];
-                                    if (RETURN_DISTANCES) {
-                                        distances_ptr[indices_offset +
-                                                      neighbors_count] =
-                                                dist[k];
-                                    }
-                                }
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
+    const int batch_size = points_row_splits_size - 1;
+    const T threshold = (METRIC == L2 ? radius * radius : radius);
+    const T inv_voxel_size = 1 / (2 * radius);
+
+    // The output has a fixed size of max_knn neighbors per query, so the
+    // neighbors can be written directly without a counting pass.
+    const size_t num_indices = num_queries * max_knn;
+    TIndex* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+    TIndex* counts_ptr;
+    output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(queries_row_splits[i],
+                                           queries_row_splits[i + 1]),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    // the max_knn nearest neighbors, reused for all queries
+                    NearestNeighborHeap<T> heap;
+                    for (size_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3_t pos(queries + i * 3);
+                        size_t bins[9];
+                        const int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins);
+                        heap.Reset(max_knn, threshold);
+                        ForEachNeighbor<METRIC, false, 8>(
+                                pos, points, heap.Threshold(), bins, num_bins,
+                                hash_table_cell_splits, hash_table_index,
+                                [&](int64_t idx, T dist) {
+                                    heap.Add(idx, dist);
+                                });
+
+                        const auto& neighbors = heap.Sort();
+                        for (size_t k = 0; k < neighbors.size(); ++k) {
+                            indices_ptr[i * max_knn + k] =
+                                    TIndex(neighbors[k].second);
+                            distances_ptr[i * max_knn + k] =
+                                    neighbors[k].first;
                         }
+                        counts_ptr[i] = TIndex(neighbors.size());
                     }
                 });
     }
-#undef VECSIZE
 }
 
 }  // namespace
@@ -526,6 +764,20 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param max_neighbors    If positive, only the \p max_neighbors nearest
+///         neighbors within the radius are returned for each query, sorted in
+///         ascending order of distance. Ties are broken by the point index.
+///         Use a value <= 0 to return all neighbors in the order of the hash
+///         table cells.
+///
+/// \param single_pass    If true, the neighbors are searched only once and
+///         collected in thread local buffers which are merged after the
+///         prefix sum over the neighbor counts. This is faster for dense
+///         point clouds but temporarily requires memory for a second copy of
+///         the output. If false, a counting pass is run before the output
+///         arrays are allocated and filled in a second pass. Both modes
+///         return the same result.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const size_t num_points,
@@ -544,7 +796,9 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const Metric metric,
                           const bool ignore_query_point,
                           const bool return_distances,
-                          OUTPUT_ALLOCATOR& output_allocator) {
+                          OUTPUT_ALLOCATOR& output_allocator,
+                          const int max_neighbors = 0,
+                          const bool single_pass = true) {
     // Dispatch all template parameter combinations
 
 #define FN_PARAMETERS                                                       \
@@ -552,7 +806,7 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
             radius, points_row_splits_size, points_row_splits,              \
             queries_row_splits_size, queries_row_splits, hash_table_splits, \
             hash_table_cell_splits_size, hash_table_cell_splits,            \
-            hash_table_index, output_allocator
+            hash_table_index, output_allocator, max_neighbors, single_pass
 
 #define CALL_TEMPLATE(METRIC, IGNORE_QUERY_POINT, RETURN_DISTANCES)     \
     if (METRIC == metric && IGNORE_QUERY_POINT == ignore_query_point && \
@@ -580,6 +834,55 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef FN_PARAMETERS
 }
 
+/// Hybrid search. This function computes the \p max_knn nearest neighbors
+/// within \p radius for each query point. The output arrays have a fixed size
+/// of \p num_queries * \p max_knn. The neighbors of each query are sorted by
+/// distance and unused entries are padded with index -1 and distance 0.
+///
+/// The parameters are the same as for FixedRadiusSearchCPU. In addition the
+/// \p output_allocator must implement AllocIndices(TIndex** ptr, size_t size,
+/// TIndex value), AllocDistances(T** ptr, size_t size, T value) and
+/// AllocCounts(TIndex** ptr, size_t size, TIndex value) which allocate arrays
+/// filled with \p value.
+///
+/// \param max_knn    The maximum number of neighbors per query.
+///
+template <class T, class TIndex, class OUTPUT_ALLOCATOR>
+void HybridSearchCPU(const size_t num_points,
+                     const T* const points,
+                     const size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     const size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const Metric metric,
+                     OUTPUT_ALLOCATOR& output_allocator) {
+#define FN_PARAMETERS                                                        \
+    num_points, points, num_queries, queries, radius, max_knn,               \
+            points_row_splits_size, points_row_splits,                       \
+            queries_row_splits_size, queries_row_splits, hash_table_splits,  \
+            hash_table_cell_splits_size, hash_table_cell_splits,             \
+            hash_table_index, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                              \
+    if (METRIC == metric)                                                  \
+        _HybridSearchCPU<T, TIndex, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS);
+
+    CALL_TEMPLATE(L1)
+    CALL_TEMPLATE(L2)
+    CALL_TEMPLATE(Linf)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -49,7 +49,8 @@ void FixedRadiusSearchCPU(const Tensor& points,
                           const bool sort,
                           Tensor& neighbors_index,
                           Tensor& neighbors_row_splits,
-                          Tensor& neighbors_distance) {
+                          Tensor& neighbors_distance,
+                          const int max_neighbors) {
     Device device = points.GetDevice();
     NeighborSearchAllocator<T, TIndex> output_allocator(device);
 
@@ -64,7 +65,7 @@ void FixedRadiusSearchCPU(const Tensor& points,
             hash_table_cell_splits.GetShape()[0],
             hash_table_cell_splits.GetDataPtr<uint32_t>(),
             hash_table_index.GetDataPtr<uint32_t>(), metric, ignore_query_point,
-            return_distances, output_allocator);
+            return_distances, output_allocator, max_neighbors);
 
     neighbors_index = output_allocator.NeighborsIndex();
     neighbors_distance = output_allocator.NeighborsDistance();
@@ -84,7 +85,24 @@ void HybridSearchCPU(const Tensor& points,
                      Tensor& neighbors_index,
                      Tensor& neighbors_count,
                      Tensor& neighbors_distance) {
-    utility::LogError("Not implemented.");
+    Device device = points.GetDevice();
+    NeighborSearchAllocator<T, TIndex> output_allocator(device);
+
+    impl::HybridSearchCPU<T, TIndex>(
+            points.GetShape()[0], points.GetDataPtr<T>(), queries.GetShape()[0],
+            queries.GetDataPtr<T>(), T(radius), max_knn,
+            points_row_splits.GetShape()[0],
+            points_row_splits.GetDataPtr<int64_t>(),
+            queries_row_splits.GetShape()[0],
+            queries_row_splits.GetDataPtr<int64_t>(),
+            hash_table_splits.GetDataPtr<uint32_t>(),
+            hash_table_cell_splits.GetShape()[0],
+            hash_table_cell_splits.GetDataPtr<uint32_t>(),
+            hash_table_index.GetDataPtr<uint32_t>(), metric, output_allocator);
+
+    neighbors_index = output_allocator.NeighborsIndex();
+    neighbors_distance = output_allocator.NeighborsDistance();
+    neighbors_count = output_allocator.NeighborsCount();
 }
 
 #define INSTANTIATE_BUILD(T)                                                  \
@@ -101,7 +119,8 @@ void HybridSearchCPU(const Tensor& points,
             const Tensor& hash_table_cell_splits, const Metric metric,         \
             const bool ignore_query_point, const bool return_distances,        \
             const bool sort, Tensor& neighbors_index,                          \
-            Tensor& neighbors_row_splits, Tensor& neighbors_distance);
+            Tensor& neighbors_row_splits, Tensor& neighbors_distance,          \
+            const int max_neighbors);
 
 #define INSTANTIATE_HYBRID(T, TIndex)                                          \
     template void HybridSearchCPU<T, TIndex>(                                  \
@@ -27,6 +27,26 @@ Device NNSIndex::GetDevice() const { return dataset_points_.GetDevice(); }
 
 Dtype NNSIndex::GetIndexDtype() const { return index_dtype_; }
 
+std::tuple<Tensor, Tensor, Tensor> HybridToRadiusSearchResult(
+        const Tensor &indices, const Tensor &distances, const Tensor &counts) {
+    const Tensor counts_host = counts.To(Device("CPU:0"), Int64).Contiguous();
+    const int64_t num_queries = counts_host.GetLength();
+    Tensor row_splits({num_queries + 1}, Int64);
+    const int64_t *counts_ptr = counts_host.GetDataPtr<int64_t>();
+    int64_t *row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    row_splits_ptr[0] = 0;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        row_splits_ptr[i + 1] = row_splits_ptr[i] + counts_ptr[i];
+    }
+
+    // The padding is at the end of each row, so the valid entries in row
+    // major order are the neighbors of all queries in compressed form.
+    const Tensor valid = indices.Ne(-1);
+    return std::make_tuple(
+            indices.IndexGet({valid}), distances.IndexGet({valid}),
+            row_splits.To(indices.GetDevice(), indices.GetDtype()));
+}
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
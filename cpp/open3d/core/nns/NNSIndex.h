@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <tuple>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
@@ -120,6 +121,18 @@ protected:
     Tensor dataset_points_;
     Dtype index_dtype_;
 };
+
+/// Converts the padded result of NNSIndex::SearchHybrid() to the format of
+/// NNSIndex::SearchRadius(). This returns the \p max_knn nearest neighbors
+/// within the radius of each query as a radius search result.
+///
+/// \param indices Tensor of shape {n, max_knn} padded with -1.
+/// \param distances Tensor of shape {n, max_knn}.
+/// \param counts Tensor of shape {n} with the number of neighbors per query.
+/// \return Tuple of Tensors, (indices, distances, neighbors_row_splits), with
+/// the neighbors of each query sorted by distance.
+std::tuple<Tensor, Tensor, Tensor> HybridToRadiusSearchResult(
+        const Tensor &indices, const Tensor &distances, const Tensor &counts);
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
\ No newline at end of file
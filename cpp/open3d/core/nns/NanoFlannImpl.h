@@ -118,14 +118,44 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
         return;
     }
 
-    std::vector<std::vector<TIndex>> neighbors_indices(num_queries);
-    std::vector<std::vector<T>> neighbors_distances(num_queries);
-    std::vector<uint32_t> neighbors_count(num_queries, 0);
-
     // cast NanoFlannIndexHolder
     auto holder_ =
             static_cast<NanoFlannIndexHolder<METRIC, T, TIndex> *>(holder);
 
+    // Every query has exactly knn neighbors if no point is ignored, so the
+    // results are written directly to the output without per query buffers.
+    if (!ignore_query_point && static_cast<size_t>(knn) <= num_points) {
+        for (size_t i = 0; i <= num_queries; ++i) {
+            query_neighbors_row_splits[i] = static_cast<int64_t>(i) * knn;
+        }
+        const size_t num_indices = num_queries * knn;
+        TIndex *indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, num_indices);
+        T *distances_ptr;
+        if (return_distances)
+            output_allocator.AllocDistances(&distances_ptr, num_indices);
+        else
+            output_allocator.AllocDistances(&distances_ptr, 0);
+
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_queries),
+                [&](const tbb::blocked_range<size_t> &r) {
+                    std::vector<T> result_distances(knn);
+                    for (size_t i = r.begin(); i != r.end(); ++i) {
+                        holder_->index_->knnSearch(
+                                &queries[i * dimension], knn,
+                                &indices_ptr[i * knn],
+                                return_distances ? &distances_ptr[i * knn]
+                                                 : result_distances.data());
+                    }
+                });
+        return;
+    }
+
+    std::vector<std::vector<TIndex>> neighbors_indices(num_queries);
+    std::vector<std::vector<T>> neighbors_distances(num_queries);
+    std::vector<uint32_t> neighbors_count(num_queries, 0);
+
     tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_queries),
             [&](const tbb::blocked_range<size_t> &r) {
@@ -96,18 +96,28 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 }
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
-        const Tensor& query_points, double radius, bool sort) {
+        const Tensor& query_points,
+        double radius,
+        bool sort,
+        int max_neighbors) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.IsCUDA()) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius,
-                                                     sort);
+                                                     sort, max_neighbors);
         } else {
             utility::LogError("Index is not set.");
         }
     } else {
         if (nanoflann_index_) {
+            if (max_neighbors > 0) {
+                Tensor indices, distances, counts;
+                std::tie(indices, distances, counts) =
+                        nanoflann_index_->SearchHybrid(query_points, radius,
+                                                       max_neighbors);
+                return HybridToRadiusSearchResult(indices, distances, counts);
+            }
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError("Index is not set.");
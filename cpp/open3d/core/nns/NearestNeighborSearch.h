@@ -77,6 +77,9 @@ public:
     /// d}.
     /// \param radius Radius.
     /// \param sort Sort the results by distance. Default is True.
+    /// \param max_neighbors If positive, only the \p max_neighbors nearest
+    /// neighbors within the radius are returned for each query, sorted by
+    /// distance. Default is 0, which returns all neighbors.
     /// \return Tuple of Tensors, (indices, distances, num_neighbors):
     /// - indices: Tensor of shape {total_number_of_neighbors,}, with dtype
     /// same as index_dtype_.
@@ -85,7 +88,10 @@ public:
     /// - num_neighbors: Tensor of shape {n+1,}, with dtype Int64. The Tensor is
     /// a prefix sum of the number of neighbors for each query point.
     std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
-            const Tensor &query_points, double radius, bool sort = true);
+            const Tensor &query_points,
+            double radius,
+            bool sort = true,
+            int max_neighbors = 0);
 
     /// Perform multi-radius search. Each query point has an independent radius.
     ///
@@ -13,15 +13,90 @@
 #include "open3d/geometry/KDTreeFlann.h"
 
 #include <nanoflann.hpp>
+#include <numeric>
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Number of queries processed as one unit of work by the batched searches.
+constexpr int kBatchSearchBlockSize = 256;
+
+/// Per-thread buffers reused across all queries handled by one thread.
+struct BatchSearchScratch {
+    std::vector<Eigen::Index> indices;
+    std::vector<double> distance2;
+    std::vector<nanoflann::ResultItem<Eigen::Index, double>> results;
+};
+
+/// Resets the CSR outputs to an empty result for \p num_queries queries.
+void ResetCSR(Eigen::Index num_queries,
+              std::vector<size_t> &offsets,
+              std::vector<int> &indices,
+              std::vector<double> &distance2) {
+    offsets.assign(num_queries + 1, 0);
+    indices.clear();
+    distance2.clear();
+}
+
+/// Runs \p search_fn on all queries in parallel and gathers the results in
+/// CSR layout. search_fn(i, scratch, block_indices, block_distance2) appends
+/// the neighbors of query i to the buffers of its block and returns the
+/// number of appended neighbors.
+template <typename SearchFn>
+void BatchSearchCSR(int num_queries,
+                    const SearchFn &search_fn,
+                    std::vector<size_t> &offsets,
+                    std::vector<int> &indices,
+                    std::vector<double> &distance2) {
+    const int num_blocks =
+            (num_queries + kBatchSearchBlockSize - 1) / kBatchSearchBlockSize;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_distance2(num_blocks);
+    offsets.assign(num_queries + 1, 0);
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        BatchSearchScratch scratch;
+#pragma omp for schedule(dynamic)
+        for (int b = 0; b < num_blocks; ++b) {
+            const int begin = b * kBatchSearchBlockSize;
+            const int end =
+                    std::min(begin + kBatchSearchBlockSize, num_queries);
+            for (int i = begin; i < end; ++i) {
+                offsets[i + 1] = search_fn(i, scratch, block_indices[b],
+                                           block_distance2[b]);
+            }
+        }
+    }
+
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    indices.resize(offsets.back());
+    distance2.resize(offsets.back());
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int b = 0; b < num_blocks; ++b) {
+        const size_t start = offsets[b * kBatchSearchBlockSize];
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  indices.begin() + start);
+        std::copy(block_distance2[b].begin(), block_distance2[b].end(),
+                  distance2.begin() + start);
+        // Release the block buffers as soon as they are merged.
+        std::vector<int>().swap(block_indices[b]);
+        std::vector<double>().swap(block_distance2[b]);
+    }
+}
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
@@ -162,6 +237,131 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+bool KDTreeFlann::BatchSearch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                              const KDTreeSearchParam &param,
+                              std::vector<size_t> &offsets,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return BatchSearchKNN(queries,
+                                  ((const KDTreeSearchParamKNN &)param).knn_,
+                                  offsets, indices, distance2);
+        case KDTreeSearchParam::SearchType::Radius:
+            return BatchSearchRadius(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    offsets, indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return BatchSearchHybrid(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, offsets,
+                    indices, distance2);
+        default:
+            ResetCSR(queries.cols(), offsets, indices, distance2);
+            return false;
+    }
+    return false;
+}
+
+bool KDTreeFlann::BatchSearchKNN(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        std::vector<size_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (data_.size() == 0 || queries.rows() != data_.rows() || knn < 0) {
+        ResetCSR(queries.cols(), offsets, indices, distance2);
+        return false;
+    }
+    BatchSearchCSR(
+            int(queries.cols()),
+            [&](int i, BatchSearchScratch &scratch,
+                std::vector<int> &block_indices,
+                std::vector<double> &block_distance2) {
+                scratch.indices.resize(knn);
+                scratch.distance2.resize(knn);
+                size_t k = nanoflann_index_->index_->knnSearch(
+                        queries.col(i).data(), knn, scratch.indices.data(),
+                        scratch.distance2.data());
+                block_indices.insert(block_indices.end(),
+                                     scratch.indices.begin(),
+                                     scratch.indices.begin() + k);
+                block_distance2.insert(block_distance2.end(),
+                                       scratch.distance2.begin(),
+                                       scratch.distance2.begin() + k);
+                return k;
+            },
+            offsets, indices, distance2);
+    return true;
+}
+
+bool KDTreeFlann::BatchSearchRadius(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        std::vector<size_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (data_.size() == 0 || queries.rows() != data_.rows()) {
+        ResetCSR(queries.cols(), offsets, indices, distance2);
+        return false;
+    }
+    BatchSearchCSR(
+            int(queries.cols()),
+            [&](int i, BatchSearchScratch &scratch,
+                std::vector<int> &block_indices,
+                std::vector<double> &block_distance2) {
+                size_t k = nanoflann_index_->index_->radiusSearch(
+                        queries.col(i).data(), radius * radius,
+                        scratch.results, nanoflann::SearchParameters(0.0));
+                for (size_t j = 0; j < k; ++j) {
+                    block_indices.push_back(int(scratch.results[j].first));
+                    block_distance2.push_back(scratch.results[j].second);
+                }
+                return k;
+            },
+            offsets, indices, distance2);
+    return true;
+}
+
+bool KDTreeFlann::BatchSearchHybrid(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<size_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (data_.size() == 0 || queries.rows() != data_.rows() || max_nn < 0) {
+        ResetCSR(queries.cols(), offsets, indices, distance2);
+        return false;
+    }
+    const double radius2 = radius * radius;
+    BatchSearchCSR(
+            int(queries.cols()),
+            [&](int i, BatchSearchScratch &scratch,
+                std::vector<int> &block_indices,
+                std::vector<double> &block_distance2) {
+                scratch.indices.resize(max_nn);
+                scratch.distance2.resize(max_nn);
+                size_t k = nanoflann_index_->index_->knnSearch(
+                        queries.col(i).data(), max_nn, scratch.indices.data(),
+                        scratch.distance2.data());
+                k = std::distance(
+                        scratch.distance2.begin(),
+                        std::lower_bound(scratch.distance2.begin(),
+                                         scratch.distance2.begin() + k,
+                                         radius2));
+                block_indices.insert(block_indices.end(),
+                                     scratch.indices.begin(),
+                                     scratch.indices.begin() + k);
+                block_distance2.insert(block_distance2.end(),
+                                       scratch.distance2.begin(),
+                                       scratch.distance2.begin() + k);
+                return k;
+            },
+            offsets, indices, distance2);
+    return true;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     if (data.size() == 0) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
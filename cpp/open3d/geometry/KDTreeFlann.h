@@ -89,6 +89,48 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Batched search for all columns of \p queries.
+    ///
+    /// The queries are processed in parallel and the results are returned in
+    /// compressed row (CSR) layout: the neighbors of the i-th query are
+    /// indices[offsets[i]:offsets[i + 1]] with squared distances
+    /// distance2[offsets[i]:offsets[i + 1]], sorted by increasing distance.
+    ///
+    /// \param queries Query points stored as columns. The number of rows must
+    /// match the dimension of the data.
+    /// \param param KDTree search parameter.
+    /// \param offsets Output offsets of size queries.cols() + 1.
+    /// \param indices Output neighbor indices of all queries.
+    /// \param distance2 Output squared distances of all queries.
+    /// \return True on success, false on invalid input.
+    bool BatchSearch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<size_t> &offsets,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// \brief Batched KNN search. See BatchSearch() for the output layout.
+    bool BatchSearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        int knn,
+                        std::vector<size_t> &offsets,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2) const;
+
+    /// \brief Batched radius search. See BatchSearch() for the output layout.
+    bool BatchSearchRadius(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           std::vector<size_t> &offsets,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2) const;
+
+    /// \brief Batched hybrid search. See BatchSearch() for the output layout.
+    bool BatchSearchHybrid(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           int max_nn,
+                           std::vector<size_t> &offsets,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -9,7 +9,9 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <map>
 #include <numeric>
+#include <tuple>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -19,6 +21,7 @@
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressBar.h"
+#include "open3d/utility/RadixSort.h"
 #include "open3d/utility/Random.h"
 
 namespace open3d {
@@ -127,18 +130,25 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> dists;
+    if (!kdtree.BatchSearchKNN(
+                Eigen::Map<const Eigen::MatrixXd>(
+                        (const double *)points_.data(), 3, points_.size()),
+                1, offsets, indices, dists)) {
+        return distances;
+    }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
+        if (offsets[i + 1] == offsets[i]) {
             utility::LogDebug(
                     "[ComputePointCloudToPointCloudDistance] Found a point "
                     "without neighbors.");
             distances[i] = 0.0;
         } else {
-            distances[i] = std::sqrt(dists[0]);
+            distances[i] = std::sqrt(dists[offsets[i]]);
         }
     }
     return distances;
@@ -242,113 +252,156 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
     return output;
 }
 
-// helper classes for VoxelDownSample and VoxelDownSampleAndTrace
+// helper functions for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
-class AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
-        }
-        if (cloud.HasCovariances()) {
-            covariance_ += cloud.covariances_[index];
-        }
-        num_of_points_++;
-    }
 
-    Eigen::Vector3d GetAveragePoint() const {
-        return point_ / double(num_of_points_);
+/// Computes the voxel of each point and sorts the points by voxel. Returns
+/// the point indices ordered by voxel in \p point_order and the offsets of the
+/// occupied voxels in \p voxel_offsets, the points of voxel i are
+/// point_order[voxel_offsets[i]:voxel_offsets[i + 1]]. The voxels are sorted
+/// lexicographically by their index and the points of a voxel keep their
+/// original order.
+void SortPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                       const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound,
+                       const Eigen::Vector3d &voxel_min_bound,
+                       double voxel_size,
+                       std::vector<Eigen::Vector3i> &voxel_indices,
+                       std::vector<int> &point_order,
+                       std::vector<int> &voxel_offsets) {
+    const int num_points = int(points.size());
+    voxel_indices.resize(num_points);
+    point_order.resize(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_points; i++) {
+        const Eigen::Vector3d ref_coord =
+                (points[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))),
+                int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+        point_order[i] = i;
+    }
+    if (num_points == 0) {
+        voxel_offsets.assign(1, 0);
+        return;
+    }
+
+    // The voxel index is monotonic in the point coordinates, so the range of
+    // voxel indices follows from the bounds of the points.
+    const Eigen::Vector3d ref_min = (min_bound - voxel_min_bound) / voxel_size;
+    const Eigen::Vector3d ref_max = (max_bound - voxel_min_bound) / voxel_size;
+    Eigen::Vector3i index_min;
+    int bits[3];
+    for (int c = 0; c < 3; c++) {
+        index_min(c) = int(floor(ref_min(c)));
+        const uint64_t extent =
+                uint64_t(int64_t(floor(ref_max(c))) - index_min(c));
+        bits[c] = 0;
+        while (bits[c] < 32 && (uint64_t(1) << bits[c]) <= extent) {
+            bits[c]++;
+        }
     }
 
-    Eigen::Vector3d GetAverageNormal() const {
-        // Call NormalizeNormals() afterwards if necessary
-        return normal_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
-    }
-
-    Eigen::Matrix3d GetAverageCovariance() const {
-        return covariance_ / double(num_of_points_);
-    }
-
-public:
-    int num_of_points_ = 0;
-    Eigen::Vector3d point_ = Eigen::Vector3d::Zero();
-    Eigen::Vector3d normal_ = Eigen::Vector3d::Zero();
-    Eigen::Vector3d color_ = Eigen::Vector3d::Zero();
-    Eigen::Matrix3d covariance_ = Eigen::Matrix3d::Zero();
-};
-
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
+    if (bits[0] + bits[1] + bits[2] <= 64) {
+        std::vector<uint64_t> keys(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3i offset = voxel_indices[i] - index_min;
+            keys[i] = (uint64_t(uint32_t(offset(0))) << (bits[1] + bits[2])) |
+                      (uint64_t(uint32_t(offset(1))) << bits[2]) |
+                      uint64_t(uint32_t(offset(2)));
         }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
+        utility::RadixSort(keys, point_order, bits[0] + bits[1] + bits[2]);
+        voxel_offsets.assign(1, 0);
+        for (int k = 1; k < num_points; k++) {
+            if (keys[k] != keys[k - 1]) {
+                voxel_offsets.push_back(k);
             }
         }
-        if (cloud.HasCovariances()) {
-            covariance_ += cloud.covariances_[index];
+    } else {
+        // The voxel indices do not fit into a single key.
+        auto less = [&voxel_indices](int i0, int i1) {
+            const Eigen::Vector3i &v0 = voxel_indices[i0];
+            const Eigen::Vector3i &v1 = voxel_indices[i1];
+            return std::tie(v0(0), v0(1), v0(2)) <
+                   std::tie(v1(0), v1(1), v1(2));
+        };
+        std::stable_sort(point_order.begin(), point_order.end(), less);
+        voxel_offsets.assign(1, 0);
+        for (int k = 1; k < num_points; k++) {
+            if (voxel_indices[point_order[k]] !=
+                voxel_indices[point_order[k - 1]]) {
+                voxel_offsets.push_back(k);
+            }
         }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
+    }
+    voxel_offsets.push_back(num_points);
+}
+
+/// Averages the points, normals, colors and covariances of \p input with the
+/// indices point_order[begin:end] into entry \p vidx of \p output. The
+/// points are summed in the order of the indices. NaN normals are skipped in
+/// the sum, but counted in the average.
+void AverageVoxel(const PointCloud &input,
+                  const std::vector<int> &point_order,
+                  int begin,
+                  int end,
+                  bool average_colors,
+                  PointCloud &output,
+                  int vidx) {
+    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+    Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+    Eigen::Vector3d color = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (int k = begin; k < end; k++) {
+        const int index = point_order[k];
+        point += input.points_[index];
+        if (input.HasNormals()) {
+            if (!std::isnan(input.normals_[index](0)) &&
+                !std::isnan(input.normals_[index](1)) &&
+                !std::isnan(input.normals_[index](2))) {
+                normal += input.normals_[index];
             }
         }
-        return Eigen::Vector3d(max_class, max_class, max_class);
+        if (input.HasColors() && average_colors) {
+            color += input.colors_[index];
+        }
+        if (input.HasCovariances()) {
+            covariance += input.covariances_[index];
+        }
     }
+    const double num_of_points = double(end - begin);
+    output.points_[vidx] = point / num_of_points;
+    if (input.HasNormals()) {
+        // Call NormalizeNormals() afterwards if necessary
+        output.normals_[vidx] = normal / num_of_points;
+    }
+    if (input.HasColors() && average_colors) {
+        output.colors_[vidx] = color / num_of_points;
+    }
+    if (input.HasCovariances()) {
+        output.covariances_[vidx] = covariance / num_of_points;
+    }
+}
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
+/// Resizes the attributes of \p output to \p num_voxels, as present in
+/// \p input.
+void ResizeVoxelOutput(const PointCloud &input,
+                       size_t num_voxels,
+                       PointCloud &output) {
+    output.points_.resize(num_voxels);
+    if (input.HasNormals()) {
+        output.normals_.resize(num_voxels);
+    }
+    if (input.HasColors()) {
+        output.colors_.resize(num_voxels);
+    }
+    if (input.HasCovariances()) {
+        output.covariances_.resize(num_voxels);
+    }
+}
 
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -359,39 +412,27 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
     }
     Eigen::Vector3d voxel_size3 =
             Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    const Eigen::Vector3d min_bound = GetMinBound();
+    const Eigen::Vector3d max_bound = GetMaxBound();
+    Eigen::Vector3d voxel_min_bound = min_bound - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = max_bound + voxel_size3 * 0.5;
     if (voxel_size * std::numeric_limits<int>::max() <
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<int> point_order;
+    std::vector<int> voxel_offsets;
+    SortPointsByVoxel(points_, min_bound, max_bound, voxel_min_bound,
+                      voxel_size, voxel_indices, point_order, voxel_offsets);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    bool has_covariances = HasCovariances();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
-        }
-        if (has_covariances) {
-            output->covariances_.emplace_back(
-                    accpoint.second.GetAverageCovariance());
-        }
+    const int num_voxels = int(voxel_offsets.size()) - 1;
+    ResizeVoxelOutput(*this, num_voxels, *output);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_voxels; vidx++) {
+        AverageVoxel(*this, point_order, voxel_offsets[vidx],
+                     voxel_offsets[vidx + 1], true, *output, vidx);
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -419,56 +460,57 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    bool has_covariances = HasCovariances();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<int> point_order;
+    std::vector<int> voxel_offsets;
+    SortPointsByVoxel(points_, GetMinBound(), GetMaxBound(), voxel_min_bound,
+                      voxel_size, voxel_indices, point_order, voxel_offsets);
+
+    const int num_voxels = int(voxel_offsets.size()) - 1;
+    const bool class_colors = HasColors() && approximate_class;
+    ResizeVoxelOutput(*this, num_voxels, *output);
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
-            } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    const int cid_temp[3] = {1, 2, 4};
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_voxels; vidx++) {
+        const int begin = voxel_offsets[vidx];
+        const int end = voxel_offsets[vidx + 1];
+        AverageVoxel(*this, point_order, begin, end, !approximate_class,
+                     *output, vidx);
+        // Class counts ordered by class, ties go to the smallest class.
+        std::map<int, int> classes;
+        original_indices[vidx].reserve(end - begin);
+        for (int k = begin; k < end; k++) {
+            const int pid = point_order[k];
+            const Eigen::Vector3d ref_coord =
+                    (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - voxel_indices[pid](c)) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            cubic_id(vidx, cid) = pid;
+            original_indices[vidx].push_back(pid);
+            if (class_colors) {
+                classes[int(colors_[pid][0])]++;
             }
         }
-        if (has_covariances) {
-            output->covariances_.emplace_back(
-                    accpoint.second.GetAverageCovariance());
-        }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        if (class_colors) {
+            int max_class = -1;
+            int max_count = -1;
+            for (const auto &class_count : classes) {
+                if (class_count.second > max_count) {
+                    max_count = class_count.second;
+                    max_class = class_count.first;
+                }
+            }
+            output->colors_[vidx] =
+                    Eigen::Vector3d(max_class, max_class, max_class);
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -668,12 +710,18 @@ std::vector<Eigen::Matrix3d> PointCloud::EstimatePerPointCovariances(
 
     KDTreeFlann kdtree;
     kdtree.SetGeometry(input);
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    kdtree.BatchSearch(Eigen::Map<const Eigen::MatrixXd>(
+                               (const double *)points.data(), 3, points.size()),
+                       search_param, offsets, indices, distance2);
 #pragma omp parallel for schedule(static)
     for (int i = 0; i < (int)points.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(points[i], search_param, indices, distance2) >= 3) {
-            auto covariance = utility::ComputeCovariance(points, indices);
+        const size_t num_neighbors = offsets[i + 1] - offsets[i];
+        if (num_neighbors >= 3) {
+            auto covariance = utility::ComputeCovariance(
+                    points, indices.data() + offsets[i], num_neighbors);
             if (input.HasCovariances() && covariance.isIdentity(1e-4)) {
                 covariances[i] = input.covariances_[i];
             } else {
@@ -723,18 +771,23 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
 
     std::vector<double> nn_dis(points_.size());
     KDTreeFlann kdtree(*this);
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> dists;
+    kdtree.BatchSearchKNN(Eigen::Map<const Eigen::MatrixXd>(
+                                  (const double *)points_.data(), 3,
+                                  points_.size()),
+                          2, offsets, indices, dists);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(2);
-        std::vector<double> dists(2);
-        if (kdtree.SearchKNN(points_[i], 2, indices, dists) <= 1) {
+        if (offsets[i + 1] - offsets[i] <= 1) {
             utility::LogDebug(
                     "[ComputePointCloudNearestNeighborDistance] Found a point "
                     "without neighbors.");
             nn_dis[i] = 0.0;
         } else {
-            nn_dis[i] = std::sqrt(dists[1]);
+            nn_dis[i] = std::sqrt(dists[offsets[i] + 1]);
         }
     }
     return nn_dis;
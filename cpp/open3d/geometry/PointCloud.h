@@ -129,13 +129,18 @@ public:
     /// \brief Downsample input pointcloud with a voxel, and return a new
     /// point-cloud. Normals, covariances and colors are averaged if they exist.
     ///
+    /// The points are sorted by voxel with a parallel radix sort, the output
+    /// points are ordered lexicographically by their voxel index.
+    ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
     std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
 
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
-    /// Also records point cloud index before downsampling.
+    /// Also records point cloud index before downsampling. The output points
+    /// are ordered lexicographically by their voxel index and the original
+    /// indices of each voxel are in increasing order.
     ///
     /// \param voxel_size Voxel size to downsample into.
     /// \param min_bound Minimum coordinate of voxel boundaries
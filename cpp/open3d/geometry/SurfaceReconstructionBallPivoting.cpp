@@ -6,170 +6,107 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <unordered_map>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 namespace {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
+/// Min number of points per spatial cell of the partitioned reconstruction.
+/// Smaller point clouds are reconstructed without partitioning.
+constexpr size_t kMinPointsPerCell = 2000;
 
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+/// Max number of spatial cells. The number of cells only depends on the
+/// point cloud, such that the mesh does not depend on the number of threads.
+constexpr size_t kMaxNumCells = 64;
 
-class BallPivotingVertex {
-public:
-    enum Type { Orphan = 0, Front = 1, Inner = 2 };
-
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
-
-public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
-    Type type_;
-};
-
-class BallPivotingEdge {
-public:
+struct BallPivotingEdge {
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+    BallPivotingEdge(int source, int target)
+        : source_(source), target_(target) {}
 
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
-
-public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
-    Type type_;
+    int source_;
+    int target_;
+    /// Index of the adjacent triangles, -1 if there is none.
+    int triangle0_ = -1;
+    int triangle1_ = -1;
+    Type type_ = Type::Front;
 };
 
-class BallPivotingTriangle {
-public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
-        : vert0_(vert0),
-          vert1_(vert1),
-          vert2_(vert2),
-          ball_center_(ball_center) {}
-
-public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+struct BallPivotingTriangle {
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
-    }
-}
-
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            if (BallPivotingVertexPtr opp = GetOppositeVertex()) {
-                Eigen::Vector3d tr_norm =
-                        (target_->point_ - source_->point_)
-                                .cross(opp->point_ - source_->point_);
-                tr_norm /= tr_norm.norm();
-                Eigen::Vector3d pt_norm =
-                        source_->normal_ + target_->normal_ + opp->normal_;
-                pt_norm /= pt_norm.norm();
-                if (pt_norm.dot(tr_norm) < 0) {
-                    std::swap(target_, source_);
-                }
-            } else {
-                utility::LogError("GetOppositeVertex() returns nullptr.");
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
+/// State shared by all regions of the reconstruction. The edge counts of a
+/// vertex are only modified by the region that owns the vertex.
+class BallPivotingContext {
+public:
+    enum VertexType { Orphan = 0, Front = 1, Inner = 2 };
+
+    BallPivotingContext(const PointCloud& pcd)
+        : points_(pcd.points_),
+          normals_(pcd.normals_),
+          kdtree_(pcd),
+          num_edges_(pcd.points_.size(), 0),
+          num_open_edges_(pcd.points_.size(), 0),
+          cells_(pcd.points_.size(), 0) {}
+
+    /// A vertex without edges is an orphan, a vertex with at least one edge
+    /// that is not inner is a front vertex.
+    VertexType GetVertexType(int vidx) const {
+        if (num_edges_[vidx] == 0) {
+            return VertexType::Orphan;
         }
+        return num_open_edges_[vidx] > 0 ? VertexType::Front
+                                         : VertexType::Inner;
     }
-}
 
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
-    }
-}
+public:
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    KDTreeFlann kdtree_;
+    std::vector<int> num_edges_;
+    std::vector<int> num_open_edges_;
+    /// Spatial cell of each vertex.
+    std::vector<int> cells_;
+};
 
+/// Ball pivoting on the vertices of one spatial cell. The ball may only touch
+/// vertices of the cell, but the empty ball test uses all points, such that
+/// the triangles of independent cells are consistent. A region with cell -1
+/// owns all vertices.
 class BallPivoting {
 public:
-    BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
-        mesh_ = std::make_shared<TriangleMesh>();
-        mesh_->vertices_ = pcd.points_;
-        mesh_->vertex_normals_ = pcd.normals_;
-        mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
-        }
-    }
+    BallPivoting(BallPivotingContext& context, int cell)
+        : context_(context), cell_(cell) {}
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
+    bool IsOwned(int vidx) const {
+        return cell_ < 0 || context_.cells_[vidx] == cell_;
     }
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = context_.points_[vidx1];
+        const Eigen::Vector3d& v2 = context_.points_[vidx2];
+        const Eigen::Vector3d& v3 = context_.points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -200,9 +137,9 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm = context_.normals_[vidx1] +
+                                      context_.normals_[vidx2] +
+                                      context_.normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -215,72 +152,98 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
-            }
-        }
-        return nullptr;
+    /// Returns the index of the edge between v0 and v1, or -1.
+    int GetLinkingEdge(int v0, int v1) const {
+        auto it = edge_indices_.find(EdgeKey(v0, v1));
+        return it == edge_indices_.end() ? -1 : it->second;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+    int GetOppositeVertex(int eidx) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        if (edge.triangle0_ < 0) {
+            return -1;
         }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+        const BallPivotingTriangle& triangle = triangles_[edge.triangle0_];
+        if (triangle.vert0_ != edge.source_ &&
+            triangle.vert0_ != edge.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != edge.source_ &&
+                   triangle.vert1_ != edge.target_) {
+            return triangle.vert1_;
+        } else {
+            return triangle.vert2_;
+        }
+    }
 
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+    void AddAdjacentTriangle(int eidx, int tidx) {
+        BallPivotingEdge& edge = edges_[eidx];
+        if (edge.triangle0_ < 0) {
+            edge.triangle0_ = tidx;
+            edge.type_ = BallPivotingEdge::Type::Front;
+            // update orientation
+            const int opp = GetOppositeVertex(eidx);
+            const Eigen::Vector3d& source = context_.points_[edge.source_];
+            Eigen::Vector3d tr_norm = (context_.points_[edge.target_] - source)
+                                              .cross(context_.points_[opp] -
+                                                     source);
+            tr_norm /= tr_norm.norm();
+            Eigen::Vector3d pt_norm = context_.normals_[edge.source_] +
+                                      context_.normals_[edge.target_] +
+                                      context_.normals_[opp];
+            pt_norm /= pt_norm.norm();
+            if (pt_norm.dot(tr_norm) < 0) {
+                std::swap(edge.target_, edge.source_);
+            }
+        } else if (edge.triangle1_ < 0) {
+            edge.triangle1_ = tidx;
+            if (edge.type_ != BallPivotingEdge::Type::Inner) {
+                context_.num_open_edges_[edge.source_]--;
+                context_.num_open_edges_[edge.target_]--;
+            }
+            edge.type_ = BallPivotingEdge::Type::Inner;
+        } else {
+            utility::LogDebug("!!! This case should not happen");
         }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+    }
 
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+    /// Returns the edge between v0 and v1, creating it if it does not exist.
+    int GetOrCreateEdge(int v0, int v1) {
+        const auto result = edge_indices_.emplace(
+                EdgeKey(v0, v1), static_cast<int>(edges_.size()));
+        if (result.second) {
+            edges_.emplace_back(v0, v1);
+            context_.num_edges_[v0]++;
+            context_.num_edges_[v1]++;
+            context_.num_open_edges_[v0]++;
+            context_.num_open_edges_[v1]++;
         }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+        return result.first->second;
+    }
+
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        utility::LogDebug(
+                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                v1, v2);
+        const int tidx = static_cast<int>(triangles_.size());
+        triangles_.push_back({v0, v1, v2, center});
+        AddAdjacentTriangle(GetOrCreateEdge(v0, v1), tidx);
+        AddAdjacentTriangle(GetOrCreateEdge(v1, v2), tidx);
+        AddAdjacentTriangle(GetOrCreateEdge(v2, v0), tidx);
+
+        const Eigen::Vector3d face_normal =
+                ComputeFaceNormal(context_.points_[v0], context_.points_[v1],
+                                  context_.points_[v2]);
+        if (face_normal.dot(context_.normals_[v0]) > -1e-16) {
+            mesh_triangles_.emplace_back(v0, v1, v2);
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            mesh_triangles_.emplace_back(v0, v2, v1);
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        mesh_triangle_normals_.push_back(face_normal);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -289,58 +252,41 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int v0, int v1, int v2) const {
+        const Eigen::Vector3d& n0 = context_.normals_[v0];
+        const Eigen::Vector3d& n1 = context_.normals_[v1];
+        const Eigen::Vector3d& n2 = context_.normals_[v2];
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(context_.points_[v0], context_.points_[v1],
+                                  context_.points_[v2]);
+        if (normal.dot(n0) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
-        return ret;
+        return normal.dot(n0) > -1e-16 && normal.dot(n1) > -1e-16 &&
+               normal.dot(n2) > -1e-16;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        if (opp == nullptr) {
-            utility::LogError("edge->GetOppositeVertex() returns nullptr.");
-            assert(opp == nullptr);
+    int FindCandidateVertex(int eidx,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        const int src = edge.source_;
+        const int tgt = edge.target_;
+        const int opp = GetOppositeVertex(eidx);
+        if (opp < 0) {
+            utility::LogError("GetOppositeVertex() returns -1.");
         }
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+        const Eigen::Vector3d& src_point = context_.points_[src];
+        const Eigen::Vector3d& tgt_point = context_.points_[tgt];
+        const Eigen::Vector3d& opp_point = context_.points_[opp];
+        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}", src,
+                          tgt, opp);
+
+        Eigen::Vector3d mp = 0.5 * (src_point + tgt_point);
+        const Eigen::Vector3d& center =
+                triangles_[edge.triangle0_].ball_center_;
+
+        Eigen::Vector3d v = tgt_point - src_point;
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
@@ -348,66 +294,39 @@ public:
 
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
+        context_.kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
         for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+            if (nbidx == src || nbidx == tgt || nbidx == opp ||
+                !IsOwned(nbidx)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
+            const Eigen::Vector3d& candidate_point = context_.points_[nbidx];
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    src_point, tgt_point, opp_point, candidate_point);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, candidate_point, src_point,
+                                     opp_point) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
+                                     mp, candidate_point, tgt_point,
+                                     opp_point) < 1e-12)) {
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!ComputeBallCenter(src, tgt, nbidx, radius, new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -417,216 +336,173 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
             for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+                if (nbidx2 == src || nbidx2 == tgt || nbidx2 == nbidx) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - context_.points_[nbidx2]).norm() <
+                    radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = nbidx;
                 candidate_center = new_center;
             }
         }
 
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
+        utility::LogDebug("[FindCandidateVertex] returns {:d}", min_candidate);
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            const int eidx = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Front) {
                 continue;
             }
+            const int src = edges_[eidx].source_;
+            const int tgt = edges_[eidx].target_;
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            const int candidate = FindCandidateVertex(eidx, radius, center);
+            if (candidate < 0 ||
+                context_.GetVertexType(candidate) ==
+                        BallPivotingContext::VertexType::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int e0 = GetLinkingEdge(candidate, src);
+            int e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 >= 0 &&
+                 edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 &&
+                 edges_[e1].type_ != BallPivotingEdge::Type::Front)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
-                         Eigen::Vector3d& center) {
+                         Eigen::Vector3d& center) const {
         utility::LogDebug(
                 "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
                 "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
+                v0, v1, v2, radius);
 
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
-            return false;
-        }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
+        const int e0 = GetLinkingEdge(v0, v2);
+        const int e1 = GetLinkingEdge(v1, v2);
+        if ((e0 >= 0 && edges_[e0].type_ == BallPivotingEdge::Type::Inner) ||
+            (e1 >= 0 && edges_[e1].type_ == BallPivotingEdge::Type::Inner)) {
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             return false;
         }
 
         // test if no other point is within the ball
         for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+            if (nbidx == v0 || nbidx == v1 || nbidx == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
+            if ((center - context_.points_[nbidx]).norm() < radius - 1e-16) {
                 return false;
             }
         }
-
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool IsOwnedOrphan(int vidx) const {
+        return IsOwned(vidx) && context_.GetVertexType(vidx) ==
+                                        BallPivotingContext::VertexType::Orphan;
+    }
+
+    bool TrySeed(int v, double radius) {
+        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v, radius);
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        context_.kdtree_.SearchRadius(context_.points_[v], 2 * radius, indices,
+                                      dists2);
         if (indices.size() < 3u) {
             return false;
         }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
-                continue;
-            }
-            if (nb0->idx_ == v->idx_) {
+            const int nb0 = indices[nbidx0];
+            if (!IsOwnedOrphan(nb0) || nb0 == v) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int candidate = indices[nbidx1];
+                if (!IsOwnedOrphan(candidate) || candidate == v) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
-                    continue;
-                }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+            if (nb1 >= 0) {
+                const int e0 = GetLinkingEdge(v, nb1);
+                const int e1 = GetLinkingEdge(nb0, nb1);
+                const int e2 = GetLinkingEdge(v, nb0);
+                if ((e0 >= 0 &&
+                     edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                    (e1 >= 0 &&
+                     edges_[e1].type_ != BallPivotingEdge::Type::Front) ||
+                    (e2 >= 0 &&
+                     edges_[e2].type_ != BallPivotingEdge::Type::Front)) {
                     continue;
                 }
 
                 CreateTriangle(v, nb0, nb1, center);
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
-                }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
-                }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
+                for (int eidx :
+                     {GetLinkingEdge(v, nb1), GetLinkingEdge(nb0, nb1),
+                      GetLinkingEdge(v, nb0)}) {
+                    if (edges_[eidx].type_ == BallPivotingEdge::Type::Front) {
+                        edge_front_.push_front(eidx);
+                    }
                 }
 
                 if (edge_front_.size() > 0) {
@@ -642,104 +518,220 @@ public:
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+    void FindSeedTriangle(double radius,
+                          const std::vector<int>& vertex_indices) {
+        for (int vidx : vertex_indices) {
+            if (context_.GetVertexType(vidx) ==
+                BallPivotingContext::VertexType::Orphan) {
+                if (TrySeed(vidx, radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
-        }
-
-        mesh_->triangles_.clear();
-
+    /// Runs the reconstruction for all radii. Seeds are only searched at the
+    /// vertices \p vertex_indices, which must be owned by this region.
+    void Run(const std::vector<double>& radii,
+             const std::vector<int>& vertex_indices) {
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
-            if (radius <= 0) {
-                utility::LogError(
-                        "got an invalid, negative radius as parameter");
-            }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
+            size_t num_border_edges = 0;
+            for (int eidx : border_edges_) {
+                const BallPivotingTriangle& triangle =
+                        triangles_[edges_[eidx].triangle0_];
                 Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
+                bool empty_ball = false;
+                if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                      triangle.vert2_, radius, center)) {
                     std::vector<int> indices;
                     std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+                    context_.kdtree_.SearchRadius(center, radius, indices,
+                                                  dists2);
+                    empty_ball = std::all_of(
+                            indices.begin(), indices.end(), [&](int idx) {
+                                return idx == triangle.vert0_ ||
+                                       idx == triangle.vert1_ ||
+                                       idx == triangle.vert2_;
+                            });
+                }
+                if (empty_ball) {
+                    edges_[eidx].type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(eidx);
+                } else {
+                    border_edges_[num_border_edges++] = eidx;
                 }
-                ++it;
             }
+            border_edges_.resize(num_border_edges);
 
             // do the reconstruction
             if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
+                FindSeedTriangle(radius, vertex_indices);
             } else {
                 ExpandTriangulation(radius);
             }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+            utility::LogDebug("[Run] region has {:d} triangles",
+                              triangles_.size());
+        }
+    }
+
+    /// Adds the triangles of \p other, which must have been reconstructed on
+    /// the same context. The edge counts of the vertices must have been
+    /// reset before merging the first region.
+    void Merge(const BallPivoting& other) {
+        for (const BallPivotingTriangle& triangle : other.triangles_) {
+            CreateTriangle(triangle.vert0_, triangle.vert1_, triangle.vert2_,
+                           triangle.ball_center_);
+        }
+    }
+
+    /// Puts all edges with a single triangle on the front.
+    void ResetFront() {
+        edge_front_.clear();
+        border_edges_.clear();
+        for (size_t eidx = 0; eidx < edges_.size(); ++eidx) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Front;
+                edge_front_.push_back(static_cast<int>(eidx));
+            }
         }
-        return mesh_;
+    }
+
+    std::vector<Eigen::Vector3i>& GetMeshTriangles() {
+        return mesh_triangles_;
+    }
+
+    std::vector<Eigen::Vector3d>& GetMeshTriangleNormals() {
+        return mesh_triangle_normals_;
     }
 
 private:
-    bool has_normals_;
-    KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
-    std::shared_ptr<TriangleMesh> mesh_;
+    static uint64_t EdgeKey(int v0, int v1) {
+        return (static_cast<uint64_t>(std::min(v0, v1)) << 32) |
+               static_cast<uint32_t>(std::max(v0, v1));
+    }
+
+    BallPivotingContext& context_;
+    int cell_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    std::unordered_map<uint64_t, int> edge_indices_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
+    std::vector<Eigen::Vector3i> mesh_triangles_;
+    std::vector<Eigen::Vector3d> mesh_triangle_normals_;
 };
+
+/// Splits the point indices \p indices into \p num_cells cells with about the
+/// same number of points by recursive median splits along the longest axis
+/// of the bounding box. The indices of each cell are sorted.
+void PartitionPoints(const std::vector<Eigen::Vector3d>& points,
+                     std::vector<int> indices,
+                     int num_cells,
+                     std::vector<std::vector<int>>& cells) {
+    if (num_cells <= 1 || indices.size() < 2) {
+        std::sort(indices.begin(), indices.end());
+        cells.push_back(std::move(indices));
+        return;
+    }
+    Eigen::Vector3d min_bound = points[indices[0]];
+    Eigen::Vector3d max_bound = points[indices[0]];
+    for (int idx : indices) {
+        min_bound = min_bound.cwiseMin(points[idx]);
+        max_bound = max_bound.cwiseMax(points[idx]);
+    }
+    int axis;
+    (max_bound - min_bound).maxCoeff(&axis);
+    const int num_left_cells = num_cells / 2;
+    const size_t mid = indices.size() * num_left_cells / num_cells;
+    std::nth_element(indices.begin(), indices.begin() + mid, indices.end(),
+                     [&](int lhs, int rhs) {
+                         return points[lhs](axis) < points[rhs](axis);
+                     });
+    std::vector<int> right(indices.begin() + mid, indices.end());
+    indices.resize(mid);
+    PartitionPoints(points, std::move(indices), num_left_cells, cells);
+    PartitionPoints(points, std::move(right), num_cells - num_left_cells,
+                    cells);
+}
+
 }  // namespace
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
-    BallPivoting bp(pcd);
-    return bp.Run(radii);
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        int n_threads) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
+    if (n_threads <= 0) {
+        n_threads = utility::EstimateMaxThreads();
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+
+    BallPivotingContext context(pcd);
+    std::vector<int> all_indices(pcd.points_.size());
+    std::iota(all_indices.begin(), all_indices.end(), 0);
+    const int num_cells = static_cast<int>(
+            std::min(kMaxNumCells, pcd.points_.size() / kMinPointsPerCell));
+
+    BallPivoting result(context, -1);
+    if (num_cells <= 1 || radii.empty()) {
+        result.Run(radii, all_indices);
+    } else {
+        // Reconstruct the cells independently, then merge the triangles and
+        // continue from the open edges, which closes the seams between the
+        // cells.
+        std::vector<std::vector<int>> cells;
+        PartitionPoints(pcd.points_, all_indices, num_cells, cells);
+        for (size_t cell = 0; cell < cells.size(); ++cell) {
+            for (int vidx : cells[cell]) {
+                context.cells_[vidx] = static_cast<int>(cell);
+            }
+        }
+        utility::LogDebug("[CreateFromPointCloudBallPivoting] {} cells",
+                          cells.size());
+
+        std::vector<std::unique_ptr<BallPivoting>> regions(cells.size());
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for (int cell = 0; cell < static_cast<int>(cells.size()); ++cell) {
+            regions[cell] = std::make_unique<BallPivoting>(context, cell);
+            regions[cell]->Run(radii, cells[cell]);
+        }
+
+        std::fill(context.num_edges_.begin(), context.num_edges_.end(), 0);
+        std::fill(context.num_open_edges_.begin(),
+                  context.num_open_edges_.end(), 0);
+        for (const auto& region : regions) {
+            result.Merge(*region);
+        }
+        regions.clear();
+
+        // The cells could not seed triangles that cross their boundaries,
+        // seed the remaining orphans after expanding the open edges with the
+        // first radius, as the serial reconstruction does.
+        result.ResetFront();
+        result.ExpandTriangulation(radii[0]);
+        result.FindSeedTriangle(radii[0], all_indices);
+        result.Run(std::vector<double>(radii.begin() + 1, radii.end()),
+                   all_indices);
+    }
+
+    mesh->triangles_ = std::move(result.GetMeshTriangles());
+    mesh->triangle_normals_ = std::move(result.GetMeshTriangleNormals());
+    return mesh;
 }
 
 }  // namespace geometry
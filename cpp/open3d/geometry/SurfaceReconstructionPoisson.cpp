@@ -7,14 +7,21 @@
 
 #include <Eigen/Dense>
 #include <cfloat>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <unordered_map>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/integration/MarchingCubesConst.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
 // clang-format off
@@ -392,6 +399,77 @@ void ExtractMesh(
     delete mesh;
 }
 
+/// Regular lattice on which the implicit function of a streaming tile is
+/// sampled instead of extracting the iso-surface with the octree.
+struct PoissonLattice {
+    /// Position of node (0, 0, 0) in the coordinates of the input points.
+    Eigen::Vector3d origin_;
+    double spacing_;
+    /// Number of nodes along x, y and z.
+    int size_;
+    /// Function values minus the iso-value, negative inside the surface. The
+    /// x index runs fastest.
+    std::vector<float> values_;
+};
+
+template <typename Real, unsigned int... FEMSigs>
+void SampleLattice(
+        UIntPack<FEMSigs...>,
+        FEMTree<sizeof...(FEMSigs), Real>& tree,
+        const DenseNodeData<Real, UIntPack<FEMSigs...>>& solution,
+        Real isoValue,
+        const std::vector<typename FEMTree<sizeof...(FEMSigs),
+                                           Real>::PointSample>& samples,
+        const std::vector<Open3DData>& sampleData,
+        XForm<Real, sizeof...(FEMSigs) + 1> xForm,
+        PoissonLattice& lattice) {
+    static const int Dim = sizeof...(FEMSigs);
+    typedef UIntPack<FEMSigs...> Sigs;
+    typename FEMTree<Dim, Real>::template MultiThreadedEvaluator<Sigs, 0>
+            evaluator(&tree, solution);
+
+    // The indicator function is not guaranteed to increase in the same
+    // direction in every tile, so compare the values in front of and behind
+    // the samples to find the outside.
+    const Real delta = (Real)(0.5 * lattice.spacing_) * xForm(0, 0);
+    std::vector<double> slopes(ThreadPool::NumThreads(), 0);
+    ThreadPool::Parallel_for(
+            0, samples.size(), [&](unsigned int thread, size_t j) {
+                const ProjectiveData<Point<Real, Dim>, Real>& sample =
+                        samples[j].sample;
+                const double l = sampleData[j].normal_.norm();
+                if (sample.weight <= 0 || l <= 0) return;
+                const Point<Real, Dim> p = sample.data / sample.weight;
+                Point<Real, Dim> n;
+                for (int d = 0; d < Dim; ++d) {
+                    n[d] = (Real)(sampleData[j].normal_(d) / l) * delta;
+                    if (p[d] - delta < 0 || p[d] + delta > 1) return;
+                }
+                slopes[thread] += evaluator.values(p + n, thread)[0] -
+                                  evaluator.values(p - n, thread)[0];
+            });
+    double slope = 0;
+    for (double s : slopes) slope += s;
+    const Real sign = slope > 0 ? (Real)1 : (Real)-1;
+
+    const size_t size = static_cast<size_t>(lattice.size_);
+    lattice.values_.resize(size * size * size);
+    ThreadPool::Parallel_for(
+            0, lattice.values_.size(), [&](unsigned int thread, size_t i) {
+                const Eigen::Vector3d q =
+                        lattice.origin_ +
+                        lattice.spacing_ * Eigen::Vector3d(double(i % size),
+                                                           double(i / size %
+                                                                  size),
+                                                           double(i / size /
+                                                                  size));
+                Point<Real, Dim> p((Real)q(0), (Real)q(1), (Real)q(2));
+                p = xForm * p;
+                lattice.values_[i] = static_cast<float>(
+                        sign * (evaluator.values(p, thread)[0] - isoValue));
+            });
+}
+
 template <class Real, typename... SampleData, unsigned int... FEMSigs>
 void Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
@@ -400,6 +478,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              float width,
              float scale,
              bool linear_fit,
+             float cube_width,
+             PoissonLattice* lattice,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -448,7 +528,15 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     {
         Open3DPointStream<Real> pointStream(&pcd);
 
-        if (width > 0.0f) {
+        if (cube_width > 0.0f) {
+            // Reconstruct in a fixed cube centered at the origin.
+            Point<Real, Dim> min, max;
+            for (int d = 0; d < Dim; ++d) {
+                min[d] = (Real)(-0.5 * cube_width);
+                max[d] = (Real)(0.5 * cube_width);
+            }
+            xForm = GetBoundingBoxXForm<Real, Dim>(min, max, (Real)1.) * xForm;
+        } else if (width > 0.0f) {
             xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
                                              (Real)(scale > 0 ? scale : 1.),
                                              depth) *
@@ -696,23 +784,406 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                           weightSum);
     }
 
-    auto SetVertex = [](Open3DVertex<Real>& v, Point<Real, Dim> p, Real w,
-                        Open3DData d) {
-        v.point = p;
-        v.normal_ = d.normal_;
-        v.color_ = d.color_;
-        v.w_ = w;
-    };
-    ExtractMesh<Open3DVertex<Real>, Real>(
-            datax, linear_fit, UIntPack<FEMSigs...>(),
-            std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
+    if (lattice) {
+        SampleLattice<Real>(UIntPack<FEMSigs...>(), tree, solution, isoValue,
+                            samples, sampleData, xForm, *lattice);
+    } else {
+        auto SetVertex = [](Open3DVertex<Real>& v, Point<Real, Dim> p, Real w,
+                            Open3DData d) {
+            v.point = p;
+            v.normal_ = d.normal_;
+            v.color_ = d.color_;
+            v.w_ = w;
+        };
+        ExtractMesh<Open3DVertex<Real>, Real>(
+                datax, linear_fit, UIntPack<FEMSigs...>(),
+                std::tuple<SampleData...>(), tree, solution, isoValue,
+                &samples, &sampleData, density, SetVertex, iXForm, out_mesh,
+                out_densities);
+    }
 
     if (density) delete density, density = NULL;
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+// Resolution of the point histogram along the longest axis of the bounding
+// box. The tile size of the streaming reconstruction is a power of two
+// multiple of the histogram cell size.
+static const int STREAMING_HISTOGRAM_RESOLUTION = 256;
+// Number of points read from the input file at once.
+static const size_t STREAMING_CHUNK_SIZE = 1 << 20;
+// Number of buffered floats after which the tile buffers are written to disk.
+static const size_t STREAMING_BUFFER_SIZE = 1 << 24;
+
+typedef std::unordered_map<Eigen::Vector3i,
+                           size_t,
+                           utility::hash_eigen<Eigen::Vector3i>>
+        StreamingHistogram;
+
+/// Regular grid of cubic tiles for the streaming reconstruction. A tile is
+/// reconstructed from the points in its core cube extended by
+/// overlap_ * tile_size_ on each side. Its implicit function is sampled on
+/// the cells_^3 cells of a global lattice that cover the core cube.
+struct StreamingTileGrid {
+    Eigen::Vector3d origin_;
+    double tile_size_;
+    double overlap_;
+    Eigen::Vector3i num_tiles_;
+    int cells_;
+
+    int64_t NumTiles() const {
+        return int64_t(num_tiles_(0)) * num_tiles_(1) * num_tiles_(2);
+    }
+    int64_t LinearIndex(const Eigen::Vector3i& tile) const {
+        return tile(0) +
+               int64_t(num_tiles_(0)) *
+                       (tile(1) + int64_t(num_tiles_(1)) * tile(2));
+    }
+    Eigen::Vector3i TileIndex(int64_t index) const {
+        return Eigen::Vector3i(
+                int(index % num_tiles_(0)),
+                int(index / num_tiles_(0) % num_tiles_(1)),
+                int(index / num_tiles_(0) / num_tiles_(1)));
+    }
+    Eigen::Vector3d TileCenter(const Eigen::Vector3i& tile) const {
+        return origin_ + tile_size_ * (tile.cast<double>() +
+                                       Eigen::Vector3d::Constant(0.5));
+    }
+    double Spacing() const { return tile_size_ / cells_; }
+
+    /// Calls \p f with the linear index of every tile whose extended cube
+    /// contains \p p.
+    template <typename F>
+    void ForEachTile(const Eigen::Vector3d& p, F f) const {
+        Eigen::Vector3i lo, hi;
+        for (int d = 0; d < 3; ++d) {
+            const double x = (p(d) - origin_(d)) / tile_size_;
+            lo(d) = std::max(0, int(std::ceil(x - 1 - overlap_)));
+            hi(d) = std::min(num_tiles_(d) - 1, int(std::floor(x + overlap_)));
+        }
+        for (int z = lo(2); z <= hi(2); ++z) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int x = lo(0); x <= hi(0); ++x) {
+                    f(LinearIndex(Eigen::Vector3i(x, y, z)));
+                }
+            }
+        }
+    }
+};
+
+/// Returns the number of histogram cells per tile edge, i.e. the largest
+/// power of two for which no extended tile contains more than \p max_points
+/// points. The count of a tile is the sum over all histogram cells that
+/// intersect its extended cube, which overestimates the actual count.
+int ChooseCellsPerTile(const StreamingHistogram& histogram,
+                       double overlap,
+                       size_t max_points) {
+    for (int m = STREAMING_HISTOGRAM_RESOLUTION; m > 1; m /= 2) {
+        const double margin = overlap * m;
+        std::unordered_map<Eigen::Vector3i, size_t,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                counts;
+        bool fits = true;
+        for (auto it = histogram.begin(); fits && it != histogram.end();
+             ++it) {
+            Eigen::Vector3i lo, hi;
+            for (int d = 0; d < 3; ++d) {
+                const double h = it->first(d);
+                lo(d) = std::max(0, int(std::floor((h - m - margin) / m)) + 1);
+                hi(d) = int(std::ceil((h + 1 + margin) / m)) - 1;
+            }
+            for (int z = lo(2); fits && z <= hi(2); ++z) {
+                for (int y = lo(1); fits && y <= hi(1); ++y) {
+                    for (int x = lo(0); fits && x <= hi(0); ++x) {
+                        size_t& count = counts[Eigen::Vector3i(x, y, z)];
+                        count += it->second;
+                        fits = count <= max_points;
+                    }
+                }
+            }
+        }
+        if (fits) {
+            return m;
+        }
+    }
+    utility::LogWarning(
+            "Points are too dense to split them into tiles with at most {} "
+            "points, using the smallest tile size.",
+            max_points);
+    return 1;
+}
+
+/// Buffers the points of all tiles and appends them to one binary file per
+/// tile once the buffers get too large.
+class StreamingTileWriter {
+public:
+    StreamingTileWriter(const std::string& directory)
+        : directory_(directory), num_buffered_(0) {}
+
+    std::string TilePath(int64_t tile) const {
+        return utility::filesystem::JoinPath(directory_,
+                                             fmt::format("tile_{}.bin", tile));
+    }
+
+    void Add(int64_t tile,
+             const Eigen::Vector3d& point,
+             const Eigen::Vector3d& normal) {
+        std::vector<float>& buffer = buffers_[tile];
+        for (int d = 0; d < 3; ++d) buffer.push_back(float(point(d)));
+        for (int d = 0; d < 3; ++d) buffer.push_back(float(normal(d)));
+        num_points_[tile]++;
+        num_buffered_ += 6;
+        if (num_buffered_ >= STREAMING_BUFFER_SIZE) {
+            Flush();
+        }
+    }
+
+    void Flush() {
+        for (const auto& it : buffers_) {
+            FILE* file = utility::filesystem::FOpen(TilePath(it.first), "ab");
+            if (!file || fwrite(it.second.data(), sizeof(float),
+                                it.second.size(),
+                                file) != it.second.size()) {
+                utility::LogError("Failed to write tile file {}.",
+                                  TilePath(it.first));
+            }
+            fclose(file);
+        }
+        buffers_.clear();
+        num_buffered_ = 0;
+    }
+
+    PointCloud Read(int64_t tile) const {
+        const size_t num_points = num_points_.at(tile);
+        std::vector<float> buffer(num_points * 6);
+        FILE* file = utility::filesystem::FOpen(TilePath(tile), "rb");
+        if (!file || fread(buffer.data(), sizeof(float), buffer.size(),
+                           file) != buffer.size()) {
+            utility::LogError("Failed to read tile file {}.", TilePath(tile));
+        }
+        fclose(file);
+        PointCloud pcd;
+        pcd.points_.resize(num_points);
+        pcd.normals_.resize(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            const float* record = buffer.data() + i * 6;
+            pcd.points_[i] = Eigen::Vector3d(record[0], record[1], record[2]);
+            pcd.normals_[i] = Eigen::Vector3d(record[3], record[4], record[5]);
+        }
+        return pcd;
+    }
+
+    const std::unordered_map<int64_t, size_t>& NumPoints() const {
+        return num_points_;
+    }
+
+private:
+    std::string directory_;
+    std::unordered_map<int64_t, std::vector<float>> buffers_;
+    std::unordered_map<int64_t, size_t> num_points_;
+    size_t num_buffered_;
+};
+
+/// Stores the lattice values of a tile on its three minimum faces, which are
+/// the only values its lower neighbors need.
+class StreamingFaceStore {
+public:
+    StreamingFaceStore(const std::string& directory, int size)
+        : directory_(directory), size_(size) {}
+
+    std::string FacePath(int64_t tile, int axis) const {
+        return utility::filesystem::JoinPath(
+                directory_, fmt::format("face_{}_{}.bin", tile, axis));
+    }
+
+    void Write(int64_t tile, const PoissonLattice& lattice) const {
+        const size_t n = size_t(size_);
+        std::vector<float> face(n * n);
+        for (int axis = 0; axis < 3; ++axis) {
+            for (size_t v = 0; v < n; ++v) {
+                for (size_t u = 0; u < n; ++u) {
+                    face[u + n * v] = lattice.values_[LatticeIndex(axis, u, v)];
+                }
+            }
+            FILE* file = utility::filesystem::FOpen(FacePath(tile, axis), "wb");
+            if (!file ||
+                fwrite(face.data(), sizeof(float), face.size(), file) !=
+                        face.size()) {
+                utility::LogError("Failed to write face file {}.",
+                                  FacePath(tile, axis));
+            }
+            fclose(file);
+        }
+    }
+
+    /// Returns the face of \p tile orthogonal to \p axis, or NaN values if
+    /// the tile has not been reconstructed.
+    std::vector<float> Read(int64_t tile, int axis) const {
+        const size_t n = size_t(size_);
+        std::vector<float> face(n * n, std::numeric_limits<float>::quiet_NaN());
+        FILE* file = utility::filesystem::FOpen(FacePath(tile, axis), "rb");
+        if (file) {
+            if (fread(face.data(), sizeof(float), face.size(), file) !=
+                face.size()) {
+                utility::LogError("Failed to read face file {}.",
+                                  FacePath(tile, axis));
+            }
+            fclose(file);
+        }
+        return face;
+    }
+
+    /// Index of the node (u, v) of the face orthogonal to \p axis, where u
+    /// and v are the coordinates along the other two axes in increasing
+    /// order.
+    size_t LatticeIndex(int axis, size_t u, size_t v) const {
+        const size_t n = size_t(size_);
+        if (axis == 0) return n * (u + n * v);
+        if (axis == 1) return u + n * n * v;
+        return u + n * v;
+    }
+
+private:
+    std::string directory_;
+    int size_;
+};
+
+/// Replaces the values of the nodes of \p lattice that belong to the upper
+/// neighbors of \p tile by their values. A node belongs to the tile whose
+/// half-open core cube contains it, so that all tiles sharing a node use the
+/// same value and the extracted surface has no cracks between tiles.
+void GatherNeighborValues(const StreamingTileGrid& grid,
+                          const StreamingFaceStore& faces,
+                          const Eigen::Vector3i& tile,
+                          PoissonLattice& lattice) {
+    const int n = grid.cells_;
+    const size_t size = size_t(n + 1);
+    for (int mask = 1; mask < 8; ++mask) {
+        const Eigen::Vector3i offset(mask & 1, (mask >> 1) & 1,
+                                     (mask >> 2) & 1);
+        const Eigen::Vector3i owner = tile + offset;
+        if ((owner.array() >= grid.num_tiles_.array()).any()) {
+            continue;
+        }
+        const int axis = offset(0) ? 0 : (offset(1) ? 1 : 2);
+        const std::vector<float> face =
+                faces.Read(grid.LinearIndex(owner), axis);
+        // Nodes on the upper faces along the offset axes, excluding the
+        // nodes of the other upper neighbors along the remaining axes.
+        Eigen::Vector3i lo, hi;
+        for (int d = 0; d < 3; ++d) {
+            if (offset(d)) {
+                lo(d) = hi(d) = n;
+            } else {
+                lo(d) = 0;
+                hi(d) = tile(d) + 1 == grid.num_tiles_(d) ? n : n - 1;
+            }
+        }
+        for (int z = lo(2); z <= hi(2); ++z) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int x = lo(0); x <= hi(0); ++x) {
+                    const Eigen::Vector3i l =
+                            Eigen::Vector3i(x, y, z) - n * offset;
+                    const int u = axis == 0 ? l(1) : l(0);
+                    const int v = axis == 2 ? l(1) : l(2);
+                    lattice.values_[x + size * (y + size * z)] =
+                            face[u + size * v];
+                }
+            }
+        }
+    }
+}
+
+typedef std::unordered_map<
+        Eigen::Vector4i,
+        int,
+        utility::hash_eigen<Eigen::Vector4i>,
+        std::equal_to<Eigen::Vector4i>,
+        Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
+        EdgeVertexMap;
+
+/// Marching cubes on the lattice of \p tile. Vertices on lattice edges in
+/// the tile boundary are shared with the neighboring tiles through
+/// \p seam_vertices, which is keyed by the global lattice edge.
+void ExtractTileMesh(const StreamingTileGrid& grid,
+                     const Eigen::Vector3i& tile,
+                     const PoissonLattice& lattice,
+                     EdgeVertexMap& seam_vertices,
+                     TriangleMesh& mesh) {
+    const int n = grid.cells_;
+    const size_t size = size_t(n + 1);
+    const double spacing = grid.Spacing();
+    const Eigen::Vector3i tile_origin = n * tile;
+    EdgeVertexMap tile_vertices;
+    int edge_to_index[12];
+    for (int z = 0; z < n; ++z) {
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                int cube_index = 0;
+                float f[8];
+                for (int i = 0; i < 8; ++i) {
+                    const Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) +
+                                                shift[i];
+                    f[i] = lattice.values_[idx(0) +
+                                           size * (idx(1) + size * idx(2))];
+                    if (std::isnan(f[i])) {
+                        cube_index = 0;
+                        break;
+                    }
+                    if (f[i] < 0.0f) {
+                        cube_index |= (1 << i);
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                for (int i = 0; i < 12; ++i) {
+                    if (!(edge_table[cube_index] & (1 << i))) {
+                        continue;
+                    }
+                    const Eigen::Vector4i local =
+                            Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                    const int edge_axis = local(3);
+                    bool on_seam = false;
+                    for (int d = 0; d < 3; ++d) {
+                        on_seam |= d != edge_axis &&
+                                   (local(d) == 0 || local(d) == n);
+                    }
+                    const Eigen::Vector4i edge_index =
+                            local + Eigen::Vector4i(tile_origin(0),
+                                                    tile_origin(1),
+                                                    tile_origin(2), 0);
+                    EdgeVertexMap& vertices =
+                            on_seam ? seam_vertices : tile_vertices;
+                    auto it = vertices.find(edge_index);
+                    if (it != vertices.end()) {
+                        edge_to_index[i] = it->second;
+                        continue;
+                    }
+                    // The position only depends on the global edge and the
+                    // shared node values, so it is the same in all tiles.
+                    Eigen::Vector3d pt =
+                            grid.origin_ +
+                            spacing * edge_index.head<3>().cast<double>();
+                    const double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                    const double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                    pt(edge_axis) += f0 * spacing / (f0 + f1);
+                    edge_to_index[i] = (int)mesh.vertices_.size();
+                    vertices[edge_index] = edge_to_index[i];
+                    mesh.vertices_.push_back(pt);
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    mesh.triangles_.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]));
+                }
+            }
+        }
+    }
+}
+
 }  // namespace
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -746,12 +1217,208 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
     Execute<float>(pcd, mesh, densities, static_cast<int>(depth), width, scale,
-                   linear_fit, FEMSigs());
+                   linear_fit, 0.0f, nullptr, FEMSigs());
 
     ThreadPool::Terminate();
 
     return std::make_tuple(mesh, densities);
 }
 
+std::shared_ptr<TriangleMesh>
+TriangleMesh::CreateFromPointCloudPoissonStreaming(
+        const std::string& filename,
+        size_t depth,
+        size_t max_points_per_tile,
+        double overlap,
+        float scale,
+        const std::string& temp_directory,
+        int n_threads) {
+    static const BoundaryType BType = DEFAULT_FEM_BOUNDARY;
+    typedef IsotropicUIntPack<
+            DIMENSION, FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMSigs;
+
+    if (depth < 2) {
+        utility::LogError("depth (={}) has to be >= 2", depth);
+    }
+    if (max_points_per_tile == 0) {
+        utility::LogError("max_points_per_tile has to be positive.");
+    }
+    if (overlap < 0 || overlap >= 0.5) {
+        utility::LogError("overlap (={}) has to be in [0, 0.5).", overlap);
+    }
+    if (scale < 1) {
+        utility::LogError("scale (={}) has to be >= 1.", scale);
+    }
+    const int cells = static_cast<int>(double(1 << depth) /
+                                       (scale * (1 + 2 * overlap)));
+    if (cells < 2) {
+        utility::LogError("depth (={}) is too small for the overlap {}.",
+                          depth, overlap);
+    }
+
+    // First pass: bounding box.
+    size_t num_points = 0;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound = -min_bound;
+    if (!io::ReadPointCloudInChunks(
+                filename, STREAMING_CHUNK_SIZE, [&](const PointCloud& chunk) {
+                    if (!chunk.HasNormals()) {
+                        utility::LogError("Point cloud has no normals");
+                    }
+                    for (const Eigen::Vector3d& p : chunk.points_) {
+                        min_bound = min_bound.cwiseMin(p);
+                        max_bound = max_bound.cwiseMax(p);
+                    }
+                    num_points += chunk.points_.size();
+                    return true;
+                })) {
+        utility::LogError("Failed to read point cloud {}.", filename);
+    }
+    if (num_points == 0) {
+        return std::make_shared<TriangleMesh>();
+    }
+
+    // Pad the bounding box by two lattice cells of a single tile, so that the
+    // surface is closed within the lattice.
+    const double max_extent =
+            std::max((max_bound - min_bound).maxCoeff(), 1e-6);
+    const double padding = 2 * max_extent * scale * (1 + 2 * overlap) /
+                            double(1 << depth);
+    StreamingTileGrid grid;
+    grid.origin_ = min_bound - Eigen::Vector3d::Constant(padding);
+    grid.overlap_ = overlap;
+    grid.cells_ = cells;
+    const double extent = max_extent + 2 * padding;
+
+    // Second pass: histogram to choose the largest tile size that satisfies
+    // the point budget.
+    int cells_per_tile = STREAMING_HISTOGRAM_RESOLUTION;
+    if (num_points > max_points_per_tile) {
+        const double cell_size = extent / STREAMING_HISTOGRAM_RESOLUTION;
+        StreamingHistogram histogram;
+        const bool success = io::ReadPointCloudInChunks(
+                filename, STREAMING_CHUNK_SIZE, [&](const PointCloud& chunk) {
+                    for (const Eigen::Vector3d& p : chunk.points_) {
+                        const Eigen::Vector3i cell =
+                                ((p - grid.origin_) / cell_size)
+                                        .array()
+                                        .floor()
+                                        .cast<int>()
+                                        .max(0)
+                                        .min(STREAMING_HISTOGRAM_RESOLUTION -
+                                             1)
+                                        .matrix();
+                        histogram[cell]++;
+                    }
+                    return true;
+                });
+        if (!success) {
+            utility::LogError("Failed to read point cloud {}.", filename);
+        }
+        cells_per_tile = ChooseCellsPerTile(histogram, overlap,
+                                            max_points_per_tile);
+    }
+    grid.tile_size_ =
+            extent * cells_per_tile / STREAMING_HISTOGRAM_RESOLUTION;
+    for (int d = 0; d < 3; ++d) {
+        grid.num_tiles_(d) = std::max(
+                1, int(std::ceil((max_bound(d) + padding - grid.origin_(d)) /
+                                 grid.tile_size_)));
+    }
+    utility::LogDebug("Streaming Poisson: {} points, {} x {} x {} tiles.",
+                      num_points, grid.num_tiles_(0), grid.num_tiles_(1),
+                      grid.num_tiles_(2));
+
+    const std::string directory = utility::filesystem::JoinPath(
+            temp_directory.empty()
+                    ? utility::filesystem::GetTempDirectoryPath()
+                    : temp_directory,
+            fmt::format("open3d_poisson_{}",
+                        std::chrono::steady_clock::now()
+                                .time_since_epoch()
+                                .count()));
+    if (!utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogError("Failed to create temporary directory {}.",
+                          directory);
+    }
+
+    // Third pass: distribute the points to the tiles. The points are stored
+    // relative to the tile center to preserve the precision of large
+    // coordinates.
+    StreamingTileWriter writer(directory);
+    size_t num_distributed = 0;
+    const bool success = io::ReadPointCloudInChunks(
+            filename, STREAMING_CHUNK_SIZE, [&](const PointCloud& chunk) {
+                for (size_t i = 0; i < chunk.points_.size(); ++i) {
+                    const Eigen::Vector3d& p = chunk.points_[i];
+                    grid.ForEachTile(p, [&](int64_t tile) {
+                        writer.Add(tile,
+                                   p - grid.TileCenter(grid.TileIndex(tile)),
+                                   chunk.normals_[i]);
+                    });
+                }
+                num_distributed += chunk.points_.size();
+                return true;
+            });
+    if (!success || num_distributed != num_points) {
+        utility::filesystem::DeleteDirectory(directory);
+        utility::LogError("Failed to read point cloud {}: got {} of {} points.",
+                          filename, num_distributed, num_points);
+    }
+    writer.Flush();
+
+    if (n_threads <= 0) {
+        n_threads = (int)std::thread::hardware_concurrency();
+    }
+
+#ifdef _OPENMP
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                     n_threads);
+#else
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                     n_threads);
+#endif
+
+    // Reconstruct the tiles in decreasing order, so that the upper neighbors
+    // of a tile have been sampled when its surface is extracted.
+    auto mesh = std::make_shared<TriangleMesh>();
+    const StreamingFaceStore faces(directory, cells + 1);
+    EdgeVertexMap seam_vertices;
+    const float cube_width = static_cast<float>(scale * grid.tile_size_ *
+                                                (1 + 2 * overlap));
+    for (int64_t index = grid.NumTiles() - 1; index >= 0; --index) {
+        // Every cell has a corner that belongs to its own tile, so empty
+        // tiles do not contribute any triangles.
+        if (writer.NumPoints().count(index) == 0) {
+            continue;
+        }
+        const Eigen::Vector3i tile = grid.TileIndex(index);
+        PoissonLattice lattice;
+        lattice.origin_ = Eigen::Vector3d::Constant(-0.5 * grid.tile_size_);
+        lattice.spacing_ = grid.Spacing();
+        lattice.size_ = cells + 1;
+        const PointCloud pcd = writer.Read(index);
+        std::shared_ptr<TriangleMesh> unused_mesh;
+        std::vector<double> unused_densities;
+        Execute<float>(pcd, unused_mesh, unused_densities,
+                       static_cast<int>(depth), 0.0f, 0.0f, false, cube_width,
+                       &lattice, FEMSigs());
+        faces.Write(index, lattice);
+        utility::filesystem::RemoveFile(writer.TilePath(index));
+        GatherNeighborValues(grid, faces, tile, lattice);
+        ExtractTileMesh(grid, tile, lattice, seam_vertices, *mesh);
+        utility::LogDebug("Streaming Poisson: tile {} / {} done.",
+                          grid.NumTiles() - index, grid.NumTiles());
+    }
+
+    ThreadPool::Terminate();
+    utility::filesystem::DeleteDirectory(directory);
+
+    mesh->ComputeVertexNormals();
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -17,6 +17,8 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshAdjacency.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 #include "open3d/utility/Random.h"
@@ -145,17 +147,26 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
     return *this;
 }
 
-TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
-    adjacency_list_.clear();
-    adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
+/// Fills the adjacency list of a mesh from its CSR vertex adjacency.
+static void FillAdjacencyList(
+        const TriangleMeshAdjacency &adjacency,
+        size_t num_vertices,
+        std::vector<std::unordered_set<int>> &adjacency_list) {
+    const std::vector<int> &offsets = adjacency.GetNeighborOffsets();
+    const std::vector<int> &neighbors = adjacency.GetNeighbors();
+    adjacency_list.clear();
+    adjacency_list.resize(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(num_vertices); ++vidx) {
+        adjacency_list[vidx].insert(neighbors.begin() + offsets[vidx],
+                                    neighbors.begin() + offsets[vidx + 1]);
     }
+}
+
+TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    FillAdjacencyList(TriangleMeshAdjacency(*this), vertices_.size(),
+                      adjacency_list_);
     return *this;
 }
 
@@ -180,16 +191,22 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
+    const TriangleMeshAdjacency adjacency(*this);
     if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+        FillAdjacencyList(adjacency, mesh->vertices_.size(),
+                          mesh->adjacency_list_);
     }
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int k = adjacency.GetNeighborOffsets()[vidx];
+                 k < adjacency.GetNeighborOffsets()[vidx + 1]; ++k) {
+                const int nbidx = adjacency.GetNeighbors()[k];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -201,7 +218,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const int nb_size = adjacency.GetNumNeighbors(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -251,16 +268,22 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
+    const TriangleMeshAdjacency adjacency(*this);
     if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+        FillAdjacencyList(adjacency, mesh->vertices_.size(),
+                          mesh->adjacency_list_);
     }
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int k = adjacency.GetNeighborOffsets()[vidx];
+                 k < adjacency.GetNeighborOffsets()[vidx + 1]; ++k) {
+                const int nbidx = adjacency.GetNeighbors()[k];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -272,7 +295,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const int nb_size = adjacency.GetNumNeighbors(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -301,17 +324,22 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const TriangleMeshAdjacency &adjacency,
         double lambda_filter,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+    const std::vector<int> &offsets = adjacency.GetNeighborOffsets();
+    const std::vector<int> &neighbors = adjacency.GetNeighbors();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
+        for (int k = offsets[vidx]; k < offsets[vidx + 1]; ++k) {
+            const int nbidx = neighbors[k];
             auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
             double dist = diff.norm();
             double weight = 1. / (dist + 1e-12);
@@ -371,13 +399,15 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
+    const TriangleMeshAdjacency adjacency(*this);
     if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+        FillAdjacencyList(adjacency, mesh->vertices_.size(),
+                          mesh->adjacency_list_);
     }
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
+                                    prev_vertex_colors, adjacency,
                                     lambda_filter, filter_vertex, filter_normal,
                                     filter_color);
         if (iter < number_of_iterations - 1) {
@@ -413,21 +443,22 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
+    const TriangleMeshAdjacency adjacency(*this);
     if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+        FillAdjacencyList(adjacency, mesh->vertices_.size(),
+                          mesh->adjacency_list_);
     }
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
+                                    prev_vertex_colors, adjacency,
                                     lambda_filter, filter_vertex, filter_normal,
                                     filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency, mu,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -854,10 +885,13 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
     bool mesh_is_edge_manifold = false;
     while (!mesh_is_edge_manifold) {
         mesh_is_edge_manifold = true;
-        auto edges_to_triangles = GetEdgeToTrianglesMap();
+        const TriangleMeshAdjacency adjacency(*this);
+        const std::vector<int> &edge_offsets =
+                adjacency.GetEdgeTriangleOffsets();
+        const std::vector<int> &edge_triangles = adjacency.GetEdgeTriangles();
 
-        for (auto &kv : edges_to_triangles) {
-            size_t n_edge_triangle_refs = kv.second.size();
+        for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+            size_t n_edge_triangle_refs = adjacency.GetNumEdgeTriangles(eidx);
             // check if the given edge is manifold
             // (has exactly 1, or 2 adjacent triangles)
             if (n_edge_triangle_refs == 1u || n_edge_triangle_refs == 2u) {
@@ -874,8 +908,8 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
             // is <= 2.
             // 1) count triangles that are not marked deleted
             int n_triangles = 0;
-            for (int tidx : kv.second) {
-                if (triangle_areas[tidx] > 0) {
+            for (int i = edge_offsets[eidx]; i < edge_offsets[eidx + 1]; ++i) {
+                if (triangle_areas[edge_triangles[i]] > 0) {
                     n_triangles++;
                 }
             }
@@ -886,7 +920,9 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
                 // find triangle with smallest area
                 int min_tidx = -1;
                 double min_area = std::numeric_limits<double>::max();
-                for (int tidx : kv.second) {
+                for (int i = edge_offsets[eidx]; i < edge_offsets[eidx + 1];
+                     ++i) {
+                    const int tidx = edge_triangles[i];
                     double area = triangle_areas[tidx];
                     if (area > 0 && area < min_area) {
                         min_tidx = tidx;
@@ -1255,15 +1291,7 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i, utility::hash_eigen<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(1)));
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(2)));
-        edges.emplace(GetOrderedEdge(triangle(1), triangle(2)));
-    }
-
-    int E = int(edges.size());
+    int E = int(TriangleMeshAdjacency(*this).GetNumEdges());
     int V = int(vertices_.size());
     int F = int(triangles_.size());
     return V + F - E;
@@ -1271,13 +1299,13 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    const TriangleMeshAdjacency adjacency(*this);
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+        const int n_triangles = adjacency.GetNumEdgeTriangles(eidx);
+        if ((allow_boundary_edges && (n_triangles < 1 || n_triangles > 2)) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
+            non_manifold_edges.push_back(adjacency.GetEdges()[eidx]);
         }
     }
     return non_manifold_edges;
@@ -1285,11 +1313,11 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    const TriangleMeshAdjacency adjacency(*this);
+    for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+        const int n_triangles = adjacency.GetNumEdgeTriangles(eidx);
+        if ((allow_boundary_edges && (n_triangles < 1 || n_triangles > 2)) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
             return false;
         }
     }
@@ -1358,51 +1386,11 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-
-        const Eigen::Vector3d bb_min1 =
-                p0.array().min(p1.array().min(p2.array()));
-        const Eigen::Vector3d bb_max1 =
-                p0.array().max(p1.array().max(p2.array()));
-
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-
-            const Eigen::Vector3d bb_min2 =
-                    q0.array().min(q1.array().min(q2.array()));
-            const Eigen::Vector3d bb_max2 =
-                    q0.array().max(q1.array().max(q2.array()));
-            if (IntersectionTest::AABBAABB(bb_min1, bb_max1, bb_min2,
-                                           bb_max2) &&
-                IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
-    return self_intersecting_triangles;
+    return TriangleMeshBVH(*this).GetSelfIntersectingTriangles();
 }
 
 bool TriangleMesh::IsSelfIntersecting() const {
-    return !GetSelfIntersectingTriangles().empty();
+    return TriangleMeshBVH(*this).IsSelfIntersecting();
 }
 
 bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
@@ -1414,22 +1402,16 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
+    return TriangleMeshBVH(*this).IsIntersecting(TriangleMeshBVH(other));
+}
+
+std::vector<Eigen::Vector2i> TriangleMesh::GetIntersectingTriangles(
+        const TriangleMesh &other) const {
+    if (!IsBoundingBoxIntersecting(other)) {
+        return {};
     }
-    return false;
+    return TriangleMeshBVH(*this).GetIntersectingTriangles(
+            TriangleMeshBVH(other));
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -1439,25 +1421,9 @@ TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<double> areas;
 
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
+    const TriangleMeshAdjacency adjacency(*this);
+    const std::vector<int> &edge_offsets = adjacency.GetEdgeTriangleOffsets();
+    const std::vector<int> &edge_triangles = adjacency.GetEdgeTriangles();
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
@@ -1480,10 +1446,15 @@ TriangleMesh::ClusterConnectedTriangles() const {
             cluster_n_triangles++;
             cluster_area += GetTriangleArea(cluster_tidx);
 
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
+            for (int k = 0; k < 3; ++k) {
+                const int eidx = adjacency.GetTriangleEdges()[cluster_tidx](k);
+                for (int i = edge_offsets[eidx]; i < edge_offsets[eidx + 1];
+                     ++i) {
+                    const int tnb = edge_triangles[i];
+                    if (triangle_clusters[tnb] == -1) {
+                        triangle_queue.push(tnb);
+                        triangle_clusters[tnb] = cluster_idx;
+                    }
                 }
             }
         }
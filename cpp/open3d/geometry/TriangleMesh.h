@@ -10,6 +10,7 @@
 #include <Eigen/Core>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -24,6 +25,7 @@ namespace geometry {
 
 class PointCloud;
 class TetraMesh;
+class TriangleMeshAdjacency;
 
 /// \class TriangleMesh
 ///
@@ -212,7 +214,8 @@ public:
     /// of triangles, and E is the number of edges.
     int EulerPoincareCharacteristic() const;
 
-    /// Function that returns the non-manifold edges of the triangle mesh.
+    /// Function that returns the non-manifold edges of the triangle mesh,
+    /// sorted lexicographically.
     /// If \param allow_boundary_edges is set to false, then also boundary
     /// edges are returned.
     std::vector<Eigen::Vector2i> GetNonManifoldEdges(
@@ -235,11 +238,15 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Each pair (i, j) satisfies i < j and the pairs are sorted.
+    /// Triangles that share a vertex are not tested. The candidate pairs are
+    /// found with a TriangleMeshBVH. To run several queries on the same mesh,
+    /// build the BVH once and query it directly.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests the triangle pairs with overlapping bounding boxes in a
+    /// TriangleMeshBVH for intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -247,9 +254,15 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests the triangle pairs with overlapping bounding boxes in the
+    /// TriangleMeshBVH of both meshes.
     bool IsIntersecting(const TriangleMesh &other) const;
 
+    /// Function that returns all pairs (i, j) such that triangle i of this
+    /// mesh intersects triangle j of \p other, sorted lexicographically.
+    std::vector<Eigen::Vector2i> GetIntersectingTriangles(
+            const TriangleMesh &other) const;
+
     /// Function that tests if the given triangle mesh is orientable, i.e.
     /// the triangles can be oriented in such a way that all normals point
     /// towards the outside.
@@ -266,7 +279,8 @@ public:
     bool OrientTriangles();
 
     /// Function that returns a map from edges (vertex0, vertex1) to the
-    /// triangle indices the given edge belongs to.
+    /// triangle indices the given edge belongs to. See TriangleMeshAdjacency
+    /// for a more compact representation.
     std::unordered_map<Eigen::Vector2i,
                        std::vector<int>,
                        utility::hash_eigen<Eigen::Vector2i>>
@@ -402,6 +416,10 @@ public:
     /// to be merged
     /// \param boundary_weight a weight applied to edge vertices used to
     /// preserve boundaries
+    ///
+    /// Meshes with more than 65536 triangles are split into spatial
+    /// partitions that are decimated in parallel, followed by a pass over the
+    /// partition seams.
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
             int target_number_of_triangles,
             double maximum_error,
@@ -524,8 +542,16 @@ public:
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
     /// the ball that are used for the surface reconstruction.
+    /// \param n_threads Number of threads used for reconstruction. Set to -1
+    /// to automatically determine it. Large point clouds are split into
+    /// spatial cells that are reconstructed in parallel, the seams between
+    /// the cells are closed by a final pass over the open edges. The cells
+    /// only depend on the point cloud, so the mesh does not depend on the
+    /// number of threads.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            int n_threads = -1);
 
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
@@ -557,6 +583,43 @@ public:
                                 bool linear_fit = false,
                                 int n_threads = -1);
 
+    /// \brief Function that computes a triangle mesh from an oriented point
+    /// cloud file that does not fit into memory, using the Screened Poisson
+    /// Reconstruction in overlapping tiles.
+    ///
+    /// The file is read in chunks. The bounding box is split into cubic tiles
+    /// so that no tile, extended by \p overlap times the tile size on each
+    /// side, contains more than \p max_points_per_tile points. The points of
+    /// each tile are buffered in \p temp_directory and every tile is solved
+    /// separately on its extended cube. The implicit functions of the tiles
+    /// are sampled on a global lattice, where every lattice node takes its
+    /// value from the tile containing it, and a single marching cubes pass
+    /// over the lattice gives a mesh without cracks between tiles.
+    ///
+    /// \param filename Point cloud file with normals, see
+    /// io::ReadPointCloudInChunks for the supported formats.
+    /// \param depth Maximum depth of the octree of each tile. The lattice
+    /// resolution per tile is about 2^depth / (scale * (1 + 2 * overlap)).
+    /// \param max_points_per_tile Maximum number of points of an extended
+    /// tile, which bounds the memory used by the octree of a tile.
+    /// \param overlap Width of the margin around each tile relative to the
+    /// tile size, in [0, 0.5).
+    /// \param scale Ratio between the edge length of the reconstruction cube
+    /// of a tile and its extended cube.
+    /// \param temp_directory Directory for temporary files. The system
+    /// temporary directory is used if empty.
+    /// \param n_threads Number of threads used for reconstruction. Set to -1
+    /// to automatically determine it.
+    /// \return The reconstructed TriangleMesh with vertex normals.
+    static std::shared_ptr<TriangleMesh> CreateFromPointCloudPoissonStreaming(
+            const std::string &filename,
+            size_t depth = 8,
+            size_t max_points_per_tile = 4000000,
+            double overlap = 0.25,
+            float scale = 1.1f,
+            const std::string &temp_directory = "",
+            int n_threads = -1);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
     /// distance from the center to the mesh vertices.
@@ -741,7 +804,7 @@ protected:
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const TriangleMeshAdjacency &adjacency,
             double lambda_filter,
             bool filter_vertex,
             bool filter_normal,
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshAdjacency.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/RadixSort.h"
+
+namespace open3d {
+namespace geometry {
+
+TriangleMeshAdjacency::TriangleMeshAdjacency(const TriangleMesh &mesh) {
+    Compute(mesh.triangles_, mesh.vertices_.size());
+}
+
+TriangleMeshAdjacency::TriangleMeshAdjacency(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    Compute(triangles, num_vertices);
+}
+
+void TriangleMeshAdjacency::Compute(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    const int num_triangles = int(triangles.size());
+    const int num_sides = 3 * num_triangles;
+    for (const Eigen::Vector3i &triangle : triangles) {
+        if (triangle.minCoeff() < 0 ||
+            size_t(triangle.maxCoeff()) >= num_vertices) {
+            utility::LogError("Triangle {} references an invalid vertex.",
+                              triangle.transpose());
+        }
+    }
+
+    // Sort the triangle sides by their ordered vertex pair. The sort is
+    // stable, so the sides of an edge stay ordered by triangle.
+    int num_bits = 1;
+    while (num_bits < 32 && (uint64_t(1) << num_bits) < num_vertices) {
+        ++num_bits;
+    }
+    std::vector<uint64_t> keys(num_sides);
+    std::vector<int> sides(num_sides);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            const uint64_t v0 = uint64_t(triangles[tidx](k));
+            const uint64_t v1 = uint64_t(triangles[tidx]((k + 1) % 3));
+            keys[3 * tidx + k] = (std::min(v0, v1) << num_bits) |
+                                 std::max(v0, v1);
+            sides[3 * tidx + k] = 3 * tidx + k;
+        }
+    }
+    utility::RadixSort(keys, sides, 2 * num_bits);
+
+    // Runs of equal keys are the edges.
+    std::vector<int> side_edges(num_sides);
+    int num_edges = 0;
+    for (int i = 0; i < num_sides; ++i) {
+        if (i > 0 && keys[i] != keys[i - 1]) {
+            ++num_edges;
+        }
+        side_edges[i] = num_edges;
+    }
+    num_edges = num_sides > 0 ? num_edges + 1 : 0;
+
+    const uint64_t mask = (uint64_t(1) << num_bits) - 1;
+    edges_.resize(num_edges);
+    edge_triangle_offsets_.assign(num_edges + 1, num_sides);
+    edge_triangles_.resize(num_sides);
+    triangle_edges_.resize(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_sides; ++i) {
+        const int eidx = side_edges[i];
+        if (i == 0 || side_edges[i - 1] != eidx) {
+            edges_[eidx] = Eigen::Vector2i(int(keys[i] >> num_bits),
+                                           int(keys[i] & mask));
+            edge_triangle_offsets_[eidx] = i;
+        }
+        edge_triangles_[i] = sides[i] / 3;
+        triangle_edges_[sides[i] / 3](sides[i] % 3) = eidx;
+    }
+
+    // Vertex adjacency. Filling it in the order of the sorted edges yields
+    // sorted neighbors: the edges (a, v) with a < v precede the edges (v, b).
+    vertex_offsets_.assign(num_vertices + 1, 0);
+    for (const Eigen::Vector2i &edge : edges_) {
+        vertex_offsets_[edge(0) + 1]++;
+        if (edge(0) != edge(1)) {
+            vertex_offsets_[edge(1) + 1]++;
+        }
+    }
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+        vertex_offsets_[vidx + 1] += vertex_offsets_[vidx];
+    }
+    vertex_neighbors_.resize(vertex_offsets_.back());
+    vertex_edges_.resize(vertex_offsets_.back());
+    std::vector<int> fill(vertex_offsets_.begin(), vertex_offsets_.end() - 1);
+    for (int eidx = 0; eidx < num_edges; ++eidx) {
+        const Eigen::Vector2i &edge = edges_[eidx];
+        vertex_neighbors_[fill[edge(0)]] = edge(1);
+        vertex_edges_[fill[edge(0)]++] = eidx;
+        if (edge(0) != edge(1)) {
+            vertex_neighbors_[fill[edge(1)]] = edge(0);
+            vertex_edges_[fill[edge(1)]++] = eidx;
+        }
+    }
+}
+
+int TriangleMeshAdjacency::GetEdgeIndex(int vidx0, int vidx1) const {
+    if (vidx0 < 0 || vidx0 >= int(GetNumVertices())) {
+        return -1;
+    }
+    auto begin = vertex_neighbors_.begin() + vertex_offsets_[vidx0];
+    auto end = vertex_neighbors_.begin() + vertex_offsets_[vidx0 + 1];
+    auto it = std::lower_bound(begin, end, vidx1);
+    if (it == end || *it != vidx1) {
+        return -1;
+    }
+    return vertex_edges_[it - vertex_neighbors_.begin()];
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshAdjacency
+///
+/// \brief Compact connectivity of a triangle mesh: a sorted edge table with
+/// the incident triangles of each edge and the vertex adjacency in
+/// compressed sparse row (CSR) format.
+///
+/// The edges are the unique pairs (v0, v1), v0 <= v1, of the triangle sides,
+/// sorted lexicographically. They are found with a parallel radix sort of the
+/// triangle sides, which needs far less memory than hash maps keyed by
+/// edges. Triangles that are listed several times, or that use a side twice,
+/// are listed as often for the edge, as in
+/// TriangleMesh::GetEdgeToTrianglesMap().
+class TriangleMeshAdjacency {
+public:
+    /// \brief Default Constructor.
+    TriangleMeshAdjacency() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Triangle mesh whose connectivity is computed.
+    TriangleMeshAdjacency(const TriangleMesh &mesh);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param triangles Triangles as vertex indices.
+    /// \param num_vertices Number of vertices, all indices of \p triangles
+    /// have to be smaller.
+    TriangleMeshAdjacency(const std::vector<Eigen::Vector3i> &triangles,
+                          size_t num_vertices);
+
+public:
+    /// Computes the connectivity of the given triangles.
+    void Compute(const std::vector<Eigen::Vector3i> &triangles,
+                 size_t num_vertices);
+
+    /// Returns the number of vertices.
+    size_t GetNumVertices() const {
+        return vertex_offsets_.empty() ? 0 : vertex_offsets_.size() - 1;
+    }
+
+    /// Returns the number of unique edges.
+    size_t GetNumEdges() const { return edges_.size(); }
+
+    /// Returns the sorted unique edges (v0, v1) with v0 <= v1.
+    const std::vector<Eigen::Vector2i> &GetEdges() const { return edges_; }
+
+    /// Returns the number of incident triangles of edge \p eidx.
+    int GetNumEdgeTriangles(int eidx) const {
+        return edge_triangle_offsets_[eidx + 1] - edge_triangle_offsets_[eidx];
+    }
+
+    /// Returns the offsets into GetEdgeTriangles(), the triangles of edge i
+    /// are in [offsets[i], offsets[i + 1]).
+    const std::vector<int> &GetEdgeTriangleOffsets() const {
+        return edge_triangle_offsets_;
+    }
+
+    /// Returns the incident triangles of all edges, in increasing order per
+    /// edge.
+    const std::vector<int> &GetEdgeTriangles() const {
+        return edge_triangles_;
+    }
+
+    /// Returns for each triangle the edge indices of its sides (0, 1),
+    /// (1, 2) and (2, 0).
+    const std::vector<Eigen::Vector3i> &GetTriangleEdges() const {
+        return triangle_edges_;
+    }
+
+    /// Returns the number of neighbors of vertex \p vidx.
+    int GetNumNeighbors(int vidx) const {
+        return vertex_offsets_[vidx + 1] - vertex_offsets_[vidx];
+    }
+
+    /// Returns the offsets into GetNeighbors(), the neighbors of vertex i are
+    /// in [offsets[i], offsets[i + 1]).
+    const std::vector<int> &GetNeighborOffsets() const {
+        return vertex_offsets_;
+    }
+
+    /// Returns the neighbors of all vertices, in increasing order per vertex.
+    /// A vertex is its own neighbor if it is used twice by a triangle, as in
+    /// TriangleMesh::ComputeAdjacencyList().
+    const std::vector<int> &GetNeighbors() const { return vertex_neighbors_; }
+
+    /// Returns for each entry of GetNeighbors() the index of the edge to
+    /// the neighbor.
+    const std::vector<int> &GetNeighborEdges() const { return vertex_edges_; }
+
+    /// Returns the index of the edge between \p vidx0 and \p vidx1, or -1 if
+    /// there is none.
+    int GetEdgeIndex(int vidx0, int vidx1) const;
+
+private:
+    std::vector<Eigen::Vector2i> edges_;
+    std::vector<int> edge_triangle_offsets_;
+    std::vector<int> edge_triangles_;
+    std::vector<Eigen::Vector3i> triangle_edges_;
+    std::vector<int> vertex_offsets_;
+    std::vector<int> vertex_neighbors_;
+    std::vector<int> vertex_edges_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,491 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of bins per axis of the binned SAH.
+constexpr int kNumBins = 16;
+
+/// Min number of node pairs per thread before the leaf pairs are tested in
+/// parallel.
+constexpr size_t kPairsPerThread = 32;
+
+double HalfSurfaceArea(const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound) {
+    const Eigen::Vector3d extent = (max_bound - min_bound).cwiseMax(0.0);
+    return extent(0) * extent(1) + extent(1) * extent(2) +
+           extent(2) * extent(0);
+}
+
+/// A subtree whose construction is deferred to the parallel phase. The root
+/// of the subtree is a placeholder node in the top of the tree.
+struct DeferredSubtree {
+    int node;
+    int begin;
+    int end;
+};
+
+/// Builds the nodes of a BVH over the triangle bounds by recursive binned SAH
+/// splits. The triangle indices are reordered in place, such that each node
+/// references a contiguous range.
+class BVHBuilder {
+public:
+    BVHBuilder(const std::vector<Eigen::Vector3d> &triangle_min,
+               const std::vector<Eigen::Vector3d> &triangle_max,
+               const std::vector<Eigen::Vector3d> &centroids,
+               std::vector<int> &indices)
+        : triangle_min_(triangle_min),
+          triangle_max_(triangle_max),
+          centroids_(centroids),
+          indices_(indices) {}
+
+    /// Builds the subtree of [begin, end) and returns the index of its root.
+    /// Subtrees with at most \p max_deferred_size triangles are not built but
+    /// appended to \p deferred if it is not null.
+    int Build(std::vector<TriangleMeshBVH::Node> &nodes,
+              int begin,
+              int end,
+              int max_deferred_size,
+              std::vector<DeferredSubtree> *deferred) const {
+        const int node_idx = static_cast<int>(nodes.size());
+        nodes.emplace_back();
+        Eigen::Vector3d min_bound = triangle_min_[indices_[begin]];
+        Eigen::Vector3d max_bound = triangle_max_[indices_[begin]];
+        for (int i = begin + 1; i < end; ++i) {
+            min_bound = min_bound.cwiseMin(triangle_min_[indices_[i]]);
+            max_bound = max_bound.cwiseMax(triangle_max_[indices_[i]]);
+        }
+        nodes[node_idx].min_bound_ = min_bound;
+        nodes[node_idx].max_bound_ = max_bound;
+        nodes[node_idx].begin_ = begin;
+        nodes[node_idx].end_ = end;
+
+        const int count = end - begin;
+        if (count <= TriangleMeshBVH::kMaxLeafSize) {
+            return node_idx;
+        }
+        if (deferred != nullptr && count <= max_deferred_size) {
+            deferred->push_back({node_idx, begin, end});
+            return node_idx;
+        }
+
+        const int mid = Split(begin, end);
+        const int left = Build(nodes, begin, mid, max_deferred_size, deferred);
+        const int right = Build(nodes, mid, end, max_deferred_size, deferred);
+        nodes[node_idx].left_ = left;
+        nodes[node_idx].right_ = right;
+        return node_idx;
+    }
+
+private:
+    /// Partitions [begin, end) at the split with the lowest SAH cost and
+    /// returns the split position. Falls back to the median of the longest
+    /// centroid axis if no bin split separates the triangles.
+    int Split(int begin, int end) const {
+        Eigen::Vector3d centroid_min = centroids_[indices_[begin]];
+        Eigen::Vector3d centroid_max = centroid_min;
+        for (int i = begin + 1; i < end; ++i) {
+            centroid_min = centroid_min.cwiseMin(centroids_[indices_[i]]);
+            centroid_max = centroid_max.cwiseMax(centroids_[indices_[i]]);
+        }
+        const Eigen::Vector3d extent = centroid_max - centroid_min;
+        int longest_axis;
+        extent.maxCoeff(&longest_axis);
+        if (extent(longest_axis) <= 0) {
+            return begin + (end - begin) / 2;
+        }
+
+        double best_cost = std::numeric_limits<double>::max();
+        int best_axis = -1;
+        int best_bin = -1;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent(axis) <= 0) {
+                continue;
+            }
+            const double scale = kNumBins / extent(axis);
+            std::array<int, kNumBins> bin_counts{};
+            std::array<Eigen::Vector3d, kNumBins> bin_min, bin_max;
+            bin_min.fill(Eigen::Vector3d::Constant(
+                    std::numeric_limits<double>::max()));
+            bin_max.fill(Eigen::Vector3d::Constant(
+                    std::numeric_limits<double>::lowest()));
+            for (int i = begin; i < end; ++i) {
+                const int idx = indices_[i];
+                const int bin = BinIndex(centroids_[idx](axis),
+                                         centroid_min(axis), scale);
+                bin_counts[bin]++;
+                bin_min[bin] = bin_min[bin].cwiseMin(triangle_min_[idx]);
+                bin_max[bin] = bin_max[bin].cwiseMax(triangle_max_[idx]);
+            }
+
+            // Sweep from the right to get the cost of the right side of each
+            // split, then from the left.
+            std::array<double, kNumBins> right_cost{};
+            Eigen::Vector3d sweep_min = bin_min[kNumBins - 1];
+            Eigen::Vector3d sweep_max = bin_max[kNumBins - 1];
+            int sweep_count = 0;
+            for (int bin = kNumBins - 1; bin > 0; --bin) {
+                sweep_min = sweep_min.cwiseMin(bin_min[bin]);
+                sweep_max = sweep_max.cwiseMax(bin_max[bin]);
+                sweep_count += bin_counts[bin];
+                right_cost[bin] =
+                        sweep_count * HalfSurfaceArea(sweep_min, sweep_max);
+            }
+            sweep_min = bin_min[0];
+            sweep_max = bin_max[0];
+            sweep_count = 0;
+            for (int bin = 1; bin < kNumBins; ++bin) {
+                sweep_min = sweep_min.cwiseMin(bin_min[bin - 1]);
+                sweep_max = sweep_max.cwiseMax(bin_max[bin - 1]);
+                sweep_count += bin_counts[bin - 1];
+                if (sweep_count == 0 || sweep_count == end - begin) {
+                    continue;
+                }
+                const double cost =
+                        sweep_count * HalfSurfaceArea(sweep_min, sweep_max) +
+                        right_cost[bin];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin = bin;
+                }
+            }
+        }
+
+        if (best_axis >= 0) {
+            const double scale = kNumBins / extent(best_axis);
+            const auto it = std::partition(
+                    indices_.begin() + begin, indices_.begin() + end,
+                    [&](int idx) {
+                        return BinIndex(centroids_[idx](best_axis),
+                                        centroid_min(best_axis),
+                                        scale) < best_bin;
+                    });
+            const int mid = static_cast<int>(it - indices_.begin());
+            if (mid > begin && mid < end) {
+                return mid;
+            }
+        }
+
+        const int mid = begin + (end - begin) / 2;
+        std::nth_element(indices_.begin() + begin, indices_.begin() + mid,
+                         indices_.begin() + end, [&](int lhs, int rhs) {
+                             return centroids_[lhs](longest_axis) <
+                                    centroids_[rhs](longest_axis);
+                         });
+        return mid;
+    }
+
+    static int BinIndex(double value, double min_value, double scale) {
+        const int bin = static_cast<int>((value - min_value) * scale);
+        return std::min(std::max(bin, 0), kNumBins - 1);
+    }
+
+    const std::vector<Eigen::Vector3d> &triangle_min_;
+    const std::vector<Eigen::Vector3d> &triangle_max_;
+    const std::vector<Eigen::Vector3d> &centroids_;
+    std::vector<int> &indices_;
+};
+
+bool NodesOverlap(const TriangleMeshBVH::Node &node0,
+                  const TriangleMeshBVH::Node &node1) {
+    return IntersectionTest::AABBAABB(node0.min_bound_, node0.max_bound_,
+                                      node1.min_bound_, node1.max_bound_);
+}
+
+bool ShareVertex(const Eigen::Vector3i &tria_p, const Eigen::Vector3i &tria_q) {
+    for (int i = 0; i < 3; ++i) {
+        if (tria_p(i) == tria_q(0) || tria_p(i) == tria_q(1) ||
+            tria_p(i) == tria_q(2)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh) {
+    SetTriangleMesh(mesh);
+}
+
+TriangleMeshBVH::TriangleMeshBVH(
+        const std::vector<Eigen::Vector3d> &vertices,
+        const std::vector<Eigen::Vector3i> &triangles) {
+    SetTriangles(vertices, triangles);
+}
+
+bool TriangleMeshBVH::SetTriangleMesh(const TriangleMesh &mesh) {
+    return SetTriangles(mesh.vertices_, mesh.triangles_);
+}
+
+bool TriangleMeshBVH::SetTriangles(
+        const std::vector<Eigen::Vector3d> &vertices,
+        const std::vector<Eigen::Vector3i> &triangles) {
+    vertices_ = vertices;
+    triangles_ = triangles;
+    nodes_.clear();
+    triangle_indices_.clear();
+    if (triangles_.empty()) {
+        return false;
+    }
+
+    const int num_triangles = static_cast<int>(triangles_.size());
+    std::vector<Eigen::Vector3d> triangle_min(num_triangles);
+    std::vector<Eigen::Vector3d> triangle_max(num_triangles);
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &tria = triangles_[tidx];
+        const Eigen::Vector3d &p0 = vertices_[tria(0)];
+        const Eigen::Vector3d &p1 = vertices_[tria(1)];
+        const Eigen::Vector3d &p2 = vertices_[tria(2)];
+        triangle_min[tidx] = p0.cwiseMin(p1).cwiseMin(p2);
+        triangle_max[tidx] = p0.cwiseMax(p1).cwiseMax(p2);
+        centroids[tidx] = 0.5 * (triangle_min[tidx] + triangle_max[tidx]);
+    }
+    triangle_indices_.resize(num_triangles);
+    std::iota(triangle_indices_.begin(), triangle_indices_.end(), 0);
+
+    // Build the top of the tree sequentially until the subtrees are small
+    // enough to be distributed over the threads, then build the subtrees in
+    // parallel and append them to the tree.
+    const BVHBuilder builder(triangle_min, triangle_max, centroids,
+                             triangle_indices_);
+    const int max_deferred_size = std::max(
+            kMaxLeafSize, num_triangles / (8 * utility::EstimateMaxThreads()));
+    std::vector<DeferredSubtree> deferred;
+    builder.Build(nodes_, 0, num_triangles, max_deferred_size, &deferred);
+
+    const int num_deferred = static_cast<int>(deferred.size());
+    std::vector<std::vector<Node>> subtree_nodes(num_deferred);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_deferred; ++i) {
+        subtree_nodes[i].reserve(2 * (deferred[i].end - deferred[i].begin));
+        builder.Build(subtree_nodes[i], deferred[i].begin, deferred[i].end, 0,
+                      nullptr);
+    }
+
+    // The root of each subtree replaces its placeholder node and the other
+    // nodes are appended.
+    for (int i = 0; i < num_deferred; ++i) {
+        const int offset = static_cast<int>(nodes_.size()) - 1;
+        auto remap = [&](int idx) {
+            return idx == 0 ? deferred[i].node : idx + offset;
+        };
+        for (Node &node : subtree_nodes[i]) {
+            if (!node.IsLeaf()) {
+                node.left_ = remap(node.left_);
+                node.right_ = remap(node.right_);
+            }
+        }
+        nodes_[deferred[i].node] = subtree_nodes[i][0];
+        nodes_.insert(nodes_.end(), subtree_nodes[i].begin() + 1,
+                      subtree_nodes[i].end());
+    }
+    return true;
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::GetSelfIntersectingTriangles()
+        const {
+    return ComputeIntersectingTriangles(*this, false);
+}
+
+bool TriangleMeshBVH::IsSelfIntersecting() const {
+    return !ComputeIntersectingTriangles(*this, true).empty();
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::GetIntersectingTriangles(
+        const TriangleMeshBVH &other) const {
+    return ComputeIntersectingTriangles(other, false);
+}
+
+bool TriangleMeshBVH::IsIntersecting(const TriangleMeshBVH &other) const {
+    return !ComputeIntersectingTriangles(other, true).empty();
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::GetOverlappingTriangleBounds(
+        const TriangleMeshBVH &other) const {
+    return ComputeIntersectingTriangles(other, false, false);
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::ComputeIntersectingTriangles(
+        const TriangleMeshBVH &other, bool first_only, bool test_triangles)
+        const {
+    if (IsEmpty() || other.IsEmpty()) {
+        return {};
+    }
+    const bool self = &other == this;
+    const std::vector<Node> &nodes0 = nodes_;
+    const std::vector<Node> &nodes1 = other.nodes_;
+
+    // Descends one level of the simultaneous traversal of the node pair (a,
+    // b). Returns false if both nodes are leaves. In the self test, the pair
+    // (a, a) stands for all triangle pairs within a, which are the pairs
+    // within each child and the pairs across the children.
+    auto descend = [&](const std::pair<int, int> &pair,
+                       std::vector<std::pair<int, int>> &pairs) {
+        const Node &node0 = nodes0[pair.first];
+        const Node &node1 = nodes1[pair.second];
+        if (node0.IsLeaf() && node1.IsLeaf()) {
+            return false;
+        }
+        if (self && pair.first == pair.second) {
+            pairs.emplace_back(node0.left_, node0.left_);
+            pairs.emplace_back(node0.right_, node0.right_);
+            pairs.emplace_back(node0.left_, node0.right_);
+            return true;
+        }
+        const bool split_first =
+                node1.IsLeaf() ||
+                (!node0.IsLeaf() &&
+                 HalfSurfaceArea(node0.min_bound_, node0.max_bound_) >=
+                         HalfSurfaceArea(node1.min_bound_, node1.max_bound_));
+        if (split_first) {
+            pairs.emplace_back(node0.left_, pair.second);
+            pairs.emplace_back(node0.right_, pair.second);
+        } else {
+            pairs.emplace_back(pair.first, node1.left_);
+            pairs.emplace_back(pair.first, node1.right_);
+        }
+        return true;
+    };
+    auto overlap = [&](const std::pair<int, int> &pair) {
+        return (self && pair.first == pair.second) ||
+               NodesOverlap(nodes0[pair.first], nodes1[pair.second]);
+    };
+
+    // Expand the traversal breadth first until there is enough work to
+    // distribute over the threads.
+    const size_t min_num_pairs =
+            kPairsPerThread * utility::EstimateMaxThreads();
+    std::vector<std::pair<int, int>> frontier;
+    if (overlap({0, 0})) {
+        frontier.emplace_back(0, 0);
+    }
+    bool expanded = true;
+    while (expanded && !frontier.empty() && frontier.size() < min_num_pairs) {
+        expanded = false;
+        std::vector<std::pair<int, int>> next_frontier, children;
+        for (const auto &pair : frontier) {
+            children.clear();
+            if (!descend(pair, children)) {
+                next_frontier.push_back(pair);
+                continue;
+            }
+            expanded = true;
+            for (const auto &child : children) {
+                if (overlap(child)) {
+                    next_frontier.push_back(child);
+                }
+            }
+        }
+        frontier = std::move(next_frontier);
+    }
+
+    const int num_pairs = static_cast<int>(frontier.size());
+    std::vector<std::vector<Eigen::Vector2i>> pair_results(num_pairs);
+    std::atomic<bool> found(false);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_pairs; ++i) {
+        std::vector<std::pair<int, int>> stack = {frontier[i]};
+        std::vector<std::pair<int, int>> children;
+        std::vector<Eigen::Vector2i> &result = pair_results[i];
+        while (!stack.empty()) {
+            if (first_only && found.load(std::memory_order_relaxed)) {
+                break;
+            }
+            const std::pair<int, int> pair = stack.back();
+            stack.pop_back();
+            children.clear();
+            if (descend(pair, children)) {
+                for (const auto &child : children) {
+                    if (overlap(child)) {
+                        stack.push_back(child);
+                    }
+                }
+                continue;
+            }
+
+            // Test the triangle pairs of the two leaves.
+            const Node &leaf0 = nodes0[pair.first];
+            const Node &leaf1 = nodes1[pair.second];
+            const bool same_leaf = self && pair.first == pair.second;
+            for (int k0 = leaf0.begin_; k0 < leaf0.end_; ++k0) {
+                const int tidx0 = triangle_indices_[k0];
+                const Eigen::Vector3i &tria_p = triangles_[tidx0];
+                const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+                const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+                const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+                const Eigen::Vector3d bb_min1 = p0.cwiseMin(p1).cwiseMin(p2);
+                const Eigen::Vector3d bb_max1 = p0.cwiseMax(p1).cwiseMax(p2);
+                for (int k1 = same_leaf ? k0 + 1 : leaf1.begin_;
+                     k1 < leaf1.end_; ++k1) {
+                    const int tidx1 = other.triangle_indices_[k1];
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    if (self && ShareVertex(tria_p, tria_q)) {
+                        continue;
+                    }
+                    const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
+                    const Eigen::Vector3d bb_min2 =
+                            q0.cwiseMin(q1).cwiseMin(q2);
+                    const Eigen::Vector3d bb_max2 =
+                            q0.cwiseMax(q1).cwiseMax(q2);
+                    if (IntersectionTest::AABBAABB(bb_min1, bb_max1, bb_min2,
+                                                   bb_max2) &&
+                        (!test_triangles ||
+                         IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                              q1, q2))) {
+                        if (self) {
+                            result.emplace_back(std::min(tidx0, tidx1),
+                                                std::max(tidx0, tidx1));
+                        } else {
+                            result.emplace_back(tidx0, tidx1);
+                        }
+                        found = true;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Eigen::Vector2i> intersecting_triangles;
+    for (const auto &result : pair_results) {
+        intersecting_triangles.insert(intersecting_triangles.end(),
+                                      result.begin(), result.end());
+    }
+    std::sort(intersecting_triangles.begin(), intersecting_triangles.end(),
+              [](const Eigen::Vector2i &lhs, const Eigen::Vector2i &rhs) {
+                  return lhs(0) < rhs(0) ||
+                         (lhs(0) == rhs(0) && lhs(1) < rhs(1));
+              });
+    return intersecting_triangles;
+}
+
+}  // namespace geometry
+}  // namespace open3d
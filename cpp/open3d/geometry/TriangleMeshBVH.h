@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a mesh for
+/// triangle-triangle intersection queries.
+///
+/// The hierarchy is a binary tree of axis aligned bounding boxes built with
+/// the binned surface area heuristic (SAH). The top of the tree is built
+/// sequentially and the remaining subtrees are built in parallel. Queries
+/// traverse two trees simultaneously (or one tree against itself) and test
+/// only the triangle pairs of overlapping leaves, which are processed in
+/// parallel.
+///
+/// The BVH keeps a copy of the vertices and triangles, such that it can be
+/// built once and reused for several queries.
+class TriangleMeshBVH {
+public:
+    /// \brief Node of the hierarchy. Inner nodes have two children, leaves
+    /// reference the range [begin, end) of GetTriangleIndices().
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        /// Index of the children, -1 for leaves.
+        int left_ = -1;
+        int right_ = -1;
+        int begin_ = 0;
+        int end_ = 0;
+
+        bool IsLeaf() const { return left_ < 0; }
+    };
+
+    /// Max number of triangles per leaf.
+    static constexpr int kMaxLeafSize = 4;
+
+    /// \brief Default Constructor.
+    TriangleMeshBVH() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Triangle mesh from which the BVH is constructed.
+    TriangleMeshBVH(const TriangleMesh &mesh);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param vertices Vertices of the triangles.
+    /// \param triangles Triangles as indices into \p vertices.
+    TriangleMeshBVH(const std::vector<Eigen::Vector3d> &vertices,
+                    const std::vector<Eigen::Vector3i> &triangles);
+
+public:
+    /// Builds the BVH from a triangle mesh. Returns false if the mesh has no
+    /// triangles.
+    bool SetTriangleMesh(const TriangleMesh &mesh);
+    /// Builds the BVH from vertices and triangles.
+    bool SetTriangles(const std::vector<Eigen::Vector3d> &vertices,
+                      const std::vector<Eigen::Vector3i> &triangles);
+
+    /// \brief Returns all pairs of intersecting triangles (i, j), i < j,
+    /// sorted lexicographically. Triangles that share a vertex are not
+    /// tested, as in TriangleMesh::GetSelfIntersectingTriangles().
+    std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
+
+    /// \brief Tests if any two triangles that do not share a vertex
+    /// intersect. Stops at the first intersection.
+    bool IsSelfIntersecting() const;
+
+    /// \brief Returns all pairs (i, j) such that triangle i of this BVH
+    /// intersects triangle j of \p other, sorted lexicographically.
+    std::vector<Eigen::Vector2i> GetIntersectingTriangles(
+            const TriangleMeshBVH &other) const;
+
+    /// \brief Tests if any triangle of this BVH intersects a triangle of \p
+    /// other. Stops at the first intersection.
+    bool IsIntersecting(const TriangleMeshBVH &other) const;
+
+    /// \brief Returns all pairs (i, j) such that the bounding box of triangle
+    /// i of this BVH overlaps the bounding box of triangle j of \p other,
+    /// sorted lexicographically. This is a conservative superset of
+    /// GetIntersectingTriangles() for callers with their own predicates.
+    std::vector<Eigen::Vector2i> GetOverlappingTriangleBounds(
+            const TriangleMeshBVH &other) const;
+
+    /// Returns true if the BVH contains no triangles.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// Returns the nodes, the root is the first node.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+
+    /// Returns the triangle indices ordered by leaf.
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+private:
+    /// Computes the pairs of intersecting triangles of this BVH and \p
+    /// other, where \p other may be this BVH. If \p first_only, stops after
+    /// finding at least one pair. If not \p test_triangles, returns the pairs
+    /// with overlapping triangle bounds.
+    std::vector<Eigen::Vector2i> ComputeIntersectingTriangles(
+            const TriangleMeshBVH &other,
+            bool first_only,
+            bool test_triangles = true) const;
+
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Node> nodes_;
+    std::vector<int> triangle_indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -5,184 +5,309 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/TriangleMeshDeformation.h"
+
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
 
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshAdjacency.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+DeformAsRigidAsPossibleContext::DeformAsRigidAsPossibleContext(
+        const TriangleMesh &mesh,
         const std::vector<int> &constraint_vertex_indices,
-        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
-        size_t max_iter,
-        DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+        MeshBase::DeformAsRigidAsPossibleEnergy energy,
+        double smoothed_alpha)
+    : energy_model_(energy),
+      smoothed_alpha_(smoothed_alpha),
+      vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      constraint_vertex_indices_(constraint_vertex_indices) {
+    const int num_vertices = int(vertices_.size());
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+    const TriangleMeshAdjacency adjacency(triangles_, vertices_.size());
+    const std::vector<int> &edge_offsets = adjacency.GetEdgeTriangleOffsets();
+
+    // The weight of an edge is the mean cotangent of its opposite angles,
+    // clamped to zero.
+    std::vector<double> edge_weights(adjacency.GetNumEdges(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+        const Eigen::Vector2i &edge = adjacency.GetEdges()[eidx];
+        if (edge(0) == edge(1)) {
+            continue;
+        }
+        double weight_sum = 0;
+        for (int i = edge_offsets[eidx]; i < edge_offsets[eidx + 1]; ++i) {
+            const int tidx = adjacency.GetEdgeTriangles()[i];
+            const Eigen::Vector3i &triangle_edges =
+                    adjacency.GetTriangleEdges()[tidx];
+            const int k = triangle_edges(0) == eidx
+                                  ? 0
+                                  : (triangle_edges(1) == eidx ? 1 : 2);
+            const int v2 = triangles_[tidx]((k + 2) % 3);
+            const Eigen::Vector3d a = vertices_[edge(0)] - vertices_[v2];
+            const Eigen::Vector3d b = vertices_[edge(1)] - vertices_[v2];
+            weight_sum += a.dot(b) / (a.cross(b)).norm();
+        }
+        edge_weights[eidx] = std::max(
+                weight_sum / adjacency.GetNumEdgeTriangles(eidx), 0.0);
+    }
+
+    adjacency_offsets_ = adjacency.GetNeighborOffsets();
+    adjacency_indices_ = adjacency.GetNeighbors();
+    adjacency_weights_.resize(adjacency_indices_.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int k = 0; k < int(adjacency_indices_.size()); ++k) {
+        adjacency_weights_[k] = edge_weights[adjacency.GetNeighborEdges()[k]];
+    }
     utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
 
-    std::unordered_map<int, Eigen::Vector3d> constraints;
-    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
-                         idx < constraint_vertex_positions.size();
-         ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+    if (energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = mesh.GetSurfaceArea();
     }
 
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+    constraint_position_index_.assign(num_vertices, -1);
+    for (size_t idx = 0; idx < constraint_vertex_indices_.size(); ++idx) {
+        const int vidx = constraint_vertex_indices_[idx];
+        if (vidx < 0 || vidx >= num_vertices) {
+            utility::LogError("Invalid constraint vertex index {}.", vidx);
+        }
+        constraint_position_index_[vidx] = int(idx);
+    }
+    free_index_.assign(num_vertices, -1);
+    for (int i = 0; i < num_vertices; ++i) {
+        if (constraint_position_index_[i] < 0) {
+            free_index_[i] = int(free_vertices_.size());
+            free_vertices_.push_back(i);
+        }
     }
 
-    // Build system matrix L and its solver
+    // The system matrix L restricted to the free vertices. The constrained
+    // vertices are moved to the right hand side, which keeps the matrix
+    // symmetric positive definite and allows a Cholesky factorization.
     utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
     std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    triplets.reserve(free_vertices_.size() + adjacency_indices_.size());
+    for (int row = 0; row < int(free_vertices_.size()); ++row) {
+        const int i = free_vertices_[row];
+        double W = 0;
+        for (int k = adjacency_offsets_[i]; k < adjacency_offsets_[i + 1];
+             ++k) {
+            const int j = adjacency_indices_[k];
+            const double w = adjacency_weights_[k];
+            if (free_index_[j] >= 0) {
+                triplets.push_back(
+                        Eigen::Triplet<double>(row, free_index_[j], -w));
             }
+            W += w;
         }
+        // Vertices without weighted edges keep their position.
+        triplets.push_back(Eigen::Triplet<double>(row, row, W > 0 ? W : 1));
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(free_vertices_.size(),
+                                  free_vertices_.size());
     L.setFromTriplets(triplets.begin(), triplets.end());
     utility::LogDebug(
             "[DeformAsRigidAsPossible] done setting up system matrix L");
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
+    solver_.analyzePattern(L);
+    solver_.factorize(L);
+    if (solver_.info() != Eigen::Success) {
         utility::LogError("Failed to build solver (factorize)");
     } else {
         utility::LogDebug(
                 "[DeformAsRigidAsPossible] done setting up sparse solver");
     }
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+    Reset();
+}
+
+void DeformAsRigidAsPossibleContext::Reset() {
+    vertices_prime_ = vertices_;
+    Rs_.assign(vertices_.size(), Eigen::Matrix3d::Identity());
+    Rs_old_.clear();
+    has_solution_ = false;
+    energy_ = -1;
+}
+
+std::shared_ptr<TriangleMesh> DeformAsRigidAsPossibleContext::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter) {
+    if (constraint_vertex_positions.size() !=
+        constraint_vertex_indices_.size()) {
+        utility::LogError(
+                "Expected {} constraint vertex positions, but got {}.",
+                constraint_vertex_indices_.size(),
+                constraint_vertex_positions.size());
+    }
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    if (smoothed) {
+        Rs_old_.resize(vertices_.size());
+    }
+
     for (size_t iter = 0; iter < max_iter; ++iter) {
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            std::swap(Rs, Rs_old);
+        if (smoothed) {
+            std::swap(Rs_, Rs_old_);
         }
+        // The rotations of the previous solution are valid for the smoothing
+        // term, without it the first iteration starts from the rest pose.
+        UpdateRotations(smoothed && (iter > 0 || has_solution_));
+        UpdatePositions(constraint_vertex_positions);
+
+        energy_ = ComputeEnergy();
+        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
+                          iter, energy_);
+    }
+    if (max_iter > 0) {
+        has_solution_ = true;
+    }
 
+    auto prime = std::make_shared<TriangleMesh>();
+    prime->vertices_ = vertices_prime_;
+    prime->triangles_ = triangles_;
+    return prime;
+}
+
+void DeformAsRigidAsPossibleContext::UpdateRotations(bool smooth) {
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update rotations
-            Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
-            Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
-            int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    R += Rs_old[j];
-                }
-                n_nbs++;
-            }
-            if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
-                iter > 0 && n_nbs > 0) {
-                S = 2 * S +
-                    (4 * smoothed_alpha * surface_area / n_nbs) * R.transpose();
-            }
-            Eigen::JacobiSVD<Eigen::Matrix3d> svd(
-                    S, Eigen::ComputeFullU | Eigen::ComputeFullV);
-            Eigen::Matrix3d U = svd.matrixU();
-            Eigen::Matrix3d V = svd.matrixV();
-            Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
-            // ensure rotation:
-            // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
-            Rs[i] = V * D.asDiagonal() * U.transpose();
-            if (Rs[i].determinant() <= 0) {
-                utility::LogError(
-                        "something went wrong with "
-                        "updating R");
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+        Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+        int n_nbs = 0;
+        for (int k = adjacency_offsets_[i]; k < adjacency_offsets_[i + 1];
+             ++k) {
+            const int j = adjacency_indices_[k];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = vertices_prime_[i] - vertices_prime_[j];
+            S += adjacency_weights_[k] * (e0 * e1.transpose());
+            if (smooth) {
+                R += Rs_old_[j];
             }
+            n_nbs++;
+        }
+        if (smooth && n_nbs > 0) {
+            S = 2 * S +
+                (4 * smoothed_alpha_ * surface_area_ / n_nbs) * R.transpose();
+        }
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Matrix3d U = svd.matrixU();
+        Eigen::Matrix3d V = svd.matrixV();
+        Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+        // ensure rotation:
+        // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+        Rs_[i] = V * D.asDiagonal() * U.transpose();
+        if (Rs_[i].determinant() <= 0) {
+            utility::LogError(
+                    "something went wrong with "
+                    "updating R");
         }
+    }
+}
 
+void DeformAsRigidAsPossibleContext::UpdatePositions(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions) {
+    const int num_free = int(free_vertices_.size());
+    Eigen::MatrixX3d b(num_free, 3);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update Positions
-            Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
-                }
+    for (int row = 0; row < num_free; ++row) {
+        const int i = free_vertices_[row];
+        Eigen::Vector3d bi(0, 0, 0);
+        double W = 0;
+        for (int k = adjacency_offsets_[i]; k < adjacency_offsets_[i + 1];
+             ++k) {
+            const int j = adjacency_indices_[k];
+            const double w = adjacency_weights_[k];
+            bi += w / 2 * ((Rs_[i] + Rs_[j]) * (vertices_[i] - vertices_[j]));
+            if (free_index_[j] < 0) {
+                bi += w * constraint_vertex_positions
+                                  [constraint_position_index_[j]];
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
+            W += w;
         }
+        if (W <= 0) {
+            bi = vertices_prime_[i];
+        }
+        b.row(row) = bi.transpose();
+    }
+
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError("Cholesky solve failed");
-            }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
-            }
+    for (int comp = 0; comp < 3; ++comp) {
+        Eigen::VectorXd p_prime = solver_.solve(b.col(comp));
+        if (solver_.info() != Eigen::Success) {
+            utility::LogError("Cholesky solve failed");
+        }
+        for (int row = 0; row < num_free; ++row) {
+            vertices_prime_[free_vertices_[row]](comp) = p_prime(row);
         }
+    }
+    for (size_t idx = 0; idx < constraint_vertex_indices_.size(); ++idx) {
+        const int vidx = constraint_vertex_indices_[idx];
+        vertices_prime_[vidx] =
+                constraint_vertex_positions[constraint_position_index_[vidx]];
+    }
+}
 
-        // Compute energy and log
-        double energy = 0;
-        double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    reg += (Rs[i] - Rs[j]).squaredNorm();
-                }
+double DeformAsRigidAsPossibleContext::ComputeEnergy() const {
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    double energy = 0;
+    double reg = 0;
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int k = adjacency_offsets_[i]; k < adjacency_offsets_[i + 1];
+             ++k) {
+            const int j = adjacency_indices_[k];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = vertices_prime_[i] - vertices_prime_[j];
+            Eigen::Vector3d diff = e1 - Rs_[i] * e0;
+            energy += adjacency_weights_[k] * diff.squaredNorm();
+            if (smoothed) {
+                reg += (Rs_[i] - Rs_[j]).squaredNorm();
             }
         }
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            energy = energy + smoothed_alpha * surface_area * reg;
-        }
-        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
-                          iter, energy);
     }
+    if (smoothed) {
+        energy = energy + smoothed_alpha_ * surface_area_ * reg;
+    }
+    return energy;
+}
 
-    return prime;
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    const size_t num_constraints = std::min(constraint_vertex_indices.size(),
+                                            constraint_vertex_positions.size());
+    DeformAsRigidAsPossibleContext context(
+            *this,
+            std::vector<int>(constraint_vertex_indices.begin(),
+                             constraint_vertex_indices.begin() +
+                                     num_constraints),
+            energy_model, smoothed_alpha);
+    return context.Deform(
+            std::vector<Eigen::Vector3d>(constraint_vertex_positions.begin(),
+                                         constraint_vertex_positions.begin() +
+                                                 num_constraints),
+            max_iter);
 }
 
 }  // namespace geometry
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCholesky>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/MeshBase.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class DeformAsRigidAsPossibleContext
+///
+/// \brief Reusable state for repeated as-rigid-as-possible deformations of
+/// the same mesh with the same constrained vertices, see
+/// TriangleMesh::DeformAsRigidAsPossible.
+///
+/// The constructor computes the vertex adjacency and the cotangent weights
+/// once and factorizes the system matrix restricted to the free vertices.
+/// Each call to Deform() only updates the right hand side and reuses the
+/// factorization. The positions and rotations of the previous call are used
+/// as the initial solution of the next call, such that for small handle
+/// movements few iterations are needed.
+class DeformAsRigidAsPossibleContext {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The mesh in its rest pose. The context keeps a copy of
+    /// its vertices and triangles.
+    /// \param constraint_vertex_indices Indices of the vertices whose
+    /// positions are given in each call to Deform().
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    DeformAsRigidAsPossibleContext(
+            const TriangleMesh &mesh,
+            const std::vector<int> &constraint_vertex_indices,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01);
+
+public:
+    /// \brief Deforms the mesh such that the constrained vertices are at
+    /// \p constraint_vertex_positions, starting from the result of the
+    /// previous call.
+    ///
+    /// \param constraint_vertex_positions Positions of the constrained
+    /// vertices, in the order of the constraint_vertex_indices of the
+    /// constructor.
+    /// \param max_iter Number of iterations to minimize the energy.
+    /// \return The deformed TriangleMesh.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter);
+
+    /// Discards the previous solution, the next call to Deform() starts
+    /// from the rest pose.
+    void Reset();
+
+    /// Returns the vertex positions of the last solution.
+    const std::vector<Eigen::Vector3d> &GetVertices() const {
+        return vertices_prime_;
+    }
+
+    /// Returns the per vertex rotations of the last solution.
+    const std::vector<Eigen::Matrix3d> &GetRotations() const { return Rs_; }
+
+    /// Returns the energy after the last iteration of the last call to
+    /// Deform(), or -1 if Deform() has not been called.
+    double GetEnergy() const { return energy_; }
+
+    /// Returns the number of constrained vertices.
+    size_t GetNumConstraints() const {
+        return constraint_vertex_indices_.size();
+    }
+
+private:
+    void UpdateRotations(bool smooth);
+    void UpdatePositions(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions);
+    double ComputeEnergy() const;
+
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_model_;
+    double smoothed_alpha_;
+    double surface_area_ = -1;
+
+    /// Rest pose.
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+
+    /// Vertex adjacency in compressed row format with the cotangent weight
+    /// of each edge.
+    std::vector<int> adjacency_offsets_;
+    std::vector<int> adjacency_indices_;
+    std::vector<double> adjacency_weights_;
+
+    /// Constrained vertex indices as passed to the constructor, and for each
+    /// vertex the index into the constraint positions or -1. If a vertex is
+    /// constrained several times, the last position is used.
+    std::vector<int> constraint_vertex_indices_;
+    std::vector<int> constraint_position_index_;
+    /// For each vertex its row in the reduced system or -1 if the vertex is
+    /// constrained.
+    std::vector<int> free_index_;
+    std::vector<int> free_vertices_;
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+
+    std::vector<Eigen::Vector3d> vertices_prime_;
+    std::vector<Eigen::Matrix3d> Rs_;
+    std::vector<Eigen::Matrix3d> Rs_old_;
+    bool has_solution_ = false;
+    double energy_ = -1;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -6,15 +6,63 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshAdjacency.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Returns for each edge of \p adjacency the index of its new vertex,
+/// starting at \p num_vertices. The new vertices are numbered in the order in
+/// which the triangles use the edges.
+std::vector<int> ComputeEdgeVertices(const TriangleMeshAdjacency& adjacency,
+                                     int num_vertices) {
+    std::vector<int> edge_vertices(adjacency.GetNumEdges(), -1);
+    int vidx = num_vertices;
+    for (const Eigen::Vector3i& triangle_edges :
+         adjacency.GetTriangleEdges()) {
+        for (int k = 0; k < 3; ++k) {
+            if (edge_vertices[triangle_edges(k)] < 0) {
+                edge_vertices[triangle_edges(k)] = vidx++;
+            }
+        }
+    }
+    return edge_vertices;
+}
+
+/// Splits each triangle of \p triangles in four triangles, using the new
+/// vertices of its edges.
+std::vector<Eigen::Vector3i> SubdivideTriangles(
+        const std::vector<Eigen::Vector3i>& triangles,
+        const TriangleMeshAdjacency& adjacency,
+        const std::vector<int>& edge_vertices) {
+    std::vector<Eigen::Vector3i> new_triangles(4 * triangles.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        const auto& triangle = triangles[tidx];
+        const auto& triangle_edges = adjacency.GetTriangleEdges()[tidx];
+        int vidx0 = triangle(0);
+        int vidx1 = triangle(1);
+        int vidx2 = triangle(2);
+        int vidx01 = edge_vertices[triangle_edges(0)];
+        int vidx12 = edge_vertices[triangle_edges(1)];
+        int vidx20 = edge_vertices[triangle_edges(2)];
+        new_triangles[tidx * 4 + 0] = Eigen::Vector3i(vidx0, vidx01, vidx20);
+        new_triangles[tidx * 4 + 1] = Eigen::Vector3i(vidx01, vidx1, vidx12);
+        new_triangles[tidx * 4 + 2] = Eigen::Vector3i(vidx12, vidx2, vidx20);
+        new_triangles[tidx * 4 + 3] = Eigen::Vector3i(vidx01, vidx12, vidx20);
+    }
+    return new_triangles;
+}
+
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -31,59 +79,43 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex reference to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
+        const TriangleMeshAdjacency adjacency(mesh->triangles_,
+                                              mesh->vertices_.size());
+        const std::vector<int> edge_vertices =
+                ComputeEdgeVertices(adjacency, int(mesh->vertices_.size()));
+        const size_t n_new_vertices =
+                mesh->vertices_.size() + adjacency.GetNumEdges();
+        mesh->vertices_.resize(n_new_vertices);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(n_new_vertices);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(n_new_vertices);
+        }
+
+        // Midpoint of each edge.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+            const int min = adjacency.GetEdges()[eidx](0);
+            const int max = adjacency.GetEdges()[eidx](1);
+            const int vidx01 = edge_vertices[eidx];
+            mesh->vertices_[vidx01] =
+                    0.5 * (mesh->vertices_[min] + mesh->vertices_[max]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx01] =
+                        0.5 * (mesh->vertex_normals_[min] +
+                               mesh->vertex_normals_[max]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx01] =
+                        0.5 * (mesh->vertex_colors_[min] +
+                               mesh->vertex_colors_[max]);
+            }
         }
-        mesh->triangles_ = new_triangles;
+        mesh->triangles_ = SubdivideTriangles(mesh->triangles_, adjacency,
+                                              edge_vertices);
     }
 
     if (HasTriangleNormals()) {
@@ -100,13 +132,6 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
@@ -114,34 +139,37 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
     auto UpdateVertex = [&](int vidx,
                             const std::shared_ptr<TriangleMesh>& old_mesh,
                             std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
+                            const TriangleMeshAdjacency& adjacency) {
+        const int begin = adjacency.GetNeighborOffsets()[vidx];
+        const int end = adjacency.GetNeighborOffsets()[vidx + 1];
+        const int n_nbs = end - begin;
+
         // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
+        int n_boundary_nbs = 0;
+        for (int k = begin; k < end; ++k) {
+            if (adjacency.GetNumEdgeTriangles(
+                        adjacency.GetNeighborEdges()[k]) == 1) {
+                n_boundary_nbs++;
             }
         }
 
         // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
+        if (n_boundary_nbs > 2) {
             utility::LogWarning(
                     "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
                     "mesh is not manifold.");
         }
 
         double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
+        if (n_boundary_nbs >= 2) {
             beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
+            alpha = 1. - n_boundary_nbs * beta;
+        } else if (n_nbs == 3) {
             beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
+            alpha = 1. - n_nbs * beta;
         } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+            beta = 3. / (8. * n_nbs);
+            alpha = 1. - n_nbs * beta;
         }
 
         new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
@@ -154,7 +182,13 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                     alpha * old_mesh->vertex_colors_[vidx];
         }
 
-        auto Update = [&](int nb) {
+        for (int k = begin; k < end; ++k) {
+            if (n_boundary_nbs >= 2 &&
+                adjacency.GetNumEdgeTriangles(
+                        adjacency.GetNeighborEdges()[k]) != 1) {
+                continue;
+            }
+            const int nb = adjacency.GetNeighbors()[k];
             new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
             if (has_vert_normal) {
                 new_mesh->vertex_normals_[vidx] +=
@@ -164,133 +198,74 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 new_mesh->vertex_colors_[vidx] +=
                         beta * old_mesh->vertex_colors_[nb];
             }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
-            }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
-            }
         }
     };
 
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
+    auto SubdivideEdge = [&](int eidx,
                              const std::shared_ptr<TriangleMesh>& old_mesh,
                              std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
-                    old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal{0, 0, 0};
+                             const TriangleMeshAdjacency& adjacency,
+                             int vidx01) {
+        const int vidx0 = adjacency.GetEdges()[eidx](0);
+        const int vidx1 = adjacency.GetEdges()[eidx](1);
+        Eigen::Vector3d new_vert =
+                old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
+        Eigen::Vector3d new_normal{0, 0, 0};
+        if (has_vert_normal) {
+            new_normal = old_mesh->vertex_normals_[vidx0] +
+                         old_mesh->vertex_normals_[vidx1];
+        }
+        Eigen::Vector3d new_color{0, 0, 0};
+        if (has_vert_color) {
+            new_color = old_mesh->vertex_colors_[vidx0] +
+                        old_mesh->vertex_colors_[vidx1];
+        }
+
+        const int n_adjacent_trias = adjacency.GetNumEdgeTriangles(eidx);
+        if (n_adjacent_trias < 2) {
+            new_vert *= 0.5;
             if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
+                new_normal *= 0.5;
             }
-            Eigen::Vector3d new_color{0, 0, 0};
             if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
+                new_color *= 0.5;
             }
-
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
-                }
-                if (has_vert_color) {
-                    new_color *= 0.5;
-                }
-            } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
+        } else {
+            new_vert *= 3. / 8.;
+            if (has_vert_normal) {
+                new_normal *= 3. / 8.;
+            }
+            if (has_vert_color) {
+                new_color *= 3. / 8.;
+            }
+            double scale = 1. / (4. * n_adjacent_trias);
+            const int offset = adjacency.GetEdgeTriangleOffsets()[eidx];
+            for (int i = offset; i < offset + n_adjacent_trias; ++i) {
+                const int tidx = adjacency.GetEdgeTriangles()[i];
+                const auto& tria = old_mesh->triangles_[tidx];
+                int vidx2 = (tria(0) != vidx0 && tria(0) != vidx1)
                                     ? tria(0)
                                     : ((tria(1) != vidx0 && tria(1) != vidx1)
                                                ? tria(1)
                                                : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
-                    if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
-                    }
-                    if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
-                    }
+                new_vert += scale * old_mesh->vertices_[vidx2];
+                if (has_vert_normal) {
+                    new_normal += scale * old_mesh->vertex_normals_[vidx2];
+                }
+                if (has_vert_color) {
+                    new_color += scale * old_mesh->vertex_colors_[vidx2];
                 }
             }
-
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
-            }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
         }
-    };
 
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+        new_mesh->vertices_[vidx01] = new_vert;
+        if (has_vert_normal) {
+            new_mesh->vertex_normals_[vidx01] = new_normal;
         }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
+        if (has_vert_color) {
+            new_mesh->vertex_colors_[vidx01] = new_color;
+        }
+    };
 
     auto old_mesh = std::make_shared<TriangleMesh>();
     old_mesh->vertices_ = vertices_;
@@ -299,9 +274,21 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
     old_mesh->triangles_ = triangles_;
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const TriangleMeshAdjacency adjacency(old_mesh->triangles_,
+                                              old_mesh->vertices_.size());
+        if (iter == 0) {
+            for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+                if (adjacency.GetNumEdgeTriangles(eidx) > 2) {
+                    utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+                    break;
+                }
+            }
+        }
+        const std::vector<int> edge_vertices = ComputeEdgeVertices(
+                adjacency, int(old_mesh->vertices_.size()));
+
         size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
+                old_mesh->vertices_.size() + adjacency.GetNumEdges();
         auto new_mesh = std::make_shared<TriangleMesh>();
         new_mesh->vertices_.resize(n_new_vertices);
         if (has_vert_normal) {
@@ -310,43 +297,23 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
         if (has_vert_color) {
             new_mesh->vertex_colors_.resize(n_new_vertices);
         }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
 
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < int(old_mesh->vertices_.size()); ++vidx) {
+            UpdateVertex(vidx, old_mesh, new_mesh, adjacency);
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+            SubdivideEdge(eidx, old_mesh, new_mesh, adjacency,
+                          edge_vertices[eidx]);
         }
 
+        new_mesh->triangles_ = SubdivideTriangles(old_mesh->triangles_,
+                                                  adjacency, edge_vertices);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (HasTriangleNormals()) {
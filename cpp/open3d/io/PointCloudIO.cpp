@@ -66,6 +66,19 @@ static const std::unordered_map<
                 {"mem::xyz", WritePointCloudInMemoryToXYZ},
         };
 
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                const std::string &,
+                size_t,
+                const std::function<bool(const geometry::PointCloud &)> &)>>
+        file_extension_to_pointcloud_chunk_read_function{
+                {"xyz", ReadPointCloudInChunksFromXYZ},
+                {"xyzn", ReadPointCloudInChunksFromXYZN},
+                {"xyzrgb", ReadPointCloudInChunksFromXYZRGB},
+                {"ply", ReadPointCloudInChunksFromPLY},
+        };
+
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
         const std::string &filename,
         const std::string &format,
@@ -168,6 +181,35 @@ bool ReadPointCloud(const unsigned char *buffer,
     return success;
 }
 
+bool ReadPointCloudInChunks(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback,
+        const std::string &format) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    if (chunk_size == 0) {
+        utility::LogWarning(
+                "Read geometry::PointCloud in chunks failed: chunk_size is "
+                "0.");
+        return false;
+    }
+
+    auto map_itr =
+            file_extension_to_pointcloud_chunk_read_function.find(file_format);
+    if (map_itr == file_extension_to_pointcloud_chunk_read_function.end()) {
+        utility::LogWarning(
+                "Read geometry::PointCloud in chunks failed: unsupported file "
+                "extension for {} (format: {}).",
+                filename, format);
+        return false;
+    }
+    return map_itr->second(filename, chunk_size, callback);
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
@@ -84,6 +84,20 @@ bool ReadPointCloud(const unsigned char *buffer,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params = {});
 
+/// \brief Reads the PointCloud \p filename in chunks of at most
+/// \p chunk_size points, so that files larger than the available memory can
+/// be processed.
+///
+/// \p callback is called for every chunk in file order and may stop reading
+/// by returning false. Supported formats are xyz, xyzn, xyzrgb and ply.
+/// \return true if the file has been read until the end or until
+/// \p callback returned false, false otherwise.
+bool ReadPointCloudInChunks(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback,
+        const std::string &format = "auto");
+
 /// \struct WritePointCloudOption
 /// \brief Optional parameters to WritePointCloud
 struct WritePointCloudOption {
@@ -185,6 +199,11 @@ bool WritePointCloudInMemoryToXYZ(unsigned char *&buffer,
                                   const geometry::PointCloud &pointcloud,
                                   const WritePointCloudOption &params);
 
+bool ReadPointCloudInChunksFromXYZ(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback);
+
 bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params);
@@ -193,6 +212,11 @@ bool WritePointCloudToXYZN(const std::string &filename,
                            const geometry::PointCloud &pointcloud,
                            const WritePointCloudOption &params);
 
+bool ReadPointCloudInChunksFromXYZN(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback);
+
 bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               const ReadPointCloudOption &params);
@@ -201,6 +225,11 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
                              const geometry::PointCloud &pointcloud,
                              const WritePointCloudOption &params);
 
+bool ReadPointCloudInChunksFromXYZRGB(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback);
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -209,6 +238,11 @@ bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudInChunksFromPLY(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback);
+
 bool ReadPointCloudFromPCD(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
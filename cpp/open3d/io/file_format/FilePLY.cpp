@@ -7,6 +7,8 @@
 
 #include <rply.h>
 
+#include <algorithm>
+
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/LineSetIO.h"
 #include "open3d/io/PointCloudIO.h"
@@ -93,6 +95,104 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_pointcloud_reader
 
+namespace ply_pointcloud_chunk_reader {
+
+struct PLYReaderState {
+    const std::function<bool(const geometry::PointCloud &)> *callback;
+    geometry::PointCloud chunk;
+    size_t chunk_size;
+    // Number of points before the current chunk.
+    long chunk_begin;
+    long vertex_index;
+    long vertex_num;
+    long normal_index;
+    long normal_num;
+    long color_index;
+    long color_num;
+    bool stopped;
+};
+
+// Hands the current chunk to the callback once all properties of its last
+// vertex have been read. The properties of a vertex are stored consecutively,
+// so no property of the next chunk has been read at this point.
+int FlushIfComplete(PLYReaderState *state_ptr) {
+    const long chunk_end =
+            state_ptr->chunk_begin + static_cast<long>(state_ptr->chunk_size);
+    const bool complete =
+            state_ptr->vertex_index == chunk_end &&
+            (state_ptr->normal_num <= 0 ||
+             state_ptr->normal_index == chunk_end) &&
+            (state_ptr->color_num <= 0 || state_ptr->color_index == chunk_end);
+    if (!complete) {
+        return 1;
+    }
+    if (!(*state_ptr->callback)(state_ptr->chunk)) {
+        state_ptr->stopped = true;
+        return 0;
+    }
+    state_ptr->chunk_begin = chunk_end;
+    return 1;
+}
+
+int ReadVertexCallback(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    if (state_ptr->vertex_index >= state_ptr->vertex_num) {
+        return 0;
+    }
+
+    double value = ply_get_argument_value(argument);
+    state_ptr->chunk.points_[state_ptr->vertex_index -
+                             state_ptr->chunk_begin](index) = value;
+    if (index == 2) {  // reading 'z'
+        state_ptr->vertex_index++;
+        return FlushIfComplete(state_ptr);
+    }
+    return 1;
+}
+
+int ReadNormalCallback(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    if (state_ptr->normal_index >= state_ptr->normal_num) {
+        return 0;
+    }
+
+    double value = ply_get_argument_value(argument);
+    state_ptr->chunk.normals_[state_ptr->normal_index -
+                              state_ptr->chunk_begin](index) = value;
+    if (index == 2) {  // reading 'nz'
+        state_ptr->normal_index++;
+        return FlushIfComplete(state_ptr);
+    }
+    return 1;
+}
+
+int ReadColorCallback(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    if (state_ptr->color_index >= state_ptr->color_num) {
+        return 0;
+    }
+
+    double value = ply_get_argument_value(argument);
+    state_ptr->chunk.colors_[state_ptr->color_index -
+                             state_ptr->chunk_begin](index) = value / 255.0;
+    if (index == 2) {  // reading 'blue'
+        state_ptr->color_index++;
+        return FlushIfComplete(state_ptr);
+    }
+    return 1;
+}
+
+}  // namespace ply_pointcloud_chunk_reader
+
 namespace ply_trianglemesh_reader {
 
 struct PLYReaderState {
@@ -440,6 +540,85 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
+bool ReadPointCloudInChunksFromPLY(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback) {
+    using namespace ply_pointcloud_chunk_reader;
+
+    p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}",
+                            filename.c_str());
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYReaderState state;
+    state.callback = &callback;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
+                                       ReadNormalCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+
+    state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
+                                      ReadColorCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+
+    if (state.vertex_num <= 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    // The chunk buffers keep their size, the last chunk is truncated below.
+    state.chunk_size = std::min(chunk_size, size_t(state.vertex_num));
+    state.chunk_begin = 0;
+    state.vertex_index = 0;
+    state.normal_index = 0;
+    state.color_index = 0;
+    state.stopped = false;
+    state.chunk.points_.resize(state.chunk_size);
+    if (state.normal_num > 0) {
+        state.chunk.normals_.resize(state.chunk_size);
+    }
+    if (state.color_num > 0) {
+        state.chunk.colors_.resize(state.chunk_size);
+    }
+
+    if (!ply_read(ply_file) && !state.stopped) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}",
+                            filename);
+        ply_close(ply_file);
+        return false;
+    }
+    ply_close(ply_file);
+
+    const size_t num_remaining =
+            static_cast<size_t>(state.vertex_index - state.chunk_begin);
+    if (!state.stopped && num_remaining > 0) {
+        state.chunk.points_.resize(num_remaining);
+        if (!state.chunk.normals_.empty()) {
+            state.chunk.normals_.resize(num_remaining);
+        }
+        if (!state.chunk.colors_.empty()) {
+            state.chunk.colors_.resize(num_remaining);
+        }
+        callback(state.chunk);
+    }
+    return true;
+}
+
 bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params) {
@@ -87,6 +87,42 @@ bool ReadPointCloudInMemoryFromXYZ(const unsigned char *buffer,
     }
 }
 
+bool ReadPointCloudInChunksFromXYZ(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback) {
+    try {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "r")) {
+            utility::LogWarning("Read XYZ failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+
+        geometry::PointCloud chunk;
+        double x, y, z;
+        const char *line_buffer;
+        while ((line_buffer = file.ReadLine())) {
+            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
+                chunk.points_.push_back(Eigen::Vector3d(x, y, z));
+            }
+            if (chunk.points_.size() == chunk_size) {
+                if (!callback(chunk)) {
+                    return true;
+                }
+                chunk.Clear();
+            }
+        }
+        if (!chunk.IsEmpty()) {
+            callback(chunk);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read XYZ failed with exception: {}", e.what());
+        return false;
+    }
+}
+
 bool WritePointCloudToXYZ(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params) {
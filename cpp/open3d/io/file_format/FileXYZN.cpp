@@ -56,6 +56,44 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
     }
 }
 
+bool ReadPointCloudInChunksFromXYZN(
+        const std::string &filename,
+        size_t chunk_size,
+        const std::function<bool(const geometry::PointCloud &)> &callback) {
+    try {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "r")) {
+            utility::LogWarning("Read XYZN failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+
+        geometry::PointCloud chunk;
+        double x, y, z, nx, ny, nz;
+        const char *line_buffer;
+        while ((line_buffer = file.ReadLine())) {
+            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
+                       &ny, &nz) == 6) {
+                chunk.points_.push_back(Eigen::Vector3d(x, y, z));
+                chunk.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
+            }
+            if (chunk.points_.size() == chunk_size) {
+                if (!callback(chunk)) {
+                    return true;
+                }
+                chunk.Clear();
+            }
+        }
+        if (!chunk.IsEmpty()) {
+            callback(chunk);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read XYZN failed with exception: {}", e.what());
+        return false;
+    }
+}
+
 bool WritePointCloudToXYZN(const std::string &filename,
                            const geometry::PointCloud &pointcloud,
                            const WritePointCloudOption &params) {
@@ -79,8 +79,8 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
 
 static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const std::vector<size_t> &offsets,
+        const std::vector<int> &indices) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
 #pragma omp parallel for schedule(static) \
@@ -88,12 +88,12 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const size_t begin = offsets[i];
+        const size_t end = offsets[i + 1];
+        if (end - begin > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            double hist_incr = 100.0 / (double)(end - begin - 1);
+            for (size_t k = begin + 1; k < end; k++) {
                 // skip the point itself, compute histogram
                 auto pf = ComputePairFeatures(point, normal,
                                               input.points_[indices[k]],
@@ -125,20 +125,28 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     if (!input.HasNormals()) {
         utility::LogError("Failed because input point cloud has no normal.");
     }
+    // The same neighborhoods are used by the SPFH and the FPFH passes, so
+    // they are searched only once.
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    kdtree.BatchSearch(Eigen::Map<const Eigen::MatrixXd>(
+                               (const double *)input.points_.data(), 3,
+                               input.points_.size()),
+                       search_param, offsets, indices, distance2);
+    auto spfh = ComputeSPFHFeature(input, offsets, indices);
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const size_t begin = offsets[i];
+        const size_t end = offsets[i + 1];
+        if (end - begin > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+            for (size_t k = begin + 1; k < end; k++) {
                 // skip the point itself
                 double dist = distance2[k];
                 if (dist == 0.0) continue;
@@ -178,25 +186,22 @@ CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
                                int(target_features.data_.cols())};
     std::vector<CorrespondenceSet> corres(num_searches);
 
-    const int kMaxThreads = utility::EstimateMaxThreads();
-    const int kOuterThreads = std::min(kMaxThreads, num_searches);
-    const int kInnerThreads = std::max(kMaxThreads / num_searches, 1);
-    (void)kOuterThreads;  // Avoids compiler warning if OpenMP is disabled
-    (void)kInnerThreads;
-#pragma omp parallel for num_threads(kOuterThreads)
+    // Each batched search is parallelized internally, so the searches in the
+    // two directions are run one after another.
     for (int k = 0; k < num_searches; ++k) {
         geometry::KDTreeFlann kdtree(features[1 - k]);
 
         int num_pts_k = num_pts[k];
+        std::vector<size_t> offsets;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.BatchSearchKNN(features[k].get().data_, 1, offsets, indices,
+                              distance2);
         corres[k] = CorrespondenceSet(num_pts_k);
-#pragma omp parallel for num_threads(kInnerThreads)
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
         for (int i = 0; i < num_pts_k; i++) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-
-            kdtree.SearchKNN(Eigen::VectorXd(features[k].get().data_.col(i)), 1,
-                             corres_tmp, dist_tmp);
-            int j = corres_tmp[0];
+            int j = offsets[i + 1] > offsets[i] ? indices[offsets[i]] : 0;
             corres[k][i] = Eigen::Vector2i(i, j);
         }
     }
@@ -0,0 +1,755 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/LinearOctree.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/RadixSort.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Number of elements per block of the parallel primitives below.
+constexpr int64_t kBlockSize = 1 << 16;
+
+int64_t NumBlocks(int64_t n) {
+    return std::max<int64_t>(1, (n + kBlockSize - 1) / kBlockSize);
+}
+
+/// Calls write(i, j) for all i in [0, n) with keep(i), where j is the number
+/// of kept elements before i. Returns the number of kept elements.
+template <typename Keep, typename Write>
+int64_t ParallelCompact(int64_t n, const Keep &keep, const Write &write) {
+    const int64_t num_blocks = NumBlocks(n);
+    std::vector<int64_t> offsets(num_blocks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t end = std::min(n, (b + 1) * kBlockSize);
+        int64_t count = 0;
+        for (int64_t i = b * kBlockSize; i < end; ++i) {
+            count += keep(i) ? 1 : 0;
+        }
+        offsets[b + 1] = count;
+    }
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        offsets[b + 1] += offsets[b];
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t end = std::min(n, (b + 1) * kBlockSize);
+        int64_t j = offsets[b];
+        for (int64_t i = b * kBlockSize; i < end; ++i) {
+            if (keep(i)) {
+                write(i, j++);
+            }
+        }
+    }
+    return offsets[num_blocks];
+}
+
+/// Finds the runs of equal keys in the sorted sequence key(0), ...,
+/// key(n - 1). Returns the key of each run in \p unique and the start of each
+/// run in \p starts, including the end n.
+template <typename Key>
+void FindRuns(int64_t n,
+              const Key &key,
+              std::vector<uint64_t> &unique,
+              std::vector<int64_t> &starts) {
+    starts.resize(n + 1);
+    const int64_t num_runs = ParallelCompact(
+            n, [&](int64_t i) { return i == 0 || key(i) != key(i - 1); },
+            [&](int64_t i, int64_t j) { starts[j] = i; });
+    starts.resize(num_runs + 1);
+    starts[num_runs] = n;
+    unique.resize(num_runs);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t j = 0; j < num_runs; ++j) {
+        unique[j] = key(starts[j]);
+    }
+}
+
+/// Computes the Morton code of the leaf containing \p point by descending
+/// from the root with the same comparisons as
+/// open3d::geometry::OctreeInternalNode::GetInsertionNodeInfo(). Returns
+/// false if the point is outside of [origin, origin + size).
+template <typename scalar_t>
+inline bool ComputeLeafCode(const scalar_t *point,
+                            const double *origin,
+                            double size,
+                            int max_depth,
+                            uint64_t &code) {
+    const double p[3] = {double(point[0]), double(point[1]),
+                         double(point[2])};
+    double o[3] = {origin[0], origin[1], origin[2]};
+    for (int k = 0; k < 3; ++k) {
+        if (!(o[k] <= p[k] && p[k] < o[k] + size)) {
+            return false;
+        }
+    }
+    code = 0;
+    for (int d = 0; d < max_depth; ++d) {
+        size /= 2.0;
+        uint64_t child_index = 0;
+        for (int k = 0; k < 3; ++k) {
+            if (!(p[k] < o[k] + size)) {
+                child_index |= uint64_t(1) << k;
+                o[k] += size;
+            }
+        }
+        code = (code << 3) | child_index;
+    }
+    return true;
+}
+
+template <typename scalar_t>
+void ComputeLeafCodes(const scalar_t *points,
+                      int64_t num_points,
+                      const double *origin,
+                      double size,
+                      int max_depth,
+                      std::vector<uint64_t> &codes,
+                      std::vector<uint8_t> &valid) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        valid[i] = ComputeLeafCode(points + 3 * i, origin, size, max_depth,
+                                   codes[i]);
+    }
+}
+
+/// Returns the integer cell coordinates of the node with Morton code \p code
+/// at \p depth.
+inline Eigen::Vector3i DecodeCell(uint64_t code, int depth) {
+    Eigen::Vector3i cell(0, 0, 0);
+    for (int d = 0; d < depth; ++d) {
+        for (int k = 0; k < 3; ++k) {
+            cell(k) |= int((code >> (3 * d + k)) & 1) << d;
+        }
+    }
+    return cell;
+}
+
+inline uint64_t EncodeCell(const Eigen::Vector3i &cell, int depth) {
+    uint64_t code = 0;
+    for (int d = 0; d < depth; ++d) {
+        for (int k = 0; k < 3; ++k) {
+            code |= uint64_t((cell(k) >> d) & 1) << (3 * d + k);
+        }
+    }
+    return code;
+}
+
+void CheckMaxDepth(int max_depth) {
+    if (max_depth < 0 || max_depth > LinearOctree::kMaxDepth) {
+        utility::LogError("max_depth must be in [0, {}], but got {}.",
+                          LinearOctree::kMaxDepth, max_depth);
+    }
+}
+
+}  // namespace
+
+void LinearOctree::BuildLevels(const std::vector<uint64_t> &keys,
+                               std::vector<int64_t> &leaf_starts) {
+    const int max_depth = max_depth_;
+    std::vector<std::vector<uint64_t>> level_codes(max_depth + 1);
+    // Start of each node in the codes of the level below, or in keys for
+    // the leaves, including the end.
+    std::vector<std::vector<int64_t>> level_starts(max_depth + 1);
+    FindRuns(
+            static_cast<int64_t>(keys.size()),
+            [&](int64_t i) { return keys[i]; }, level_codes[max_depth],
+            level_starts[max_depth]);
+    for (int d = max_depth - 1; d >= 0; --d) {
+        const std::vector<uint64_t> &child_codes = level_codes[d + 1];
+        FindRuns(
+                static_cast<int64_t>(child_codes.size()),
+                [&](int64_t i) { return child_codes[i] >> 3; }, level_codes[d],
+                level_starts[d]);
+    }
+
+    std::vector<int64_t> level_splits(max_depth + 2, 0);
+    for (int d = 0; d <= max_depth; ++d) {
+        level_splits[d + 1] =
+                level_splits[d] + static_cast<int64_t>(level_codes[d].size());
+    }
+    const int64_t num_nodes = level_splits.back();
+
+    codes_ = core::Tensor::Empty({num_nodes}, core::UInt64);
+    child_ranges_ = core::Tensor::Empty({num_nodes, 2}, core::Int64);
+    uint64_t *codes_ptr = codes_.GetDataPtr<uint64_t>();
+    int64_t *child_ranges_ptr = child_ranges_.GetDataPtr<int64_t>();
+    for (int d = 0; d <= max_depth; ++d) {
+        const int64_t begin = level_splits[d];
+        const int64_t num = level_splits[d + 1] - begin;
+        const std::vector<uint64_t> &codes = level_codes[d];
+        const std::vector<int64_t> &starts = level_starts[d];
+        const int64_t child_begin = d < max_depth ? level_splits[d + 1] : 0;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t j = 0; j < num; ++j) {
+            codes_ptr[begin + j] = codes[j];
+            int64_t *child_range = child_ranges_ptr + 2 * (begin + j);
+            if (d < max_depth) {
+                child_range[0] = child_begin + starts[j];
+                child_range[1] = child_begin + starts[j + 1];
+            } else {
+                child_range[0] = 0;
+                child_range[1] = 0;
+            }
+        }
+    }
+    level_splits_ = core::Tensor(level_splits, {max_depth + 2}, core::Int64);
+    point_ranges_ = core::Tensor::Empty({0, 2}, core::Int64);
+    leaf_starts = std::move(level_starts[max_depth]);
+}
+
+void LinearOctree::BuildPointRanges(
+        const std::vector<int64_t> &leaf_point_starts) {
+    const int64_t num_nodes = GetNumNodes();
+    const int64_t *level_splits = level_splits_.GetDataPtr<int64_t>();
+    const int64_t *child_ranges = child_ranges_.GetDataPtr<int64_t>();
+    point_ranges_ = core::Tensor::Empty({num_nodes, 2}, core::Int64);
+    int64_t *point_ranges = point_ranges_.GetDataPtr<int64_t>();
+
+    const int64_t leaf_begin = level_splits[max_depth_];
+    const int64_t num_leaves = GetNumLeaves();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t j = 0; j < num_leaves; ++j) {
+        point_ranges[2 * (leaf_begin + j)] = leaf_point_starts[j];
+        point_ranges[2 * (leaf_begin + j) + 1] = leaf_point_starts[j + 1];
+    }
+    for (int d = max_depth_ - 1; d >= 0; --d) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = level_splits[d]; i < level_splits[d + 1]; ++i) {
+            const int64_t first_child = child_ranges[2 * i];
+            const int64_t last_child = child_ranges[2 * i + 1] - 1;
+            point_ranges[2 * i] = point_ranges[2 * first_child];
+            point_ranges[2 * i + 1] = point_ranges[2 * last_child + 1];
+        }
+    }
+}
+
+LinearOctree LinearOctree::CreateFromPointCloud(const PointCloud &pcd,
+                                                int max_depth,
+                                                double size_expand) {
+    CheckMaxDepth(max_depth);
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    LinearOctree octree;
+    octree.max_depth_ = max_depth;
+    if (pcd.IsEmpty()) {
+        octree.level_splits_ =
+                core::Tensor::Zeros({max_depth + 2}, core::Int64);
+        return octree;
+    }
+
+    // Set bounds in the same way as the legacy octree.
+    const core::Device host("CPU:0");
+    const core::Tensor points = pcd.GetPointPositions().To(host).Contiguous();
+    const core::Tensor min_tensor =
+            points.Min({0}).To(core::Float64).Contiguous();
+    const core::Tensor max_tensor =
+            points.Max({0}).To(core::Float64).Contiguous();
+    const Eigen::Array3d min_bound(min_tensor.GetDataPtr<double>());
+    const Eigen::Array3d max_bound(max_tensor.GetDataPtr<double>());
+    const Eigen::Array3d center = (min_bound + max_bound) / 2;
+    const Eigen::Array3d half_sizes = center - min_bound;
+    const double max_half_size = half_sizes.maxCoeff();
+    const Eigen::Array3d origin = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        octree.size_ = size_expand;
+    } else {
+        octree.size_ = max_half_size * 2 * (1 + size_expand);
+    }
+    octree.origin_ = core::Tensor(std::vector<double>{origin(0), origin(1),
+                                                      origin(2)},
+                                  {3}, core::Float64);
+
+    // Leaf codes of all points within bounds.
+    const int64_t num_points = points.GetLength();
+    std::vector<uint64_t> codes(num_points);
+    std::vector<uint8_t> valid(num_points);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        ComputeLeafCodes(points.GetDataPtr<scalar_t>(), num_points,
+                         origin.data(), octree.size_, max_depth, codes, valid);
+    });
+    std::vector<uint64_t> keys(num_points);
+    std::vector<int64_t> indices(num_points);
+    const int64_t num_valid = ParallelCompact(
+            num_points, [&](int64_t i) { return valid[i] != 0; },
+            [&](int64_t i, int64_t j) {
+                keys[j] = codes[i];
+                indices[j] = i;
+            });
+    keys.resize(num_valid);
+    indices.resize(num_valid);
+    utility::RadixSort(keys, indices, 3 * max_depth);
+
+    std::vector<int64_t> leaf_starts;
+    octree.BuildLevels(keys, leaf_starts);
+    octree.BuildPointRanges(leaf_starts);
+    octree.point_indices_ = core::Tensor(indices, {num_valid}, core::Int64);
+
+    if (pcd.HasPointColors()) {
+        const core::Tensor colors = pcd.GetPointColors()
+                                            .To(host, core::Float64)
+                                            .Contiguous();
+        const double *colors_ptr = colors.GetDataPtr<double>();
+        const int64_t num_leaves = octree.GetNumLeaves();
+        octree.leaf_colors_ =
+                core::Tensor::Empty({num_leaves, 3}, core::Float64);
+        double *leaf_colors_ptr = octree.leaf_colors_.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t j = 0; j < num_leaves; ++j) {
+            // The legacy octree keeps the color of the last inserted point.
+            const int64_t idx = indices[leaf_starts[j + 1] - 1];
+            std::copy_n(colors_ptr + 3 * idx, 3, leaf_colors_ptr + 3 * j);
+        }
+    }
+    return octree;
+}
+
+LinearOctree LinearOctree::CreateFromVoxelGrid(
+        const open3d::geometry::VoxelGrid &voxel_grid, int max_depth) {
+    CheckMaxDepth(max_depth);
+
+    LinearOctree octree;
+    octree.max_depth_ = max_depth;
+    const Eigen::Vector3d origin = voxel_grid.origin_;
+    octree.size_ = (voxel_grid.GetMaxBound() - origin).maxCoeff();
+    octree.origin_ = core::Tensor(std::vector<double>{origin(0), origin(1),
+                                                      origin(2)},
+                                  {3}, core::Float64);
+
+    std::vector<open3d::geometry::Voxel> voxels;
+    voxels.reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        voxels.push_back(it.second);
+    }
+
+    // Leaf codes of all voxel centers within bounds.
+    const int64_t num_voxels = static_cast<int64_t>(voxels.size());
+    const double half_voxel_size = voxel_grid.voxel_size_ / 2.;
+    std::vector<uint64_t> codes(num_voxels);
+    std::vector<uint8_t> valid(num_voxels);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_voxels; ++i) {
+        const Eigen::Vector3d mid_point =
+                half_voxel_size + origin.array() +
+                voxels[i].grid_index_.array().cast<double>() *
+                        voxel_grid.voxel_size_;
+        valid[i] = ComputeLeafCode(mid_point.data(), origin.data(),
+                                   octree.size_, max_depth, codes[i]);
+    }
+    std::vector<uint64_t> keys(num_voxels);
+    std::vector<int64_t> indices(num_voxels);
+    const int64_t num_valid = ParallelCompact(
+            num_voxels, [&](int64_t i) { return valid[i] != 0; },
+            [&](int64_t i, int64_t j) {
+                keys[j] = codes[i];
+                indices[j] = i;
+            });
+    keys.resize(num_valid);
+    indices.resize(num_valid);
+    utility::RadixSort(keys, indices, 3 * max_depth);
+
+    std::vector<int64_t> leaf_starts;
+    octree.BuildLevels(keys, leaf_starts);
+
+    const int64_t num_leaves = octree.GetNumLeaves();
+    octree.leaf_colors_ = core::Tensor::Empty({num_leaves, 3}, core::Float64);
+    double *leaf_colors_ptr = octree.leaf_colors_.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t j = 0; j < num_leaves; ++j) {
+        Eigen::Vector3d color(0, 0, 0);
+        for (int64_t k = leaf_starts[j]; k < leaf_starts[j + 1]; ++k) {
+            color += voxels[indices[k]].color_;
+        }
+        color /= double(leaf_starts[j + 1] - leaf_starts[j]);
+        std::copy_n(color.data(), 3, leaf_colors_ptr + 3 * j);
+    }
+    return octree;
+}
+
+LinearOctree LinearOctree::FromLegacy(
+        const open3d::geometry::Octree &octree_legacy) {
+    const int max_depth = static_cast<int>(octree_legacy.max_depth_);
+    CheckMaxDepth(max_depth);
+
+    LinearOctree octree;
+    octree.max_depth_ = max_depth;
+    octree.size_ = octree_legacy.size_;
+    const Eigen::Vector3d &origin = octree_legacy.origin_;
+    octree.origin_ = core::Tensor(std::vector<double>{origin(0), origin(1),
+                                                      origin(2)},
+                                  {3}, core::Float64);
+
+    // The DFS visits the children in the order of their child index, so the
+    // leaves are collected in increasing Morton order.
+    const double leaf_size = octree.GetNodeSize(max_depth);
+    std::vector<uint64_t> keys;
+    std::vector<Eigen::Vector3d> colors;
+    std::vector<const std::vector<size_t> *> leaf_indices;
+    bool has_point_indices = true;
+    octree_legacy.Traverse(
+            [&](const std::shared_ptr<open3d::geometry::OctreeNode> &node,
+                const std::shared_ptr<open3d::geometry::OctreeNodeInfo>
+                        &node_info) -> bool {
+                if (!std::dynamic_pointer_cast<
+                            open3d::geometry::OctreeLeafNode>(node)) {
+                    return false;
+                }
+                auto color_leaf = std::dynamic_pointer_cast<
+                        open3d::geometry::OctreeColorLeafNode>(node);
+                if (!color_leaf) {
+                    utility::LogError(
+                            "Only OctreeColorLeafNode leaves are supported.");
+                }
+                if (static_cast<int>(node_info->depth_) != max_depth) {
+                    utility::LogError(
+                            "All leaves must be at max_depth {}, but got a "
+                            "leaf at depth {}.",
+                            max_depth, node_info->depth_);
+                }
+                const Eigen::Vector3i cell =
+                        ((node_info->origin_ - origin) / leaf_size)
+                                .array()
+                                .round()
+                                .cast<int>();
+                keys.push_back(EncodeCell(cell, max_depth));
+                colors.push_back(color_leaf->color_);
+                auto point_leaf = std::dynamic_pointer_cast<
+                        open3d::geometry::OctreePointColorLeafNode>(node);
+                leaf_indices.push_back(point_leaf ? &point_leaf->indices_
+                                                  : nullptr);
+                has_point_indices = has_point_indices && point_leaf;
+                return false;
+            });
+
+    std::vector<int64_t> leaf_starts;
+    octree.BuildLevels(keys, leaf_starts);
+    const int64_t num_leaves = octree.GetNumLeaves();
+    if (num_leaves != static_cast<int64_t>(keys.size())) {
+        utility::LogError("The legacy octree has duplicate leaves.");
+    }
+
+    octree.leaf_colors_ = core::Tensor::Empty({num_leaves, 3}, core::Float64);
+    double *leaf_colors_ptr = octree.leaf_colors_.GetDataPtr<double>();
+    for (int64_t j = 0; j < num_leaves; ++j) {
+        std::copy_n(colors[j].data(), 3, leaf_colors_ptr + 3 * j);
+    }
+
+    if (has_point_indices && num_leaves > 0) {
+        std::vector<int64_t> leaf_point_starts(num_leaves + 1, 0);
+        for (int64_t j = 0; j < num_leaves; ++j) {
+            leaf_point_starts[j + 1] =
+                    leaf_point_starts[j] +
+                    static_cast<int64_t>(leaf_indices[j]->size());
+        }
+        octree.point_indices_ = core::Tensor::Empty(
+                {leaf_point_starts.back()}, core::Int64);
+        int64_t *point_indices_ptr =
+                octree.point_indices_.GetDataPtr<int64_t>();
+        for (int64_t j = 0; j < num_leaves; ++j) {
+            std::copy(leaf_indices[j]->begin(), leaf_indices[j]->end(),
+                      point_indices_ptr + leaf_point_starts[j]);
+        }
+        octree.BuildPointRanges(leaf_point_starts);
+    }
+    return octree;
+}
+
+open3d::geometry::Octree LinearOctree::ToLegacy() const {
+    const double *origin = origin_.GetDataPtr<double>();
+    open3d::geometry::Octree octree(
+            max_depth_, Eigen::Vector3d(origin[0], origin[1], origin[2]),
+            size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+
+    const bool has_point_indices = HasPointIndices();
+    const bool has_leaf_colors = HasLeafColors();
+    const uint64_t *codes = codes_.GetDataPtr<uint64_t>();
+    const int64_t *child_ranges = child_ranges_.GetDataPtr<int64_t>();
+    const int64_t *point_ranges =
+            has_point_indices ? point_ranges_.GetDataPtr<int64_t>() : nullptr;
+    const int64_t *point_indices =
+            has_point_indices ? point_indices_.GetDataPtr<int64_t>() : nullptr;
+    const double *leaf_colors =
+            has_leaf_colors ? leaf_colors_.GetDataPtr<double>() : nullptr;
+    const int64_t leaf_begin = level_splits_.GetDataPtr<int64_t>()[max_depth_];
+
+    std::function<std::shared_ptr<open3d::geometry::OctreeNode>(int64_t, int)>
+            create_node = [&](int64_t node, int depth)
+            -> std::shared_ptr<open3d::geometry::OctreeNode> {
+        std::vector<size_t> indices;
+        if (has_point_indices) {
+            indices.assign(point_indices + point_ranges[2 * node],
+                           point_indices + point_ranges[2 * node + 1]);
+        }
+        if (depth == max_depth_) {
+            Eigen::Vector3d color(0, 0, 0);
+            if (has_leaf_colors) {
+                color = Eigen::Vector3d(leaf_colors + 3 * (node - leaf_begin));
+            }
+            if (has_point_indices) {
+                auto leaf = std::make_shared<
+                        open3d::geometry::OctreePointColorLeafNode>();
+                leaf->color_ = color;
+                leaf->indices_ = std::move(indices);
+                return leaf;
+            }
+            auto leaf =
+                    std::make_shared<open3d::geometry::OctreeColorLeafNode>();
+            leaf->color_ = color;
+            return leaf;
+        }
+
+        std::shared_ptr<open3d::geometry::OctreeInternalNode> internal;
+        if (has_point_indices) {
+            // Internal nodes of the legacy octree list the points in the
+            // order of insertion.
+            auto internal_point = std::make_shared<
+                    open3d::geometry::OctreeInternalPointNode>();
+            std::sort(indices.begin(), indices.end());
+            internal_point->indices_ = std::move(indices);
+            internal = internal_point;
+        } else {
+            internal = std::make_shared<open3d::geometry::OctreeInternalNode>();
+        }
+        for (int64_t child = child_ranges[2 * node];
+             child < child_ranges[2 * node + 1]; ++child) {
+            internal->children_[codes[child] & 7] =
+                    create_node(child, depth + 1);
+        }
+        return internal;
+    };
+    octree.root_node_ = create_node(0, 0);
+    return octree;
+}
+
+open3d::geometry::VoxelGrid LinearOctree::ToVoxelGrid() const {
+    const double *origin = origin_.GetDataPtr<double>();
+    open3d::geometry::VoxelGrid voxel_grid;
+    voxel_grid.origin_ = Eigen::Vector3d(origin[0], origin[1], origin[2]);
+    voxel_grid.voxel_size_ = GetNodeSize(max_depth_);
+
+    const int64_t leaf_begin = level_splits_.GetDataPtr<int64_t>()[max_depth_];
+    const int64_t num_leaves = GetNumLeaves();
+    const uint64_t *codes = codes_.GetDataPtr<uint64_t>();
+    const bool has_leaf_colors = HasLeafColors();
+    for (int64_t j = 0; j < num_leaves; ++j) {
+        Eigen::Vector3d color(0, 0, 0);
+        if (has_leaf_colors) {
+            color = Eigen::Vector3d(leaf_colors_.GetDataPtr<double>() + 3 * j);
+        }
+        voxel_grid.AddVoxel(open3d::geometry::Voxel(
+                DecodeCell(codes[leaf_begin + j], max_depth_), color));
+    }
+    return voxel_grid;
+}
+
+std::string LinearOctree::ToString() const {
+    return fmt::format(
+            "LinearOctree with {} nodes, {} leaves and max depth {}.",
+            GetNumNodes(), GetNumLeaves(), max_depth_);
+}
+
+int64_t LinearOctree::GetNumLeaves() const {
+    const int64_t *level_splits = level_splits_.GetDataPtr<int64_t>();
+    return level_splits[max_depth_ + 1] - level_splits[max_depth_];
+}
+
+double LinearOctree::GetNodeSize(int depth) const {
+    return std::ldexp(size_, -depth);
+}
+
+int LinearOctree::GetNodeDepth(int64_t node_index) const {
+    if (node_index < 0 || node_index >= GetNumNodes()) {
+        utility::LogError("Node index {} out of range [0, {}).", node_index,
+                          GetNumNodes());
+    }
+    const int64_t *level_splits = level_splits_.GetDataPtr<int64_t>();
+    return static_cast<int>(std::upper_bound(level_splits,
+                                             level_splits + max_depth_ + 2,
+                                             node_index) -
+                            level_splits) -
+           1;
+}
+
+core::Tensor LinearOctree::GetNodeOrigins() const {
+    const int64_t num_nodes = GetNumNodes();
+    core::Tensor node_origins =
+            core::Tensor::Empty({num_nodes, 3}, core::Float64);
+    const double *origin = origin_.GetDataPtr<double>();
+    const uint64_t *codes = codes_.GetDataPtr<uint64_t>();
+    const int64_t *level_splits = level_splits_.GetDataPtr<int64_t>();
+    double *node_origins_ptr = node_origins.GetDataPtr<double>();
+    for (int d = 0; d <= max_depth_; ++d) {
+        const double node_size = GetNodeSize(d);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = level_splits[d]; i < level_splits[d + 1]; ++i) {
+            const Eigen::Vector3i cell = DecodeCell(codes[i], d);
+            for (int k = 0; k < 3; ++k) {
+                node_origins_ptr[3 * i + k] = origin[k] + cell(k) * node_size;
+            }
+        }
+    }
+    return node_origins;
+}
+
+core::Tensor LinearOctree::GetPointIndicesOfNode(int64_t node_index) const {
+    if (!HasPointIndices()) {
+        utility::LogError("The octree has no point indices.");
+    }
+    if (node_index < 0 || node_index >= GetNumNodes()) {
+        utility::LogError("Node index {} out of range [0, {}).", node_index,
+                          GetNumNodes());
+    }
+    const int64_t *point_ranges = point_ranges_.GetDataPtr<int64_t>();
+    return point_indices_.Slice(0, point_ranges[2 * node_index],
+                                point_ranges[2 * node_index + 1]);
+}
+
+void LinearOctree::Traverse(const std::function<bool(int64_t, int)> &f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    const int64_t *child_ranges = child_ranges_.GetDataPtr<int64_t>();
+    std::vector<std::pair<int64_t, int>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        const int64_t node = stack.back().first;
+        const int depth = stack.back().second;
+        stack.pop_back();
+        if (f(node, depth)) {
+            continue;
+        }
+        // Push in reverse order, such that the first child is visited first.
+        for (int64_t child = child_ranges[2 * node + 1] - 1;
+             child >= child_ranges[2 * node]; --child) {
+            stack.emplace_back(child, depth + 1);
+        }
+    }
+}
+
+core::Tensor LinearOctree::LocateLeaves(
+        const core::Tensor &query_points) const {
+    core::AssertTensorDtypes(query_points, {core::Float32, core::Float64});
+    core::AssertTensorShape(query_points, {utility::nullopt, 3});
+
+    const core::Tensor points =
+            query_points.To(core::Device("CPU:0")).Contiguous();
+    const int64_t num_queries = points.GetLength();
+    core::Tensor leaves = core::Tensor::Full({num_queries}, -1, core::Int64);
+    if (IsEmpty()) {
+        return leaves;
+    }
+
+    const double *origin = origin_.GetDataPtr<double>();
+    const int64_t leaf_begin = level_splits_.GetDataPtr<int64_t>()[max_depth_];
+    const uint64_t *leaf_codes = codes_.GetDataPtr<uint64_t>() + leaf_begin;
+    const uint64_t *leaf_codes_end = leaf_codes + GetNumLeaves();
+    int64_t *leaves_ptr = leaves.GetDataPtr<int64_t>();
+    std::vector<uint64_t> codes(num_queries);
+    std::vector<uint8_t> valid(num_queries);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        ComputeLeafCodes(points.GetDataPtr<scalar_t>(), num_queries, origin,
+                         size_, max_depth_, codes, valid);
+    });
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        if (!valid[i]) {
+            continue;
+        }
+        const uint64_t *it =
+                std::lower_bound(leaf_codes, leaf_codes_end, codes[i]);
+        if (it != leaf_codes_end && *it == codes[i]) {
+            leaves_ptr[i] = leaf_begin + (it - leaf_codes);
+        }
+    }
+    return leaves;
+}
+
+core::Tensor LinearOctree::FindLeavesInBox(
+        const core::Tensor &min_bound, const core::Tensor &max_bound) const {
+    core::AssertTensorShape(min_bound, {3});
+    core::AssertTensorShape(max_bound, {3});
+    const core::Device host("CPU:0");
+    const core::Tensor min_tensor =
+            min_bound.To(host, core::Float64).Contiguous();
+    const core::Tensor max_tensor =
+            max_bound.To(host, core::Float64).Contiguous();
+    const double *box_min = min_tensor.GetDataPtr<double>();
+    const double *box_max = max_tensor.GetDataPtr<double>();
+
+    std::vector<int64_t> frontier;
+    if (!IsEmpty()) {
+        frontier.push_back(0);
+    }
+    const double *origin = origin_.GetDataPtr<double>();
+    const uint64_t *codes = codes_.GetDataPtr<uint64_t>();
+    const int64_t *child_ranges = child_ranges_.GetDataPtr<int64_t>();
+
+    // Breadth first descent, keeping the nodes whose half open cube
+    // intersects the closed box. The frontier stays sorted by node index.
+    for (int d = 0; d <= max_depth_ && !frontier.empty(); ++d) {
+        const double node_size = GetNodeSize(d);
+        std::vector<int64_t> next;
+        for (int64_t node : frontier) {
+            const Eigen::Vector3i cell = DecodeCell(codes[node], d);
+            bool intersects = true;
+            for (int k = 0; k < 3; ++k) {
+                const double node_min = origin[k] + cell(k) * node_size;
+                intersects = intersects && node_min <= box_max[k] &&
+                             box_min[k] < node_min + node_size;
+            }
+            if (!intersects) {
+                continue;
+            }
+            if (d == max_depth_) {
+                next.push_back(node);
+            } else {
+                for (int64_t child = child_ranges[2 * node];
+                     child < child_ranges[2 * node + 1]; ++child) {
+                    next.push_back(child);
+                }
+            }
+        }
+        frontier.swap(next);
+    }
+    return core::Tensor(frontier, {static_cast<int64_t>(frontier.size())},
+                        core::Int64);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
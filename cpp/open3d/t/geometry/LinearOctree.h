@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class LinearOctree
+/// \brief Pointer-free octree stored as arrays of Morton codes.
+///
+/// The octree covers the cube [origin, origin + size) and all leaves are at
+/// max_depth, like the legacy open3d::geometry::Octree. The child index of a
+/// node is x + 2 * y + 4 * z, as in the legacy octree, and the Morton code of
+/// a node at depth d is the concatenation of the 3 bit child indices on the
+/// path from the root, i.e. the code of a child is (parent_code << 3) |
+/// child_index.
+///
+/// The nodes are stored level by level, sorted by their Morton code within
+/// each level. The nodes of depth d are [level_splits[d], level_splits[d + 1])
+/// and the leaves are the nodes of depth max_depth. Because of the ordering,
+/// the children of a node and the points of a node are contiguous ranges.
+///
+/// - codes: UInt64 tensor of shape {num_nodes} with the Morton codes.
+/// - level_splits: Int64 tensor of shape {max_depth + 2}.
+/// - child_ranges: Int64 tensor of shape {num_nodes, 2} with the range
+///   [begin, end) of node indices of the children. The range of leaves is
+///   empty.
+/// - point_ranges: Int64 tensor of shape {num_nodes, 2} with the range
+///   [begin, end) of the node's points in point_indices. Only available if
+///   the octree has point indices.
+/// - point_indices: Int64 tensor with the indices of the points sorted by
+///   their leaf, with increasing index within each leaf.
+/// - leaf_colors: Float64 tensor of shape {num_leaves, 3}, if available.
+///
+/// All tensors live on the CPU, the construction is parallelized with a
+/// radix sort of the Morton codes.
+class LinearOctree {
+public:
+    /// Max supported depth, such that all codes fit into 63 bits.
+    static constexpr int kMaxDepth = 21;
+
+    /// \brief Constructs an empty octree.
+    LinearOctree() {}
+
+    /// \brief Builds the octree of a point cloud.
+    ///
+    /// The bounds are computed as in
+    /// open3d::geometry::Octree::ConvertFromPointCloud() and points outside
+    /// of the bounds are skipped in the same way. If the point cloud has
+    /// colors, the color of a leaf is the color of its point with the largest
+    /// index, as in the legacy octree.
+    ///
+    /// \param pcd Input point cloud.
+    /// \param max_depth Depth of the leaves, at most kMaxDepth.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accommodate all
+    /// points.
+    static LinearOctree CreateFromPointCloud(const PointCloud &pcd,
+                                             int max_depth,
+                                             double size_expand = 0.01);
+
+    /// \brief Builds the octree of the voxel centers of a legacy VoxelGrid.
+    ///
+    /// The bounds are computed as in
+    /// open3d::geometry::Octree::CreateFromVoxelGrid(). The color of a leaf
+    /// is the mean color of its voxels.
+    static LinearOctree CreateFromVoxelGrid(
+            const open3d::geometry::VoxelGrid &voxel_grid, int max_depth);
+
+    /// \brief Creates a LinearOctree from a legacy Octree.
+    ///
+    /// The legacy leaves must be OctreeColorLeafNode at max_depth. Point
+    /// indices are copied if all leaves are OctreePointColorLeafNode.
+    static LinearOctree FromLegacy(const open3d::geometry::Octree &octree);
+
+    /// \brief Converts to a legacy Octree.
+    ///
+    /// An octree with point indices is converted to OctreeInternalPointNode
+    /// and OctreePointColorLeafNode nodes, such that the result is identical
+    /// to open3d::geometry::Octree::ConvertFromPointCloud(). Otherwise
+    /// OctreeInternalNode and OctreeColorLeafNode nodes are used.
+    open3d::geometry::Octree ToLegacy() const;
+
+    /// \brief Converts the leaves to a legacy VoxelGrid with voxel size
+    /// size / 2^max_depth.
+    open3d::geometry::VoxelGrid ToVoxelGrid() const;
+
+    /// \brief Text description.
+    std::string ToString() const;
+
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return GetNumNodes() == 0; }
+
+    /// Returns the number of nodes.
+    int64_t GetNumNodes() const { return codes_.GetLength(); }
+
+    /// Returns the number of leaves.
+    int64_t GetNumLeaves() const;
+
+    /// Returns the min bound of the octree as Float64 tensor of shape {3}.
+    const core::Tensor &GetOrigin() const { return origin_; }
+
+    /// Returns the edge length of the root cube.
+    double GetSize() const { return size_; }
+
+    /// Returns the depth of the leaves.
+    int GetMaxDepth() const { return max_depth_; }
+
+    /// Returns the edge length of the nodes at \p depth.
+    double GetNodeSize(int depth) const;
+
+    /// Returns the Morton codes of the nodes.
+    const core::Tensor &GetCodes() const { return codes_; }
+
+    /// Returns the node index range of each level.
+    const core::Tensor &GetLevelSplits() const { return level_splits_; }
+
+    /// Returns the child node index range of each node.
+    const core::Tensor &GetChildRanges() const { return child_ranges_; }
+
+    /// Returns the point index range of each node.
+    const core::Tensor &GetPointRanges() const { return point_ranges_; }
+
+    /// Returns the point indices sorted by leaf.
+    const core::Tensor &GetPointIndices() const { return point_indices_; }
+
+    /// Returns the colors of the leaves.
+    const core::Tensor &GetLeafColors() const { return leaf_colors_; }
+
+    /// Returns true if the octree stores point indices.
+    bool HasPointIndices() const { return point_ranges_.GetLength() > 0; }
+
+    /// Returns true if the octree stores leaf colors.
+    bool HasLeafColors() const { return leaf_colors_.GetLength() > 0; }
+
+    /// \brief Returns the depth of a node.
+    int GetNodeDepth(int64_t node_index) const;
+
+    /// \brief Returns the min bound of all nodes as Float64 tensor of shape
+    /// {num_nodes, 3}.
+    core::Tensor GetNodeOrigins() const;
+
+    /// \brief Returns the indices of the points of a node. The returned
+    /// tensor shares the memory with the octree.
+    core::Tensor GetPointIndicesOfNode(int64_t node_index) const;
+
+    /// \brief DFS traversal from the root in the same order as
+    /// open3d::geometry::Octree::Traverse().
+    ///
+    /// \param f Callback with the node index and the depth of the node. If f
+    /// returns true, the children of the node will not be traversed.
+    void Traverse(const std::function<bool(int64_t, int)> &f) const;
+
+    /// \brief Returns the leaf containing each query point.
+    ///
+    /// \param query_points Float32 or Float64 tensor of shape {n, 3}.
+    /// \return Int64 tensor of shape {n} with the node index of the leaf, or
+    /// -1 if the point is outside of the octree or its leaf does not exist.
+    core::Tensor LocateLeaves(const core::Tensor &query_points) const;
+
+    /// \brief Returns all leaves that intersect the box
+    /// [min_bound, max_bound].
+    ///
+    /// \param min_bound Tensor of shape {3}.
+    /// \param max_bound Tensor of shape {3}.
+    /// \return Int64 tensor with the sorted node indices of the leaves.
+    core::Tensor FindLeavesInBox(const core::Tensor &min_bound,
+                                 const core::Tensor &max_bound) const;
+
+private:
+    /// Builds all levels from the sorted (not necessarily unique) leaf codes
+    /// \p keys. Returns the start of each leaf in \p keys in \p leaf_starts,
+    /// including the end.
+    void BuildLevels(const std::vector<uint64_t> &keys,
+                     std::vector<int64_t> &leaf_starts);
+
+    /// Computes the point ranges of all nodes from the start of the points
+    /// of each leaf in point_indices, including the end.
+    void BuildPointRanges(const std::vector<int64_t> &leaf_point_starts);
+
+    core::Tensor origin_ = core::Tensor::Zeros({3}, core::Float64);
+    double size_ = 0;
+    int max_depth_ = 0;
+    core::Tensor codes_ = core::Tensor::Empty({0}, core::UInt64);
+    core::Tensor level_splits_ = core::Tensor::Zeros({2}, core::Int64);
+    core::Tensor child_ranges_ = core::Tensor::Empty({0, 2}, core::Int64);
+    core::Tensor point_ranges_ = core::Tensor::Empty({0, 2}, core::Int64);
+    core::Tensor point_indices_ = core::Tensor::Empty({0}, core::Int64);
+    core::Tensor leaf_colors_ = core::Tensor::Empty({0, 3}, core::Float64);
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
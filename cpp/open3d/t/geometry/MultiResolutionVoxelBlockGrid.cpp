@@ -0,0 +1,1018 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Returns the keys shifted by all the offsets in {min_offset, ..., 1}^3.
+static core::Tensor ShiftKeys(const core::Tensor &keys, int min_offset) {
+    std::vector<core::Tensor> keys_shifted;
+    for (int dz = min_offset; dz <= 1; ++dz) {
+        for (int dy = min_offset; dy <= 1; ++dy) {
+            for (int dx = min_offset; dx <= 1; ++dx) {
+                core::Tensor dt =
+                        core::Tensor(std::vector<int>{dx, dy, dz}, {1, 3},
+                                     core::Int32, keys.GetDevice());
+                keys_shifted.push_back(keys + dt);
+            }
+        }
+    }
+    return core::Concatenate(keys_shifted, 0);
+}
+
+/// Returns the Int32 keys of the cells of size cell_size that contain the
+/// points, rounding towards negative infinity.
+static core::Tensor GetCellKeys(const core::Tensor &points, float cell_size) {
+    return (points / cell_size).Floor().To(core::Int32);
+}
+
+/// Returns the keys that are not in the set yet and inserts them.
+static core::Tensor InsertNewKeys(core::HashSet &key_set,
+                                  const core::Tensor &keys) {
+    if (keys.GetLength() == 0) return keys;
+    core::Tensor buf_indices, masks;
+    key_set.Insert(keys, buf_indices, masks);
+    return keys.IndexGet({masks});
+}
+
+/// Returns the mask of the keys that are in the hash map.
+static core::Tensor ContainsKeys(core::HashMap hashmap,
+                                 const core::Tensor &keys) {
+    if (keys.GetLength() == 0 || hashmap.Size() == 0) {
+        return core::Tensor::Zeros({keys.GetLength()}, core::Bool,
+                                   keys.GetDevice());
+    }
+    core::Tensor buf_indices, masks;
+    hashmap.Find(keys, buf_indices, masks);
+    return masks;
+}
+
+/// Returns the active keys of a hash map.
+static core::Tensor GetActiveKeys(core::HashMap hashmap) {
+    return hashmap.GetKeyTensor().IndexGet(
+            {hashmap.GetActiveIndices().To(core::Int64)});
+}
+
+/// Returns the mesh with the triangles whose centroids are in (keep_inside)
+/// or not in the cells of size cell_size with the keys of the set.
+static TriangleMesh SelectTrianglesByCells(const TriangleMesh &mesh,
+                                           core::HashSet &cell_set,
+                                           float cell_size,
+                                           bool keep_inside) {
+    if (!mesh.HasTriangleIndices() || cell_set.Size() == 0) {
+        return keep_inside ? TriangleMesh(mesh.GetDevice()) : mesh;
+    }
+    const core::Tensor triangles = mesh.GetTriangleIndices();
+    if (triangles.GetLength() == 0) return mesh;
+    const core::Tensor centroids =
+            mesh.GetVertexPositions()
+                    .IndexGet({triangles.To(core::Int64)})
+                    .Sum({1}) /
+            3.0f;
+    core::Tensor buf_indices, masks;
+    cell_set.Find(GetCellKeys(centroids, cell_size), buf_indices, masks);
+    return mesh.SelectFacesByMask(keep_inside ? masks : masks.LogicalNot());
+}
+
+/// Voxel values trilinearly interpolated from a voxel block grid.
+struct VoxelSamples {
+    core::Tensor tsdf;
+    core::Tensor weight;
+    core::Tensor color;
+    /// False if a corner with interpolation weight is not allocated or not
+    /// observed.
+    core::Tensor valid;
+};
+
+/// Trilinear interpolation of the tsdf, weight and color of a grid at the
+/// points {N, 3}. The tsdf is decoded to Float32.
+static VoxelSamples SampleVoxels(VoxelBlockGrid &grid,
+                                 const core::Tensor &points,
+                                 float voxel_size,
+                                 int64_t block_resolution,
+                                 bool sample_color) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t resolution = block_resolution;
+    core::HashMap hashmap = grid.GetHashMap();
+
+    // Points within rounding errors of a voxel are snapped to it, and the
+    // corners without interpolation weight are not required, so that the
+    // points on the voxels of the last layer of a grid can be sampled.
+    const core::Tensor voxel_coords = points / voxel_size;
+    const core::Tensor base = (voxel_coords + 1e-4f).Floor();
+    const core::Tensor ratio = (voxel_coords - base).Clip(0.0f, 1.0f).T();
+    const core::Tensor base_keys = base.To(core::Int32);
+
+    core::Tensor tsdf_values = grid.GetAttribute("tsdf").View({-1});
+    const bool decode_tsdf = tsdf_values.GetDtype() == core::Int16;
+    core::Tensor weight_values = grid.GetAttribute("weight").View({-1});
+    core::Tensor color_values;
+    if (sample_color) {
+        color_values = grid.GetAttribute("color").View({-1, 3});
+    }
+
+    VoxelSamples samples;
+    samples.tsdf = core::Tensor::Zeros({n}, core::Float32, device);
+    samples.weight = core::Tensor::Zeros({n}, core::Float32, device);
+    samples.valid = core::Tensor::Ones({n}, core::Bool, device);
+    if (sample_color) {
+        samples.color = core::Tensor::Zeros({n, 3}, core::Float32, device);
+    }
+    for (int k = 0; k < 8; ++k) {
+        const int dx = k & 1, dy = (k >> 1) & 1, dz = (k >> 2) & 1;
+        const core::Tensor corner_keys =
+                base_keys + core::Tensor(std::vector<int>{dx, dy, dz}, {1, 3},
+                                         core::Int32, device);
+        const core::Tensor block_keys = GetCellKeys(
+                corner_keys.To(core::Float32), static_cast<float>(resolution));
+        const core::Tensor local = (corner_keys - block_keys * resolution)
+                                           .To(core::Int64)
+                                           .T();
+
+        core::Tensor buf_indices, masks;
+        hashmap.Find(block_keys, buf_indices, masks);
+        const core::Tensor linear_indices =
+                (buf_indices.To(core::Int64) * (resolution * resolution *
+                                                resolution) +
+                 (local[2] * resolution + local[1]) * resolution + local[0]) *
+                masks.To(core::Int64);
+
+        core::Tensor r = dx ? ratio[0] : 1.0f - ratio[0];
+        r = r * (dy ? ratio[1] : 1.0f - ratio[1]);
+        r = r * (dz ? ratio[2] : 1.0f - ratio[2]);
+
+        core::Tensor tsdf =
+                tsdf_values.IndexGet({linear_indices}).To(core::Float32);
+        if (decode_tsdf) {
+            tsdf = tsdf / 32767.0f;
+        }
+        const core::Tensor weight =
+                weight_values.IndexGet({linear_indices}).To(core::Float32);
+        samples.valid = samples.valid.LogicalAnd(
+                masks.LogicalAnd(weight.Gt(0.0f)).LogicalOr(r.Le(0.0f)));
+        samples.tsdf = samples.tsdf + r * tsdf;
+        samples.weight = samples.weight + r * weight;
+        if (sample_color) {
+            samples.color =
+                    samples.color +
+                    r.View({n, 1}) * color_values.IndexGet({linear_indices})
+                                             .To(core::Float32);
+        }
+    }
+    return samples;
+}
+
+/// Converts Float32 values to the dtype of a voxel attribute, rounding and
+/// saturating integers.
+static core::Tensor EncodeValues(const core::Tensor &values,
+                                 const core::Dtype &dtype) {
+    if (dtype == core::Float32) {
+        return values;
+    } else if (dtype == core::UInt8) {
+        return values.Round().Clip(0, 255).To(dtype);
+    } else if (dtype == core::UInt16) {
+        return values.Round().Clip(0, 65535).To(dtype);
+    }
+    utility::LogError("Unsupported voxel attribute dtype {}.",
+                      dtype.ToString());
+}
+
+/// Returns the half-edges of the triangles {T, 3} that are not shared with
+/// another triangle as the indices 3 * triangle + k of the edges from vertex k
+/// to vertex (k + 1) % 3, and their start and end vertices.
+static std::tuple<core::Tensor, core::Tensor, core::Tensor>
+GetBoundaryHalfEdges(const core::Tensor &triangles) {
+    const core::Device &device = triangles.GetDevice();
+    const core::Tensor starts = triangles.Contiguous().View({-1});
+    const core::Tensor ends =
+            core::Concatenate(
+                    {triangles.Slice(1, 1, 3), triangles.Slice(1, 0, 1)}, 1)
+                    .View({-1});
+    // The undirected edges {min(v0, v1), max(v0, v1)}.
+    const core::Tensor min_vertices =
+            ends + (starts - ends) * starts.Lt(ends).To(core::Int64);
+    const core::Tensor edges = core::Concatenate(
+            {min_vertices.View({-1, 1}),
+             (starts + ends - min_vertices).View({-1, 1})},
+            1);
+    core::HashSet edge_set(edges.GetLength(), core::Int64, {2}, device);
+    core::Tensor buf_indices, masks;
+    edge_set.Insert(edges, buf_indices, masks);
+    edge_set.Find(edges, buf_indices, masks);
+    const core::Tensor edge_indices = buf_indices.To(core::Int64);
+    // IndexAdd_ only supports floats, the small counts are exact.
+    core::Tensor edge_counts = core::Tensor::Zeros({edge_set.GetCapacity()},
+                                                   core::Float32, device);
+    edge_counts.IndexAdd_(
+            0, edge_indices,
+            core::Tensor::Ones({edges.GetLength()}, core::Float32, device));
+    const core::Tensor half_edges =
+            edge_counts.IndexGet({edge_indices}).Eq(1).NonZero().View({-1});
+    return std::make_tuple(half_edges, starts.IndexGet({half_edges}),
+                           ends.IndexGet({half_edges}));
+}
+
+/// Concatenates the meshes of the levels, ordered from fine to coarse, and
+/// stitches them at the level boundaries. The vertices of a coarser mesh on a
+/// level boundary coincide with vertices of a finer mesh and are welded to
+/// them. Between two welded vertices, the coarse boundary edge is matched by
+/// a path of boundary edges of the finer mesh across the coarse cube face,
+/// and the coarse triangle is split into a fan over the path. The meshes stay
+/// on their device, only the boundary vertices and half-edges and the split
+/// triangles are processed on the host.
+static TriangleMesh StitchLevelMeshes(const std::vector<TriangleMesh> &meshes,
+                                      const std::vector<int64_t> &levels,
+                                      float voxel_size,
+                                      float weld_distance,
+                                      int max_path_length) {
+    const core::Device device = meshes[0].GetDevice();
+    bool has_colors = true;
+    for (const TriangleMesh &mesh : meshes) {
+        has_colors = has_colors && mesh.HasVertexColors();
+    }
+    std::vector<core::Tensor> level_positions, level_normals, level_colors,
+            level_triangles;
+    // First vertex and first triangle of each mesh.
+    std::vector<int64_t> vertex_offsets = {0}, triangle_offsets = {0};
+    for (const TriangleMesh &mesh : meshes) {
+        level_positions.push_back(mesh.GetVertexPositions());
+        level_normals.push_back(mesh.GetVertexNormals());
+        if (has_colors) {
+            level_colors.push_back(mesh.GetVertexColors().To(core::Float32));
+        }
+        level_triangles.push_back(
+                mesh.GetTriangleIndices().To(core::Int64).Add(
+                        vertex_offsets.back()));
+        vertex_offsets.push_back(vertex_offsets.back() +
+                                 mesh.GetVertexPositions().GetLength());
+        triangle_offsets.push_back(triangle_offsets.back() +
+                                   mesh.GetTriangleIndices().GetLength());
+    }
+    core::Tensor positions = core::Concatenate(level_positions, 0);
+    core::Tensor normals = core::Concatenate(level_normals, 0);
+    core::Tensor colors =
+            has_colors ? core::Concatenate(level_colors, 0) : core::Tensor();
+    core::Tensor triangles = core::Concatenate(level_triangles, 0);
+    const int64_t num_vertices = positions.GetLength();
+    // Level of the vertex or triangle i with the offsets of the meshes.
+    auto get_level = [&](const std::vector<int64_t> &offsets, int64_t i) {
+        return levels[std::upper_bound(offsets.begin(), offsets.end(), i) -
+                      offsets.begin() - 1];
+    };
+
+    // Weld the boundary vertices to the nearest boundary vertex of a finer
+    // level on the same grid line within the weld distance, from fine to
+    // coarse so that the vertices of the finest level are kept. The
+    // coordinates of the vertices off their cube edges are multiples of the
+    // finest voxel size, the grid lines are keyed by these multiples.
+    core::Tensor half_edges, starts, ends;
+    std::tie(half_edges, starts, ends) = GetBoundaryHalfEdges(triangles);
+    std::vector<int64_t> boundary_vertices =
+            core::Concatenate({starts, ends}, 0).ToFlatVector<int64_t>();
+    std::sort(boundary_vertices.begin(), boundary_vertices.end());
+    boundary_vertices.erase(
+            std::unique(boundary_vertices.begin(), boundary_vertices.end()),
+            boundary_vertices.end());
+    const size_t num_boundary = boundary_vertices.size();
+    std::vector<float> boundary_positions;
+    if (num_boundary > 0) {
+        boundary_positions =
+                positions
+                        .IndexGet({core::Tensor(boundary_vertices,
+                                                {int64_t(num_boundary)},
+                                                core::Int64, device)})
+                        .ToFlatVector<float>();
+    }
+    auto get_line_key = [&](size_t i, int axis) {
+        const int64_t q0 = std::llround(
+                boundary_positions[3 * i + (axis + 1) % 3] / voxel_size);
+        const int64_t q1 = std::llround(
+                boundary_positions[3 * i + (axis + 2) % 3] / voxel_size);
+        return (uint64_t(uint32_t(q0)) << 32) | uint32_t(q1);
+    };
+    std::unordered_map<uint64_t, std::vector<size_t>> line_vertices[3];
+    std::vector<int64_t> boundary_levels(num_boundary);
+    for (size_t i = 0; i < num_boundary; ++i) {
+        boundary_levels[i] = get_level(vertex_offsets, boundary_vertices[i]);
+        for (int axis = 0; axis < 3; ++axis) {
+            line_vertices[axis][get_line_key(i, axis)].push_back(i);
+        }
+    }
+    // The boundary vertices are sorted by level, a finer vertex is welded
+    // before the vertices that are welded to it.
+    std::vector<size_t> welded_to(num_boundary);
+    std::iota(welded_to.begin(), welded_to.end(), 0);
+    std::vector<int64_t> welded_sources, welded_targets;
+    for (size_t i = 0; i < num_boundary; ++i) {
+        float min_distance = weld_distance;
+        for (int axis = 0; axis < 3; ++axis) {
+            for (size_t j : line_vertices[axis].at(get_line_key(i, axis))) {
+                if (boundary_levels[j] >= boundary_levels[i]) continue;
+                float distance = 0;
+                for (int k = 0; k < 3; ++k) {
+                    distance = std::max(
+                            distance, std::abs(boundary_positions[3 * j + k] -
+                                               boundary_positions[3 * i + k]));
+                }
+                if (distance <= min_distance) {
+                    min_distance = distance;
+                    welded_to[i] = welded_to[j];
+                }
+            }
+        }
+        if (welded_to[i] != i) {
+            welded_sources.push_back(boundary_vertices[i]);
+            welded_targets.push_back(boundary_vertices[welded_to[i]]);
+        }
+    }
+    if (!welded_sources.empty()) {
+        const int64_t num_welded = int64_t(welded_sources.size());
+        core::Tensor vertex_map = core::Tensor::Arange(0, num_vertices, 1,
+                                                       core::Int64, device);
+        vertex_map.IndexSet(
+                {core::Tensor(welded_sources, {num_welded}, core::Int64,
+                              device)},
+                core::Tensor(welded_targets, {num_welded}, core::Int64,
+                             device));
+        triangles = vertex_map.IndexGet({triangles});
+    }
+
+    // Find the paths of the finer boundary half-edges from the end to the
+    // start of the coarse boundary half-edges, the finer triangles are on the
+    // other side of the boundary.
+    std::tie(half_edges, starts, ends) = GetBoundaryHalfEdges(triangles);
+    const std::vector<int64_t> edge_ids = half_edges.ToFlatVector<int64_t>();
+    const std::vector<int64_t> edge_starts = starts.ToFlatVector<int64_t>();
+    const std::vector<int64_t> edge_ends = ends.ToFlatVector<int64_t>();
+    std::vector<int64_t> edge_levels(edge_ids.size());
+    std::unordered_map<int64_t, std::vector<size_t>> outgoing_half_edges;
+    for (size_t i = 0; i < edge_ids.size(); ++i) {
+        edge_levels[i] = get_level(triangle_offsets, edge_ids[i] / 3);
+        outgoing_half_edges[edge_starts[i]].push_back(i);
+    }
+    std::vector<bool> is_used(edge_ids.size(), false);
+    // Vertices inserted into the triangle edges 3 * triangle + k.
+    std::unordered_map<int64_t, std::vector<int64_t>> edge_paths;
+    for (size_t e = 0; e < edge_ids.size(); ++e) {
+        std::unordered_map<int64_t, size_t> reached_by;
+        std::vector<int64_t> frontier = {edge_ends[e]};
+        bool found = false;
+        for (int depth = 0; depth < max_path_length && !found; ++depth) {
+            std::vector<int64_t> next_frontier;
+            for (int64_t v : frontier) {
+                auto it = outgoing_half_edges.find(v);
+                if (it == outgoing_half_edges.end()) continue;
+                for (size_t i : it->second) {
+                    const int64_t u = edge_ends[i];
+                    if (is_used[i] || edge_levels[i] >= edge_levels[e] ||
+                        u == edge_ends[e] || reached_by.count(u) > 0) {
+                        continue;
+                    }
+                    reached_by[u] = i;
+                    found = found || u == edge_starts[e];
+                    next_frontier.push_back(u);
+                }
+            }
+            frontier.swap(next_frontier);
+        }
+        if (!found) continue;
+
+        std::vector<int64_t> path;
+        for (int64_t v = edge_starts[e]; v != edge_ends[e];
+             v = edge_starts[reached_by[v]]) {
+            is_used[reached_by[v]] = true;
+            if (v != edge_starts[e]) path.push_back(v);
+        }
+        edge_paths[edge_ids[e]] = path;
+    }
+
+    // Split the triangles with paths on their edges into fans. With a single
+    // path, the fan is centered at the opposite vertex, otherwise at a new
+    // vertex at the centroid. The degenerate triangles are removed.
+    const core::Tensor corners = triangles.T().Contiguous();
+    core::Tensor keep = corners[0]
+                                .Ne(corners[1])
+                                .LogicalAnd(corners[1].Ne(corners[2]))
+                                .LogicalAnd(corners[2].Ne(corners[0]));
+    std::vector<int64_t> seam_triangles;
+    for (const auto &edge_path : edge_paths) {
+        seam_triangles.push_back(edge_path.first / 3);
+    }
+    std::sort(seam_triangles.begin(), seam_triangles.end());
+    seam_triangles.erase(
+            std::unique(seam_triangles.begin(), seam_triangles.end()),
+            seam_triangles.end());
+    const int64_t num_seam = int64_t(seam_triangles.size());
+    std::vector<int64_t> fan_triangles;
+    std::vector<float> center_positions, center_normals, center_colors;
+    if (num_seam > 0) {
+        const core::Tensor seam_indices(seam_triangles, {num_seam},
+                                        core::Int64, device);
+        keep.IndexSet({seam_indices},
+                      core::Tensor::Zeros({num_seam}, core::Bool, device));
+        const core::Tensor seam_corners = triangles.IndexGet({seam_indices});
+        const std::vector<int64_t> seam_vertices =
+                seam_corners.ToFlatVector<int64_t>();
+        // Attributes {S, 3, 3} of the corners of the split triangles.
+        const std::vector<float> corner_positions =
+                positions.IndexGet({seam_corners}).ToFlatVector<float>();
+        const std::vector<float> corner_normals =
+                normals.IndexGet({seam_corners}).ToFlatVector<float>();
+        std::vector<float> corner_colors;
+        if (has_colors) {
+            corner_colors =
+                    colors.IndexGet({seam_corners}).ToFlatVector<float>();
+        }
+        for (int64_t s = 0; s < num_seam; ++s) {
+            const int64_t t = seam_triangles[s];
+            const int64_t *triangle = &seam_vertices[3 * s];
+            if (triangle[0] == triangle[1] || triangle[1] == triangle[2] ||
+                triangle[2] == triangle[0]) {
+                continue;
+            }
+            std::vector<int64_t> polygon;
+            int num_paths = 0, path_edge = 0;
+            for (int k = 0; k < 3; ++k) {
+                polygon.push_back(triangle[k]);
+                auto it = edge_paths.find(3 * t + k);
+                if (it != edge_paths.end()) {
+                    polygon.insert(polygon.end(), it->second.begin(),
+                                   it->second.end());
+                    ++num_paths;
+                    path_edge = k;
+                }
+            }
+            if (num_paths == 1) {
+                const int64_t apex = triangle[(path_edge + 2) % 3];
+                std::rotate(polygon.begin(),
+                            std::find(polygon.begin(), polygon.end(), apex),
+                            polygon.end());
+                for (size_t j = 1; j + 1 < polygon.size(); ++j) {
+                    fan_triangles.insert(fan_triangles.end(),
+                                         {apex, polygon[j], polygon[j + 1]});
+                }
+                continue;
+            }
+            const int64_t center =
+                    num_vertices + int64_t(center_positions.size() / 3);
+            Eigen::Vector3f normal = Eigen::Vector3f::Zero();
+            for (int i = 0; i < 3; ++i) {
+                float position = 0, color = 0;
+                for (int k = 0; k < 3; ++k) {
+                    position += corner_positions[9 * s + 3 * k + i] / 3.0f;
+                    normal(i) += corner_normals[9 * s + 3 * k + i];
+                    if (has_colors) {
+                        color += corner_colors[9 * s + 3 * k + i] / 3.0f;
+                    }
+                }
+                center_positions.push_back(position);
+                if (has_colors) center_colors.push_back(color);
+            }
+            normal.normalize();
+            center_normals.insert(center_normals.end(), normal.data(),
+                                  normal.data() + 3);
+            for (size_t j = 0; j < polygon.size(); ++j) {
+                fan_triangles.insert(
+                        fan_triangles.end(),
+                        {center, polygon[j],
+                         polygon[(j + 1) % polygon.size()]});
+            }
+        }
+    }
+    triangles = triangles.IndexGet({keep});
+    if (!fan_triangles.empty()) {
+        triangles = core::Concatenate(
+                {triangles,
+                 core::Tensor(fan_triangles,
+                              {int64_t(fan_triangles.size() / 3), 3},
+                              core::Int64, device)},
+                0);
+    }
+    if (!center_positions.empty()) {
+        const int64_t num_centers = int64_t(center_positions.size() / 3);
+        positions = core::Concatenate(
+                {positions, core::Tensor(center_positions, {num_centers, 3},
+                                         core::Float32, device)},
+                0);
+        normals = core::Concatenate(
+                {normals, core::Tensor(center_normals, {num_centers, 3},
+                                       core::Float32, device)},
+                0);
+        if (has_colors) {
+            colors = core::Concatenate(
+                    {colors, core::Tensor(center_colors, {num_centers, 3},
+                                          core::Float32, device)},
+                    0);
+        }
+    }
+
+    // Remove the welded vertices.
+    const int64_t num_stitched_vertices = positions.GetLength();
+    const core::Tensor triangle_vertices = triangles.Reshape({-1});
+    core::Tensor is_referenced = core::Tensor::Zeros({num_stitched_vertices},
+                                                     core::Bool, device);
+    is_referenced.IndexSet({triangle_vertices},
+                           core::Tensor::Ones({triangle_vertices.GetLength()},
+                                              core::Bool, device));
+    const core::Tensor kept_vertices = is_referenced.NonZero().View({-1});
+    core::Tensor new_indices = core::Tensor::Full<int64_t>(
+            {num_stitched_vertices}, -1, core::Int64, device);
+    new_indices.IndexSet({kept_vertices},
+                         core::Tensor::Arange(0, kept_vertices.GetLength(), 1,
+                                              core::Int64, device));
+    TriangleMesh mesh(positions.IndexGet({kept_vertices}),
+                      new_indices.IndexGet({triangles}).To(core::Int32));
+    mesh.SetVertexNormals(normals.IndexGet({kept_vertices}));
+    if (has_colors) {
+        mesh.SetVertexColors(colors.IndexGet({kept_vertices}));
+    }
+    return mesh;
+}
+
+MultiResolutionVoxelBlockGrid::MultiResolutionVoxelBlockGrid(
+        const std::vector<std::string> &attr_names,
+        const std::vector<core::Dtype> &attr_dtypes,
+        const std::vector<core::SizeVector> &attr_channels,
+        float voxel_size,
+        int64_t block_resolution,
+        int64_t block_count,
+        int64_t num_levels,
+        float level_depth,
+        float level_overlap,
+        const core::Device &device,
+        const core::HashBackendType &backend)
+    : attr_names_(attr_names),
+      attr_dtypes_(attr_dtypes),
+      attr_channels_(attr_channels),
+      voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      level_depth_(level_depth),
+      level_overlap_(level_overlap),
+      device_(device),
+      backend_(backend) {
+    if (num_levels < 1) {
+        utility::LogError("num_levels must be positive, but got {}.",
+                          num_levels);
+    }
+    if (block_resolution % (int64_t(1) << (num_levels - 1)) != 0) {
+        utility::LogError(
+                "block_resolution must be divisible by 2^(num_levels - 1) to "
+                "align the blocks with the cubes of all the coarser levels, "
+                "but got {}.",
+                block_resolution);
+    }
+    if (level_depth <= 0) {
+        utility::LogError("level_depth must be positive, but got {}.",
+                          level_depth);
+    }
+    if (level_overlap < 0 || level_overlap >= 1) {
+        utility::LogError("level_overlap must be in [0, 1), but got {}.",
+                          level_overlap);
+    }
+    if (std::find(attr_names.begin(), attr_names.end(), "tsdf") ==
+                attr_names.end() ||
+        std::find(attr_names.begin(), attr_names.end(), "weight") ==
+                attr_names.end()) {
+        utility::LogError("The attributes tsdf and weight are required.");
+    }
+
+    for (int64_t level = 0; level < num_levels; ++level) {
+        levels_.emplace_back(attr_names, attr_dtypes, attr_channels,
+                             voxel_size * std::ldexp(1.0f, int(level)),
+                             block_resolution, block_count, device, backend);
+    }
+}
+
+VoxelBlockGrid &MultiResolutionVoxelBlockGrid::GetLevel(int64_t level) {
+    if (level < 0 || level >= GetNumLevels()) {
+        utility::LogError("Level {} is out of range [0, {}).", level,
+                          GetNumLevels());
+    }
+    return levels_[level];
+}
+
+float MultiResolutionVoxelBlockGrid::GetVoxelSize(int64_t level) const {
+    return voxel_size_ * std::ldexp(1.0f, int(level));
+}
+
+std::pair<float, float> MultiResolutionVoxelBlockGrid::GetDepthRange(
+        int64_t level) const {
+    const float depth_min =
+            level == 0 ? 0.0f
+                       : level_depth_ * std::ldexp(1.0f, int(level) - 1) *
+                                 (1.0f - level_overlap_);
+    const float depth_max =
+            level + 1 == GetNumLevels()
+                    ? std::numeric_limits<float>::infinity()
+                    : level_depth_ * std::ldexp(1.0f, int(level)) *
+                              (1.0f + level_overlap_);
+    return std::make_pair(depth_min, depth_max);
+}
+
+Image MultiResolutionVoxelBlockGrid::MaskDepth(const Image &depth,
+                                               int64_t level,
+                                               float depth_scale) const {
+    const core::Tensor depth_tensor = depth.AsTensor();
+    const core::Tensor z = depth_tensor.To(core::Float32) / depth_scale;
+    float depth_min, depth_max;
+    std::tie(depth_min, depth_max) = GetDepthRange(level);
+    core::Tensor mask = z.Ge(depth_min);
+    if (std::isfinite(depth_max)) {
+        mask = mask.LogicalAnd(z.Lt(depth_max));
+    }
+    return Image(depth_tensor * mask.To(depth_tensor.GetDtype()));
+}
+
+core::Tensor MultiResolutionVoxelBlockGrid::GetBandWeights(
+        const core::Tensor &depth, int64_t level) const {
+    // Band boundaries without the overlaps.
+    const float band_min =
+            level == 0 ? 0.0f
+                       : level_depth_ * std::ldexp(1.0f, int(level) - 1);
+    const float band_max = level_depth_ * std::ldexp(1.0f, int(level));
+    float depth_min, depth_max;
+    std::tie(depth_min, depth_max) = GetDepthRange(level);
+
+    core::Tensor weights = depth.Gt(0.0f).To(core::Float32);
+    if (level > 0) {
+        weights = weights * (level_overlap_ > 0
+                                     ? ((depth - depth_min) /
+                                        (band_min - depth_min))
+                                               .Clip(0.0f, 1.0f)
+                                     : depth.Ge(band_min).To(core::Float32));
+    }
+    if (level + 1 < GetNumLevels()) {
+        weights = weights * (level_overlap_ > 0
+                                     ? ((depth_max - depth) /
+                                        (depth_max - band_max))
+                                               .Clip(0.0f, 1.0f)
+                                     : depth.Lt(band_max).To(core::Float32));
+    }
+    return weights;
+}
+
+std::vector<core::Tensor>
+MultiResolutionVoxelBlockGrid::GetUniqueBlockCoordinates(
+        const Image &depth,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        float depth_scale,
+        float depth_max,
+        float trunc_voxel_multiplier) {
+    CheckDepthTensor(depth.AsTensor());
+    std::vector<core::Tensor> block_coords;
+    for (int64_t level = 0; level < GetNumLevels(); ++level) {
+        if (GetDepthRange(level).first >= depth_max) {
+            block_coords.push_back(
+                    core::Tensor({0, 3}, core::Int32, device_));
+            continue;
+        }
+        block_coords.push_back(levels_[level].GetUniqueBlockCoordinates(
+                MaskDepth(depth, level, depth_scale), intrinsic, extrinsic,
+                depth_scale, depth_max, trunc_voxel_multiplier));
+    }
+    return block_coords;
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(
+        const std::vector<core::Tensor> &block_coords,
+        const Image &depth,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        float depth_scale,
+        float depth_max,
+        float trunc_voxel_multiplier) {
+    Integrate(block_coords, depth, Image(), intrinsic, extrinsic, depth_scale,
+              depth_max, trunc_voxel_multiplier);
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(
+        const std::vector<core::Tensor> &block_coords,
+        const Image &depth,
+        const Image &color,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        float depth_scale,
+        float depth_max,
+        float trunc_voxel_multiplier) {
+    if (int64_t(block_coords.size()) != GetNumLevels()) {
+        utility::LogError(
+                "Expected block coordinates of {} levels, but got {}.",
+                GetNumLevels(), block_coords.size());
+    }
+    CheckDepthTensor(depth.AsTensor());
+    for (int64_t level = 0; level < GetNumLevels(); ++level) {
+        if (block_coords[level].GetLength() == 0) continue;
+        levels_[level].Integrate(block_coords[level],
+                                 MaskDepth(depth, level, depth_scale), color,
+                                 intrinsic, extrinsic, depth_scale, depth_max,
+                                 trunc_voxel_multiplier);
+    }
+}
+
+TensorMap MultiResolutionVoxelBlockGrid::RayCast(
+        const std::vector<core::Tensor> &block_coords,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        const std::vector<std::string> attrs,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold,
+        float trunc_voxel_multiplier,
+        int range_map_down_factor) {
+    if (int64_t(block_coords.size()) != GetNumLevels()) {
+        utility::LogError(
+                "Expected block coordinates of {} levels, but got {}.",
+                GetNumLevels(), block_coords.size());
+    }
+    std::vector<std::string> level_attrs = {"depth"};
+    for (const std::string &attr : attrs) {
+        if (attr != "depth" && attr != "vertex" && attr != "normal" &&
+            attr != "color") {
+            utility::LogError(
+                    "Unsupported attribute {}, only vertex, depth, color and "
+                    "normal can be blended across levels.",
+                    attr);
+        }
+        if (attr != "depth") level_attrs.push_back(attr);
+    }
+
+    // Render each level in its depth band.
+    std::vector<TensorMap> renderings;
+    std::vector<core::Tensor> depths, weights;
+    std::vector<int64_t> rendered_levels;
+    const float depth_none = std::numeric_limits<float>::max();
+    core::Tensor depth_nearest = core::Tensor::Full(
+            {height, width, 1}, depth_none, core::Float32, device_);
+    for (int64_t level = 0; level < GetNumLevels(); ++level) {
+        float level_depth_min, level_depth_max;
+        std::tie(level_depth_min, level_depth_max) = GetDepthRange(level);
+        level_depth_min = std::max(level_depth_min, depth_min);
+        level_depth_max = std::min(level_depth_max, depth_max);
+        if (level_depth_min >= level_depth_max ||
+            block_coords[level].GetLength() == 0 ||
+            levels_[level].GetHashMap().Size() == 0) {
+            continue;
+        }
+        renderings.push_back(levels_[level].RayCast(
+                block_coords[level], intrinsic, extrinsic, width, height,
+                level_attrs, depth_scale, level_depth_min, level_depth_max,
+                weight_threshold, trunc_voxel_multiplier,
+                range_map_down_factor));
+        const core::Tensor depth = renderings.back()["depth"] / depth_scale;
+        const core::Tensor weight = GetBandWeights(depth, level);
+        const core::Tensor hit_depth =
+                depth + weight.Le(0.0f).To(core::Float32) * depth_none;
+        const core::Tensor closer = hit_depth.Lt(depth_nearest);
+        depth_nearest = closer.To(core::Float32) * hit_depth +
+                        closer.LogicalNot().To(core::Float32) * depth_nearest;
+        depths.push_back(depth);
+        weights.push_back(weight);
+        rendered_levels.push_back(level);
+    }
+
+    // Blend the hits of the levels within the truncation distance of the
+    // nearest hit.
+    core::Tensor weight_sum =
+            core::Tensor::Zeros({height, width, 1}, core::Float32, device_);
+    std::vector<core::Tensor> blended;
+    for (const std::string &attr : level_attrs) {
+        const int64_t channels = attr == "depth" ? 1 : 3;
+        blended.push_back(core::Tensor::Zeros({height, width, channels},
+                                              core::Float32, device_));
+    }
+    for (size_t i = 0; i < rendered_levels.size(); ++i) {
+        const float sdf_trunc =
+                GetVoxelSize(rendered_levels[i]) * trunc_voxel_multiplier;
+        const core::Tensor weight =
+                weights[i] * (depths[i] - depth_nearest)
+                                     .Le(sdf_trunc)
+                                     .To(core::Float32);
+        weight_sum = weight_sum + weight;
+        for (size_t k = 0; k < level_attrs.size(); ++k) {
+            blended[k] = blended[k] + weight * renderings[i][level_attrs[k]];
+        }
+    }
+
+    const core::Tensor weight_sum_safe =
+            weight_sum + weight_sum.Le(0.0f).To(core::Float32);
+    TensorMap renderings_map("depth");
+    for (size_t k = 0; k < level_attrs.size(); ++k) {
+        core::Tensor rendering = blended[k] / weight_sum_safe;
+        if (level_attrs[k] == "normal") {
+            const core::Tensor norm = (rendering * rendering)
+                                              .Sum({2}, true)
+                                              .Sqrt();
+            rendering =
+                    rendering / (norm + norm.Le(0.0f).To(core::Float32));
+        }
+        renderings_map[level_attrs[k]] = rendering;
+    }
+    return renderings_map;
+}
+
+VoxelBlockGrid MultiResolutionVoxelBlockGrid::CreateTransitionGrid(
+        int64_t level,
+        const core::Tensor &ring_keys,
+        std::vector<VoxelBlockGrid> &transition_grids,
+        float weight_threshold) {
+    core::HashMap hashmap = levels_[level].GetHashMap();
+    const core::Tensor buf_indices = hashmap.GetActiveIndices().To(core::Int64);
+    const core::Tensor keys = core::Concatenate(
+            {hashmap.GetKeyTensor().IndexGet({buf_indices}), ring_keys}, 0);
+
+    // Copy of the level with empty ring blocks.
+    std::vector<core::Tensor> values;
+    for (const core::Tensor &value : hashmap.GetValueTensors()) {
+        core::SizeVector ring_shape = value.GetShape();
+        ring_shape[0] = ring_keys.GetLength();
+        values.push_back(core::Concatenate(
+                {value.IndexGet({buf_indices}),
+                 core::Tensor::Zeros(ring_shape, value.GetDtype(), device_)},
+                0));
+    }
+    const float voxel_size = GetVoxelSize(level);
+    VoxelBlockGrid grid(attr_names_, attr_dtypes_, attr_channels_, voxel_size,
+                        block_resolution_, keys.GetLength(), device_,
+                        backend_);
+    core::HashMap grid_hashmap = grid.GetHashMap();
+    core::Tensor grid_buf_indices, masks;
+    grid_hashmap.Insert(keys, values, grid_buf_indices, masks);
+
+    // Sample the voxels that Marching Cubes would skip from the transition
+    // grid of the nearest coarser level that observed them.
+    core::Tensor voxel_coords, flattened_indices;
+    std::tie(voxel_coords, flattened_indices) =
+            grid.GetVoxelCoordinatesAndFlattenedIndices();
+    core::Tensor tsdf_values = grid.GetAttribute("tsdf").View({-1});
+    core::Tensor weight_values = grid.GetAttribute("weight").View({-1});
+    const core::Tensor unobserved =
+            weight_values.IndexGet({flattened_indices})
+                    .To(core::Float32)
+                    .Le(weight_threshold);
+    voxel_coords = voxel_coords.IndexGet({unobserved});
+    flattened_indices = flattened_indices.IndexGet({unobserved});
+
+    const bool sample_color = std::find(attr_names_.begin(), attr_names_.end(),
+                                        "color") != attr_names_.end();
+    for (int64_t coarser = level + 1;
+         coarser < GetNumLevels() && flattened_indices.GetLength() > 0;
+         ++coarser) {
+        if (transition_grids[coarser].GetHashMap().Size() == 0) continue;
+        VoxelSamples samples =
+                SampleVoxels(transition_grids[coarser], voxel_coords,
+                             GetVoxelSize(coarser), block_resolution_,
+                             sample_color);
+        const core::Tensor indices =
+                flattened_indices.IndexGet({samples.valid});
+        const core::Tensor invalid = samples.valid.LogicalNot();
+        voxel_coords = voxel_coords.IndexGet({invalid});
+        flattened_indices = flattened_indices.IndexGet({invalid});
+        if (indices.GetLength() == 0) continue;
+
+        // The TSDF is normalized by the truncation distance, which doubles
+        // with each level.
+        const core::Tensor tsdf =
+                (samples.tsdf.IndexGet({samples.valid}) *
+                 std::ldexp(1.0f, int(coarser - level)))
+                        .Clip(-1.0f, 1.0f);
+        tsdf_values.IndexSet(
+                {indices}, tsdf_values.GetDtype() == core::Int16
+                                   ? (tsdf * 32767.0f).Round().To(core::Int16)
+                                   : tsdf);
+        weight_values.IndexSet(
+                {indices},
+                EncodeValues(samples.weight.IndexGet({samples.valid}),
+                             weight_values.GetDtype()));
+        if (sample_color) {
+            core::Tensor color_values =
+                    grid.GetAttribute("color").View({-1, 3});
+            color_values.IndexSet(
+                    {indices},
+                    EncodeValues(samples.color.IndexGet({samples.valid}),
+                                 color_values.GetDtype()));
+        }
+    }
+    return grid;
+}
+
+TriangleMesh MultiResolutionVoxelBlockGrid::ExtractTriangleMesh(
+        float weight_threshold) {
+    // The levels are extended by their rings from coarse to fine, so that
+    // the rings are sampled from the extended coarser levels.
+    const int64_t num_levels = GetNumLevels();
+    std::vector<VoxelBlockGrid> transition_grids(levels_.begin(),
+                                                 levels_.end());
+    // Blocks of each level whose cubes are meshed by the level.
+    std::vector<core::HashSet> meshed_block_sets;
+    std::vector<TriangleMesh> level_meshes(num_levels);
+    for (int64_t level = 0; level < num_levels; ++level) {
+        meshed_block_sets.emplace_back(
+                std::max<int64_t>(levels_[level].GetHashMap().Size(), 1),
+                core::Int32, core::SizeVector{3}, device_);
+    }
+    for (int64_t level = num_levels - 1; level >= 0; --level) {
+        core::HashMap hashmap = levels_[level].GetHashMap();
+        const int64_t block_count = hashmap.Size();
+        if (block_count == 0) continue;
+        core::HashSet &meshed_block_set = meshed_block_sets[level];
+        const core::Tensor keys = GetActiveKeys(hashmap);
+        meshed_block_set.Insert(keys);
+
+        std::vector<int64_t> coarser_levels;
+        for (int64_t coarser = level + 1; coarser < num_levels; ++coarser) {
+            if (transition_grids[coarser].GetHashMap().Size() > 0) {
+                coarser_levels.push_back(coarser);
+            }
+        }
+        if (coarser_levels.empty()) {
+            level_meshes[level] =
+                    levels_[level].ExtractTriangleMesh(weight_threshold);
+            continue;
+        }
+
+        // The ring of the blocks is sampled from the nearest coarser level
+        // that contains it, so that the vertices on the outer faces of the
+        // ring lie on the coarse cube edges. The cubes of the outer ring
+        // blocks only provide the corners of the cubes of the ring.
+        auto has_ancestor = [&](const core::Tensor &ring) {
+            core::Tensor mask = core::Tensor::Zeros({ring.GetLength()},
+                                                    core::Bool, device_);
+            for (int64_t coarser : coarser_levels) {
+                mask = mask.LogicalOr(ContainsKeys(
+                        transition_grids[coarser].GetHashMap(),
+                        GetCellKeys(ring.To(core::Float32),
+                                    std::ldexp(1.0f, int(coarser - level)))));
+            }
+            return mask;
+        };
+        core::HashSet block_set(27 * block_count, core::Int32, {3}, device_);
+        block_set.Insert(keys);
+        core::Tensor ring = InsertNewKeys(block_set, ShiftKeys(keys, -1));
+        ring = ring.IndexGet({has_ancestor(ring)});
+        core::Tensor outer_ring = InsertNewKeys(block_set, ShiftKeys(ring, 0));
+        outer_ring = outer_ring.IndexGet({has_ancestor(outer_ring)});
+        if (ring.GetLength() > 0) meshed_block_set.Insert(ring);
+
+        transition_grids[level] = CreateTransitionGrid(
+                level, core::Concatenate({ring, outer_ring}, 0),
+                transition_grids, weight_threshold);
+        level_meshes[level] = SelectTrianglesByCells(
+                transition_grids[level].ExtractTriangleMesh(weight_threshold),
+                meshed_block_set, GetVoxelSize(level) * block_resolution_,
+                true);
+    }
+
+    // Remove the triangles in the blocks meshed by the finer levels.
+    std::vector<TriangleMesh> meshes;
+    std::vector<int64_t> mesh_levels;
+    for (int64_t level = 0; level < num_levels; ++level) {
+        TriangleMesh mesh = level_meshes[level];
+        for (int64_t finer = 0; finer < level; ++finer) {
+            mesh = SelectTrianglesByCells(
+                    mesh, meshed_block_sets[finer],
+                    GetVoxelSize(finer) * block_resolution_, false);
+        }
+        if (mesh.HasTriangleIndices() &&
+            mesh.GetTriangleIndices().GetLength() > 0) {
+            meshes.push_back(mesh);
+            mesh_levels.push_back(level);
+        }
+    }
+    if (meshes.empty()) return TriangleMesh(device_);
+
+    // The seam vertices of the levels coincide up to rounding. A boundary
+    // path across a cube face of level l has fewer than 2^(l + 2) edges of a
+    // finer level.
+    return StitchLevelMeshes(meshes, mesh_levels, voxel_size_,
+                             0.01f * voxel_size_, 4 << (num_levels - 1));
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
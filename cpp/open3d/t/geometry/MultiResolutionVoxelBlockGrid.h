@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class MultiResolutionVoxelBlockGrid
+/// \brief A TSDF volume whose voxel blocks have different voxel sizes.
+///
+/// Each block carries a level l and has the voxel size voxel_size * 2^l, the
+/// blocks of each level are stored in a separate VoxelBlockGrid. The level of
+/// an observation is chosen at integration time by its depth, so that the
+/// voxel size grows with the distance to the camera: level 0 takes the
+/// depths below level_depth and level l > 0 takes the depths in
+/// [level_depth * 2^(l - 1), level_depth * 2^l), the last level takes all
+/// the remaining depths. The depth bands of neighboring levels overlap by
+/// the fraction level_overlap of the band boundary, so that both levels
+/// observe the surfaces near the boundary.
+///
+/// RayCast renders each level in its depth band and blends the levels in the
+/// overlaps by the position in the band. ExtractTriangleMesh extends the
+/// blocks of each level by a ring of blocks sampled from the nearest coarser
+/// level, from coarse to fine, and removes the coarse triangles in the fine
+/// and ring blocks. The levels then meet at coarse cube faces, where the
+/// vertices on the coarse cube edges coincide. These vertices are welded, and
+/// the coarse triangles at the seams are split into fans over the fine
+/// boundary edges across the coarse cube faces, so that the seams between any
+/// two levels are closed.
+///
+/// All the levels have to be integrated with the same trunc_voxel_multiplier
+/// so that their normalized TSDFs can be converted into each other.
+class MultiResolutionVoxelBlockGrid {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param attr_names Attributes of the voxels, "tsdf" and "weight" are
+    /// required, see VoxelBlockGrid for the supported dtypes.
+    /// \param attr_dtypes Dtypes of the attributes.
+    /// \param attr_channels Channels of the attributes.
+    /// \param voxel_size Voxel size of level 0.
+    /// \param block_resolution Block resolution of all the levels. Must be
+    /// divisible by 2^(num_levels - 1).
+    /// \param block_count Initial capacity of the block hash map per level.
+    /// \param num_levels Number of levels.
+    /// \param level_depth Depth in meters at which level 1 starts.
+    /// \param level_overlap Fraction of the band boundaries by which the
+    /// depth bands of neighboring levels overlap, in [0, 1).
+    /// \param device Device of the grids.
+    /// \param backend Hash backend of the grids.
+    MultiResolutionVoxelBlockGrid(
+            const std::vector<std::string> &attr_names,
+            const std::vector<core::Dtype> &attr_dtypes,
+            const std::vector<core::SizeVector> &attr_channels,
+            float voxel_size = 0.0058,
+            int64_t block_resolution = 16,
+            int64_t block_count = 10000,
+            int64_t num_levels = 3,
+            float level_depth = 1.0f,
+            float level_overlap = 0.2f,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Returns the number of levels.
+    int64_t GetNumLevels() const {
+        return static_cast<int64_t>(levels_.size());
+    }
+
+    /// Returns the voxel block grid of a level, e.g. to save it or to access
+    /// its blocks.
+    VoxelBlockGrid &GetLevel(int64_t level);
+
+    /// Returns the voxel size of a level.
+    float GetVoxelSize(int64_t level) const;
+
+    /// Returns the depth band [min, max) in meters that is integrated into a
+    /// level, including the overlaps with the neighboring levels.
+    std::pair<float, float> GetDepthRange(int64_t level) const;
+
+    /// Get the active block coordinates of each level from a depth image.
+    /// Each level only takes the depths in its depth band. The coordinates
+    /// are not activated in the grids.
+    std::vector<core::Tensor> GetUniqueBlockCoordinates(
+            const Image &depth,
+            const core::Tensor &intrinsic,
+            const core::Tensor &extrinsic,
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            float trunc_voxel_multiplier = 8.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Integrate an RGB-D frame into each level in the block coordinates from
+    /// GetUniqueBlockCoordinates, using only the depths in its depth band.
+    void Integrate(const std::vector<core::Tensor> &block_coords,
+                   const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Similar to RGB-D integration, but only applied to depth.
+    void Integrate(const std::vector<core::Tensor> &block_coords,
+                   const Image &depth,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Ray cast each level in its depth band and blend the levels.
+    /// The nearest hit with a non-zero band weight wins, and the hits of the
+    /// other levels within their truncation distance from it are blended by
+    /// their band weights, which fall off linearly in the overlaps.
+    /// Supported attributes: vertex, depth, color, normal. The depth is always
+    /// returned.
+    TensorMap RayCast(const std::vector<core::Tensor> &block_coords,
+                      const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f,
+                      float trunc_voxel_multiplier = 8.0f,
+                      int range_map_down_factor = 8);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract a mesh of all the levels with Marching Cubes, with the seams
+    /// between the levels stitched. The stitching runs on the host.
+    TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f);
+
+private:
+    /// Returns the depth image with the depths outside of the depth band of
+    /// the level set to 0.
+    Image MaskDepth(const Image &depth, int64_t level, float depth_scale) const;
+
+    /// Returns the band weights of the depths {H, W, 1} in meters for a
+    /// level, 1 inside the band, falling off linearly in the overlaps.
+    core::Tensor GetBandWeights(const core::Tensor &depth, int64_t level) const;
+
+    /// Returns a copy of a level extended by the ring blocks, with the voxels
+    /// at or below the weight threshold sampled from the transition grid of
+    /// the nearest coarser level that observed them.
+    VoxelBlockGrid CreateTransitionGrid(
+            int64_t level,
+            const core::Tensor &ring_keys,
+            std::vector<VoxelBlockGrid> &transition_grids,
+            float weight_threshold);
+
+    std::vector<std::string> attr_names_;
+    std::vector<core::Dtype> attr_dtypes_;
+    std::vector<core::SizeVector> attr_channels_;
+    float voxel_size_;
+    int64_t block_resolution_;
+    float level_depth_;
+    float level_overlap_;
+    core::Device device_;
+    core::HashBackendType backend_;
+
+    std::vector<VoxelBlockGrid> levels_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
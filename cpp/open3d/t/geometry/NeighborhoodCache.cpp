@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/NeighborhoodCache.h"
+
+#include <algorithm>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Returns a hash of the bits of the points, computed on their device. Each
+/// 32-bit word is weighted by a distinct odd number, so that changing a single
+/// word changes the hash.
+static uint64_t HashPoints(const core::Tensor &points) {
+    const core::Tensor points_c = points.Contiguous();
+    const int64_t num_words =
+            points_c.NumElements() * points_c.GetDtype().ByteSize() / 4;
+    if (num_words == 0) {
+        return 0;
+    }
+    const core::Tensor words =
+            core::Tensor({num_words}, {1},
+                         const_cast<void *>(points_c.GetDataPtr()),
+                         core::UInt32, points_c.GetBlob())
+                    .To(core::UInt64);
+    const core::Tensor weights = core::Tensor::Arange(
+            1, 2 * num_words, 2, core::UInt64, points_c.GetDevice());
+    return (words * weights).Sum({0}).Item<uint64_t>();
+}
+
+NeighborhoodCache::NeighborhoodCache(const core::Tensor &points,
+                                     const utility::optional<int> max_nn,
+                                     const utility::optional<double> radius)
+    : max_nn_(max_nn), radius_(radius) {
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    points_blob_ = points.GetBlob();
+    points_data_ptr_ = points.GetDataPtr();
+    points_hash_ = HashPoints(points);
+    points_shape_ = points.GetShape();
+    points_strides_ = points.GetStrides();
+    points_dtype_ = points.GetDtype();
+    device_ = points.GetDevice();
+    if (max_nn.has_value() && max_nn.value() <= 0) {
+        utility::LogError("max_nn must be positive, but got {}.",
+                          max_nn.value());
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("radius must be positive, but got {}.",
+                          radius.value());
+    }
+
+    const int64_t num_points = points.GetLength();
+    const core::Tensor points_d = points.Contiguous();
+    core::nns::NearestNeighborSearch tree(points_d, core::Int32);
+
+    if (radius.has_value() && max_nn.has_value()) {
+        search_type_ = SearchType::Hybrid;
+        if (!tree.HybridIndex(radius.value())) {
+            utility::LogError("Building HybridIndex failed.");
+        }
+        std::tie(indices_, distances_, counts_) =
+                tree.HybridSearch(points_d, radius.value(), max_nn.value());
+    } else if (!radius.has_value() && max_nn.has_value()) {
+        search_type_ = SearchType::KNN;
+        if (!tree.KnnIndex()) {
+            utility::LogError("Building KnnIndex failed.");
+        }
+        std::tie(indices_, distances_) =
+                tree.KnnSearch(points_d, max_nn.value());
+        indices_ = indices_.To(core::Int32).Contiguous();
+        distances_ = distances_.Contiguous();
+
+        // All points have min(max_nn, num_points) neighbors.
+        const int fill_value = static_cast<int>(
+                std::min<int64_t>(max_nn.value(), num_points));
+        counts_ = core::Tensor::Full({num_points}, fill_value, core::Int32,
+                                     points.GetDevice());
+    } else if (radius.has_value() && !max_nn.has_value()) {
+        search_type_ = SearchType::Radius;
+        if (!tree.FixedRadiusIndex(radius.value())) {
+            utility::LogError("Building FixedRadiusIndex failed.");
+        }
+        std::tie(indices_, distances_, counts_) =
+                tree.FixedRadiusSearch(points_d, radius.value());
+        counts_ = counts_.To(core::Int32);
+    } else {
+        utility::LogError("Both max_nn and radius are none.");
+    }
+}
+
+bool NeighborhoodCache::IsValid() const {
+    const std::shared_ptr<core::Blob> blob = points_blob_.lock();
+    if (!blob) {
+        return false;
+    }
+    const core::Tensor points(points_shape_, points_strides_,
+                              const_cast<void *>(points_data_ptr_),
+                              points_dtype_, blob);
+    return HashPoints(points) == points_hash_;
+}
+
+bool NeighborhoodCache::IsValidFor(const core::Tensor &points) const {
+    return points.GetBlob() != nullptr &&
+           points.GetBlob() == points_blob_.lock() &&
+           points.GetDataPtr() == points_data_ptr_ &&
+           points.GetShape() == points_shape_ &&
+           points.GetStrides() == points_strides_ &&
+           points.GetDtype() == points_dtype_ &&
+           HashPoints(points) == points_hash_;
+}
+
+std::string NeighborhoodCache::ToString() const {
+    if (!IsValid()) {
+        return "NeighborhoodCache (invalid)";
+    }
+    switch (search_type_) {
+        case SearchType::KNN:
+            return fmt::format("NeighborhoodCache [KNN, max_nn: {}] on {}",
+                               max_nn_.value(), device_.ToString());
+        case SearchType::Radius:
+            return fmt::format("NeighborhoodCache [Radius, radius: {}] on {}",
+                               radius_.value(), device_.ToString());
+        case SearchType::Hybrid:
+        default:
+            return fmt::format(
+                    "NeighborhoodCache [Hybrid, max_nn: {}, radius: {}] on {}",
+                    max_nn_.value(), radius_.value(), device_.ToString());
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
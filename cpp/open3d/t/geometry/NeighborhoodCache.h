@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class NeighborhoodCache
+/// \brief Neighbors of all points of a point set, computed once and reused by
+/// all operations that need the same neighborhood.
+///
+/// The search is selected in the same way as in PointCloud::EstimateNormals:
+/// KNN search if only max_nn is given, radius search if only radius is given
+/// and hybrid search if both are given. The query points are the points
+/// themselves, i.e. every point is its own neighbor.
+///
+/// - KNN and hybrid search:
+///     - indices: Int32 tensor of shape {n, k}. For hybrid search k is max_nn
+///       and unused entries are -1. For KNN search k is min(max_nn, n).
+///     - distances: Squared distances of the same shape as indices.
+///     - counts: Int32 tensor of shape {n} with the number of valid neighbors.
+/// - Radius search:
+///     - indices: Int32 tensor of shape {num_neighbors}.
+///     - distances: Squared distances of shape {num_neighbors}.
+///     - counts: Int32 tensor of shape {n + 1} with the row splits, i.e. the
+///       neighbors of point i are in [counts[i], counts[i + 1]).
+///
+/// The cache is keyed on the memory of the points and a hash of their values,
+/// which is computed on their device when the cache is built and checked on
+/// every validity check. The cache becomes invalid when the points are
+/// modified in place, by any means, or when their memory is freed. The cache
+/// does not keep the points alive.
+class NeighborhoodCache {
+public:
+    enum class SearchType { KNN, Radius, Hybrid };
+
+    /// \brief Constructs an empty, invalid cache.
+    NeighborhoodCache() {}
+
+    /// \brief Computes the neighbors of all \p points.
+    ///
+    /// \param points Float32 or Float64 tensor of shape {n, 3}.
+    /// \param max_nn [optional] Neighbor search max neighbors parameter.
+    /// \param radius [optional] Neighbor search radius parameter.
+    NeighborhoodCache(const core::Tensor &points,
+                      const utility::optional<int> max_nn,
+                      const utility::optional<double> radius);
+
+    /// \brief Text description.
+    std::string ToString() const;
+
+    /// Returns the search type used to compute the neighbors.
+    SearchType GetSearchType() const { return search_type_; }
+
+    /// Returns the max neighbors parameter used for the search.
+    utility::optional<int> GetMaxNN() const { return max_nn_; }
+
+    /// Returns the radius parameter used for the search.
+    utility::optional<double> GetRadius() const { return radius_; }
+
+    /// Returns the neighbor indices.
+    const core::Tensor &GetIndices() const { return indices_; }
+
+    /// Returns the squared distances to the neighbors.
+    const core::Tensor &GetDistances() const { return distances_; }
+
+    /// Returns the neighbor counts for KNN and hybrid search or the row
+    /// splits for radius search.
+    const core::Tensor &GetCounts() const { return counts_; }
+
+    /// Returns true if the cache has been computed and the points it has been
+    /// computed for still exist and have not been modified since.
+    bool IsValid() const;
+
+    /// Returns true if the cache is valid and has been computed for the
+    /// \p points tensor, i.e. the tensors share the same memory, shape,
+    /// strides and dtype.
+    bool IsValidFor(const core::Tensor &points) const;
+
+    /// Returns true if the cache has been computed with the search parameters
+    /// \p max_nn and \p radius.
+    bool Matches(const utility::optional<int> max_nn,
+                 const utility::optional<double> radius) const {
+        return max_nn_ == max_nn && radius_ == radius;
+    }
+
+private:
+    SearchType search_type_ = SearchType::KNN;
+    utility::optional<int> max_nn_;
+    utility::optional<double> radius_;
+    core::Tensor indices_;
+    core::Tensor distances_;
+    core::Tensor counts_;
+    /// Key of the points the cache has been computed for.
+    std::weak_ptr<core::Blob> points_blob_;
+    const void *points_data_ptr_ = nullptr;
+    uint64_t points_hash_ = 0;
+    core::SizeVector points_shape_;
+    core::SizeVector points_strides_;
+    core::Dtype points_dtype_;
+    core::Device device_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
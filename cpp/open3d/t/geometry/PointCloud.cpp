@@ -7,12 +7,6 @@
 
 #include "open3d/t/geometry/PointCloud.h"
 
-#include <libqhullcpp/PointCoordinates.h>
-#include <libqhullcpp/Qhull.h>
-#include <libqhullcpp/QhullFacet.h>
-#include <libqhullcpp/QhullFacetList.h>
-#include <libqhullcpp/QhullVertexSet.h>
-
 #include <Eigen/Core>
 #include <algorithm>
 #include <limits>
@@ -170,6 +164,7 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
 PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     core::AssertTensorShape(transformation, {4, 4});
 
+    InvalidateNeighborhoodCache();
     kernel::transform::TransformPoints(transformation, GetPointPositions());
     if (HasPointNormals()) {
         kernel::transform::TransformNormals(transformation, GetPointNormals());
@@ -188,6 +183,7 @@ PointCloud &PointCloud::Translate(const core::Tensor &translation,
     if (!relative) {
         transform -= GetCenter();
     }
+    InvalidateNeighborhoodCache();
     GetPointPositions() += transform;
     return *this;
 }
@@ -198,6 +194,7 @@ PointCloud &PointCloud::Scale(double scale, const core::Tensor &center) {
     const core::Tensor center_d =
             center.To(GetDevice(), GetPointPositions().GetDtype());
 
+    InvalidateNeighborhoodCache();
     GetPointPositions().Sub_(center_d).Mul_(scale).Add_(center_d);
     return *this;
 }
@@ -207,6 +204,7 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     core::AssertTensorShape(R, {3, 3});
     core::AssertTensorShape(center, {3});
 
+    InvalidateNeighborhoodCache();
     kernel::transform::RotatePoints(R, GetPointPositions(), center);
 
     if (HasPointNormals()) {
@@ -422,6 +420,14 @@ PointCloud PointCloud::FarthestPointDownSample(const size_t num_samples,
     return SelectByMask(selection_mask);
 }
 
+/// Number of query points per chunk of the outlier removal searches, such that
+/// the neighbor tensors of a chunk hold about 4M entries independent of the
+/// size of the point cloud.
+static int64_t GetOutlierRemovalChunkSize(int64_t num_neighbors) {
+    constexpr int64_t kMaxChunkNeighbors = int64_t(1) << 22;
+    return std::max<int64_t>(1, kMaxChunkNeighbors / num_neighbors);
+}
+
 std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
         size_t nb_points, double search_radius) const {
     if (nb_points < 1 || search_radius <= 0) {
@@ -429,21 +435,52 @@ std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
                 "Illegal input parameters, number of points and radius must be "
                 "positive");
     }
-    core::nns::NearestNeighborSearch target_nns(GetPointPositions());
-
-    const bool check = target_nns.FixedRadiusIndex(search_radius);
-    if (!check) {
-        utility::LogError("Fixed radius search index is not set.");
+    if (GetPointPositions().GetLength() == 0) {
+        return std::make_tuple(PointCloud(GetDevice()),
+                               core::Tensor({0}, core::Bool, GetDevice()));
     }
+    core::Tensor num_neighbors;
+    const NeighborhoodCache *cache =
+            FindNeighborhoodCache(utility::nullopt, search_radius);
+    if (!cache && HasNeighborhoodCache() &&
+        neighborhood_cache_->GetSearchType() ==
+                NeighborhoodCache::SearchType::Hybrid &&
+        neighborhood_cache_->GetRadius().value() == search_radius &&
+        neighborhood_cache_->GetMaxNN().value() >=
+                static_cast<int64_t>(nb_points)) {
+        // The hybrid search counts are min(count, max_nn), which is enough to
+        // decide whether a point has at least nb_points neighbors.
+        num_neighbors = neighborhood_cache_->GetCounts();
+    } else if (cache) {
+        core::Tensor row_splits = cache->GetCounts().To(GetDevice());
+        const int64_t size = row_splits.GetLength();
+        num_neighbors = row_splits.Slice(0, 1, size) -
+                        row_splits.Slice(0, 0, size - 1);
+    } else {
+        // A hybrid search for nb_points neighbors is enough to decide whether
+        // a point is an inlier. It is run on chunks of query points, such
+        // that only the neighbor counts are kept for the whole point cloud.
+        core::nns::NearestNeighborSearch target_nns(GetPointPositions());
+        const bool check = target_nns.HybridIndex(search_radius);
+        if (!check) {
+            utility::LogError("Hybrid search index is not set.");
+        }
 
-    core::Tensor indices, distance, row_splits;
-    std::tie(indices, distance, row_splits) = target_nns.FixedRadiusSearch(
-            GetPointPositions(), search_radius, false);
-    row_splits = row_splits.To(GetDevice());
-
-    const int64_t size = row_splits.GetLength();
-    const core::Tensor num_neighbors =
-            row_splits.Slice(0, 1, size) - row_splits.Slice(0, 0, size - 1);
+        const int max_nn = static_cast<int>(std::min<size_t>(
+                nb_points, std::numeric_limits<int>::max()));
+        const int64_t num_points = GetPointPositions().GetLength();
+        const int64_t chunk_size = GetOutlierRemovalChunkSize(max_nn);
+        num_neighbors =
+                core::Tensor::Empty({num_points}, core::Int64, GetDevice());
+        for (int64_t begin = 0; begin < num_points; begin += chunk_size) {
+            const int64_t end = std::min(num_points, begin + chunk_size);
+            core::Tensor indices, distances, counts;
+            std::tie(indices, distances, counts) = target_nns.HybridSearch(
+                    GetPointPositions().Slice(0, begin, end), search_radius,
+                    max_nn);
+            num_neighbors.Slice(0, begin, end) = counts.To(core::Int64);
+        }
+    }
 
     const core::Tensor valid =
             num_neighbors.Ge(static_cast<int64_t>(nb_points));
@@ -462,17 +499,42 @@ std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
                                core::Tensor({0}, core::Bool, GetDevice()));
     }
 
-    core::nns::NearestNeighborSearch nns(GetPointPositions().Contiguous());
-    const bool check = nns.KnnIndex();
-    if (!check) {
-        utility::LogError("Knn search index is not set.");
-    }
+    core::Tensor avg_distances;
+    if (HasNeighborhoodCache() &&
+        neighborhood_cache_->GetSearchType() ==
+                NeighborhoodCache::SearchType::KNN &&
+        neighborhood_cache_->GetMaxNN().value() >=
+                static_cast<int64_t>(nb_neighbors)) {
+        // KNN results are sorted by distance, so the first nb_neighbors
+        // columns are the result of a search with nb_neighbors.
+        core::Tensor distance2 = neighborhood_cache_->GetDistances();
+        distance2 = distance2.Slice(
+                1, 0,
+                std::min<int64_t>(nb_neighbors, distance2.GetShape(1)));
+        avg_distances = distance2.Sqrt().Mean({1});
+    } else {
+        // Only the mean neighbor distance of each point is kept, the KNN
+        // results are computed and discarded chunk by chunk.
+        core::nns::NearestNeighborSearch nns(
+                GetPointPositions().Contiguous());
+        const bool check = nns.KnnIndex();
+        if (!check) {
+            utility::LogError("Knn search index is not set.");
+        }
 
-    core::Tensor indices, distance2;
-    std::tie(indices, distance2) =
-            nns.KnnSearch(GetPointPositions(), nb_neighbors);
+        const int64_t num_points = GetPointPositions().GetLength();
+        const int64_t chunk_size = GetOutlierRemovalChunkSize(nb_neighbors);
+        avg_distances = core::Tensor::Empty(
+                {num_points}, GetPointPositions().GetDtype(), GetDevice());
+        for (int64_t begin = 0; begin < num_points; begin += chunk_size) {
+            const int64_t end = std::min(num_points, begin + chunk_size);
+            core::Tensor indices, distance2;
+            std::tie(indices, distance2) = nns.KnnSearch(
+                    GetPointPositions().Slice(0, begin, end), nb_neighbors);
+            avg_distances.Slice(0, begin, end) = distance2.Sqrt().Mean({1});
+        }
+    }
 
-    core::Tensor avg_distances = distance2.Sqrt().Mean({1});
     const double cloud_mean =
             avg_distances.Mean({0}).To(core::Float64).Item<double>();
     const core::Tensor std_distances_centered = avg_distances - cloud_mean;
@@ -534,6 +596,23 @@ std::tuple<PointCloud, core::Tensor> PointCloud::RemoveDuplicatedPoints()
     return std::make_tuple(SelectByMask(masks), masks);
 }
 
+PointCloud &PointCloud::ComputeNeighborhoodCache(
+        const utility::optional<int> max_nn /* = 30*/,
+        const utility::optional<double> radius /*= utility::nullopt*/) {
+    neighborhood_cache_ = std::make_shared<const NeighborhoodCache>(
+            GetPointPositions(), max_nn, radius);
+    return *this;
+}
+
+const NeighborhoodCache &PointCloud::GetNeighborhoodCache() const {
+    if (!HasNeighborhoodCache()) {
+        utility::LogError(
+                "The point cloud has no valid neighborhood cache. Call "
+                "ComputeNeighborhoodCache() first.");
+    }
+    return *neighborhood_cache_;
+}
+
 PointCloud &PointCloud::NormalizeNormals() {
     if (!HasPointNormals()) {
         utility::LogWarning("PointCloud has no normals.");
@@ -588,18 +667,27 @@ std::tuple<PointCloud, core::Tensor> PointCloud::ComputeBoundaryPoints(
 
     // Compute nearest neighbors.
     core::Tensor indices, distance2, counts;
-    core::nns::NearestNeighborSearch tree(points_d, core::Int32);
+    if (const NeighborhoodCache *cache = FindNeighborhoodCache(max_nn, radius)) {
+        indices = cache->GetIndices();
+        counts = cache->GetCounts();
+        utility::LogDebug(
+                "Use cached HybridSearch [max_nn: {} | radius {}] for "
+                "computing boundary points.",
+                max_nn, radius);
+    } else {
+        core::nns::NearestNeighborSearch tree(points_d, core::Int32);
 
-    bool check = tree.HybridIndex(radius);
-    if (!check) {
-        utility::LogError("Building HybridIndex failed.");
+        bool check = tree.HybridIndex(radius);
+        if (!check) {
+            utility::LogError("Building HybridIndex failed.");
+        }
+        std::tie(indices, distance2, counts) =
+                tree.HybridSearch(points_d, radius, max_nn);
+        utility::LogDebug(
+                "Use HybridSearch [max_nn: {} | radius {}] for computing "
+                "boundary points.",
+                max_nn, radius);
     }
-    std::tie(indices, distance2, counts) =
-            tree.HybridSearch(points_d, radius, max_nn);
-    utility::LogDebug(
-            "Use HybridSearch [max_nn: {} | radius {}] for computing "
-            "boundary points.",
-            max_nn, radius);
 
     core::Tensor mask = core::Tensor::Zeros({num_points}, core::Bool, device);
     if (IsCPU()) {
@@ -640,55 +728,32 @@ void PointCloud::EstimateNormals(
             core::Tensor::Empty({GetPointPositions().GetLength(), 3, 3}, dtype,
                                 device));
 
-    if (radius.has_value() && max_knn.has_value()) {
-        utility::LogDebug("Using Hybrid Search for computing covariances");
-        // Computes and sets `covariances` attribute using Hybrid Search
-        // method.
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateCovariancesUsingHybridSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointAttr("covariances"), radius.value(),
-                    max_knn.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateCovariancesUsingHybridSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointAttr("covariances"), radius.value(),
-                      max_knn.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
-    } else if (max_knn.has_value() && !radius.has_value()) {
-        utility::LogDebug("Using KNN Search for computing covariances");
-        // Computes and sets `covariances` attribute using KNN Search method.
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateCovariancesUsingKNNSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointAttr("covariances"), max_knn.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::EstimateCovariancesUsingKNNSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointAttr("covariances"), max_knn.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
-    } else if (!max_knn.has_value() && radius.has_value()) {
-        utility::LogDebug("Using Radius Search for computing covariances");
-        // Computes and sets `covariances` attribute using KNN Search method.
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateCovariancesUsingRadiusSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointAttr("covariances"), radius.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateCovariancesUsingRadiusSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointAttr("covariances"), radius.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
+    // Computes and sets `covariances` attribute using the neighbors of the
+    // attached NeighborhoodCache if it matches the search parameters.
+    NeighborhoodCache computed_cache;
+    const NeighborhoodCache *cache = FindNeighborhoodCache(max_knn, radius);
+    if (!cache) {
+        computed_cache = NeighborhoodCache(GetPointPositions(), max_knn, radius);
+        cache = &computed_cache;
+    }
+    utility::LogDebug("Using {} for computing covariances", cache->ToString());
+    if (cache->GetSearchType() == NeighborhoodCache::SearchType::KNN &&
+        cache->GetIndices().GetShape(1) < 3) {
+        utility::LogError(
+                "Not enough neighbors to compute Covariances / Normals. Try "
+                "increasing the max_nn parameter.");
+    }
+
+    if (IsCPU()) {
+        kernel::pointcloud::EstimateCovariancesCPU(
+                this->GetPointPositions().Contiguous(), cache->GetIndices(),
+                cache->GetCounts(), this->GetPointAttr("covariances"));
+    } else if (IsCUDA()) {
+        CUDA_CALL(kernel::pointcloud::EstimateCovariancesCUDA,
+                  this->GetPointPositions().Contiguous(), cache->GetIndices(),
+                  cache->GetCounts(), this->GetPointAttr("covariances"));
     } else {
-        utility::LogError("Both max_nn and radius are none.");
+        utility::LogError("Unimplemented device");
     }
 
     // Estimate `normal` of each point using its `covariance` matrix.
@@ -806,64 +871,35 @@ void PointCloud::EstimateColorGradients(
     }
 
     // Compute and set `color_gradients` attribute.
-    if (radius.has_value() && max_knn.has_value()) {
-        utility::LogDebug("Using Hybrid Search for computing color_gradients");
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateColorGradientsUsingHybridSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointNormals().Contiguous(),
-                    this->GetPointColors().Contiguous(),
-                    this->GetPointAttr("color_gradients"), radius.value(),
-                    max_knn.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateColorGradientsUsingHybridSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointNormals().Contiguous(),
-                      this->GetPointColors().Contiguous(),
-                      this->GetPointAttr("color_gradients"), radius.value(),
-                      max_knn.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
-    } else if (max_knn.has_value() && !radius.has_value()) {
-        utility::LogDebug("Using KNN Search for computing color_gradients");
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateColorGradientsUsingKNNSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointNormals().Contiguous(),
-                    this->GetPointColors().Contiguous(),
-                    this->GetPointAttr("color_gradients"), max_knn.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateColorGradientsUsingKNNSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointNormals().Contiguous(),
-                      this->GetPointColors().Contiguous(),
-                      this->GetPointAttr("color_gradients"), max_knn.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
-    } else if (!max_knn.has_value() && radius.has_value()) {
-        utility::LogDebug("Using Radius Search for computing color_gradients");
-        if (IsCPU()) {
-            kernel::pointcloud::EstimateColorGradientsUsingRadiusSearchCPU(
-                    this->GetPointPositions().Contiguous(),
-                    this->GetPointNormals().Contiguous(),
-                    this->GetPointColors().Contiguous(),
-                    this->GetPointAttr("color_gradients"), radius.value());
-        } else if (IsCUDA()) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateColorGradientsUsingRadiusSearchCUDA,
-                      this->GetPointPositions().Contiguous(),
-                      this->GetPointNormals().Contiguous(),
-                      this->GetPointColors().Contiguous(),
-                      this->GetPointAttr("color_gradients"), radius.value());
-        } else {
-            utility::LogError("Unimplemented device");
-        }
+    NeighborhoodCache computed_cache;
+    const NeighborhoodCache *cache = FindNeighborhoodCache(max_knn, radius);
+    if (!cache) {
+        computed_cache = NeighborhoodCache(GetPointPositions(), max_knn, radius);
+        cache = &computed_cache;
+    }
+    utility::LogDebug("Using {} for computing color_gradients",
+                      cache->ToString());
+    if (cache->GetSearchType() == NeighborhoodCache::SearchType::KNN &&
+        cache->GetIndices().GetShape(1) < 4) {
+        utility::LogError(
+                "Not enough neighbors to compute Covariances / Normals. Try "
+                "changing the search parameter.");
+    }
+
+    if (IsCPU()) {
+        kernel::pointcloud::EstimateColorGradientsCPU(
+                this->GetPointPositions().Contiguous(),
+                this->GetPointNormals().Contiguous(),
+                this->GetPointColors().Contiguous(), cache->GetIndices(),
+                cache->GetCounts(), this->GetPointAttr("color_gradients"));
+    } else if (IsCUDA()) {
+        CUDA_CALL(kernel::pointcloud::EstimateColorGradientsCUDA,
+                  this->GetPointPositions().Contiguous(),
+                  this->GetPointNormals().Contiguous(),
+                  this->GetPointColors().Contiguous(), cache->GetIndices(),
+                  cache->GetCounts(), this->GetPointAttr("color_gradients"));
     } else {
-        utility::LogError("Both max_nn and radius are none.");
+        utility::LogError("Unimplemented device");
     }
 }
 
@@ -1149,38 +1185,53 @@ std::tuple<TriangleMesh, core::Tensor> PointCloud::HiddenPointRemoval(
         const core::Tensor &camera_location, double radius) const {
     core::AssertTensorShape(camera_location, {3});
     core::AssertTensorDevice(camera_location, GetDevice());
-
-    // The HiddenPointRemoval only need positions attribute.
-    PointCloud tpcd(GetPointPositions());
-    const open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    const Eigen::Vector3d camera_location_eigen =
-            core::eigen_converter::TensorToEigenMatrixXd(
-                    camera_location.Reshape({3, 1}));
-
-    std::shared_ptr<open3d::geometry::TriangleMesh> lmesh;
-    std::vector<size_t> pt_map;
-    std::tie(lmesh, pt_map) =
-            lpcd.HiddenPointRemoval(camera_location_eigen, radius);
-
-    // Convert pt_map into Int64 Tensor.
-    std::vector<int64_t> indices(pt_map.begin(), pt_map.end());
-
+    if (radius <= 0) {
+        utility::LogError("radius must be larger than zero.");
+    }
+
+    // Spherical flipping of the points around the camera location, the
+    // camera location itself is added as the last point.
+    const int64_t n = GetPointPositions().GetLength();
+    const core::Tensor points =
+            GetPointPositions().To(core::Float64) -
+            camera_location.To(core::Float64).Reshape({1, 3});
+    const core::Tensor norms = (points * points).Sum({1}, true).Sqrt();
+    const core::Tensor flipped = core::Concatenate(
+            {points + points * ((radius - norms) * 2 / norms),
+             core::Tensor::Zeros({1, 3}, core::Float64, GetDevice())});
+
+    // The visible points are the vertices of the convex hull.
+    core::Tensor point_indices, triangles;
+    kernel::pointcloud::ComputeConvexHullCPU(
+            flipped.To(core::Device("CPU:0")), /*joggle_inputs=*/false,
+            /*prefilter=*/true, point_indices, triangles);
+
+    // Remove the camera location, which is the last hull vertex if any.
+    const int64_t num_vertices = point_indices.GetLength();
+    if (point_indices[num_vertices - 1].Item<int64_t>() == n) {
+        point_indices = point_indices.Slice(0, 0, num_vertices - 1);
+        triangles = triangles.IndexGet(
+                {triangles.Ne(num_vertices - 1).All(core::SizeVector{1})});
+    }
+
+    point_indices = point_indices.To(GetDevice());
     return std::make_tuple(
-            TriangleMesh::FromLegacy(*lmesh, GetPointPositions().GetDtype(),
-                                     core::Int64, GetDevice()),
-            core::Tensor(std::move(indices)).To(GetDevice()));
+            TriangleMesh(GetPointPositions().IndexGet({point_indices}),
+                         triangles.To(GetDevice())),
+            point_indices);
 }
 
 core::Tensor PointCloud::ClusterDBSCAN(double eps,
                                        size_t min_points,
                                        bool print_progress) const {
-    // Create a legacy point cloud with only points, no attributes to reduce
-    // copying.
-    PointCloud tpcd(GetPointPositions());
-    open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    std::vector<int> labels =
-            lpcd.ClusterDBSCAN(eps, min_points, print_progress);
-    return core::Tensor(std::move(labels)).To(GetDevice());
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::Tensor labels;
+    // The clustering runs on the CPU. Points on other devices are copied.
+    kernel::pointcloud::ClusterDBSCANCPU(
+            GetPointPositions().To(core::Device("CPU:0")), eps, min_points,
+            labels, print_progress);
+    return labels.To(GetDevice());
 }
 
 std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
@@ -1188,91 +1239,50 @@ std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
         const int ransac_n,
         const int num_iterations,
         const double probability) const {
-    // The RANSAC plane fitting only need positions attribute.
-    PointCloud tpcd(GetPointPositions());
-    const open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    std::vector<size_t> inliers;
-    Eigen::Vector4d plane;
-    std::tie(plane, inliers) = lpcd.SegmentPlane(distance_threshold, ransac_n,
-                                                 num_iterations, probability);
-
-    // Convert inliers into Int64 Tensor.
-    std::vector<int64_t> indices(inliers.begin(), inliers.end());
+    core::Tensor plane_models, labels;
+    std::tie(plane_models, labels) = SegmentPlanes(
+            1, distance_threshold, ransac_n, num_iterations, probability, 0);
+    if (plane_models.GetLength() == 0) {
+        return std::make_tuple(
+                core::Tensor::Zeros({4}, core::Float64, GetDevice()),
+                core::Tensor::Empty({0}, core::Int64, GetDevice()));
+    }
+    return std::make_tuple(plane_models[0], labels.Eq(0).NonZero()[0]);
+}
 
-    return std::make_tuple(
-            core::eigen_converter::EigenMatrixToTensor(plane).Flatten().To(
-                    GetDevice()),
-            core::Tensor(std::move(indices)).To(GetDevice()));
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlanes(
+        const int max_planes,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        const int64_t min_inliers) const {
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::Tensor plane_models, labels;
+    // The segmentation runs on the CPU. Points on other devices are copied.
+    kernel::pointcloud::SegmentPlanesCPU(
+            GetPointPositions().To(core::Device("CPU:0")), distance_threshold,
+            ransac_n, num_iterations, probability, max_planes, min_inliers,
+            plane_models, labels);
+    return std::make_tuple(plane_models.To(GetDevice()),
+                           labels.To(GetDevice()));
 }
 
 TriangleMesh PointCloud::ComputeConvexHull(bool joggle_inputs) const {
-    // QHull needs double dtype on the CPU.
-    static_assert(std::is_same<realT, double>::value,
-                  "Qhull realT is not double. Update code!");
-    using int_t = int32_t;
-    const auto int_dtype = core::Int32;
-    core::Tensor coordinates(
-            GetPointPositions().To(core::Float64).To(core::Device("CPU:0")));
-
-    orgQhull::Qhull qhull;
-    std::string options = "Qt";  // triangulated output
-    if (joggle_inputs) {
-        options = "QJ";  // joggle input to avoid precision problems
-    }
-    qhull.runQhull("", 3, coordinates.GetLength(),
-                   coordinates.GetDataPtr<double>(), options.c_str());
-    orgQhull::QhullFacetList facets = qhull.facetList();
-
-    core::Tensor vertices({qhull.vertexCount(), 3}, core::Float64),
-            triangles({qhull.facetCount(), 3}, int_dtype),
-            point_indices({qhull.vertexCount()}, int_dtype);
-    std::unordered_map<int_t, int_t> vertex_map;  // pcd -> conv hull
-    int_t tidx = 0, next_vtx = 0;
-    auto p_vertices = vertices.GetDataPtr<double>();
-    auto p_triangle = triangles.GetDataPtr<int_t>();
-    auto p_point_indices = point_indices.GetDataPtr<int_t>();
-    for (orgQhull::QhullFacetList::iterator it = facets.begin();
-         it != facets.end(); ++it) {
-        if (!(*it).isGood()) continue;
-
-        orgQhull::QhullVertexSet vSet = it->vertices();
-        int_t triangle_subscript = 0;
-        for (orgQhull::QhullVertexSet::iterator vIt = vSet.begin();
-             vIt != vSet.end(); ++vIt, ++triangle_subscript) {
-            orgQhull::QhullPoint p = (*vIt).point();
-            int_t vidx = p.id();
-
-            auto inserted = vertex_map.insert({vidx, next_vtx});
-            if (inserted.second) {
-                p_triangle[triangle_subscript] = next_vtx;  // hull vertex idx
-                double *coords = p.coordinates();
-                std::copy(coords, coords + 3, p_vertices);
-                p_vertices += 3;
-                p_point_indices[next_vtx++] = vidx;
-            } else {
-                p_triangle[triangle_subscript] =
-                        inserted.first->second;  // hull vertex idx
-            }
-        }
-        if ((*it).isTopOrient()) {
-            std::swap(p_triangle[0], p_triangle[1]);
-        }
-        tidx++;
-        p_triangle += 3;
-    }
-    if (tidx < triangles.GetShape(0)) {
-        triangles = triangles.Slice(0, 0, tidx);
-    }
-    if (next_vtx != vertices.GetShape(0)) {
-        utility::LogError(
-                "Qhull output has incorrect number of vertices {} instead of "
-                "reported {}",
-                next_vtx, vertices.GetShape(0));
-    }
-
-    TriangleMesh convex_hull(vertices, triangles);
-    convex_hull.SetVertexAttr("point_indices", point_indices);
-    return convex_hull.To(GetPointPositions().GetDevice());
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::Tensor point_indices, triangles;
+    // The hull is computed on the CPU. Points on other devices are copied.
+    kernel::pointcloud::ComputeConvexHullCPU(
+            GetPointPositions().To(core::Device("CPU:0")), joggle_inputs,
+            /*prefilter=*/true, point_indices, triangles);
+
+    point_indices = point_indices.To(GetDevice());
+    TriangleMesh convex_hull(GetPointPositions().IndexGet({point_indices}),
+                             triangles.To(GetDevice(), core::Int32));
+    convex_hull.SetVertexAttr("point_indices", point_indices.To(core::Int32));
+    return convex_hull;
 }
 
 AxisAlignedBoundingBox PointCloud::GetAxisAlignedBoundingBox() const {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -20,6 +21,7 @@
 #include "open3d/t/geometry/DrawableGeometry.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/NeighborhoodCache.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
@@ -160,6 +162,9 @@ public:
             utility::LogError("Attribute device {} != Pointcloud's device {}.",
                               value.GetDevice().ToString(), device_.ToString());
         }
+        if (key == "positions") {
+            InvalidateNeighborhoodCache();
+        }
         point_attr_[key] = value;
     }
 
@@ -194,7 +199,12 @@ public:
     /// cannot be removed. Throws warning if attribute key does not exists.
     ///
     /// \param key Attribute name.
-    void RemovePointAttr(const std::string &key) { point_attr_.Erase(key); }
+    void RemovePointAttr(const std::string &key) {
+        if (key == "positions") {
+            InvalidateNeighborhoodCache();
+        }
+        point_attr_.Erase(key);
+    }
 
     /// Check if the "positions" attribute's value has length > 0.
     /// This is a convenience function.
@@ -227,6 +237,7 @@ public:
 
     /// Clear all data in the point cloud.
     PointCloud &Clear() override {
+        InvalidateNeighborhoodCache();
         point_attr_.clear();
         return *this;
     }
@@ -362,6 +373,9 @@ public:
     /// \brief Remove points that have less than \p nb_points neighbors in a
     /// sphere of a given radius.
     ///
+    /// The neighbors are counted in chunks of points and the search stops at
+    /// \p nb_points neighbors per point.
+    ///
     /// \param nb_points Number of neighbor points required within the radius.
     /// \param search_radius Radius of the sphere.
     /// \return Tuple of filtered point cloud and boolean mask tensor for
@@ -372,6 +386,9 @@ public:
     /// \brief Remove points that are further away from their \p nb_neighbor
     /// neighbors in average. This function is not recommended to use on GPU.
     ///
+    /// The neighbors are searched in chunks of points and only the mean
+    /// neighbor distance of each point is kept.
+    ///
     /// \param nb_neighbors Number of neighbors around the target point.
     /// \param std_ratio Standard deviation ratio.
     /// \return Tuple of filtered point cloud and boolean mask tensor for
@@ -405,8 +422,8 @@ public:
     /// for noisy point clouds can be found in Mehra et. al. 'Visibility of
     /// Noisy Point Cloud Data', 2010.
     ///
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting visible triangle mesh and indiecs will be made.
+    /// The convex hull of the flipped points is computed on the CPU, with
+    /// the native Quickhull of ComputeConvexHull().
     ///
     /// \param camera_location All points not visible from that location will be
     /// removed.
@@ -419,10 +436,15 @@ public:
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting labels will be made.
+    /// Core points are found with a uniform grid of cell size \p eps and
+    /// merged into clusters with a parallel lock-free union-find. Clusters are
+    /// numbered in the order of their smallest core point index, so the
+    /// labels are deterministic. The clustering runs on the CPU, for other
+    /// devices a copy of the point cloud data and resulting labels will be
+    /// made.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
+    /// Points are neighbors if their distance is less than \p eps.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
@@ -433,8 +455,10 @@ public:
                                bool print_progress = false) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting plane model and inlier indiecs will be made.
+    /// Hypotheses are scored in batches and every new best model is refined
+    /// with least squares on its inliers (LO-RANSAC). The segmentation runs
+    /// on the CPU, for other devices a copy of the point cloud data and
+    /// resulting plane model and inlier indices will be made.
     ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
@@ -450,20 +474,49 @@ public:
             const int num_iterations = 100,
             const double probability = 0.99999999) const;
 
-    /// Compute the convex hull of a point cloud using qhull.
+    /// \brief Segment up to \p max_planes planes one after another using the
+    /// RANSAC algorithm of SegmentPlane.
     ///
-    /// This runs on the CPU.
+    /// Each plane is searched among the points that are not inliers of the
+    /// previous planes. The points are copied once and compacted in place
+    /// after each plane. The search stops early if the best plane has less
+    /// than \p min_inliers inliers.
+    ///
+    /// \param max_planes Maximum number of planes.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param min_inliers Minimum number of inliers of a plane.
+    /// \return Tuple of the plane models as Float64 tensor of shape {P, 4}
+    /// and an Int32 tensor with the plane index of each point, -1 for points
+    /// that are not on any plane, on the same device as the point cloud.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlanes(
+            const int max_planes,
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int64_t min_inliers = 1) const;
+
+    /// Compute the convex hull of a point cloud with a parallel Quickhull.
+    ///
+    /// This runs on the CPU. Points on the CPU are read in place, the points
+    /// inside the hull of the extreme points along the axes and diagonals are
+    /// discarded in a first parallel pass.
     ///
     /// \param joggle_inputs (default False). Handle precision problems by
-    /// randomly perturbing the input data. Set to True if perturbing the input
-    /// iis acceptable but you need convex simplicial output. If False,
-    /// neighboring facets may be merged in case of precision problems. See
-    /// [QHull docs](http://www.qhull.org/html/qh-impre.htm#joggle) for more
-    /// details.
-    ///
-    /// \return TriangleMesh representing the convexh hull. This contains an
-    /// extra vertex property "point_map" that contains the index of the
-    /// corresponding vertex in the original mesh.
+    /// randomly perturbing the input data, as the 'QJ' option of
+    /// [QHull](http://www.qhull.org/html/qh-impre.htm#joggle). Set to True if
+    /// perturbing the input is acceptable, e.g. for degenerate input. If
+    /// False, points within the rounding error of a hull face are not hull
+    /// vertices and degenerate input throws.
+    ///
+    /// \return TriangleMesh representing the convex hull. This contains an
+    /// extra Int32 vertex property "point_indices" that contains the index of
+    /// the corresponding point in the point cloud, in increasing order.
     TriangleMesh ComputeConvexHull(bool joggle_inputs = false) const;
 
     /// \brief Compute the boundary points of a point cloud.
@@ -481,6 +534,49 @@ public:
             int max_nn = 30,
             double angle_threshold = 90.0) const;
 
+public:
+    /// \brief Computes the neighbors of all points and attaches them to the
+    /// point cloud as a NeighborhoodCache.
+    ///
+    /// EstimateNormals, EstimateColorGradients, ComputeBoundaryPoints,
+    /// RemoveRadiusOutliers, RemoveStatisticalOutliers and
+    /// pipelines::registration::ComputeFPFHFeature reuse the cached neighbors
+    /// instead of searching again if their search parameters are compatible
+    /// with the cache. The search is selected as in EstimateNormals.
+    ///
+    /// The cache is checked against a hash of the positions on every access.
+    /// It is dropped when the positions are replaced and becomes invalid when
+    /// they are modified in place, e.g. by Transform(), by Tensor operations
+    /// or through raw data pointers. ClearNeighborhoodCache() drops it
+    /// explicitly.
+    ///
+    /// Copies of the point cloud share the cache. Computing a new cache for a
+    /// copy does not change the cache of the original point cloud.
+    ///
+    /// \param max_nn [optional] Neighbor search max neighbors parameter
+    /// [Default = 30].
+    /// \param radius [optional] Neighbor search radius parameter.
+    PointCloud &ComputeNeighborhoodCache(
+            const utility::optional<int> max_nn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// Returns true if a neighborhood cache is attached and valid for the
+    /// current point positions.
+    bool HasNeighborhoodCache() const {
+        return neighborhood_cache_ && point_attr_.Contains("positions") &&
+               neighborhood_cache_->IsValidFor(GetPointPositions());
+    }
+
+    /// Returns the attached neighborhood cache. Throws an exception if
+    /// HasNeighborhoodCache() is false.
+    const NeighborhoodCache &GetNeighborhoodCache() const;
+
+    /// Detaches the neighborhood cache from the point cloud.
+    PointCloud &ClearNeighborhoodCache() {
+        InvalidateNeighborhoodCache();
+        return *this;
+    }
+
 public:
     /// Normalize point normals to length 1.
     PointCloud &NormalizeNormals();
@@ -738,9 +834,28 @@ public:
             std::vector<Metric> metrics = {Metric::ChamferDistance},
             MetricParameters params = MetricParameters()) const;
 
+protected:
+    /// Returns the attached neighborhood cache if it is valid and has been
+    /// computed with the search parameters \p max_nn and \p radius.
+    /// Otherwise returns nullptr.
+    const NeighborhoodCache *FindNeighborhoodCache(
+            const utility::optional<int> max_nn,
+            const utility::optional<double> radius) const {
+        if (HasNeighborhoodCache() &&
+            neighborhood_cache_->Matches(max_nn, radius)) {
+            return neighborhood_cache_.get();
+        }
+        return nullptr;
+    }
+
+    /// Detaches the neighborhood cache. Copies of this point cloud keep the
+    /// cache, which stays valid for them while their positions are unchanged.
+    void InvalidateNeighborhoodCache() { neighborhood_cache_.reset(); }
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap point_attr_;
+    std::shared_ptr<const NeighborhoodCache> neighborhood_cache_;
 };
 
 }  // namespace geometry
@@ -18,18 +18,31 @@
 #include <embree4/rtcore.h>
 #include <tbb/parallel_for.h>
 
-#include <Eigen/Core>
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <tuple>
 #include <unsupported/Eigen/AlignedVector3>
 #include <vector>
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
 namespace callbacks {
 
+// Dynamic meshes are instanced, the ID of the instance is the geometry ID.
+// Static meshes are attached directly to the scene.
+inline unsigned int GetGeometryID(unsigned int inst_id, unsigned int geom_id) {
+    return inst_id != RTC_INVALID_GEOMETRY_ID ? inst_id : geom_id;
+}
+
+inline unsigned int GetGeometryID(const RTCHit& hit) {
+    return GetGeometryID(hit.instID[0], hit.geomID);
+}
+
 struct GeomPrimID {
     uint32_t geomID;
     uint32_t primID;
@@ -76,9 +89,10 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        GeomPrimID gpID = {hit.geomID, hit.primID, ray.tfar};
+        const unsigned int geom_id = GetGeometryID(hit);
+        GeomPrimID gpID = {geom_id, hit.primID, ray.tfar};
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar[ray_id];
-        if (prev_gpIDtfar.geomID != hit.geomID ||
+        if (prev_gpIDtfar.geomID != geom_id ||
             (prev_gpIDtfar.primID != hit.primID &&
              prev_gpIDtfar.ray_tfar != ray.tfar)) {
             ++(intersections[ray_id]);
@@ -141,14 +155,15 @@ void ListIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        GeomPrimID gpID = {hit.geomID, hit.primID, ray.tfar};
+        const unsigned int geom_id = GetGeometryID(hit);
+        GeomPrimID gpID = {geom_id, hit.primID, ray.tfar};
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar[ray_id];
-        if (prev_gpIDtfar.geomID != hit.geomID ||
+        if (prev_gpIDtfar.geomID != geom_id ||
             (prev_gpIDtfar.primID != hit.primID &&
              prev_gpIDtfar.ray_tfar != ray.tfar)) {
             size_t idx = cumsum[ray_id] + track_intersections[ray_id];
             ray_ids[idx] = ray_id;
-            geometry_ids[idx] = hit.geomID;
+            geometry_ids[idx] = geom_id;
             primitive_ids[idx] = hit.primID;
             primitive_uvs[idx * 2 + 0] = hit.u;
             primitive_uvs[idx * 2 + 1] = hit.v;
@@ -276,6 +291,75 @@ struct GeometryPtr {
     const void* ptr2;
 };
 
+// The embree objects of a mesh in the scene. Static meshes are attached to the
+// top level scene. Dynamic meshes have their own scene with a refittable BVH,
+// which is attached to the top level scene as an instance. The handles are
+// owned by the top level scene.
+struct SceneGeometry {
+    // The geometry attached to the top level scene, the mesh or its instance.
+    RTCGeometry geometry = nullptr;
+    RTCGeometry mesh = nullptr;
+    // The instanced scene of a dynamic mesh.
+    RTCScene scene = nullptr;
+    size_t num_vertices = 0;
+    // Column-major 4x4 transformation from the mesh to the scene.
+    float transform[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    bool enabled = true;
+    bool scene_committed = false;
+};
+
+// Applies the column-major 4x4 transformation m to (x, y, z, w).
+inline void TransformVec3(
+        const float* m, float w, float& x, float& y, float& z) {
+    const float tx = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+    const float ty = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+    const float tz = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+    x = tx;
+    y = ty;
+    z = tz;
+}
+
+// Computes the normalized normal of a hit in world space. The geometry normal
+// (ng_x, ng_y, ng_z) of a hit is in the space of the instanced mesh, if the
+// instance ID inst_id is valid.
+inline void GetHitNormal(RTCScene scene,
+                         unsigned int inst_id,
+                         float ng_x,
+                         float ng_y,
+                         float ng_z,
+                         float* normal) {
+    float nx = ng_x, ny = ng_y, nz = ng_z;
+    if (inst_id != RTC_INVALID_GEOMETRY_ID) {
+        float xfm[12];
+        rtcGetGeometryTransformFromScene(scene, inst_id, 0.f,
+                                         RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR, xfm);
+        nx = xfm[0] * ng_x + xfm[3] * ng_y + xfm[6] * ng_z;
+        ny = xfm[1] * ng_x + xfm[4] * ng_y + xfm[7] * ng_z;
+        nz = xfm[2] * ng_x + xfm[5] * ng_y + xfm[8] * ng_z;
+    }
+    const float inv_norm = 1.f / std::sqrt(nx * nx + ny * ny + nz * nz);
+    normal[0] = nx * inv_norm;
+    normal[1] = ny * inv_norm;
+    normal[2] = nz * inv_norm;
+}
+
+inline void GetHitNormal(RTCScene scene, const RTCHit& hit, float* normal) {
+    GetHitNormal(scene, hit.instID[0], hit.Ng_x, hit.Ng_y, hit.Ng_z, normal);
+}
+
+// Computes the origin and the matrix mapping homogeneous pixel coordinates to
+// ray directions in world space of a pinhole camera with the intrinsic matrix
+// K and the world to camera transformation T. The z component of the
+// directions in camera space is 1, such that the hit distance is the depth.
+inline void ComputePinholeRayParameters(const Eigen::Matrix3d& K,
+                                        const Eigen::Matrix4d& T,
+                                        Eigen::Vector3f& origin,
+                                        Eigen::Matrix3f& RT_invK) {
+    const Eigen::Matrix3d RT = T.topLeftCorner<3, 3>().transpose();
+    origin = (-RT * T.topRightCorner<3, 1>()).cast<float>();
+    RT_invK = (RT * K.inverse()).cast<float>();
+}
+
 template <typename Vec3fType, typename Vec2fType>
 struct ClosestPointResult {
     ClosestPointResult()
@@ -293,11 +377,22 @@ struct ClosestPointResult {
 template <typename Vec3fType, typename Vec3faType, typename Vec2fType>
 bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     assert(args->userPtr);
-    const unsigned int geomID = args->geomID;
+    const RTCPointQueryContext* context = args->context;
+    // Dynamic meshes are instanced, the ID of the instance is the geometry
+    // ID.
+    const unsigned int geomID = context->instStackSize > 0
+                                        ? context->instID[0]
+                                        : args->geomID;
     const unsigned int primID = args->primID;
 
-    // query position in world space
-    Vec3faType q(args->query->x, args->query->y, args->query->z);
+    // Embree transforms the query to the space of the mesh for similarity
+    // transforms. The transforms are rigid, distances are the same in both
+    // spaces.
+    float qx = args->query->x, qy = args->query->y, qz = args->query->z;
+    if (context->instStackSize > 0 && args->similarityScale <= 0) {
+        TransformVec3(context->world2inst[0], 1.f, qx, qy, qz);
+    }
+    Vec3faType q(qx, qy, qz);
 
     ClosestPointResult<Vec3fType, Vec2fType>* result =
             static_cast<ClosestPointResult<Vec3fType, Vec2fType>*>(
@@ -342,6 +437,13 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
             Vec3faType e2 = v2 - v0;
             result->uv = Vec2fType(u, v);
             result->n = (e1.cross(e2)).normalized();
+            if (context->instStackSize > 0) {
+                const float* inst2world = context->inst2world[0];
+                TransformVec3(inst2world, 1.f, result->p.x(), result->p.y(),
+                              result->p.z());
+                TransformVec3(inst2world, 0.f, result->n.x(), result->n.y(),
+                              result->n.z());
+            }
             return true;  // Return true to indicate that the query radius
                           // changed.
         }
@@ -359,25 +461,61 @@ struct RaycastingScene::Impl {
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
     RTCDevice device_;
-    // Vector for storing some information about the added geometry.
+    // Vectors for storing some information about the added geometry. The
+    // geometry ID is the index. IDs of removed geometries have no geometry
+    // and may be reused by embree.
     std::vector<GeometryPtr> geometry_ptrs_;
+    std::vector<SceneGeometry> geometries_;
     core::Device tensor_device_;  // cpu or sycl
 
     bool devprop_join_commit;
 
     virtual ~Impl() = default;
 
+    void CommitScene(RTCScene scene) {
+        if (devprop_join_commit) {
+            rtcJoinCommitScene(scene);
+        } else {
+            rtcCommitScene(scene);
+        }
+    }
+
     void CommitScene() {
         if (!scene_committed_) {
-            if (devprop_join_commit) {
-                rtcJoinCommitScene(scene_);
-            } else {
-                rtcCommitScene(scene_);
+            // The instanced scenes have to be committed first. Scenes of
+            // dynamic meshes with updated vertices only refit their BVH.
+            for (SceneGeometry& geometry : geometries_) {
+                if (geometry.scene && !geometry.scene_committed) {
+                    CommitScene(geometry.scene);
+                    geometry.scene_committed = true;
+                }
             }
+            CommitScene(scene_);
             scene_committed_ = true;
         }
     }
 
+    // Returns the bounds of all enabled geometries. The lower bounds are
+    // larger than the upper bounds if the scene is empty.
+    RTCBounds GetSceneBounds() {
+        CommitScene();
+        RTCBounds bounds;
+        rtcGetSceneBounds(scene_, &bounds);
+        return bounds;
+    }
+
+    SceneGeometry& GetGeometry(uint32_t geom_id) {
+        if (geom_id >= geometries_.size() || !geometries_[geom_id].geometry) {
+            utility::LogError("Invalid geometry ID {}.", geom_id);
+        }
+        return geometries_[geom_id];
+    }
+
+    // Copies host or device memory of the tensor device to an embree buffer.
+    virtual void CopyToBuffer(void* dst,
+                              const void* src,
+                              size_t num_bytes) = 0;
+
     virtual void CastRays(const float* const rays,
                           const size_t num_rays,
                           float* t_hit,
@@ -388,6 +526,20 @@ struct RaycastingScene::Impl {
                           const int nthreads,
                           const bool line_intersection) = 0;
 
+    // Casts the rays of the pixels of a batch of pinhole cameras. Each camera
+    // has 12 ray parameters: the origin and the column-major matrix mapping
+    // homogeneous pixel coordinates to ray directions. Outputs may be null.
+    virtual void CastPinholeRays(const float* const ray_params,
+                                 const size_t batch_size,
+                                 const int width_px,
+                                 const int height_px,
+                                 float* t_hit,
+                                 unsigned int* geometry_ids,
+                                 unsigned int* primitive_ids,
+                                 float* primitive_uvs,
+                                 float* primitive_normals,
+                                 const int nthreads) = 0;
+
     virtual void TestOcclusions(const float* const rays,
                                 const size_t num_rays,
                                 const float tnear,
@@ -521,20 +673,13 @@ struct RaycastingScene::SYCLImpl : public RaycastingScene::Impl {
 
                         t_hit[i] = rh.ray.tfar;
                         if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                            geometry_ids[i] = rh.hit.geomID;
+                            geometry_ids[i] =
+                                    callbacks::GetGeometryID(rh.hit);
                             primitive_ids[i] = rh.hit.primID;
                             primitive_uvs[i * 2 + 0] = rh.hit.u;
                             primitive_uvs[i * 2 + 1] = rh.hit.v;
-                            float inv_norm =
-                                    1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                    rh.hit.Ng_y * rh.hit.Ng_y +
-                                                    rh.hit.Ng_z * rh.hit.Ng_z);
-                            primitive_normals[i * 3 + 0] =
-                                    rh.hit.Ng_x * inv_norm;
-                            primitive_normals[i * 3 + 1] =
-                                    rh.hit.Ng_y * inv_norm;
-                            primitive_normals[i * 3 + 2] =
-                                    rh.hit.Ng_z * inv_norm;
+                            GetHitNormal(scene, rh.hit,
+                                         &primitive_normals[i * 3]);
                         } else {
                             geometry_ids[i] = RTC_INVALID_GEOMETRY_ID;
                             primitive_ids[i] = RTC_INVALID_GEOMETRY_ID;
@@ -549,6 +694,79 @@ struct RaycastingScene::SYCLImpl : public RaycastingScene::Impl {
         queue_.wait_and_throw();
     }
 
+    void CastPinholeRays(const float* const ray_params,
+                         const size_t batch_size,
+                         const int width_px,
+                         const int height_px,
+                         float* t_hit,
+                         unsigned int* geometry_ids,
+                         unsigned int* primitive_ids,
+                         float* primitive_uvs,
+                         float* primitive_normals,
+                         const int nthreads) override {
+        CommitScene();
+
+        auto scene = this->scene_;
+        const size_t num_pixels = size_t(width_px) * height_px;
+        queue_.submit([=](sycl::handler& cgh) {
+            cgh.parallel_for(
+                    sycl::range<1>(batch_size * num_pixels),
+                    [=](sycl::item<1> item, sycl::kernel_handler kh) {
+                        const size_t i = item.get_id(0);
+                        const float* p = &ray_params[12 * (i / num_pixels)];
+                        const float u = (i % num_pixels) % width_px + 0.5f;
+                        const float v = (i % num_pixels) / width_px + 0.5f;
+
+                        struct RTCRayHit rh;
+                        rh.ray.org_x = p[0];
+                        rh.ray.org_y = p[1];
+                        rh.ray.org_z = p[2];
+                        rh.ray.dir_x = p[3] * u + p[6] * v + p[9];
+                        rh.ray.dir_y = p[4] * u + p[7] * v + p[10];
+                        rh.ray.dir_z = p[5] * u + p[8] * v + p[11];
+                        rh.ray.tnear = 0;
+                        rh.ray.tfar = std::numeric_limits<float>::infinity();
+                        rh.ray.mask = -1;
+                        rh.ray.id = i;
+                        rh.ray.flags = 0;
+                        rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+                        rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+
+                        rtcIntersect1(scene, &rh);
+
+                        const bool hit =
+                                rh.hit.geomID != RTC_INVALID_GEOMETRY_ID;
+                        if (t_hit) {
+                            t_hit[i] = rh.ray.tfar;
+                        }
+                        if (geometry_ids) {
+                            geometry_ids[i] =
+                                    hit ? callbacks::GetGeometryID(rh.hit)
+                                        : RTC_INVALID_GEOMETRY_ID;
+                        }
+                        if (primitive_ids) {
+                            primitive_ids[i] = hit ? rh.hit.primID
+                                                   : RTC_INVALID_GEOMETRY_ID;
+                        }
+                        if (primitive_uvs) {
+                            primitive_uvs[i * 2 + 0] = hit ? rh.hit.u : 0;
+                            primitive_uvs[i * 2 + 1] = hit ? rh.hit.v : 0;
+                        }
+                        if (primitive_normals) {
+                            if (hit) {
+                                GetHitNormal(scene, rh.hit,
+                                             &primitive_normals[i * 3]);
+                            } else {
+                                primitive_normals[i * 3 + 0] = 0;
+                                primitive_normals[i * 3 + 1] = 0;
+                                primitive_normals[i * 3 + 2] = 0;
+                            }
+                        }
+                    });
+        });
+        queue_.wait_and_throw();
+    }
+
     void TestOcclusions(const float* const rays,
                         const size_t num_rays,
                         const float tnear,
@@ -818,12 +1036,18 @@ struct RaycastingScene::SYCLImpl : public RaycastingScene::Impl {
     void CopyArray(int* src, uint32_t* dst, size_t num_elements) override {
         queue_.memcpy(dst, src, num_elements * sizeof(uint32_t)).wait();
     }
+
+    void CopyToBuffer(void* dst, const void* src, size_t num_bytes) override {
+        queue_.memcpy(dst, src, num_bytes).wait();
+    }
 };
 #endif
 
 struct RaycastingScene::CPUImpl : public RaycastingScene::Impl {
     // The maximum number of rays used in calls to embree.
     const size_t BATCH_SIZE = 1024;
+    // The edge length of the image tiles of CastPinholeRays.
+    const int TILE_SIZE = 16;
 
     void CastRays(const float* const rays,
                   const size_t num_rays,
@@ -874,16 +1098,11 @@ struct RaycastingScene::CPUImpl : public RaycastingScene::Impl {
                 size_t idx = rh.ray.id + range.begin();
                 t_hit[idx] = rh.ray.tfar;
                 if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
+                    geometry_ids[idx] = callbacks::GetGeometryID(rh.hit);
                     primitive_ids[idx] = rh.hit.primID;
                     primitive_uvs[idx * 2 + 0] = rh.hit.u;
                     primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
+                    GetHitNormal(scene_, rh.hit, &primitive_normals[idx * 3]);
                 } else {
                     geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
                     primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
@@ -910,6 +1129,119 @@ struct RaycastingScene::CPUImpl : public RaycastingScene::Impl {
         }
     }
 
+    void CastPinholeRays(const float* const ray_params,
+                         const size_t batch_size,
+                         const int width_px,
+                         const int height_px,
+                         float* t_hit,
+                         unsigned int* geometry_ids,
+                         unsigned int* primitive_ids,
+                         float* primitive_uvs,
+                         float* primitive_normals,
+                         const int nthreads) override {
+        CommitScene();
+
+        // The images are split into tiles, which are the units of work. The
+        // rays of a tile are cast as packets of 4x2 pixels.
+        const int num_tiles_x = (width_px + TILE_SIZE - 1) / TILE_SIZE;
+        const int num_tiles_y = (height_px + TILE_SIZE - 1) / TILE_SIZE;
+        const size_t num_tiles = size_t(num_tiles_x) * num_tiles_y;
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            RTCRayHit8 rh;
+            alignas(32) int valid[8];
+            for (size_t tile = range.begin(); tile < range.end(); ++tile) {
+                const size_t b = tile / num_tiles;
+                const int x0 = int(tile % num_tiles % num_tiles_x) * TILE_SIZE;
+                const int y0 = int(tile % num_tiles / num_tiles_x) * TILE_SIZE;
+                const int x1 = std::min(x0 + TILE_SIZE, width_px);
+                const int y1 = std::min(y0 + TILE_SIZE, height_px);
+                const float* p = &ray_params[12 * b];
+                for (int y = y0; y < y1; y += 2) {
+                    for (int x = x0; x < x1; x += 4) {
+                        for (int k = 0; k < 8; ++k) {
+                            const float u = x + k % 4 + 0.5f;
+                            const float v = y + k / 4 + 0.5f;
+                            valid[k] = (x + k % 4 < x1 && y + k / 4 < y1)
+                                               ? -1
+                                               : 0;
+                            rh.ray.org_x[k] = p[0];
+                            rh.ray.org_y[k] = p[1];
+                            rh.ray.org_z[k] = p[2];
+                            rh.ray.dir_x[k] = p[3] * u + p[6] * v + p[9];
+                            rh.ray.dir_y[k] = p[4] * u + p[7] * v + p[10];
+                            rh.ray.dir_z[k] = p[5] * u + p[8] * v + p[11];
+                            rh.ray.tnear[k] = 0;
+                            rh.ray.tfar[k] =
+                                    std::numeric_limits<float>::infinity();
+                            rh.ray.time[k] = 0;
+                            rh.ray.mask[k] = -1;
+                            rh.ray.id[k] = k;
+                            rh.ray.flags[k] = 0;
+                            rh.hit.geomID[k] = RTC_INVALID_GEOMETRY_ID;
+                            rh.hit.instID[0][k] = RTC_INVALID_GEOMETRY_ID;
+                        }
+
+                        rtcIntersect8(valid, scene_, &rh);
+
+                        for (int k = 0; k < 8; ++k) {
+                            if (!valid[k]) continue;
+                            const size_t idx =
+                                    (b * height_px + y + k / 4) * width_px +
+                                    x + k % 4;
+                            const bool hit =
+                                    rh.hit.geomID[k] != RTC_INVALID_GEOMETRY_ID;
+                            if (t_hit) {
+                                t_hit[idx] = rh.ray.tfar[k];
+                            }
+                            if (geometry_ids) {
+                                geometry_ids[idx] =
+                                        hit ? callbacks::GetGeometryID(
+                                                      rh.hit.instID[0][k],
+                                                      rh.hit.geomID[k])
+                                            : RTC_INVALID_GEOMETRY_ID;
+                            }
+                            if (primitive_ids) {
+                                primitive_ids[idx] =
+                                        hit ? rh.hit.primID[k]
+                                            : RTC_INVALID_GEOMETRY_ID;
+                            }
+                            if (primitive_uvs) {
+                                primitive_uvs[idx * 2 + 0] =
+                                        hit ? rh.hit.u[k] : 0;
+                                primitive_uvs[idx * 2 + 1] =
+                                        hit ? rh.hit.v[k] : 0;
+                            }
+                            if (primitive_normals) {
+                                float* n = &primitive_normals[idx * 3];
+                                if (hit) {
+                                    GetHitNormal(scene_, rh.hit.instID[0][k],
+                                                 rh.hit.Ng_x[k], rh.hit.Ng_y[k],
+                                                 rh.hit.Ng_z[k], n);
+                                } else {
+                                    n[0] = n[1] = n[2] = 0;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        const size_t num_total_tiles = batch_size * num_tiles;
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_total_tiles, 1),
+                        LoopFn);
+            });
+        } else {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_total_tiles, 1),
+                              LoopFn);
+        }
+    }
+
     void TestOcclusions(const float* const rays,
                         const size_t num_rays,
                         const float tnear,
@@ -1186,6 +1518,10 @@ struct RaycastingScene::CPUImpl : public RaycastingScene::Impl {
     void CopyArray(int* src, uint32_t* dst, size_t num_elements) override {
         std::copy(src, src + num_elements, dst);
     }
+
+    void CopyToBuffer(void* dst, const void* src, size_t num_bytes) override {
+        std::memcpy(dst, src, num_bytes);
+    }
 };
 
 RaycastingScene::RaycastingScene(int64_t nthreads, const core::Device& device) {
@@ -1229,7 +1565,8 @@ RaycastingScene::~RaycastingScene() {
 }
 
 uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
-                                       const core::Tensor& triangle_indices) {
+                                       const core::Tensor& triangle_indices,
+                                       bool dynamic) {
     core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
     core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
     core::AssertTensorDtype(vertex_positions, core::Float32);
@@ -1244,6 +1581,10 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
     impl_->scene_committed_ = false;
     RTCGeometry geom =
             rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+    if (dynamic) {
+        // Refit the BVH of the mesh if the vertex positions are updated.
+        rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
+    }
 
     // rtcSetNewGeometryBuffer will take care of alignment and padding
     float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
@@ -1254,54 +1595,58 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
             geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
             3 * sizeof(uint32_t), num_triangles);
 
-    {
-        auto data = vertex_positions.Contiguous();
-#ifdef BUILD_SYCL_MODULE
-        if (impl_->tensor_device_.IsSYCL()) {
-            dynamic_cast<RaycastingScene::SYCLImpl*>(impl_.get())
-                    ->queue_
-                    .memcpy(vertex_buffer, data.GetDataPtr(),
-                            sizeof(float) * 3 * num_vertices)
-                    .wait();
-        } else {
-#endif
-            std::memcpy(vertex_buffer, data.GetDataPtr(),
+    impl_->CopyToBuffer(vertex_buffer,
+                        vertex_positions.Contiguous().GetDataPtr(),
                         sizeof(float) * 3 * num_vertices);
-#ifdef BUILD_SYCL_MODULE
-        }
-#endif
-    }
-    {
-        auto data = triangle_indices.Contiguous();
-#ifdef BUILD_SYCL_MODULE
-        if (impl_->tensor_device_.IsSYCL()) {
-            dynamic_cast<RaycastingScene::SYCLImpl*>(impl_.get())
-                    ->queue_
-                    .memcpy(index_buffer, data.GetDataPtr(),
-                            sizeof(uint32_t) * 3 * num_triangles)
-                    .wait();
-        } else {
-#endif
-            std::memcpy(index_buffer, data.GetDataPtr(),
+    impl_->CopyToBuffer(index_buffer,
+                        triangle_indices.Contiguous().GetDataPtr(),
                         sizeof(uint32_t) * 3 * num_triangles);
-#ifdef BUILD_SYCL_MODULE
-        }
-#endif
-    }
     rtcSetGeometryEnableFilterFunctionFromArguments(geom, true);
     rtcCommitGeometry(geom);
 
-    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
-    rtcReleaseGeometry(geom);
+    SceneGeometry geometry;
+    geometry.geometry = geom;
+    geometry.mesh = geom;
+    geometry.num_vertices = num_vertices;
+    if (dynamic) {
+        // The mesh has its own scene, which is instanced in the top level
+        // scene. The dynamic flag selects the per mesh BVH builders, which
+        // respect the refit build quality.
+        geometry.scene = rtcNewScene(impl_->device_);
+        rtcSetSceneFlags(geometry.scene,
+                         RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_DYNAMIC |
+                                 RTC_SCENE_FLAG_FILTER_FUNCTION_IN_ARGUMENTS);
+        rtcAttachGeometry(geometry.scene, geom);
+        rtcReleaseGeometry(geom);
+
+        geometry.geometry =
+                rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_INSTANCE);
+        rtcSetGeometryInstancedScene(geometry.geometry, geometry.scene);
+        rtcSetGeometryTransform(geometry.geometry, 0,
+                                RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                                geometry.transform);
+        rtcCommitGeometry(geometry.geometry);
+        rtcReleaseScene(geometry.scene);
+    }
+
+    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geometry.geometry);
+    rtcReleaseGeometry(geometry.geometry);
 
     GeometryPtr geometry_ptr = {RTC_GEOMETRY_TYPE_TRIANGLE,
                                 (const void*)vertex_buffer,
                                 (const void*)index_buffer};
-    impl_->geometry_ptrs_.push_back(geometry_ptr);
+    if (geom_id >= impl_->geometries_.size()) {
+        impl_->geometries_.resize(geom_id + 1);
+        impl_->geometry_ptrs_.resize(
+                geom_id + 1, {RTC_GEOMETRY_TYPE_USER, nullptr, nullptr});
+    }
+    impl_->geometries_[geom_id] = geometry;
+    impl_->geometry_ptrs_[geom_id] = geometry_ptr;
     return geom_id;
 }
 
-uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
+uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh,
+                                       bool dynamic) {
     size_t num_verts = mesh.GetVertexPositions().GetLength();
     if (num_verts > std::numeric_limits<uint32_t>::max()) {
         utility::LogError(
@@ -1309,7 +1654,97 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                 std::numeric_limits<uint32_t>::max());
     }
     return AddTriangles(mesh.GetVertexPositions(),
-                        mesh.GetTriangleIndices().To(core::UInt32));
+                        mesh.GetTriangleIndices().To(core::UInt32), dynamic);
+}
+
+void RaycastingScene::RemoveGeometry(uint32_t geom_id) {
+    impl_->GetGeometry(geom_id);
+    impl_->scene_committed_ = false;
+    // Detaching releases the mesh, and the instance and the scene of a
+    // dynamic mesh.
+    rtcDetachGeometry(impl_->scene_, geom_id);
+    impl_->geometries_[geom_id] = SceneGeometry();
+    impl_->geometry_ptrs_[geom_id] = {RTC_GEOMETRY_TYPE_USER, nullptr, nullptr};
+}
+
+void RaycastingScene::UpdateVertexPositions(
+        uint32_t geom_id, const core::Tensor& vertex_positions) {
+    SceneGeometry& geometry = impl_->GetGeometry(geom_id);
+    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
+    core::AssertTensorShape(vertex_positions,
+                            {int64_t(geometry.num_vertices), 3});
+    core::AssertTensorDtype(vertex_positions, core::Float32);
+
+    impl_->CopyToBuffer(
+            rtcGetGeometryBufferData(geometry.mesh, RTC_BUFFER_TYPE_VERTEX, 0),
+            vertex_positions.Contiguous().GetDataPtr(),
+            sizeof(float) * 3 * geometry.num_vertices);
+    rtcUpdateGeometryBuffer(geometry.mesh, RTC_BUFFER_TYPE_VERTEX, 0);
+    rtcCommitGeometry(geometry.mesh);
+    if (geometry.scene) {
+        // The bounds of the instanced scene change.
+        rtcCommitGeometry(geometry.geometry);
+        geometry.scene_committed = false;
+    }
+    impl_->scene_committed_ = false;
+}
+
+void RaycastingScene::SetGeometryTransform(uint32_t geom_id,
+                                           const core::Tensor& transformation) {
+    SceneGeometry& geometry = impl_->GetGeometry(geom_id);
+    if (!geometry.scene) {
+        utility::LogError(
+                "Geometry {} is static. Add it with dynamic = true to set its "
+                "transformation.",
+                geom_id);
+    }
+    core::AssertTensorShape(transformation, {4, 4});
+    const Eigen::Matrix4d T = core::eigen_converter::TensorToEigenMatrixXd(
+            transformation.To(core::Device("CPU:0"), core::Float64));
+    const Eigen::Matrix3d R = T.topLeftCorner<3, 3>();
+    if (!(R.transpose() * R).isIdentity(1e-4) || R.determinant() <= 0 ||
+        !T.row(3).isApprox(Eigen::RowVector4d(0, 0, 0, 1))) {
+        utility::LogError("The transformation must be rigid, but got\n{}",
+                          transformation.ToString());
+    }
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            geometry.transform[4 * col + row] = float(T(row, col));
+        }
+    }
+    rtcSetGeometryTransform(geometry.geometry, 0,
+                            RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                            geometry.transform);
+    rtcCommitGeometry(geometry.geometry);
+    impl_->scene_committed_ = false;
+}
+
+core::Tensor RaycastingScene::GetGeometryTransform(uint32_t geom_id) const {
+    const SceneGeometry& geometry = impl_->GetGeometry(geom_id);
+    // The tensor is row-major.
+    return core::Tensor(std::vector<float>(geometry.transform,
+                                           geometry.transform + 16),
+                        {4, 4}, core::Float32)
+            .T()
+            .Contiguous();
+}
+
+void RaycastingScene::SetGeometryEnabled(uint32_t geom_id, bool enabled) {
+    SceneGeometry& geometry = impl_->GetGeometry(geom_id);
+    if (geometry.enabled == enabled) {
+        return;
+    }
+    if (enabled) {
+        rtcEnableGeometry(geometry.geometry);
+    } else {
+        rtcDisableGeometry(geometry.geometry);
+    }
+    geometry.enabled = enabled;
+    impl_->scene_committed_ = false;
+}
+
+bool RaycastingScene::IsGeometryEnabled(uint32_t geom_id) const {
+    return impl_->GetGeometry(geom_id).enabled;
 }
 
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
@@ -1346,6 +1781,106 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     return result;
 }
 
+void RaycastingScene::RenderDepthBatch(
+        const core::Tensor& intrinsic_matrices,
+        const core::Tensor& extrinsic_matrices,
+        int width_px,
+        int height_px,
+        std::unordered_map<std::string, core::Tensor>& outputs,
+        const int nthreads) {
+    core::AssertTensorDevice(intrinsic_matrices, core::Device());
+    core::AssertTensorDevice(extrinsic_matrices, core::Device());
+    core::Tensor extrinsics = extrinsic_matrices;
+    if (extrinsics.NumDims() == 2) {
+        core::AssertTensorShape(extrinsics, {4, 4});
+        extrinsics = extrinsics.Reshape({1, 4, 4});
+    }
+    const int64_t batch_size = extrinsics.GetLength();
+    core::AssertTensorShape(extrinsics, {batch_size, 4, 4});
+    core::Tensor intrinsics = intrinsic_matrices;
+    if (intrinsics.NumDims() == 2) {
+        core::AssertTensorShape(intrinsics, {3, 3});
+        intrinsics = intrinsics.Reshape({1, 3, 3}).Expand({batch_size, 3, 3});
+    }
+    core::AssertTensorShape(intrinsics, {batch_size, 3, 3});
+    if (batch_size == 0 || width_px <= 0 || height_px <= 0) {
+        utility::LogError(
+                "Expected at least one camera and a positive image size, but "
+                "got {} cameras and size {}x{}.",
+                batch_size, width_px, height_px);
+    }
+
+    // Origin and ray direction matrix of each camera.
+    core::Tensor ray_params({batch_size, 12}, core::Float32);
+    float* ray_params_ptr = ray_params.GetDataPtr<float>();
+    for (int64_t b = 0; b < batch_size; ++b) {
+        Eigen::Vector3f origin;
+        Eigen::Matrix3f RT_invK;
+        ComputePinholeRayParameters(
+                core::eigen_converter::TensorToEigenMatrixXd(intrinsics[b]),
+                core::eigen_converter::TensorToEigenMatrixXd(extrinsics[b]),
+                origin, RT_invK);
+        std::copy(origin.data(), origin.data() + 3, &ray_params_ptr[12 * b]);
+        std::copy(RT_invK.data(), RT_invK.data() + 9,
+                  &ray_params_ptr[12 * b + 3]);
+    }
+    ray_params = ray_params.To(impl_->tensor_device_);
+
+    // Returns the data pointer of the output if it has been requested.
+    auto GetOutput = [&](const std::string& name, const core::Dtype& dtype,
+                         int64_t channels) -> void* {
+        auto it = outputs.find(name);
+        if (it == outputs.end()) {
+            return nullptr;
+        }
+        core::SizeVector shape{batch_size, height_px, width_px};
+        if (channels > 1) {
+            shape.push_back(channels);
+        }
+        core::Tensor& tensor = it->second;
+        if (tensor.GetShape() != shape || tensor.GetDtype() != dtype ||
+            tensor.GetDevice() != impl_->tensor_device_ ||
+            !tensor.IsContiguous()) {
+            tensor = core::Tensor(shape, dtype, impl_->tensor_device_);
+        }
+        return tensor.GetDataPtr();
+    };
+    for (const auto& it : outputs) {
+        if (it.first != "t_hit" && it.first != "geometry_ids" &&
+            it.first != "primitive_ids" && it.first != "primitive_uvs" &&
+            it.first != "primitive_normals") {
+            utility::LogError("Unknown output {}.", it.first);
+        }
+    }
+
+    impl_->CastPinholeRays(
+            ray_params.GetDataPtr<float>(), batch_size, width_px, height_px,
+            static_cast<float*>(GetOutput("t_hit", core::Float32, 1)),
+            static_cast<uint32_t*>(GetOutput("geometry_ids", core::UInt32, 1)),
+            static_cast<uint32_t*>(
+                    GetOutput("primitive_ids", core::UInt32, 1)),
+            static_cast<float*>(GetOutput("primitive_uvs", core::Float32, 2)),
+            static_cast<float*>(
+                    GetOutput("primitive_normals", core::Float32, 3)),
+            nthreads);
+}
+
+std::unordered_map<std::string, core::Tensor> RaycastingScene::RenderDepthBatch(
+        const core::Tensor& intrinsic_matrices,
+        const core::Tensor& extrinsic_matrices,
+        int width_px,
+        int height_px,
+        const std::vector<std::string>& output_names,
+        const int nthreads) {
+    std::unordered_map<std::string, core::Tensor> outputs;
+    for (const std::string& name : output_names) {
+        outputs[name] = core::Tensor();
+    }
+    RenderDepthBatch(intrinsic_matrices, extrinsic_matrices, width_px,
+                     height_px, outputs, nthreads);
+    return outputs;
+}
+
 core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
                                              const float tnear,
                                              const float tfar,
@@ -1620,6 +2155,150 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
     return result.To(core::Float32);
 }
 
+VoxelBlockGrid RaycastingScene::ComputeNarrowBandSignedDistance(
+        float voxel_size,
+        int64_t block_resolution,
+        float trunc_voxel_multiplier,
+        const int nthreads,
+        const int nsamples) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive but is {}",
+                          voxel_size);
+    }
+    if (block_resolution <= 0) {
+        utility::LogError("block_resolution must be positive but is {}",
+                          block_resolution);
+    }
+    if (trunc_voxel_multiplier <= 0) {
+        utility::LogError("trunc_voxel_multiplier must be positive but is {}",
+                          trunc_voxel_multiplier);
+    }
+    if (nsamples < 1 || (nsamples % 2) != 1) {
+        utility::LogError("nsamples must be odd and >= 1 but is {}", nsamples);
+    }
+
+    const core::Device host("CPU:0");
+    const float sdf_trunc = voxel_size * trunc_voxel_multiplier;
+    const float block_size = voxel_size * block_resolution;
+    const RTCBounds bounds = impl_->GetSceneBounds();
+    const float lower[3] = {bounds.lower_x, bounds.lower_y, bounds.lower_z};
+    const float upper[3] = {bounds.upper_x, bounds.upper_y, bounds.upper_z};
+
+    // Range of the blocks that may contain voxels within the band.
+    int64_t block_min[3];
+    int64_t extent = 0;
+    for (int i = 0; i < 3; ++i) {
+        block_min[i] = int64_t(std::floor((lower[i] - sdf_trunc) / block_size));
+        const int64_t block_max =
+                int64_t(std::floor((upper[i] + sdf_trunc) / block_size));
+        extent = std::max(extent, block_max - block_min[i] + 1);
+    }
+    if (!(lower[0] <= upper[0] && lower[1] <= upper[1] &&
+          lower[2] <= upper[2])) {
+        extent = 0;
+    }
+
+    // Start with at most 4 cells per axis and halve the cell size until the
+    // cells are blocks. Only cells that may contain voxels within the band
+    // are subdivided.
+    int64_t cell_size = 1;
+    while (cell_size * 4 < extent) {
+        cell_size *= 2;
+    }
+    const int64_t num_cells = (extent + cell_size - 1) / cell_size;
+    std::vector<int64_t> init_cells;
+    init_cells.reserve(num_cells * num_cells * num_cells * 3);
+    for (int64_t z = 0; z < num_cells; ++z) {
+        for (int64_t y = 0; y < num_cells; ++y) {
+            for (int64_t x = 0; x < num_cells; ++x) {
+                init_cells.push_back(block_min[0] + x * cell_size);
+                init_cells.push_back(block_min[1] + y * cell_size);
+                init_cells.push_back(block_min[2] + z * cell_size);
+            }
+        }
+    }
+    core::Tensor cells(init_cells, {num_cells * num_cells * num_cells, 3},
+                       core::Int64, host);
+    const core::Tensor child_offsets = core::Tensor::Init<int64_t>(
+            {{{0, 0, 0},
+              {1, 0, 0},
+              {0, 1, 0},
+              {1, 1, 0},
+              {0, 0, 1},
+              {1, 0, 1},
+              {0, 1, 1},
+              {1, 1, 1}}});
+    while (cells.GetLength() > 0) {
+        const float half_size = 0.5f * cell_size * block_size;
+        const core::Tensor centers =
+                cells.To(core::Float32) * block_size + half_size;
+        const core::Tensor distance =
+                ComputeDistance(centers.To(impl_->tensor_device_), nthreads)
+                        .To(host);
+        cells = cells.IndexGet(
+                {distance.Le(std::sqrt(3.f) * half_size + sdf_trunc)});
+        if (cell_size == 1) {
+            break;
+        }
+        cell_size /= 2;
+        const int64_t n = cells.GetLength();
+        cells = (cells.Reshape({n, 1, 3}) + child_offsets * cell_size)
+                        .Reshape({n * 8, 3});
+    }
+
+    const int64_t num_blocks = cells.GetLength();
+    VoxelBlockGrid grid({"tsdf", "weight"}, {core::Float32, core::Float32},
+                        {{1}, {1}}, voxel_size, block_resolution,
+                        std::max<int64_t>(num_blocks, 1), host);
+    if (num_blocks == 0) {
+        return grid;
+    }
+    core::HashMap hashmap = grid.GetHashMap();
+    core::Tensor buf_indices, masks;
+    hashmap.Activate(cells.To(core::Int32), buf_indices, masks);
+
+    const int64_t resolution3 =
+            block_resolution * block_resolution * block_resolution;
+    const int64_t num_voxels = hashmap.GetCapacity() * resolution3;
+    core::Tensor tsdf = grid.GetAttribute("tsdf").View({num_voxels});
+    core::Tensor weight = grid.GetAttribute("weight").View({num_voxels});
+    tsdf.Fill(1.0f);
+    weight.Fill(0.0f);
+
+    // Evaluate the blocks in chunks to bound the memory of the queries.
+    const int64_t chunk_size =
+            std::max<int64_t>(1, (int64_t(1) << 20) / resolution3);
+    for (int64_t begin = 0; begin < num_blocks; begin += chunk_size) {
+        const int64_t end = std::min(num_blocks, begin + chunk_size);
+        core::Tensor voxel_coords, voxel_indices;
+        std::tie(voxel_coords, voxel_indices) =
+                grid.GetVoxelCoordinatesAndFlattenedIndices(
+                        buf_indices.Slice(0, begin, end));
+        const core::Tensor distance =
+                ComputeDistance(voxel_coords.To(impl_->tensor_device_),
+                                nthreads)
+                        .To(host);
+
+        // The sign is only needed within the band.
+        const core::Tensor band = distance.Lt(sdf_trunc).NonZero()[0];
+        if (band.GetLength() == 0) {
+            continue;
+        }
+        const core::Tensor band_coords =
+                voxel_coords.IndexGet({band}).To(impl_->tensor_device_);
+        const core::Tensor occupancy =
+                ComputeOccupancy(band_coords, nthreads, nsamples).To(host);
+        const core::Tensor band_indices = voxel_indices.IndexGet({band});
+        tsdf.IndexSet({band_indices},
+                      distance.IndexGet({band}) *
+                              (1.0f - 2.0f * occupancy) / sdf_trunc);
+        weight.IndexSet({band_indices},
+                        core::Tensor::Ones({band.GetLength()}, core::Float32,
+                                           host));
+    }
+    return grid;
+}
+
 core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& intrinsic_matrix,
         const core::Tensor& extrinsic_matrix,
@@ -1630,28 +2309,19 @@ core::Tensor RaycastingScene::CreateRaysPinhole(
     core::AssertTensorDevice(extrinsic_matrix, core::Device());
     core::AssertTensorShape(extrinsic_matrix, {4, 4});
 
-    auto intrinsic_matrix_contig =
-            intrinsic_matrix.To(core::Float64).Contiguous();
-    auto extrinsic_matrix_contig =
-            extrinsic_matrix.To(core::Float64).Contiguous();
-    // Eigen is col major
-    Eigen::Map<Eigen::MatrixXd> KT(intrinsic_matrix_contig.GetDataPtr<double>(),
-                                   3, 3);
-    Eigen::Map<Eigen::MatrixXd> TT(extrinsic_matrix_contig.GetDataPtr<double>(),
-                                   4, 4);
-
-    Eigen::Matrix3d invK = KT.transpose().inverse();
-    Eigen::Matrix3d RT = TT.block(0, 0, 3, 3);
-    Eigen::Vector3d t = TT.transpose().block(0, 3, 3, 1);
-    Eigen::Vector3d C = -RT * t;
-    Eigen::Matrix3f RT_invK = (RT * invK).cast<float>();
+    Eigen::Vector3f C;
+    Eigen::Matrix3f RT_invK;
+    ComputePinholeRayParameters(
+            core::eigen_converter::TensorToEigenMatrixXd(intrinsic_matrix),
+            core::eigen_converter::TensorToEigenMatrixXd(extrinsic_matrix), C,
+            RT_invK);
 
     core::Tensor rays({height_px, width_px, 6}, core::Float32);
     Eigen::Map<Eigen::MatrixXf> rays_map(rays.GetDataPtr<float>(), 6,
                                          height_px * width_px);
 
     Eigen::Matrix<float, 6, 1> r;
-    r.topRows<3>() = C.cast<float>();
+    r.topRows<3>() = C;
     int64_t linear_idx = 0;
     for (int y = 0; y < height_px; ++y) {
         for (int x = 0; x < width_px; ++x, ++linear_idx) {
@@ -13,6 +13,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
 
 namespace open3d {
 namespace t {
@@ -39,14 +40,61 @@ public:
     /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float.
     /// \param triangle_indices Triangles as Tensor of dim {M,3} and dtype
     /// uint32_t.
+    /// \param dynamic If true, the mesh gets its own refittable acceleration
+    /// structure, which is instanced in the scene. This makes
+    /// UpdateVertexPositions() and SetGeometryTransform() cheap, but the
+    /// queries are slower than for static meshes.
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const core::Tensor &vertex_positions,
-                          const core::Tensor &triangle_indices);
+                          const core::Tensor &triangle_indices,
+                          bool dynamic = false);
 
     /// \brief Add a triangle mesh to the scene.
     /// \param mesh A triangle mesh.
+    /// \param dynamic If true, the mesh gets its own refittable acceleration
+    /// structure, which is instanced in the scene.
     /// \return The geometry ID of the added mesh.
-    uint32_t AddTriangles(const TriangleMesh &mesh);
+    uint32_t AddTriangles(const TriangleMesh &mesh, bool dynamic = false);
+
+    /// \brief Removes a geometry from the scene.
+    /// \param geom_id The ID of the geometry. The ID may be reused by
+    /// geometries added later.
+    void RemoveGeometry(uint32_t geom_id);
+
+    /// \brief Updates the vertex positions of a triangle mesh.
+    ///
+    /// The acceleration structure of a dynamic mesh is refitted instead of
+    /// rebuilt, which is much faster than removing and adding the mesh. The
+    /// quality of a refitted structure degrades if the deformation moves
+    /// nearby triangles far apart. Add the mesh again in this case. The
+    /// acceleration structure of the scene is rebuilt for static meshes.
+    /// \param geom_id The ID of the geometry.
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float
+    /// with the same number of vertices as the mesh.
+    void UpdateVertexPositions(uint32_t geom_id,
+                               const core::Tensor &vertex_positions);
+
+    /// \brief Sets the rigid transformation of a dynamic geometry.
+    ///
+    /// Dynamic meshes are instanced in the scene. Changing the transformation
+    /// only updates the top level of the acceleration structure, which is much
+    /// cheaper than updating the vertex positions.
+    /// \param geom_id The ID of a geometry added with dynamic = true.
+    /// \param transformation Rigid 4x4 transformation from the mesh to the
+    /// scene.
+    void SetGeometryTransform(uint32_t geom_id,
+                              const core::Tensor &transformation);
+
+    /// \brief Returns the 4x4 Float32 transformation of a geometry. Static
+    /// geometries have the identity transformation.
+    core::Tensor GetGeometryTransform(uint32_t geom_id) const;
+
+    /// \brief Enables or disables a geometry. Disabled geometries are ignored
+    /// by all queries.
+    void SetGeometryEnabled(uint32_t geom_id, bool enabled);
+
+    /// \brief Returns true if the geometry is enabled.
+    bool IsGeometryEnabled(uint32_t geom_id) const;
 
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -74,6 +122,48 @@ public:
     std::unordered_map<std::string, core::Tensor> CastRays(
             const core::Tensor &rays, const int nthreads = 0) const;
 
+    /// \brief Renders images of a batch of pinhole cameras.
+    ///
+    /// This is equivalent to casting the rays of CreateRaysPinhole() for each
+    /// camera, but the rays are generated on the fly and cast as coherent
+    /// packets of neighboring pixels, and only the requested outputs are
+    /// written.
+    /// \param intrinsic_matrices The upper triangular intrinsic matrix with
+    /// shape {3,3}, or one matrix per camera with shape {B,3,3}.
+    /// \param extrinsic_matrices The 4x4 world to camera SE(3) transformations
+    /// with shape {B,4,4}, or {4,4} for a single camera.
+    /// \param width_px The width of the images in pixels.
+    /// \param height_px The height of the images in pixels.
+    /// \param outputs Maps the names of the requested outputs to their
+    /// tensors. The names are the keys of the dictionary of CastRays() and
+    /// the shapes have an additional leading batch dimension, e.g.,
+    /// {B,height_px,width_px} for \b t_hit, which is the depth since the
+    /// directions of the rays have a z component of 1 in camera space.
+    /// Tensors which already have the shape, dtype and device of the output
+    /// and are contiguous are overwritten, otherwise new tensors are
+    /// allocated.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    void RenderDepthBatch(
+            const core::Tensor &intrinsic_matrices,
+            const core::Tensor &extrinsic_matrices,
+            int width_px,
+            int height_px,
+            std::unordered_map<std::string, core::Tensor> &outputs,
+            const int nthreads = 0);
+
+    /// \brief Renders images of a batch of pinhole cameras.
+    ///
+    /// \param output_names The names of the requested outputs, see
+    /// CastRays().
+    /// \return A dictionary with the requested outputs.
+    std::unordered_map<std::string, core::Tensor> RenderDepthBatch(
+            const core::Tensor &intrinsic_matrices,
+            const core::Tensor &extrinsic_matrices,
+            int width_px,
+            int height_px,
+            const std::vector<std::string> &output_names = {"t_hit"},
+            const int nthreads = 0);
+
     /// \brief Checks if the rays have any intersection with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -218,6 +308,39 @@ public:
                                   const int nthreads = 0,
                                   const int nsamples = 1);
 
+    /// \brief Computes a sparse truncated signed distance field in a narrow
+    /// band around the surfaces of the scene.
+    ///
+    /// Instead of evaluating a dense grid, the bounding box of the scene is
+    /// subdivided hierarchically. Starting with a coarse grid, only cells
+    /// whose center is closer to the surface than the cell radius plus the
+    /// truncation distance are refined, until the cells are voxel blocks.
+    /// The signed distance is then evaluated for the voxels of the remaining
+    /// blocks, and the sign is computed only for voxels within the band.
+    /// The memory scales with the area of the surfaces instead of the volume.
+    ///
+    /// The same assumptions as for ComputeSignedDistance() apply.
+    ///
+    /// \param voxel_size The size of the voxels.
+    /// \param block_resolution The number of voxels of a block per axis.
+    /// \param trunc_voxel_multiplier The truncation distance in voxels.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param nsamples The number of rays used for determining the inside.
+    /// This must be an odd number.
+    ///
+    /// \return A voxel block grid on the CPU with the Float32 attributes
+    /// "tsdf" and "weight". The tsdf is the signed distance divided by the
+    /// truncation distance. Voxels within the band have the weight 1 and all
+    /// other voxels have the tsdf 1 and the weight 0. Surfaces can be
+    /// extracted with VoxelBlockGrid::ExtractTriangleMesh() and a weight
+    /// threshold of 0.
+    VoxelBlockGrid ComputeNarrowBandSignedDistance(
+            float voxel_size,
+            int64_t block_resolution = 8,
+            float trunc_voxel_multiplier = 4.0f,
+            const int nthreads = 0,
+            const int nsamples = 1);
+
     /// \brief Creates rays for the given camera parameters.
     ///
     /// \param intrinsic_matrix The upper triangular intrinsic matrix with
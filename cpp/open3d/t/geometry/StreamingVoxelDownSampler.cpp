@@ -0,0 +1,416 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/StreamingVoxelDownSampler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Random.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Adds the partial sums \p values of the unique voxels \p keys to
+/// \p voxels. New voxels are inserted with their partial sums.
+void MergeVoxels(core::HashMap &voxels,
+                 const core::Tensor &keys,
+                 const std::vector<core::Tensor> &values) {
+    core::Tensor buf_indices, masks;
+    voxels.Insert(keys, values, buf_indices, masks);
+    const core::Tensor existing = masks.LogicalNot();
+    if (!existing.Any().Item<bool>()) {
+        return;
+    }
+    voxels.Find(keys.IndexGet({existing}), buf_indices, masks);
+    buf_indices = buf_indices.To(core::Int64);
+    std::vector<core::Tensor> buffers = voxels.GetValueTensors();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        buffers[i].IndexAdd_(0, buf_indices, values[i].IndexGet({existing}));
+    }
+}
+
+}  // namespace
+
+StreamingVoxelDownSampler::StreamingVoxelDownSampler(
+        double voxel_size,
+        int64_t max_voxels,
+        const std::string &spill_dir,
+        int64_t tile_size,
+        const core::Device &device)
+    : voxel_size_(voxel_size),
+      max_voxels_(max_voxels),
+      spill_dir_(spill_dir),
+      tile_size_(tile_size),
+      device_(device) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (max_voxels <= 0) {
+        utility::LogError("max_voxels must be positive.");
+    }
+    if (tile_size <= 0) {
+        utility::LogError("tile_size must be positive.");
+    }
+    if (spill_dir_.empty()) {
+        spill_dir_ = utility::filesystem::GetTempDirectoryPath();
+    }
+}
+
+StreamingVoxelDownSampler::~StreamingVoxelDownSampler() { Reset(); }
+
+void StreamingVoxelDownSampler::Reset() {
+    attr_names_.clear();
+    attr_dtypes_.clear();
+    attr_shapes_.clear();
+    voxels_.reset();
+    num_points_ = 0;
+    if (!spill_path_.empty()) {
+        utility::filesystem::DeleteDirectory(spill_path_);
+        spill_path_.clear();
+    }
+    spilled_tiles_.clear();
+}
+
+void StreamingVoxelDownSampler::InitAttributes(const PointCloud &chunk) {
+    for (const std::string &key : chunk.GetPointAttr().GetKeySet()) {
+        attr_names_.push_back(key);
+    }
+    std::sort(attr_names_.begin(), attr_names_.end());
+    for (const std::string &key : attr_names_) {
+        const core::Tensor &attr = chunk.GetPointAttr(key);
+        if (attr.NumDims() != 2) {
+            utility::LogError(
+                    "Point attribute {} must have the shape {{num_points, "
+                    "channels}}, but got {}.",
+                    key, attr.GetShape().ToString());
+        }
+        attr_dtypes_.push_back(attr.GetDtype());
+        attr_shapes_.push_back({attr.GetShape(1)});
+    }
+    voxels_.reset(new core::HashMap(CreateVoxelMap(
+            std::min<int64_t>(max_voxels_, chunk.GetPointPositions()
+                                                   .GetLength()))));
+}
+
+core::HashMap StreamingVoxelDownSampler::CreateVoxelMap(
+        int64_t init_capacity) const {
+    // The first value is the point count, followed by the sums of the point
+    // attributes in the order of attr_names_.
+    std::vector<core::Dtype> dtypes(attr_names_.size() + 1, core::Float64);
+    std::vector<core::SizeVector> shapes{{1}};
+    shapes.insert(shapes.end(), attr_shapes_.begin(), attr_shapes_.end());
+    return core::HashMap(std::max<int64_t>(init_capacity, 1), core::Int64, {3},
+                         dtypes, shapes, device_);
+}
+
+void StreamingVoxelDownSampler::AddChunk(const PointCloud &chunk) {
+    if (!chunk.HasPointPositions()) {
+        utility::LogError("The chunk has no point positions.");
+    }
+    const int64_t num_points = chunk.GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return;
+    }
+    if (attr_names_.empty()) {
+        InitAttributes(chunk);
+    }
+    if (chunk.GetPointAttr().size() != attr_names_.size()) {
+        utility::LogError(
+                "The chunk has {} point attributes, but the first chunk had "
+                "{}.",
+                chunk.GetPointAttr().size(), attr_names_.size());
+    }
+    for (size_t i = 0; i < attr_names_.size(); ++i) {
+        if (!chunk.HasPointAttr(attr_names_[i])) {
+            utility::LogError("The chunk has no point attribute {}.",
+                              attr_names_[i]);
+        }
+        const core::Tensor &attr = chunk.GetPointAttr(attr_names_[i]);
+        if (attr.GetDtype() != attr_dtypes_[i] ||
+            attr.GetShape() != core::SizeVector{num_points,
+                                                attr_shapes_[i][0]}) {
+            utility::LogError(
+                    "Point attribute {} of the chunk does not match the dtype "
+                    "and shape of the first chunk.",
+                    attr_names_[i]);
+        }
+    }
+
+    // Sum the chunk per voxel first, so that each voxel of the chunk is
+    // merged into the accumulated voxels once.
+    const core::Tensor voxel_keys =
+            (chunk.GetPointPositions().To(device_) / voxel_size_)
+                    .Floor()
+                    .To(core::Int64);
+    core::HashSet chunk_voxels(num_points, core::Int64, {3}, device_);
+    core::Tensor buf_indices, masks;
+    chunk_voxels.Insert(voxel_keys, buf_indices, masks);
+    chunk_voxels.Find(voxel_keys, buf_indices, masks);
+    buf_indices = buf_indices.To(core::Int64);
+    const core::Tensor active =
+            chunk_voxels.GetActiveIndices().To(core::Int64);
+    const int64_t capacity = chunk_voxels.GetCapacity();
+
+    std::vector<core::Tensor> values;
+    core::Tensor counts =
+            core::Tensor::Zeros({capacity, 1}, core::Float64, device_);
+    counts.IndexAdd_(0, buf_indices,
+                     core::Tensor::Ones({num_points, 1}, core::Float64,
+                                        device_));
+    values.push_back(counts.IndexGet({active}));
+    for (size_t i = 0; i < attr_names_.size(); ++i) {
+        core::Tensor sums = core::Tensor::Zeros(
+                {capacity, attr_shapes_[i][0]}, core::Float64, device_);
+        sums.IndexAdd_(0, buf_indices,
+                       chunk.GetPointAttr(attr_names_[i])
+                               .To(device_)
+                               .To(core::Float64));
+        values.push_back(sums.IndexGet({active}));
+    }
+    const core::Tensor chunk_keys =
+            chunk_voxels.GetKeyTensor().IndexGet({active});
+    MergeVoxels(*voxels_, chunk_keys, values);
+    num_points_ += num_points;
+
+    if (voxels_->Size() > max_voxels_) {
+        SpillFinishedTiles(chunk_keys);
+    }
+}
+
+bool StreamingVoxelDownSampler::AddFile(const std::string &filename,
+                                        int64_t chunk_size,
+                                        const core::Dtype &dtype,
+                                        const std::string &format) {
+    if (chunk_size <= 0) {
+        utility::LogError("chunk_size must be positive.");
+    }
+    return io::ReadPointCloudInChunks(
+            filename, static_cast<size_t>(chunk_size),
+            [&](const open3d::geometry::PointCloud &chunk) {
+                AddChunk(PointCloud::FromLegacy(chunk, dtype, device_));
+                return true;
+            },
+            format);
+}
+
+core::Tensor StreamingVoxelDownSampler::ComputeTileKeys(
+        const core::Tensor &voxel_keys) const {
+    return (voxel_keys.To(core::Float64) / static_cast<double>(tile_size_))
+            .Floor()
+            .To(core::Int64);
+}
+
+void StreamingVoxelDownSampler::SpillFinishedTiles(
+        const core::Tensor &chunk_voxel_keys) {
+    const core::Tensor active = voxels_->GetActiveIndices().To(core::Int64);
+    const core::Tensor tiles = ComputeTileKeys(
+            voxels_->GetKeyTensor().IndexGet({active}));
+    const core::Tensor chunk_tiles = ComputeTileKeys(chunk_voxel_keys);
+
+    core::HashSet chunk_tile_set(chunk_tiles.GetLength(), core::Int64, {3},
+                                 device_);
+    core::Tensor buf_indices, masks;
+    chunk_tile_set.Insert(chunk_tiles, buf_indices, masks);
+    chunk_tile_set.Find(tiles, buf_indices, masks);
+    const core::Tensor finished = masks.LogicalNot();
+    const int64_t num_finished =
+            finished.To(core::Int64).Sum({0}).Item<int64_t>();
+    if (voxels_->Size() - num_finished > max_voxels_ / 2) {
+        utility::LogDebug("Spilling all {} voxels.", voxels_->Size());
+        SpillVoxels(active);
+    } else {
+        utility::LogDebug("Spilling {} voxels of finished tiles.",
+                          num_finished);
+        SpillVoxels(active.IndexGet({finished}));
+    }
+}
+
+std::string StreamingVoxelDownSampler::GetTilePath(const TileKey &tile) const {
+    return utility::filesystem::JoinPath(
+            spill_path_,
+            fmt::format("tile_{}_{}_{}.bin", tile[0], tile[1], tile[2]));
+}
+
+void StreamingVoxelDownSampler::SpillVoxels(const core::Tensor &buf_indices) {
+    const int64_t num_voxels = buf_indices.GetLength();
+    if (num_voxels == 0) {
+        return;
+    }
+    if (spill_path_.empty()) {
+        std::string path;
+        do {
+            path = utility::filesystem::JoinPath(
+                    spill_dir_, fmt::format("open3d_voxel_down_sample_{:08x}",
+                                            utility::random::RandUint32()));
+        } while (utility::filesystem::DirectoryExists(path));
+        if (!utility::filesystem::MakeDirectoryHierarchy(path)) {
+            utility::LogError("Failed to create the spill directory {}.",
+                              path);
+        }
+        spill_path_ = path;
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor keys = voxels_->GetKeyTensor().IndexGet({buf_indices});
+    const core::Tensor tiles = ComputeTileKeys(keys).To(host).Contiguous();
+    std::vector<core::Tensor> values;
+    for (const core::Tensor &buffer : voxels_->GetValueTensors()) {
+        values.push_back(buffer.IndexGet({buf_indices}));
+    }
+    voxels_->Erase(keys);
+
+    // Group the voxels by tile, then append each group to its tile file.
+    const int64_t *tile_ptr = tiles.GetDataPtr<int64_t>();
+    std::vector<int64_t> order(num_voxels);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int64_t i0, int64_t i1) {
+        return std::lexicographical_compare(tile_ptr + 3 * i0,
+                                            tile_ptr + 3 * i0 + 3,
+                                            tile_ptr + 3 * i1,
+                                            tile_ptr + 3 * i1 + 3);
+    });
+    const core::Tensor order_tensor(order, {num_voxels}, core::Int64, host);
+    const core::Tensor sorted_keys =
+            keys.To(host).IndexGet({order_tensor}).Contiguous();
+    for (core::Tensor &value : values) {
+        value = value.To(host).IndexGet({order_tensor}).Contiguous();
+    }
+
+    int64_t begin = 0;
+    while (begin < num_voxels) {
+        const int64_t *tile = tile_ptr + 3 * order[begin];
+        int64_t end = begin + 1;
+        while (end < num_voxels &&
+               std::equal(tile, tile + 3, tile_ptr + 3 * order[end])) {
+            ++end;
+        }
+        const TileKey tile_key{tile[0], tile[1], tile[2]};
+        const std::string path = GetTilePath(tile_key);
+        FILE *file = utility::filesystem::FOpen(path, "ab");
+        if (file == nullptr) {
+            utility::LogError("Failed to open the spill file {}.", path);
+        }
+        // Block layout: number of voxels, voxel keys, then the Float64
+        // values in the order of the value tensors.
+        const int64_t count = end - begin;
+        bool success = fwrite(&count, sizeof(int64_t), 1, file) == 1;
+        const core::Tensor block_keys = sorted_keys.Slice(0, begin, end);
+        success = success && fwrite(block_keys.GetDataPtr(), sizeof(int64_t),
+                                    block_keys.NumElements(),
+                                    file) == size_t(block_keys.NumElements());
+        for (const core::Tensor &value : values) {
+            const core::Tensor block = value.Slice(0, begin, end);
+            success = success && fwrite(block.GetDataPtr(), sizeof(double),
+                                        block.NumElements(),
+                                        file) == size_t(block.NumElements());
+        }
+        fclose(file);
+        if (!success) {
+            utility::LogError("Failed to write the spill file {}.", path);
+        }
+        spilled_tiles_.insert(tile_key);
+        begin = end;
+    }
+}
+
+PointCloud StreamingVoxelDownSampler::ComputeMeans(
+        const core::HashMap &voxels) const {
+    const core::Tensor active = voxels.GetActiveIndices().To(core::Int64);
+    const std::vector<core::Tensor> buffers = voxels.GetValueTensors();
+    const core::Tensor counts = buffers[0].IndexGet({active});
+    PointCloud pcd(device_);
+    for (size_t i = 0; i < attr_names_.size(); ++i) {
+        pcd.SetPointAttr(attr_names_[i],
+                         (buffers[i + 1].IndexGet({active}) / counts)
+                                 .To(attr_dtypes_[i]));
+    }
+    return pcd;
+}
+
+PointCloud StreamingVoxelDownSampler::Extract() {
+    if (!voxels_) {
+        return PointCloud(device_);
+    }
+    if (spilled_tiles_.empty()) {
+        PointCloud pcd = ComputeMeans(*voxels_);
+        Reset();
+        return pcd;
+    }
+
+    // Merge the spilled partial sums of each tile.
+    SpillVoxels(voxels_->GetActiveIndices().To(core::Int64));
+    const core::Device host("CPU:0");
+    std::vector<std::vector<core::Tensor>> tile_attrs(attr_names_.size());
+    for (const TileKey &tile : spilled_tiles_) {
+        const std::string path = GetTilePath(tile);
+        FILE *file = utility::filesystem::FOpen(path, "rb");
+        if (file == nullptr) {
+            utility::LogError("Failed to open the spill file {}.", path);
+        }
+        core::HashMap tile_voxels = CreateVoxelMap(1024);
+        int64_t count = 0;
+        while (fread(&count, sizeof(int64_t), 1, file) == 1) {
+            core::Tensor keys =
+                    core::Tensor::Empty({count, 3}, core::Int64, host);
+            bool success = fread(keys.GetDataPtr(), sizeof(int64_t),
+                                 keys.NumElements(),
+                                 file) == size_t(keys.NumElements());
+            std::vector<core::Tensor> values;
+            for (size_t i = 0; i <= attr_names_.size(); ++i) {
+                const int64_t channels = i == 0 ? 1 : attr_shapes_[i - 1][0];
+                core::Tensor value = core::Tensor::Empty(
+                        {count, channels}, core::Float64, host);
+                success = success &&
+                          fread(value.GetDataPtr(), sizeof(double),
+                                value.NumElements(),
+                                file) == size_t(value.NumElements());
+                values.push_back(value.To(device_));
+            }
+            if (!success) {
+                fclose(file);
+                utility::LogError("Failed to read the spill file {}.", path);
+            }
+            MergeVoxels(tile_voxels, keys.To(device_), values);
+        }
+        fclose(file);
+        utility::filesystem::RemoveFile(path);
+
+        PointCloud tile_pcd = ComputeMeans(tile_voxels);
+        for (size_t i = 0; i < attr_names_.size(); ++i) {
+            tile_attrs[i].push_back(tile_pcd.GetPointAttr(attr_names_[i]));
+        }
+    }
+
+    PointCloud pcd(device_);
+    for (size_t i = 0; i < attr_names_.size(); ++i) {
+        pcd.SetPointAttr(attr_names_[i], core::Concatenate(tile_attrs[i], 0));
+    }
+    Reset();
+    return pcd;
+}
+
+std::string StreamingVoxelDownSampler::ToString() const {
+    return fmt::format(
+            "StreamingVoxelDownSampler with {} points, {} voxels in memory "
+            "and {} spilled tiles on {}.",
+            num_points_, GetNumVoxelsInMemory(), GetNumSpilledTiles(),
+            device_.ToString());
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
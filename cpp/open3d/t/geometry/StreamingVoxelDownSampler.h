@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class StreamingVoxelDownSampler
+/// \brief Voxel downsampling of point clouds that do not fit into memory.
+///
+/// The point cloud is passed in chunks with AddChunk() or AddFile(). The
+/// voxel of each point is computed as in PointCloud::VoxelDownSample() and
+/// the number of points and the sums of all point attributes are accumulated
+/// per voxel in a hash map.
+///
+/// The space is partitioned into cubic tiles of tile_size voxels. When the
+/// hash map holds more than max_voxels voxels, the voxels of all tiles that
+/// have not been touched by the last chunk are considered finished and their
+/// partial sums are appended to one file per tile in a temporary directory
+/// below spill_dir. If the voxels of the tiles touched by the last chunk
+/// still take more than half of max_voxels, all voxels are spilled.
+///
+/// Extract() merges the partial sums tile by tile, so that the memory for the
+/// accumulation is bounded by max_voxels and the number of voxels of a single
+/// tile. The result is the same as PointCloud::VoxelDownSample() with the
+/// "mean" reduction of the whole point cloud, up to the order of the points
+/// and rounding, since the sums are accumulated in Float64.
+///
+/// All chunks must have the same point attributes, with the same dtypes and
+/// shapes {num_points, channels}.
+class StreamingVoxelDownSampler {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param max_voxels Max number of voxels that are accumulated in memory
+    /// before finished tiles are spilled to disk.
+    /// \param spill_dir Directory for the spilled tiles. The system temp
+    /// directory is used if empty.
+    /// \param tile_size Edge length of the spill tiles in voxels.
+    /// \param device Device of the accumulation. Chunks are moved to this
+    /// device.
+    StreamingVoxelDownSampler(
+            double voxel_size,
+            int64_t max_voxels = 1 << 24,
+            const std::string &spill_dir = "",
+            int64_t tile_size = 256,
+            const core::Device &device = core::Device("CPU:0"));
+    ~StreamingVoxelDownSampler();
+    StreamingVoxelDownSampler(const StreamingVoxelDownSampler &) = delete;
+    StreamingVoxelDownSampler &operator=(const StreamingVoxelDownSampler &) =
+            delete;
+
+public:
+    /// Accumulates the points of \p chunk.
+    void AddChunk(const PointCloud &chunk);
+
+    /// \brief Accumulates the points of a file, which is read in chunks of
+    /// \p chunk_size points with io::ReadPointCloudInChunks().
+    ///
+    /// \param filename Path of a xyz, xyzn, xyzrgb or ply file.
+    /// \param chunk_size Max number of points per chunk.
+    /// \param dtype Dtype of the positions and normals of the chunks. Float64
+    /// keeps the precision of large coordinates.
+    /// \param format File format, "auto" to deduce it from the extension.
+    /// \return true if the file has been read successfully.
+    bool AddFile(const std::string &filename,
+                 int64_t chunk_size = 1 << 22,
+                 const core::Dtype &dtype = core::Float32,
+                 const std::string &format = "auto");
+
+    /// Returns the downsampled point cloud of all points added so far and
+    /// resets the sampler.
+    PointCloud Extract();
+
+    /// Discards all accumulated points and spilled tiles.
+    void Reset();
+
+    /// Returns the number of points added since the last reset.
+    int64_t GetNumPoints() const { return num_points_; }
+
+    /// Returns the number of voxels accumulated in memory.
+    int64_t GetNumVoxelsInMemory() const {
+        return voxels_ ? voxels_->Size() : 0;
+    }
+
+    /// Returns the number of tiles that have been spilled to disk.
+    int64_t GetNumSpilledTiles() const {
+        return static_cast<int64_t>(spilled_tiles_.size());
+    }
+
+    std::string ToString() const;
+
+private:
+    typedef std::array<int64_t, 3> TileKey;
+
+    void InitAttributes(const PointCloud &chunk);
+    core::HashMap CreateVoxelMap(int64_t init_capacity) const;
+    core::Tensor ComputeTileKeys(const core::Tensor &voxel_keys) const;
+    void SpillFinishedTiles(const core::Tensor &chunk_voxel_keys);
+    void SpillVoxels(const core::Tensor &buf_indices);
+    std::string GetTilePath(const TileKey &tile) const;
+    PointCloud ComputeMeans(const core::HashMap &voxels) const;
+
+    double voxel_size_;
+    int64_t max_voxels_;
+    std::string spill_dir_;
+    int64_t tile_size_;
+    core::Device device_;
+
+    /// Point attributes of the first chunk, all chunks must match.
+    std::vector<std::string> attr_names_;
+    std::vector<core::Dtype> attr_dtypes_;
+    std::vector<core::SizeVector> attr_shapes_;
+
+    /// Voxel keys to the point count and the Float64 attribute sums.
+    std::unique_ptr<core::HashMap> voxels_;
+    int64_t num_points_ = 0;
+
+    /// Directory of the spilled tiles, created on the first spill.
+    std::string spill_path_;
+    std::set<TileKey> spilled_tiles_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
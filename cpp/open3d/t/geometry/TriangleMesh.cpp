@@ -9,18 +9,14 @@
 
 #include <fmt/core.h>
 #include <tbb/parallel_for_each.h>
-#include <vtkBooleanOperationPolyDataFilter.h>
-#include <vtkCleanPolyData.h>
-#include <vtkClipPolyData.h>
 #include <vtkCutter.h>
-#include <vtkFillHolesFilter.h>
 #include <vtkPlane.h>
-#include <vtkQuadricDecimation.h>
 
 #include <Eigen/Core>
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -37,10 +33,12 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/TensorKey.h"
 #include "open3d/core/linalg/AddMM.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/t/geometry/LineSet.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RaycastingScene.h"
@@ -607,12 +605,58 @@ TriangleMesh TriangleMesh::To(const core::Device &device, bool copy) const {
 
 TriangleMesh TriangleMesh::ComputeConvexHull(bool joggle_inputs) const {
     PointCloud pcd(GetVertexPositions());
-    return pcd.ComputeConvexHull();
+    return pcd.ComputeConvexHull(joggle_inputs);
 }
 
+namespace {
+
+/// Interpolates the vertex attribute \p attr for the vertices computed from
+/// \p vertex_sources and \p vertex_weights by the mesh kernels. Float
+/// attributes are blended, other attributes are copied from the source with
+/// the larger weight.
+core::Tensor InterpolateVertexAttr(const core::Tensor &attr,
+                                   const core::Tensor &vertex_sources,
+                                   const core::Tensor &vertex_weights) {
+    const core::Device host("CPU:0");
+    const int64_t num_vertices = vertex_sources.GetLength();
+    core::SizeVector shape = attr.GetShape();
+    const int64_t num_channels =
+            core::SizeVector(shape.begin() + 1, shape.end()).NumElements();
+    shape[0] = num_vertices;
+    const core::Tensor values =
+            attr.To(host).Reshape({attr.GetLength(), num_channels});
+    const core::Tensor first = vertex_sources.GetItem(
+            {core::TensorKey::Slice(core::None, core::None, core::None),
+             core::TensorKey::Index(0)});
+    const core::Tensor second = vertex_sources.GetItem(
+            {core::TensorKey::Slice(core::None, core::None, core::None),
+             core::TensorKey::Index(1)});
+
+    core::Tensor result;
+    if (attr.GetDtype() == core::Float32 || attr.GetDtype() == core::Float64) {
+        const core::Tensor weights = vertex_weights.Reshape({num_vertices, 1});
+        const core::Tensor values_f64 = values.To(core::Float64);
+        result = values_f64.IndexGet({first}) * weights +
+                 values_f64.IndexGet({second}) * (1.0 - weights);
+    } else {
+        core::Tensor nearest = first.Clone();
+        int64_t *nearest_ptr = nearest.GetDataPtr<int64_t>();
+        const int64_t *second_ptr = second.Contiguous().GetDataPtr<int64_t>();
+        const double *weights_ptr = vertex_weights.GetDataPtr<double>();
+        for (int64_t i = 0; i < num_vertices; ++i) {
+            if (weights_ptr[i] < 0.5) {
+                nearest_ptr[i] = second_ptr[i];
+            }
+        }
+        result = values.IndexGet({nearest});
+    }
+    return result.Reshape(shape).To(attr.GetDevice(), attr.GetDtype());
+}
+
+}  // namespace
+
 TriangleMesh TriangleMesh::ClipPlane(const core::Tensor &point,
                                      const core::Tensor &normal) const {
-    using namespace vtkutils;
     core::AssertTensorShape(point, {3});
     core::AssertTensorShape(normal, {3});
     // allow int types for convenience
@@ -621,24 +665,33 @@ TriangleMesh TriangleMesh::ClipPlane(const core::Tensor &point,
     core::AssertTensorDtypes(
             normal, {core::Float32, core::Float64, core::Int32, core::Int64});
 
-    auto point_ = point.To(core::Device(), core::Float64).Contiguous();
-    auto normal_ = normal.To(core::Device(), core::Float64).Contiguous();
-
-    auto polydata = CreateVtkPolyDataFromGeometry(
-            *this, GetVertexAttr().GetKeySet(), GetTriangleAttr().GetKeySet(),
-            {}, {}, false);
-
-    vtkNew<vtkPlane> clipPlane;
-    clipPlane->SetNormal(normal_.GetDataPtr<double>());
-    clipPlane->SetOrigin(point_.GetDataPtr<double>());
-    vtkNew<vtkClipPolyData> clipper;
-    clipper->SetInputData(polydata);
-    clipper->SetClipFunction(clipPlane);
-    vtkNew<vtkCleanPolyData> cleaner;
-    cleaner->SetInputConnection(clipper->GetOutputPort());
-    cleaner->Update();
-    auto clipped_polydata = cleaner->GetOutput();
-    return CreateTriangleMeshFromVtkPolyData(clipped_polydata);
+    const core::Device host("CPU:0");
+    const core::Tensor point_ = point.To(host, core::Float64).Contiguous();
+    const core::Tensor normal_ = normal.To(host, core::Float64).Contiguous();
+
+    core::Tensor triangles, vertex_sources, vertex_weights, triangle_sources;
+    kernel::trianglemesh::ClipPlaneCPU(
+            GetVertexPositions().To(host, core::Float64).Contiguous(),
+            GetTriangleIndices().To(host, core::Int64).Contiguous(), point_,
+            normal_, triangles, vertex_sources, vertex_weights,
+            triangle_sources);
+
+    TriangleMesh mesh(GetDevice());
+    for (const auto &kv : GetVertexAttr()) {
+        mesh.SetVertexAttr(kv.first,
+                           InterpolateVertexAttr(kv.second, vertex_sources,
+                                                 vertex_weights));
+    }
+    mesh.SetTriangleIndices(
+            triangles.To(GetDevice(), GetTriangleIndices().GetDtype()));
+    triangle_sources = triangle_sources.To(GetDevice());
+    for (const auto &kv : GetTriangleAttr()) {
+        if (kv.first != "indices") {
+            mesh.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({triangle_sources}));
+        }
+    }
+    return mesh;
 }
 
 LineSet TriangleMesh::SlicePlane(
@@ -679,76 +732,164 @@ LineSet TriangleMesh::SlicePlane(
     return CreateLineSetFromVtkPolyData(slices_polydata);
 }
 
+namespace {
+
+/// Builds the legacy BVH of the triangles of \p mesh, copied to the CPU.
+open3d::geometry::TriangleMeshBVH CreateTriangleMeshBVH(
+        const TriangleMesh &mesh) {
+    if (!mesh.HasVertexPositions() || !mesh.HasTriangleIndices()) {
+        return open3d::geometry::TriangleMeshBVH();
+    }
+    return open3d::geometry::TriangleMeshBVH(
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    mesh.GetVertexPositions()),
+            core::eigen_converter::TensorToEigenVector3iVector(
+                    mesh.GetTriangleIndices()));
+}
+
+}  // namespace
+
+core::Tensor TriangleMesh::GetSelfIntersectingTriangles() const {
+    return core::eigen_converter::EigenVector2iVectorToTensor(
+            CreateTriangleMeshBVH(*this).GetSelfIntersectingTriangles(),
+            core::Int64, core::Device("CPU:0"));
+}
+
+core::Tensor TriangleMesh::GetIntersectingTriangles(
+        const TriangleMesh &other) const {
+    return core::eigen_converter::EigenVector2iVectorToTensor(
+            CreateTriangleMeshBVH(*this).GetIntersectingTriangles(
+                    CreateTriangleMeshBVH(other)),
+            core::Int64, core::Device("CPU:0"));
+}
+
 TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
-        double target_reduction, bool preserve_volume) const {
-    using namespace vtkutils;
+        double target_reduction,
+        bool preserve_volume,
+        int max_partition_triangles) const {
     if (target_reduction >= 1.0 || target_reduction < 0) {
         utility::LogError(
                 "target_reduction must be in the range [0,1) but is {}",
                 target_reduction);
     }
-
-    // exclude attributes because they will not be preserved
-    auto polydata = CreateVtkPolyDataFromGeometry(*this, {}, {}, {}, {}, false);
-
-    vtkNew<vtkQuadricDecimation> decimate;
-    decimate->SetInputData(polydata);
-    decimate->SetTargetReduction(target_reduction);
-    decimate->SetVolumePreservation(preserve_volume);
-    decimate->Update();
-    auto decimated_polydata = decimate->GetOutput();
-
-    return CreateTriangleMeshFromVtkPolyData(decimated_polydata);
+    if (max_partition_triangles <= 0) {
+        utility::LogError("max_partition_triangles must be > 0 but is {}",
+                          max_partition_triangles);
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor vertices =
+            GetVertexPositions().To(host, core::Float64).Contiguous();
+    const core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int32).Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+
+    // Float vertex attributes are averaged when an edge is collapsed.
+    std::vector<std::string> attr_keys;
+    std::vector<core::Tensor> vertex_attrs;
+    for (const auto &kv : GetVertexAttr()) {
+        const core::Dtype dtype = kv.second.GetDtype();
+        if (kv.first == "positions" ||
+            (dtype != core::Float32 && dtype != core::Float64)) {
+            continue;
+        }
+        attr_keys.push_back(kv.first);
+        vertex_attrs.push_back(kv.second.To(host, core::Float64)
+                                       .Reshape({num_vertices, -1})
+                                       .Contiguous());
+    }
+
+    const int64_t target_number_of_triangles =
+            std::llround((1 - target_reduction) * triangles.GetLength());
+    core::Tensor out_vertices, out_triangles;
+    std::vector<core::Tensor> out_vertex_attrs;
+    kernel::trianglemesh::SimplifyQuadricDecimationCPU(
+            vertices, triangles, vertex_attrs, target_number_of_triangles,
+            std::numeric_limits<double>::infinity(), 1.0, preserve_volume,
+            max_partition_triangles, out_vertices, out_triangles,
+            out_vertex_attrs);
+
+    TriangleMesh mesh(GetDevice());
+    mesh.SetVertexPositions(out_vertices.To(
+            GetDevice(), GetVertexPositions().GetDtype()));
+    mesh.SetTriangleIndices(out_triangles.To(
+            GetDevice(), GetTriangleIndices().GetDtype()));
+    for (size_t i = 0; i < attr_keys.size(); ++i) {
+        const core::Tensor &attr = GetVertexAttr(attr_keys[i]);
+        core::SizeVector shape = attr.GetShape();
+        shape[0] = out_vertex_attrs[i].GetLength();
+        mesh.SetVertexAttr(attr_keys[i],
+                           out_vertex_attrs[i].Reshape(shape).To(
+                                   GetDevice(), attr.GetDtype()));
+    }
+    if (HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    return mesh;
 }
 
 namespace {
 TriangleMesh BooleanOperation(const TriangleMesh &mesh_A,
                               const TriangleMesh &mesh_B,
                               double tolerance,
-                              int op) {
-    using namespace vtkutils;
-    // exclude triangle attributes because they will not be preserved
-    auto polydata_A = CreateVtkPolyDataFromGeometry(
-            mesh_A, mesh_A.GetVertexAttr().GetKeySet(), {}, {}, {}, false);
-    auto polydata_B = CreateVtkPolyDataFromGeometry(
-            mesh_B, mesh_B.GetVertexAttr().GetKeySet(), {}, {}, {}, false);
-
-    // clean meshes before passing them to the boolean operation
-    vtkNew<vtkCleanPolyData> cleaner_A;
-    cleaner_A->SetInputData(polydata_A);
-
-    vtkNew<vtkCleanPolyData> cleaner_B;
-    cleaner_B->SetInputData(polydata_B);
-
-    vtkNew<vtkBooleanOperationPolyDataFilter> boolean_filter;
-    boolean_filter->SetOperation(op);
-    boolean_filter->SetTolerance(tolerance);
-    boolean_filter->SetInputConnection(0, cleaner_A->GetOutputPort());
-    boolean_filter->SetInputConnection(1, cleaner_B->GetOutputPort());
-    boolean_filter->Update();
-    auto out_polydata = boolean_filter->GetOutput();
-
-    return CreateTriangleMeshFromVtkPolyData(out_polydata);
+                              kernel::trianglemesh::BooleanOperation op) {
+    const core::Device host("CPU:0");
+    core::Tensor vertices, triangles, vertex_sources, vertex_weights;
+    kernel::trianglemesh::BooleanOperationCPU(
+            mesh_A.GetVertexPositions().To(host, core::Float64).Contiguous(),
+            mesh_A.GetTriangleIndices().To(host, core::Int64).Contiguous(),
+            mesh_B.GetVertexPositions().To(host, core::Float64).Contiguous(),
+            mesh_B.GetTriangleIndices().To(host, core::Int64).Contiguous(),
+            op, tolerance, vertices, triangles, vertex_sources,
+            vertex_weights);
+
+    const core::Device device = mesh_A.GetDevice();
+    TriangleMesh mesh(device);
+    mesh.SetVertexPositions(
+            vertices.To(device, mesh_A.GetVertexPositions().GetDtype()));
+    mesh.SetTriangleIndices(
+            triangles.To(device, mesh_A.GetTriangleIndices().GetDtype()));
+    // Vertex attributes are kept if both meshes have them with the same dtype
+    // and shape. Triangle attributes are not preserved.
+    for (const auto &kv : mesh_A.GetVertexAttr()) {
+        if (kv.first == "positions" || !mesh_B.HasVertexAttr(kv.first)) {
+            continue;
+        }
+        const core::Tensor &attr_A = kv.second;
+        const core::Tensor &attr_B = mesh_B.GetVertexAttr(kv.first);
+        const core::SizeVector &shape_A = attr_A.GetShape();
+        const core::SizeVector &shape_B = attr_B.GetShape();
+        if (attr_A.GetDtype() != attr_B.GetDtype() ||
+            !std::equal(shape_A.begin() + 1, shape_A.end(),
+                        shape_B.begin() + 1, shape_B.end())) {
+            continue;
+        }
+        const core::Tensor attr = core::Concatenate(
+                {attr_A.To(device), attr_B.To(device)}, 0);
+        mesh.SetVertexAttr(kv.first, InterpolateVertexAttr(attr, vertex_sources,
+                                                           vertex_weights));
+    }
+    return mesh;
 }
 }  // namespace
 
 TriangleMesh TriangleMesh::BooleanUnion(const TriangleMesh &mesh,
                                         double tolerance) const {
     return BooleanOperation(*this, mesh, tolerance,
-                            vtkBooleanOperationPolyDataFilter::VTK_UNION);
+                            kernel::trianglemesh::BooleanOperation::Union);
 }
 
 TriangleMesh TriangleMesh::BooleanIntersection(const TriangleMesh &mesh,
                                                double tolerance) const {
     return BooleanOperation(
             *this, mesh, tolerance,
-            vtkBooleanOperationPolyDataFilter::VTK_INTERSECTION);
+            kernel::trianglemesh::BooleanOperation::Intersection);
 }
 
 TriangleMesh TriangleMesh::BooleanDifference(const TriangleMesh &mesh,
                                              double tolerance) const {
     return BooleanOperation(*this, mesh, tolerance,
-                            vtkBooleanOperationPolyDataFilter::VTK_DIFFERENCE);
+                            kernel::trianglemesh::BooleanOperation::Difference);
 }
 
 AxisAlignedBoundingBox TriangleMesh::GetAxisAlignedBoundingBox() const {
@@ -760,17 +901,22 @@ OrientedBoundingBox TriangleMesh::GetOrientedBoundingBox() const {
 }
 
 TriangleMesh TriangleMesh::FillHoles(double hole_size) const {
-    using namespace vtkutils;
-    // do not include triangle attributes because they will not be preserved by
-    // the hole filling algorithm
-    auto polydata = CreateVtkPolyDataFromGeometry(
-            *this, GetVertexAttr().GetKeySet(), {}, {}, {}, false);
-    vtkNew<vtkFillHolesFilter> fill_holes;
-    fill_holes->SetInputData(polydata);
-    fill_holes->SetHoleSize(hole_size);
-    fill_holes->Update();
-    auto result = fill_holes->GetOutput();
-    return CreateTriangleMeshFromVtkPolyData(result);
+    const core::Device host("CPU:0");
+    core::Tensor triangles;
+    kernel::trianglemesh::FillHolesCPU(
+            GetVertexPositions().To(host, core::Float64).Contiguous(),
+            GetTriangleIndices().To(host, core::Int64).Contiguous(),
+            hole_size, triangles);
+
+    // Triangle attributes are not preserved because the new triangles have no
+    // values for them.
+    TriangleMesh mesh(GetDevice());
+    for (const auto &kv : GetVertexAttr()) {
+        mesh.SetVertexAttr(kv.first, kv.second.Clone());
+    }
+    mesh.SetTriangleIndices(
+            triangles.To(GetDevice(), GetTriangleIndices().GetDtype()));
+    return mesh;
 }
 
 std::tuple<float, int, int> TriangleMesh::ComputeUVAtlas(
@@ -1768,16 +1914,22 @@ core::Tensor TriangleMesh::GetNonManifoldEdges(
 
     DISPATCH_INT_DTYPE_PREFIX_TO_TEMPLATE(tri_dtype, tris, [&]() {
         auto edges = GetEdgeToTrianglesMap<scalar_tris_t>(tris_cpu);
-        std::vector<scalar_tris_t> non_manifold_edges;
+        std::vector<Edge<scalar_tris_t>> sorted_edges;
 
         for (auto &kv : edges) {
             if ((allow_boundary_edges &&
                  (kv.second.size() < 1 || kv.second.size() > 2)) ||
                 (!allow_boundary_edges && kv.second.size() != 2)) {
-                non_manifold_edges.push_back(std::get<0>(kv.first));
-                non_manifold_edges.push_back(std::get<1>(kv.first));
+                sorted_edges.push_back(kv.first);
             }
         }
+        // Same order as the legacy TriangleMesh::GetNonManifoldEdges().
+        std::sort(sorted_edges.begin(), sorted_edges.end());
+        std::vector<scalar_tris_t> non_manifold_edges;
+        for (const auto &edge : sorted_edges) {
+            non_manifold_edges.push_back(std::get<0>(edge));
+            non_manifold_edges.push_back(std::get<1>(edge));
+        }
 
         result = core::Tensor(non_manifold_edges,
                               {(long int)non_manifold_edges.size() / 2, 2},
@@ -612,6 +612,39 @@ public:
             const std::vector<double> contour_values = {0.0},
             const core::Device &device = core::Device("CPU:0"));
 
+    /// Create a mesh from an oriented point cloud file that does not fit into
+    /// memory with the Screened Poisson Reconstruction in overlapping tiles.
+    /// See open3d::geometry::TriangleMesh::CreateFromPointCloudPoissonStreaming
+    /// for details.
+    /// \param filename Point cloud file with normals (xyz, xyzn, xyzrgb or
+    /// ply).
+    /// \param depth Maximum depth of the octree of each tile.
+    /// \param max_points_per_tile Maximum number of points of a tile
+    /// including its overlap.
+    /// \param overlap Width of the margin around each tile relative to the
+    /// tile size, in [0, 0.5).
+    /// \param scale Ratio between the edge length of the reconstruction cube
+    /// of a tile and its extended cube.
+    /// \param temp_directory Directory for temporary files. The system
+    /// temporary directory is used if empty.
+    /// \param n_threads Number of threads, -1 to use all cores.
+    /// \param float_dtype Float32 or Float64, used to store floating point
+    /// values, e.g. vertices, normals.
+    /// \param int_dtype Int32 or Int64, used to store index values, e.g.
+    /// triangles.
+    /// \param device The device where the resulting TriangleMesh resides.
+    static TriangleMesh CreateFromPointCloudPoissonStreaming(
+            const std::string &filename,
+            int depth = 8,
+            int64_t max_points_per_tile = 4000000,
+            double overlap = 0.25,
+            float scale = 1.1f,
+            const std::string &temp_directory = "",
+            int n_threads = -1,
+            core::Dtype float_dtype = core::Float32,
+            core::Dtype int_dtype = core::Int64,
+            const core::Device &device = core::Device("CPU:0"));
+
 public:
     /// Clear all data in the trianglemesh.
     TriangleMesh &Clear() override {
@@ -696,6 +729,8 @@ public:
     /// This method clips the triangle mesh with the specified plane.
     /// Parts of the mesh on the positive side of the plane will be kept and
     /// triangles intersected by the plane will be cut.
+    /// The new vertices on the plane are shared by the cut triangles and their
+    /// attributes are interpolated. Triangle attributes are preserved.
     /// \param point A point on the plane as [Tensor of dim {3}].
     /// \param normal The normal of the plane as [Tensor of dim {3}]. The normal
     /// points to the positive side of the plane for which the geometry will be
@@ -716,6 +751,23 @@ public:
                        const core::Tensor &normal,
                        const std::vector<double> contour_values = {0.0}) const;
 
+    /// \brief Returns all pairs of intersecting triangles of the mesh.
+    ///
+    /// Triangles that share a vertex are not tested. The candidate pairs are
+    /// found with open3d::geometry::TriangleMeshBVH.
+    /// \return Int64 tensor of shape {n, 2} on the CPU with the triangle
+    /// indices (i, j), i < j, sorted lexicographically.
+    core::Tensor GetSelfIntersectingTriangles() const;
+
+    /// \brief Returns all pairs of intersecting triangles of this mesh and
+    /// \p other.
+    ///
+    /// \param other The other triangle mesh.
+    /// \return Int64 tensor of shape {n, 2} on the CPU with the index of the
+    /// triangle of this mesh and the index of the triangle of \p other,
+    /// sorted lexicographically.
+    core::Tensor GetIntersectingTriangles(const TriangleMesh &other) const;
+
     core::Device GetDevice() const override { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -757,26 +809,28 @@ public:
             core::Dtype int_dtype = core::Int64,
             const core::Device &device = core::Device("CPU:0"));
 
-    /// Compute the convex hull of the triangle mesh using qhull.
+    /// Compute the convex hull of the triangle mesh vertices with a parallel
+    /// Quickhull. See PointCloud::ComputeConvexHull().
     ///
     /// This runs on the CPU.
     ///
     /// \param joggle_inputs (default False). Handle precision problems by
-    /// randomly perturbing the input data. Set to True if perturbing the input
-    /// iis acceptable but you need convex simplicial output. If False,
-    /// neighboring facets may be merged in case of precision problems. See
-    /// [QHull docs](http://www.qhull.org/html/qh-impre.htm#joggle) for more
-    /// details.
+    /// randomly perturbing the input data, as the 'QJ' option of
+    /// [QHull](http://www.qhull.org/html/qh-impre.htm#joggle).
     ///
-    /// \return TriangleMesh representing the convexh hull. This contains an
-    /// extra vertex property "point_map" that contains the index of the
-    /// corresponding vertex in the original mesh.
+    /// \return TriangleMesh representing the convex hull. This contains an
+    /// extra Int32 vertex property "point_indices" that contains the index of
+    /// the corresponding vertex in the original mesh.
     TriangleMesh ComputeConvexHull(bool joggle_inputs = false) const;
 
     /// Function to simplify mesh using Quadric Error Metric Decimation by
     /// Garland and Heckbert.
     ///
-    /// This function always uses the CPU device.
+    /// This function always uses the CPU device. Meshes with more than
+    /// \p max_partition_triangles triangles are split into spatial partitions
+    /// that are decimated in parallel with locked partition boundaries,
+    /// followed by a pass over the partition seams. Float vertex attributes
+    /// are averaged when an edge is collapsed, other attributes are dropped.
     ///
     /// \param target_reduction The factor of triangles to delete, i.e.,
     /// setting this to 0.9 will return a mesh with about 10% of the original
@@ -784,20 +838,30 @@ public:
     /// It is not guaranteed that the target reduction factor will be reached.
     /// \param preserve_volume If set to true this enables volume preservation
     /// which reduces the error in triangle normal direction.
+    /// \param max_partition_triangles The maximum number of triangles of a
+    /// partition.
     ///
     /// \return Simplified TriangleMesh.
-    TriangleMesh SimplifyQuadricDecimation(double target_reduction,
-                                           bool preserve_volume = true) const;
+    TriangleMesh SimplifyQuadricDecimation(
+            double target_reduction,
+            bool preserve_volume = true,
+            int max_partition_triangles = 65536) const;
 
     /// Computes the mesh that encompasses the union of the volumes of two
     /// meshes.
     /// Both meshes should be manifold.
     ///
-    /// This function always uses the CPU device.
+    /// The intersection curves of the two meshes are computed with exact
+    /// predicates and the parts of the surfaces are classified with the
+    /// winding number of the other mesh. Vertex attributes present in both
+    /// meshes with the same dtype and shape are interpolated, triangle
+    /// attributes are not preserved. The computation runs on the CPU and the
+    /// result is on the device of this mesh.
     ///
     /// \param mesh This is the second operand for the boolean operation.
     /// \param tolerance Threshold which determines when point distances are
-    /// considered to be 0.
+    /// considered to be 0. Vertices of the result closer than the tolerance
+    /// are merged.
     ///
     /// \return The mesh describing the union volume.
     TriangleMesh BooleanUnion(const TriangleMesh &mesh,
@@ -806,11 +870,12 @@ public:
     /// Computes the mesh that encompasses the intersection of the volumes of
     /// two meshes. Both meshes should be manifold.
     ///
-    /// This function always uses the CPU device.
+    /// The computation runs on the CPU, see BooleanUnion() for details.
     ///
     /// \param mesh This is the second operand for the boolean operation.
     /// \param tolerance Threshold which determines when point distances are
-    /// considered to be 0.
+    /// considered to be 0. Vertices of the result closer than the tolerance
+    /// are merged.
     ///
     /// \return The mesh describing the intersection volume.
     TriangleMesh BooleanIntersection(const TriangleMesh &mesh,
@@ -819,11 +884,12 @@ public:
     /// Computes the mesh that encompasses the volume after subtracting the
     /// volume of the second operand. Both meshes should be manifold.
     ///
-    /// This function always uses the CPU device.
+    /// The computation runs on the CPU, see BooleanUnion() for details.
     ///
     /// \param mesh This is the second operand for the boolean operation.
     /// \param tolerance Threshold which determines when point distances are
-    /// considered to be 0.
+    /// considered to be 0. Vertices of the result closer than the tolerance
+    /// are merged.
     ///
     /// \return The mesh describing the difference volume.
     TriangleMesh BooleanDifference(const TriangleMesh &mesh,
@@ -837,7 +903,9 @@ public:
 
     /// Fill holes by triangulating boundary edges.
     ///
-    /// This function always uses the CPU device.
+    /// Each boundary loop is triangulated by ear clipping in the plane of its
+    /// average normal. Vertex attributes are preserved, triangle attributes
+    /// are not. The computation runs on the CPU.
     ///
     /// \param hole_size This is the approximate threshold for filling holes.
     /// The value describes the maximum radius of holes to be filled.
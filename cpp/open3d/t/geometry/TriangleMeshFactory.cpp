@@ -308,6 +308,34 @@ TriangleMesh TriangleMesh::CreateIsosurfaces(
     return tmesh.To(device);
 }
 
+TriangleMesh TriangleMesh::CreateFromPointCloudPoissonStreaming(
+        const std::string &filename,
+        int depth,
+        int64_t max_points_per_tile,
+        double overlap,
+        float scale,
+        const std::string &temp_directory,
+        int n_threads,
+        core::Dtype float_dtype,
+        core::Dtype int_dtype,
+        const core::Device &device) {
+    if (depth < 2) {
+        utility::LogError("depth (={}) has to be >= 2", depth);
+    }
+    if (max_points_per_tile <= 0) {
+        utility::LogError("max_points_per_tile has to be positive.");
+    }
+    std::shared_ptr<open3d::geometry::TriangleMesh> legacy_mesh =
+            open3d::geometry::TriangleMesh::
+                    CreateFromPointCloudPoissonStreaming(
+                            filename, size_t(depth),
+                            size_t(max_points_per_tile), overlap, scale,
+                            temp_directory, n_threads);
+
+    return TriangleMesh::FromLegacy(*legacy_mesh, float_dtype, int_dtype,
+                                    device);
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
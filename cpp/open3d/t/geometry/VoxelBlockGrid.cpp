@@ -7,13 +7,24 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <set>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace t {
@@ -50,6 +61,22 @@ static std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
                           masks_nb.View({27, n, 1}));
 }
 
+/// Returns the keys shifted by all the offsets in {min_offset, ..., 1}^3.
+static core::Tensor ShiftBlockKeys(const core::Tensor &keys, int min_offset) {
+    std::vector<core::Tensor> keys_shifted;
+    for (int dz = min_offset; dz <= 1; ++dz) {
+        for (int dy = min_offset; dy <= 1; ++dy) {
+            for (int dx = min_offset; dx <= 1; ++dx) {
+                core::Tensor dt =
+                        core::Tensor(std::vector<int>{dx, dy, dz}, {1, 3},
+                                     core::Int32, keys.GetDevice());
+                keys_shifted.push_back(keys + dt);
+            }
+        }
+    }
+    return core::Concatenate(keys_shifted, 0);
+}
+
 static TensorMap ConstructTensorMap(
         const core::HashMap &block_hashmap,
         std::unordered_map<std::string, int> name_attr_map) {
@@ -62,6 +89,202 @@ static TensorMap ConstructTensorMap(
     return tensor_map;
 }
 
+/// Paged out blocks of a voxel block grid. The blocks of each page are
+/// appended in compressed batches to one file per page and the whole page is
+/// paged back in when it is touched.
+struct VoxelBlockGrid::BlockStore {
+    typedef std::array<int64_t, 3> PageKey;
+
+    struct ResidentPage {
+        /// Frame of the last touch, 0 if never touched.
+        int64_t last_touched = 0;
+        /// Number of blocks in memory.
+        int64_t num_blocks = 0;
+    };
+
+    ~BlockStore() { utility::filesystem::DeleteDirectory(path); }
+
+    PageKey GetPageKey(const int *block_key) const {
+        PageKey page;
+        for (int i = 0; i < 3; ++i) {
+            // Round towards negative infinity.
+            const int64_t key = block_key[i];
+            page[i] = key >= 0 ? key / page_size
+                               : -((-key - 1) / page_size) - 1;
+        }
+        return page;
+    }
+
+    std::string GetPagePath(const PageKey &page) const {
+        return utility::filesystem::JoinPath(
+                path,
+                fmt::format("page_{}_{}_{}.bin", page[0], page[1], page[2]));
+    }
+
+    /// Appends the blocks with the keys and value buffers on the host to the
+    /// page file.
+    void PageOut(const PageKey &page,
+                 const core::Tensor &keys,
+                 const std::vector<core::Tensor> &values) {
+        std::vector<const core::Tensor *> tensors = {&keys};
+        for (const core::Tensor &value : values) {
+            tensors.push_back(&value);
+        }
+        std::vector<uint8_t> bytes;
+        for (const core::Tensor *tensor : tensors) {
+            const uint8_t *ptr =
+                    static_cast<const uint8_t *>(tensor->GetDataPtr());
+            bytes.insert(bytes.end(), ptr,
+                         ptr + tensor->NumElements() *
+                                       tensor->GetDtype().ByteSize());
+        }
+        uLongf num_compressed = compressBound(bytes.size());
+        std::vector<uint8_t> compressed(num_compressed);
+        if (compress2(compressed.data(), &num_compressed, bytes.data(),
+                      bytes.size(), Z_BEST_SPEED) != Z_OK) {
+            utility::LogError("Failed to compress the voxel blocks.");
+        }
+
+        const std::string file_name = GetPagePath(page);
+        FILE *file = utility::filesystem::FOpen(file_name, "ab");
+        if (file == nullptr) {
+            utility::LogError("Failed to open the page file {}.", file_name);
+        }
+        // Batch layout: number of blocks, compressed size, then the
+        // compressed keys and values in the order of the value tensors.
+        const int64_t num_blocks = keys.GetLength();
+        const int64_t header[2] = {num_blocks, int64_t(num_compressed)};
+        bool success = fwrite(header, sizeof(int64_t), 2, file) == 2;
+        success = success && fwrite(compressed.data(), 1, num_compressed,
+                                    file) == num_compressed;
+        fclose(file);
+        if (!success) {
+            utility::LogError("Failed to write the page file {}.", file_name);
+        }
+        paged_out[page] += num_blocks;
+        num_paged_out_blocks += num_blocks;
+    }
+
+    /// Inserts the blocks of the page file into the hash map.
+    void PageIn(const PageKey &page, core::HashMap &hashmap) {
+        auto it = paged_out.find(page);
+        if (it == paged_out.end()) {
+            return;
+        }
+        const std::string file_name = GetPagePath(page);
+        FILE *file = utility::filesystem::FOpen(file_name, "rb");
+        if (file == nullptr) {
+            utility::LogError("Failed to open the page file {}.", file_name);
+        }
+
+        const core::Device host("CPU:0");
+        const core::Device device = hashmap.GetDevice();
+        const std::vector<core::Tensor> buffers = hashmap.GetValueTensors();
+        int64_t num_blocks = 0;
+        int64_t header[2];
+        bool success = true;
+        while (success && fread(header, sizeof(int64_t), 2, file) == 2) {
+            std::vector<uint8_t> compressed(header[1]);
+            success = fread(compressed.data(), 1, compressed.size(), file) ==
+                      compressed.size();
+
+            std::vector<core::Tensor> tensors = {
+                    core::Tensor({header[0], 3}, core::Int32, host)};
+            for (const core::Tensor &buffer : buffers) {
+                core::SizeVector shape = buffer.GetShape();
+                shape[0] = header[0];
+                tensors.emplace_back(shape, buffer.GetDtype(), host);
+            }
+            std::vector<uint8_t> bytes;
+            for (const core::Tensor &tensor : tensors) {
+                bytes.resize(bytes.size() + tensor.NumElements() *
+                                                    tensor.GetDtype()
+                                                            .ByteSize());
+            }
+            uLongf num_bytes = bytes.size();
+            success = success &&
+                      uncompress(bytes.data(), &num_bytes, compressed.data(),
+                                 compressed.size()) == Z_OK &&
+                      num_bytes == bytes.size();
+            if (!success) {
+                break;
+            }
+
+            size_t offset = 0;
+            for (core::Tensor &tensor : tensors) {
+                const size_t size =
+                        tensor.NumElements() * tensor.GetDtype().ByteSize();
+                std::memcpy(tensor.GetDataPtr(), bytes.data() + offset, size);
+                offset += size;
+                tensor = tensor.To(device);
+            }
+            const core::Tensor keys = tensors[0];
+            tensors.erase(tensors.begin());
+            core::Tensor buf_indices, masks;
+            hashmap.Insert(keys, tensors, buf_indices, masks);
+            num_blocks += header[0];
+        }
+        fclose(file);
+        if (!success || num_blocks != it->second) {
+            utility::LogError("Failed to read the page file {}.", file_name);
+        }
+        utility::filesystem::RemoveFile(file_name);
+        GetResidentPage(page).num_blocks += num_blocks;
+        num_paged_out_blocks -= it->second;
+        paged_out.erase(it);
+    }
+
+    /// Returns the page with blocks in memory, adds it as never touched if it
+    /// is not resident yet.
+    ResidentPage &GetResidentPage(const PageKey &page) {
+        auto it = resident_pages.find(page);
+        if (it == resident_pages.end()) {
+            it = resident_pages.emplace(page, ResidentPage()).first;
+            lru_pages.emplace(0, page);
+        }
+        return it->second;
+    }
+
+    /// Marks the page as touched in the current frame.
+    void Touch(const PageKey &page) {
+        ResidentPage &resident_page = GetResidentPage(page);
+        lru_pages.erase({resident_page.last_touched, page});
+        resident_page.last_touched = frame;
+        lru_pages.emplace(frame, page);
+    }
+
+    /// Counts the blocks with the keys, which have been added to the hash map.
+    void AddBlocks(const core::Tensor &keys) {
+        const core::Tensor keys_host =
+                keys.To(core::Device("CPU:0")).Contiguous();
+        const int *key_ptr = keys_host.GetDataPtr<int>();
+        for (int64_t i = 0; i < keys_host.GetLength(); ++i) {
+            ++GetResidentPage(GetPageKey(key_ptr + 3 * i)).num_blocks;
+        }
+    }
+
+    /// Removes the page from the resident pages.
+    void RemoveResidentPage(const PageKey &page) {
+        auto it = resident_pages.find(page);
+        lru_pages.erase({it->second.last_touched, page});
+        resident_pages.erase(it);
+    }
+
+    int64_t max_resident_blocks;
+    int64_t page_size;
+    std::string path;
+
+    /// Incremented by each call to GetUniqueBlockCoordinates.
+    int64_t frame = 1;
+    /// Pages with blocks in memory or touched since they were paged out.
+    std::map<PageKey, ResidentPage> resident_pages;
+    /// The resident pages ordered by their last touch.
+    std::set<std::pair<int64_t, PageKey>> lru_pages;
+    /// Number of blocks of the paged out pages.
+    std::map<PageKey, int64_t> paged_out;
+    int64_t num_paged_out_blocks = 0;
+};
+
 VoxelBlockGrid::VoxelBlockGrid(
         const std::vector<std::string> &attr_names,
         const std::vector<core::Dtype> &attr_dtypes,
@@ -241,6 +464,11 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
                                    voxel_size_ * trunc_voxel_multiplier,
                                    depth_scale, depth_max, down_factor);
 
+    if (block_store_ != nullptr) {
+        ++block_store_->frame;
+        TouchBlocks(block_coords);
+        EvictBlocks();
+    }
     return block_coords;
 }
 
@@ -263,6 +491,12 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
     kernel::voxel_grid::PointCloudTouch(
             frustum_hashmap_, positions, block_coords, block_resolution_,
             voxel_size_, voxel_size_ * trunc_voxel_multiplier);
+
+    if (block_store_ != nullptr) {
+        ++block_store_->frame;
+        TouchBlocks(block_coords);
+        EvictBlocks();
+    }
     return block_coords;
 }
 
@@ -310,8 +544,25 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
     CheckIntrinsicTensor(color_intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
+    if (block_store_ != nullptr) {
+        TouchBlocks(block_coords);
+    }
+
     core::Tensor buf_indices, masks;
     block_hashmap_->Activate(block_coords, buf_indices, masks);
+    if (block_store_ != nullptr) {
+        block_store_->AddBlocks(block_coords.IndexGet({masks}));
+        // Buffers of paged out blocks are reused, reset the new blocks.
+        const core::Tensor new_indices =
+                buf_indices.IndexGet({masks}).To(core::Int64);
+        for (core::Tensor value : block_hashmap_->GetValueTensors()) {
+            core::SizeVector shape = value.GetShape();
+            shape[0] = new_indices.GetLength();
+            value.IndexSet({new_indices},
+                           core::Tensor::Zeros(shape, value.GetDtype(),
+                                               value.GetDevice()));
+        }
+    }
     block_hashmap_->Find(block_coords, buf_indices, masks);
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
@@ -323,6 +574,17 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
             block_value_map, depth_intrinsic, color_intrinsic, extrinsic,
             block_resolution_, voxel_size_,
             voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max);
+
+    if (dirty_block_set_ == nullptr) {
+        dirty_block_set_ = std::make_shared<core::HashSet>(
+                std::max<int64_t>(block_coords.GetLength(), 1), core::Int32,
+                core::SizeVector{3}, block_hashmap_->GetDevice());
+    }
+    dirty_block_set_->Insert(block_coords);
+
+    if (block_store_ != nullptr) {
+        EvictBlocks();
+    }
 }
 
 TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
@@ -342,6 +604,11 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
     CheckIntrinsicTensor(intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
+    if (block_store_ != nullptr) {
+        TouchBlocks(block_coords);
+        EvictBlocks();
+    }
+
     // Extrinsic: world to camera -> pose: camera to world
     core::Device device = block_hashmap_->GetDevice();
 
@@ -393,10 +660,10 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
     kernel::voxel_grid::RayCast(
-            block_hashmap_, block_value_map, range_minmax_map, renderings_map,
-            intrinsic, extrinsic, height, width, block_resolution_, voxel_size_,
-            depth_scale, depth_min, depth_max, weight_threshold,
-            trunc_voxel_multiplier, range_map_down_factor);
+            block_hashmap_, block_value_map, block_coords, range_minmax_map,
+            renderings_map, intrinsic, extrinsic, height, width,
+            block_resolution_, voxel_size_, depth_scale, depth_min, depth_max,
+            weight_threshold, trunc_voxel_multiplier, range_map_down_factor);
 
     return renderings_map;
 }
@@ -456,11 +723,13 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    core::Tensor triangle_block_indices;
     kernel::voxel_grid::ExtractTriangleMesh(
             active_buf_indices_i32, inverse_index_map, active_nb_buf_indices,
             active_nb_masks, block_keys, block_value_map, vertices, triangles,
-            vertex_normals, vertex_colors, block_resolution_, voxel_size_,
-            weight_threshold, estimated_vertex_number);
+            triangle_block_indices, vertex_normals, vertex_colors, num_blocks,
+            block_resolution_, voxel_size_, weight_threshold,
+            estimated_vertex_number);
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
@@ -471,8 +740,161 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     return mesh;
 }
 
+std::pair<core::Tensor, std::vector<TriangleMesh>>
+VoxelBlockGrid::ExtractTriangleMeshIncremental(float weight_threshold) {
+    AssertInitialized();
+    core::Device device = block_hashmap_->GetDevice();
+    std::vector<TriangleMesh> chunks;
+    if (GetNumDirtyBlocks() == 0) {
+        return std::make_pair(core::Tensor({0, 3}, core::Int32, device),
+                              chunks);
+    }
+
+    // Dirty blocks in memory.
+    core::Tensor dirty_keys = dirty_block_set_->GetKeyTensor().IndexGet(
+            {dirty_block_set_->GetActiveIndices().To(core::Int64)});
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(dirty_keys, buf_indices, masks);
+    dirty_keys = dirty_keys.IndexGet({masks});
+    if (dirty_keys.GetLength() == 0) {
+        return std::make_pair(core::Tensor({0, 3}, core::Int32, device),
+                              chunks);
+    }
+
+    // The cubes of the dirty blocks and their neighbors are re-meshed.
+    core::HashSet block_set(27 * dirty_keys.GetLength(), core::Int32, {3},
+                            device);
+    core::Tensor nb_keys = ShiftBlockKeys(dirty_keys, -1);
+    nb_keys = nb_keys.IndexGet({block_set.Insert(nb_keys).second});
+    block_hashmap_->Find(nb_keys, buf_indices, masks);
+    core::Tensor surface_keys = nb_keys.IndexGet({masks});
+    core::Tensor surface_buf_indices = buf_indices.IndexGet({masks});
+    int64_t num_surface_blocks = surface_keys.GetLength();
+
+    // The cubes reach into the blocks in the positive directions, which only
+    // provide the vertices on their edges.
+    core::Tensor halo_keys = ShiftBlockKeys(surface_keys, 0);
+    halo_keys = halo_keys.IndexGet({block_set.Insert(halo_keys).second});
+    core::Tensor halo_buf_indices({0}, core::Int32, device);
+    if (halo_keys.GetLength() > 0) {
+        block_hashmap_->Find(halo_keys, buf_indices, masks);
+        halo_buf_indices = buf_indices.IndexGet({masks});
+    }
+
+    core::Tensor block_indices =
+            core::Concatenate({surface_buf_indices, halo_buf_indices}, 0);
+    core::Tensor nb_buf_indices, nb_masks;
+    std::tie(nb_buf_indices, nb_masks) =
+            BufferRadiusNeighbors(block_hashmap_, block_indices);
+
+    core::Tensor inverse_index_map({block_hashmap_->GetCapacity()}, core::Int32,
+                                   device);
+    inverse_index_map.IndexSet(
+            {block_indices.To(core::Int64)},
+            core::Tensor::Arange(0, block_indices.GetLength(), 1, core::Int32,
+                                 device));
+
+    core::Tensor vertices, triangles, triangle_block_indices, vertex_normals,
+            vertex_colors;
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    int vertex_count = -1;
+    kernel::voxel_grid::ExtractTriangleMesh(
+            block_indices, inverse_index_map, nb_buf_indices, nb_masks,
+            block_keys, block_value_map, vertices, triangles,
+            triangle_block_indices, vertex_normals, vertex_colors,
+            num_surface_blocks, block_resolution_, voxel_size_,
+            weight_threshold, vertex_count);
+
+    // Group the triangles by block and index the vertices of each chunk in
+    // the order of their first use.
+    core::Device host("CPU:0");
+    const std::vector<int> triangles_host =
+            triangles.To(host).ToFlatVector<int>();
+    const std::vector<int> triangle_blocks =
+            triangle_block_indices.To(host).ToFlatVector<int>();
+    const int64_t num_triangles = triangle_blocks.size();
+
+    std::vector<int64_t> triangle_offsets(num_surface_blocks + 1, 0);
+    for (int b : triangle_blocks) {
+        ++triangle_offsets[b + 1];
+    }
+    for (int64_t b = 0; b < num_surface_blocks; ++b) {
+        triangle_offsets[b + 1] += triangle_offsets[b];
+    }
+    std::vector<int64_t> sorted_triangles(num_triangles);
+    std::vector<int64_t> cursors(triangle_offsets.begin(),
+                                 triangle_offsets.end() - 1);
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        sorted_triangles[cursors[triangle_blocks[t]]++] = t;
+    }
+
+    std::vector<int64_t> vertex_offsets(num_surface_blocks + 1, 0);
+    std::vector<int64_t> chunk_vertices;
+    std::vector<int> chunk_triangles(num_triangles * 3);
+    std::vector<int64_t> vertex_chunk(vertices.GetLength(), -1);
+    std::vector<int> vertex_local(vertices.GetLength(), 0);
+    for (int64_t b = 0; b < num_surface_blocks; ++b) {
+        vertex_offsets[b] = chunk_vertices.size();
+        for (int64_t i = triangle_offsets[b]; i < triangle_offsets[b + 1];
+             ++i) {
+            for (int k = 0; k < 3; ++k) {
+                const int v = triangles_host[sorted_triangles[i] * 3 + k];
+                if (vertex_chunk[v] != b) {
+                    vertex_chunk[v] = b;
+                    vertex_local[v] = static_cast<int>(chunk_vertices.size() -
+                                                       vertex_offsets[b]);
+                    chunk_vertices.push_back(v);
+                }
+                chunk_triangles[i * 3 + k] = vertex_local[v];
+            }
+        }
+    }
+    vertex_offsets[num_surface_blocks] = chunk_vertices.size();
+
+    const int64_t num_chunk_vertices = chunk_vertices.size();
+    core::Tensor vertex_indices(chunk_vertices, {num_chunk_vertices},
+                                core::Int64, device);
+    core::Tensor chunk_positions = vertices.IndexGet({vertex_indices});
+    core::Tensor chunk_normals = vertex_normals.IndexGet({vertex_indices});
+    core::Tensor chunk_colors;
+    bool has_colors = vertex_colors.GetLength() == vertices.GetLength();
+    if (has_colors) {
+        chunk_colors = vertex_colors.IndexGet({vertex_indices});
+    }
+    core::Tensor chunk_indices(chunk_triangles, {num_triangles, 3},
+                               core::Int32, device);
+
+    chunks.reserve(num_surface_blocks);
+    for (int64_t b = 0; b < num_surface_blocks; ++b) {
+        const int64_t v0 = vertex_offsets[b], v1 = vertex_offsets[b + 1];
+        TriangleMesh chunk(chunk_positions.Slice(0, v0, v1),
+                           chunk_indices.Slice(0, triangle_offsets[b],
+                                               triangle_offsets[b + 1]));
+        chunk.SetVertexNormals(chunk_normals.Slice(0, v0, v1));
+        if (has_colors) {
+            chunk.SetVertexColors(chunk_colors.Slice(0, v0, v1));
+        }
+        chunks.push_back(chunk);
+    }
+
+    dirty_block_set_->Erase(dirty_keys);
+    return std::make_pair(surface_keys, chunks);
+}
+
+void VoxelBlockGrid::ClearDirtyBlocks() {
+    if (dirty_block_set_ != nullptr) {
+        dirty_block_set_->Clear();
+    }
+}
+
 void VoxelBlockGrid::Save(const std::string &file_name) const {
     AssertInitialized();
+    if (IsPagingEnabled()) {
+        utility::LogError(
+                "Paging is enabled, call DisablePaging() before saving.");
+    }
     // TODO(wei): provide 'GetActiveKeyValues' functionality.
     core::Tensor keys = block_hashmap_->GetKeyTensor();
     std::vector<core::Tensor> values = block_hashmap_->GetValueTensors();
@@ -530,6 +952,10 @@ VoxelBlockGrid VoxelBlockGrid::To(const core::Device &device, bool copy) const {
     if (!copy && block_hashmap_->GetDevice() == device) {
         return *this;
     }
+    if (IsPagingEnabled()) {
+        utility::LogError(
+                "Paging is enabled, call DisablePaging() before copying.");
+    }
 
     auto device_hashmap =
             std::make_shared<core::HashMap>(this->block_hashmap_->To(device));
@@ -601,6 +1027,169 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     return vbg;
 }
 
+void VoxelBlockGrid::EnablePaging(int64_t max_resident_blocks,
+                                  const std::string &page_dir,
+                                  int64_t page_size) {
+    AssertInitialized();
+    if (max_resident_blocks <= 0) {
+        utility::LogError("max_resident_blocks must be positive, but got {}",
+                          max_resident_blocks);
+    }
+    if (page_size <= 0) {
+        utility::LogError("page_size must be positive, but got {}",
+                          page_size);
+    }
+    if (IsPagingEnabled()) {
+        utility::LogError("Paging is already enabled.");
+    }
+
+    std::string dir = page_dir;
+    if (dir.empty()) {
+        dir = utility::filesystem::GetTempDirectoryPath();
+    }
+    std::string path;
+    do {
+        path = utility::filesystem::JoinPath(
+                dir, fmt::format("open3d_voxel_block_pages_{:08x}",
+                                 utility::random::RandUint32()));
+    } while (utility::filesystem::DirectoryExists(path));
+    if (!utility::filesystem::MakeDirectoryHierarchy(path)) {
+        utility::LogError("Failed to create the page directory {}.", path);
+    }
+
+    block_store_ = std::make_shared<BlockStore>();
+    block_store_->max_resident_blocks = max_resident_blocks;
+    block_store_->page_size = page_size;
+    block_store_->path = path;
+    block_store_->AddBlocks(block_hashmap_->GetKeyTensor().IndexGet(
+            {block_hashmap_->GetActiveIndices().To(core::Int64)}));
+    EvictBlocks();
+}
+
+void VoxelBlockGrid::DisablePaging() {
+    if (!IsPagingEnabled()) {
+        return;
+    }
+    std::vector<BlockStore::PageKey> pages;
+    for (const auto &page : block_store_->paged_out) {
+        pages.push_back(page.first);
+    }
+    for (const BlockStore::PageKey &page : pages) {
+        block_store_->PageIn(page, *block_hashmap_);
+    }
+    block_store_.reset();
+}
+
+int64_t VoxelBlockGrid::GetNumPagedOutBlocks() const {
+    return IsPagingEnabled() ? block_store_->num_paged_out_blocks : 0;
+}
+
+void VoxelBlockGrid::TouchBlocks(const core::Tensor &block_coords) {
+    const core::Tensor keys =
+            block_coords.To(core::Device("CPU:0")).Contiguous();
+    const int *key_ptr = keys.GetDataPtr<int>();
+    std::set<BlockStore::PageKey> pages;
+    for (int64_t i = 0; i < keys.GetLength(); ++i) {
+        pages.insert(block_store_->GetPageKey(key_ptr + 3 * i));
+    }
+    for (const BlockStore::PageKey &page : pages) {
+        block_store_->PageIn(page, *block_hashmap_);
+        block_store_->Touch(page);
+    }
+}
+
+void VoxelBlockGrid::EvictBlocks() {
+    PageOutBlocks();
+
+    // The buffers are allocated for the capacity of the hash map, which only
+    // grows on insertion. Rehash into smaller buffers to release the memory
+    // of the paged out blocks and of the initial capacity, only when the
+    // capacity is far above the budget so that the rehash is rare.
+    const int64_t num_blocks =
+            std::max(block_store_->max_resident_blocks, block_hashmap_->Size());
+    if (block_hashmap_->GetCapacity() > 4 * num_blocks) {
+        block_hashmap_->Reserve(2 * num_blocks);
+    }
+}
+
+void VoxelBlockGrid::PageOutBlocks() {
+    BlockStore &store = *block_store_;
+    const int64_t num_blocks = block_hashmap_->Size();
+    if (num_blocks <= store.max_resident_blocks) {
+        return;
+    }
+
+    // Select the least recently touched pages. Pages touched in the current
+    // frame are kept.
+    std::vector<BlockStore::PageKey> selected_pages;
+    int64_t num_selected = 0;
+    for (auto it = store.lru_pages.begin();
+         it != store.lru_pages.end() && it->first < store.frame &&
+         num_blocks - num_selected > store.max_resident_blocks;
+         ++it) {
+        selected_pages.push_back(it->second);
+        num_selected += store.resident_pages.at(it->second).num_blocks;
+    }
+    for (const BlockStore::PageKey &page : selected_pages) {
+        store.RemoveResidentPage(page);
+    }
+    if (num_selected == 0) {
+        return;
+    }
+
+    // Select the blocks of the pages on the device, only these are copied to
+    // the host.
+    const core::Device host("CPU:0");
+    const core::Device device = block_hashmap_->GetDevice();
+    const core::Tensor buf_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    const core::Tensor keys =
+            block_hashmap_->GetKeyTensor().IndexGet({buf_indices});
+    // Page keys, rounded towards negative infinity.
+    const int page_size = int(store.page_size);
+    const core::Tensor page_keys =
+            (keys - keys.Lt(0).To(core::Int32) * (page_size - 1)) / page_size;
+    std::vector<int> selected_page_keys;
+    for (const BlockStore::PageKey &page : selected_pages) {
+        selected_page_keys.insert(selected_page_keys.end(), page.begin(),
+                                  page.end());
+    }
+    core::HashSet page_set(int64_t(selected_pages.size()), core::Int32, {3},
+                           device);
+    page_set.Insert(core::Tensor(selected_page_keys,
+                                 {int64_t(selected_pages.size()), 3},
+                                 core::Int32, device));
+    core::Tensor page_buf_indices, masks;
+    page_set.Find(page_keys, page_buf_indices, masks);
+    const core::Tensor selected_keys = keys.IndexGet({masks});
+    const core::Tensor selected_buf_indices = buf_indices.IndexGet({masks});
+    const core::Tensor selected_keys_host =
+            selected_keys.To(host).Contiguous();
+    std::vector<core::Tensor> values;
+    for (const core::Tensor &buffer : block_hashmap_->GetValueTensors()) {
+        values.push_back(
+                buffer.IndexGet({selected_buf_indices}).To(host).Contiguous());
+    }
+
+    const int *key_ptr = selected_keys_host.GetDataPtr<int>();
+    std::map<BlockStore::PageKey, std::vector<int64_t>> pages;
+    for (int64_t i = 0; i < selected_keys_host.GetLength(); ++i) {
+        pages[store.GetPageKey(key_ptr + 3 * i)].push_back(i);
+    }
+    for (const auto &page : pages) {
+        const core::Tensor indices(page.second,
+                                   {int64_t(page.second.size())},
+                                   core::Int64, host);
+        std::vector<core::Tensor> page_values;
+        for (const core::Tensor &value : values) {
+            page_values.push_back(value.IndexGet({indices}));
+        }
+        store.PageOut(page.first, selected_keys_host.IndexGet({indices}),
+                      page_values);
+    }
+    block_hashmap_->Erase(selected_keys);
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
@@ -9,6 +9,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -37,6 +38,12 @@ public:
     ///                10000,
     ///                core::Device("CUDA:0"),
     ///                core::HashBackendType::Default);
+    /// The TSDF operations support the (tsdf, weight, color) dtypes
+    /// (Float32, Float32, Float32), (Float32, UInt16, UInt16) and the compact
+    /// (Int16, UInt16, UInt8) and (Int16, UInt8, UInt8), which take 7 and 6
+    /// bytes per voxel instead of 20. An Int16 tsdf stores the TSDF
+    /// normalized by the truncation distance scaled by 32767. Integer weights
+    /// saturate and integer colors are rounded.
     VoxelBlockGrid(const std::vector<std::string> &attr_names,
                    const std::vector<core::Dtype> &attr_dtypes,
                    const std::vector<core::SizeVector> &attr_channels,
@@ -175,6 +182,9 @@ public:
     /// The block coordinates in the frustum can be taken from
     /// GetUniqueBlockCoordinates.
     /// All the block coordinates can be taken from GetHashMap().GetKeyTensor().
+    /// On CPU, the rays skip the space outside of the blocks in block_coords
+    /// with an occupancy grid of these blocks, and each thread casts a tile
+    /// of pixels.
     TensorMap RayCast(const core::Tensor &block_coords,
                       const core::Tensor &intrinsic,
                       const core::Tensor &extrinsic,
@@ -212,6 +222,29 @@ public:
     TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f,
                                      int estimated_vertex_numer = -1);
 
+    /// Specific operation for TSDF volumes.
+    /// Incrementally extract the mesh of the blocks that changed since the
+    /// last call. Integrate marks the blocks it updates as dirty. The dirty
+    /// blocks and their 26 neighbors, whose cubes and vertex normals depend on
+    /// the dirty voxels, are re-meshed with Marching Cubes.
+    /// Returns the Int32 coordinates {N, 3} of the re-meshed blocks and one
+    /// mesh chunk per block, holding the triangles of the cubes whose origin
+    /// voxel is in the block. Replacing the chunks of these blocks in a cache
+    /// of chunks keyed by block coordinates gives the mesh of
+    /// ExtractTriangleMesh, except that the vertices on the block boundaries
+    /// are duplicated in the chunks sharing them.
+    /// Dirty blocks that are paged out stay dirty.
+    std::pair<core::Tensor, std::vector<TriangleMesh>>
+    ExtractTriangleMeshIncremental(float weight_threshold = 3.0f);
+
+    /// Returns the number of blocks marked as dirty by Integrate.
+    int64_t GetNumDirtyBlocks() const {
+        return dirty_block_set_ ? dirty_block_set_->Size() : 0;
+    }
+
+    /// Clear the dirty marks, e.g. after caching a full mesh.
+    void ClearDirtyBlocks();
+
     /// Save a voxel block grid to a .npz file.
     void Save(const std::string &file_name) const;
 
@@ -221,9 +254,50 @@ public:
     /// Convert the hash map to another device.
     VoxelBlockGrid To(const core::Device &device, bool copy = false) const;
 
+    /// Enable paging of voxel blocks to disk to bound the memory usage.
+    /// The space is partitioned into cubic pages of page_size blocks. Each
+    /// call to GetUniqueBlockCoordinates starts a new frame. When more than
+    /// max_resident_blocks blocks are in memory, the blocks of the pages that
+    /// have been touched least recently are compressed, appended to one file
+    /// per page in a temporary directory below page_dir, and removed from the
+    /// hash map. Pages are touched by GetUniqueBlockCoordinates, Integrate and
+    /// RayCast, which also page the blocks of touched pages back in. Pages
+    /// touched in the current frame are never paged out, so the budget can
+    /// be exceeded by the blocks of a single frame. When the capacity of the
+    /// hash map exceeds four times the budget or the number of blocks in
+    /// memory, whichever is larger, it is shrunk to twice that.
+    /// While paging is enabled, all other functions, e.g. ExtractTriangleMesh,
+    /// only see the blocks in memory.
+    void EnablePaging(int64_t max_resident_blocks,
+                      const std::string &page_dir = "",
+                      int64_t page_size = 8);
+
+    /// Page all blocks back in and disable paging.
+    void DisablePaging();
+
+    /// Returns true if paging is enabled.
+    bool IsPagingEnabled() const { return block_store_ != nullptr; }
+
+    /// Returns the number of blocks that are paged out to disk.
+    int64_t GetNumPagedOutBlocks() const;
+
 private:
     void AssertInitialized() const;
 
+    /// Page in the paged out blocks of the pages of block_coords and mark the
+    /// pages as touched in the current frame.
+    void TouchBlocks(const core::Tensor &block_coords);
+
+    /// Page out the least recently touched pages until the number of blocks
+    /// in memory is within the budget. Then shrink the hash map to twice the
+    /// budget or the number of blocks in memory, whichever is larger, if its
+    /// capacity exceeds four times that.
+    void EvictBlocks();
+
+    /// Page out the least recently touched pages until the number of blocks
+    /// in memory is within the budget.
+    void PageOutBlocks();
+
     VoxelBlockGrid(float voxelSize,
                    int64_t blockResolution,
                    const std::shared_ptr<core::HashMap> &blockHashmap,
@@ -247,6 +321,14 @@ private:
 
     // Allocated fragment buffer for reuse in depth estimation
     core::Tensor fragment_buffer_;
+
+    // Coordinates of the blocks integrated since the last incremental mesh
+    // extraction.
+    std::shared_ptr<core::HashSet> dirty_block_set_;
+
+    // Paging state, shared by copies of the grid. Null if paging is disabled.
+    struct BlockStore;
+    std::shared_ptr<BlockStore> block_store_;
 };
 }  // namespace geometry
 }  // namespace t
@@ -0,0 +1,508 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Random.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace pointcloud {
+
+namespace {
+
+/// Below this number of points the points are assigned to the faces on a
+/// single thread.
+constexpr int64_t kMinParallelPoints = 1 << 14;
+
+/// Relative amplitude of the random perturbation of joggled inputs.
+constexpr double kJoggleAmplitude = 1e-9;
+
+/// A triangle of the hull. The vertices are counter-clockwise seen from the
+/// outside and neighbors[i] is the face across the edge from vertices[i] to
+/// vertices[(i + 1) % 3].
+struct HullFace {
+    int64_t vertices[3];
+    int32_t neighbors[3];
+    Eigen::Vector3d normal;
+    double offset;
+    /// Points in front of the face that are not in front of an older face.
+    std::vector<int64_t> outside;
+    int64_t farthest = -1;
+    double farthest_distance = 0;
+    bool deleted = false;
+};
+
+/// Returns the index i < n with the largest value(i), the smallest index
+/// among equal values, and the value. The index is -1 if n is 0.
+template <class func_t>
+std::pair<int64_t, double> ParallelArgMax(int64_t n, func_t value) {
+    std::pair<int64_t, double> best(-1,
+                                    -std::numeric_limits<double>::infinity());
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::pair<int64_t, double> local = best;
+#pragma omp for schedule(static) nowait
+        for (int64_t i = 0; i < n; ++i) {
+            const double v = value(i);
+            if (v > local.second) {
+                local = {i, v};
+            }
+        }
+#pragma omp critical(ParallelArgMax)
+        {
+            if (local.second > best.second ||
+                (local.second == best.second && local.first >= 0 &&
+                 local.first < best.first)) {
+                best = local;
+            }
+        }
+    }
+    return best;
+}
+
+template <class scalar_t>
+class QuickHull {
+public:
+    QuickHull(const scalar_t* points, int64_t n) : points_(points), n_(n) {}
+
+    void Compute(bool prefilter) {
+        // The extreme points along the axes and, for the pre-filtering, along
+        // the diagonals. The directions come in pairs of opposite directions.
+        std::vector<Eigen::Vector3d> directions;
+        for (int k = 0; k < 3; ++k) {
+            directions.push_back(Eigen::Vector3d::Unit(k));
+            directions.push_back(-Eigen::Vector3d::Unit(k));
+        }
+        if (prefilter) {
+            for (const double x : {-1.0, 1.0}) {
+                for (const double y : {-1.0, 1.0}) {
+                    const Eigen::Vector3d direction(x, y, 1.0);
+                    directions.push_back(direction / std::sqrt(3.0));
+                    directions.push_back(-direction / std::sqrt(3.0));
+                }
+            }
+        }
+        const std::vector<int64_t> extremes = FindExtremePoints(directions);
+
+        // Tolerance of the distances to the planes, as in Qhull.
+        double max_abs_sum = 0;
+        for (int k = 0; k < 3; ++k) {
+            max_abs_sum += std::max(std::abs(Point(extremes[2 * k])(k)),
+                                    std::abs(Point(extremes[2 * k + 1])(k)));
+        }
+        eps_ = 3 * std::numeric_limits<double>::epsilon() * max_abs_sum;
+
+        BuildSimplex(extremes);
+        if (prefilter) {
+            // The hull of the extreme points is inside the convex hull, so
+            // the points inside of it are discarded when the points are
+            // assigned to the faces.
+            for (size_t i = 6; i < extremes.size(); ++i) {
+                for (size_t f = 0; f < faces_.size(); ++f) {
+                    if (!faces_[f].deleted &&
+                        Distance(faces_[f], extremes[i]) > eps_) {
+                        AddPoint(extremes[i], static_cast<int32_t>(f));
+                        break;
+                    }
+                }
+            }
+        }
+
+        std::vector<int32_t> faces;
+        for (size_t f = 0; f < faces_.size(); ++f) {
+            if (!faces_[f].deleted) {
+                faces.push_back(static_cast<int32_t>(f));
+            }
+        }
+        AssignPoints(
+                n_, [](int64_t i) { return i; }, faces);
+
+        while (!stack_.empty()) {
+            const int32_t f = stack_.back();
+            stack_.pop_back();
+            if (!faces_[f].deleted && faces_[f].farthest >= 0) {
+                AddPoint(faces_[f].farthest, f);
+            }
+        }
+    }
+
+    void GetResult(core::Tensor& point_indices, core::Tensor& triangles) const {
+        std::vector<int64_t> vertices;
+        std::vector<int64_t> triangle_vertices;
+        for (const HullFace& face : faces_) {
+            if (!face.deleted) {
+                vertices.insert(vertices.end(), face.vertices,
+                                face.vertices + 3);
+                triangle_vertices.insert(triangle_vertices.end(),
+                                         face.vertices, face.vertices + 3);
+            }
+        }
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                       vertices.end());
+        for (int64_t& v : triangle_vertices) {
+            v = std::lower_bound(vertices.begin(), vertices.end(), v) -
+                vertices.begin();
+        }
+        const int64_t num_vertices = static_cast<int64_t>(vertices.size());
+        const int64_t num_triangles =
+                static_cast<int64_t>(triangle_vertices.size()) / 3;
+        point_indices = core::Tensor(std::move(vertices), {num_vertices});
+        triangles = core::Tensor(std::move(triangle_vertices),
+                                 {num_triangles, 3});
+    }
+
+private:
+    Eigen::Vector3d Point(int64_t i) const {
+        return Eigen::Vector3d(points_[3 * i + 0], points_[3 * i + 1],
+                               points_[3 * i + 2]);
+    }
+
+    double Distance(const HullFace& face, int64_t i) const {
+        return face.normal.dot(Point(i)) - face.offset;
+    }
+
+    /// Returns the extreme point along each direction in one pass.
+    std::vector<int64_t> FindExtremePoints(
+            const std::vector<Eigen::Vector3d>& directions) const {
+        const size_t num_directions = directions.size();
+        std::vector<int64_t> extremes(num_directions, 0);
+        std::vector<double> best(num_directions,
+                                 -std::numeric_limits<double>::infinity());
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<int64_t> local_extremes(num_directions, 0);
+            std::vector<double> local_best(
+                    num_directions, -std::numeric_limits<double>::infinity());
+#pragma omp for schedule(static) nowait
+            for (int64_t i = 0; i < n_; ++i) {
+                const Eigen::Vector3d p = Point(i);
+                for (size_t d = 0; d < num_directions; ++d) {
+                    const double v = directions[d].dot(p);
+                    if (v > local_best[d]) {
+                        local_best[d] = v;
+                        local_extremes[d] = i;
+                    }
+                }
+            }
+#pragma omp critical(FindExtremePoints)
+            {
+                for (size_t d = 0; d < num_directions; ++d) {
+                    if (local_best[d] > best[d] ||
+                        (local_best[d] == best[d] &&
+                         local_extremes[d] < extremes[d])) {
+                        best[d] = local_best[d];
+                        extremes[d] = local_extremes[d];
+                    }
+                }
+            }
+        }
+        return extremes;
+    }
+
+    int32_t AddFace(int64_t a, int64_t b, int64_t c) {
+        HullFace face;
+        face.vertices[0] = a;
+        face.vertices[1] = b;
+        face.vertices[2] = c;
+        std::fill(face.neighbors, face.neighbors + 3, -1);
+        const Eigen::Vector3d pa = Point(a);
+        face.normal = (Point(b) - pa).cross(Point(c) - pa);
+        const double norm = face.normal.norm();
+        if (norm > 0) {
+            face.normal /= norm;
+        }
+        face.offset = face.normal.dot(pa);
+        faces_.push_back(std::move(face));
+        return static_cast<int32_t>(faces_.size()) - 1;
+    }
+
+    /// Builds the initial tetrahedron from the two farthest axis extremes,
+    /// the point farthest from their line and the point farthest from the
+    /// plane of the three points.
+    void BuildSimplex(const std::vector<int64_t>& extremes) {
+        int64_t a = extremes[0], b = extremes[1];
+        double max_length = -1;
+        for (int i = 0; i < 6; ++i) {
+            for (int j = i + 1; j < 6; ++j) {
+                const double length =
+                        (Point(extremes[i]) - Point(extremes[j])).norm();
+                if (length > max_length) {
+                    max_length = length;
+                    a = extremes[i];
+                    b = extremes[j];
+                }
+            }
+        }
+        if (max_length <= eps_) {
+            utility::LogError(
+                    "Cannot compute the convex hull, all the points are "
+                    "equal. Use joggle_inputs to perturb the points.");
+        }
+
+        const Eigen::Vector3d pa = Point(a);
+        const Eigen::Vector3d ab = (Point(b) - pa) / max_length;
+        const std::pair<int64_t, double> c =
+                ParallelArgMax(n_, [&](int64_t i) {
+                    return ab.cross(Point(i) - pa).squaredNorm();
+                });
+        if (std::sqrt(c.second) <= eps_) {
+            utility::LogError(
+                    "Cannot compute the convex hull, all the points are "
+                    "collinear. Use joggle_inputs to perturb the points.");
+        }
+
+        const Eigen::Vector3d normal =
+                ab.cross(Point(c.first) - pa).normalized();
+        const std::pair<int64_t, double> d =
+                ParallelArgMax(n_, [&](int64_t i) {
+                    return std::abs(normal.dot(Point(i) - pa));
+                });
+        if (d.second <= eps_) {
+            utility::LogError(
+                    "Cannot compute the convex hull, all the points are "
+                    "coplanar. Use joggle_inputs to perturb the points.");
+        }
+
+        // The fourth point has to be behind the first face.
+        int64_t v[4] = {a, b, c.first, d.first};
+        if (normal.dot(Point(d.first) - pa) > 0) {
+            std::swap(v[1], v[2]);
+        }
+        const int64_t tetrahedron[4][3] = {{v[0], v[1], v[2]},
+                                           {v[1], v[0], v[3]},
+                                           {v[2], v[1], v[3]},
+                                           {v[0], v[2], v[3]}};
+        for (const auto& face : tetrahedron) {
+            AddFace(face[0], face[1], face[2]);
+        }
+        for (HullFace& face : faces_) {
+            for (int e = 0; e < 3; ++e) {
+                const int64_t from = face.vertices[e];
+                const int64_t to = face.vertices[(e + 1) % 3];
+                for (int32_t g = 0; g < 4; ++g) {
+                    for (int k = 0; k < 3; ++k) {
+                        if (faces_[g].vertices[k] == to &&
+                            faces_[g].vertices[(k + 1) % 3] == from) {
+                            face.neighbors[e] = g;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// Assigns the points index(i), i < count, to the first face in \p faces
+    /// that they are in front of. Points that are behind all the faces are
+    /// inside the hull and discarded.
+    template <class func_t>
+    void AssignPoints(int64_t count,
+                      func_t index,
+                      const std::vector<int32_t>& faces) {
+        const auto find_face = [&](int64_t i, double& distance) {
+            for (const int32_t f : faces) {
+                distance = Distance(faces_[f], i);
+                if (distance > eps_) {
+                    return f;
+                }
+            }
+            return int32_t(-1);
+        };
+        const auto assign = [&](int64_t i, int32_t f, double distance) {
+            HullFace& face = faces_[f];
+            if (face.outside.empty()) {
+                stack_.push_back(f);
+            }
+            face.outside.push_back(i);
+            if (distance > face.farthest_distance || face.farthest < 0) {
+                face.farthest = i;
+                face.farthest_distance = distance;
+            }
+        };
+
+        if (count < kMinParallelPoints) {
+            for (int64_t k = 0; k < count; ++k) {
+                const int64_t i = index(k);
+                double distance;
+                const int32_t f = find_face(i, distance);
+                if (f >= 0) {
+                    assign(i, f, distance);
+                }
+            }
+            return;
+        }
+        std::vector<int32_t> assigned(count);
+        std::vector<double> distances(count);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t k = 0; k < count; ++k) {
+            assigned[k] = find_face(index(k), distances[k]);
+        }
+        for (int64_t k = 0; k < count; ++k) {
+            if (assigned[k] >= 0) {
+                assign(index(k), assigned[k], distances[k]);
+            }
+        }
+    }
+
+    /// Adds the point \p eye in front of the face \p start to the hull. The
+    /// faces visible from the point are replaced by a cone of new faces from
+    /// their boundary to the point.
+    void AddPoint(int64_t eye, int32_t start) {
+        struct HorizonEdge {
+            int64_t from;
+            int64_t to;
+            int32_t outer;
+        };
+        std::vector<int32_t> visible = {start};
+        std::vector<HorizonEdge> horizon;
+        faces_[start].deleted = true;
+        visited_.resize(faces_.size(), 0);
+        ++visit_stamp_;
+        visited_[start] = visit_stamp_;
+        for (size_t k = 0; k < visible.size(); ++k) {
+            const HullFace& face = faces_[visible[k]];
+            for (int e = 0; e < 3; ++e) {
+                const int32_t g = face.neighbors[e];
+                if (faces_[g].deleted) {
+                    continue;
+                }
+                if (visited_[g] != visit_stamp_ &&
+                    Distance(faces_[g], eye) > eps_) {
+                    visited_[g] = visit_stamp_;
+                    faces_[g].deleted = true;
+                    visible.push_back(g);
+                } else {
+                    visited_[g] = visit_stamp_;
+                    horizon.push_back({face.vertices[e],
+                                       face.vertices[(e + 1) % 3], g});
+                }
+            }
+        }
+
+        // The cone of new faces. Each face is linked to the outer face of
+        // its horizon edge and to the new faces of the adjacent edges.
+        const int32_t first_new = static_cast<int32_t>(faces_.size());
+        std::unordered_map<int64_t, int32_t> face_from;
+        for (const HorizonEdge& edge : horizon) {
+            const int32_t f = AddFace(edge.from, edge.to, eye);
+            if (!face_from.emplace(edge.from, f).second) {
+                utility::LogError(
+                        "Cannot compute the convex hull because of precision "
+                        "problems. Use joggle_inputs to perturb the points.");
+            }
+            faces_[f].neighbors[0] = edge.outer;
+            HullFace& outer = faces_[edge.outer];
+            for (int k = 0; k < 3; ++k) {
+                if (outer.vertices[k] == edge.to &&
+                    outer.vertices[(k + 1) % 3] == edge.from) {
+                    outer.neighbors[k] = f;
+                }
+            }
+        }
+        std::vector<int32_t> new_faces;
+        for (int32_t f = first_new; f < static_cast<int32_t>(faces_.size());
+             ++f) {
+            auto next = face_from.find(faces_[f].vertices[1]);
+            if (next == face_from.end()) {
+                utility::LogError(
+                        "Cannot compute the convex hull because of precision "
+                        "problems. Use joggle_inputs to perturb the points.");
+            }
+            faces_[f].neighbors[1] = next->second;
+            faces_[next->second].neighbors[2] = f;
+            new_faces.push_back(f);
+        }
+
+        // The points in front of the removed faces are in front of the new
+        // faces or inside the hull.
+        std::vector<int64_t> candidates;
+        for (const int32_t f : visible) {
+            HullFace& face = faces_[f];
+            for (const int64_t i : face.outside) {
+                if (i != eye) {
+                    candidates.push_back(i);
+                }
+            }
+            std::vector<int64_t>().swap(face.outside);
+            face.farthest = -1;
+        }
+        AssignPoints(
+                static_cast<int64_t>(candidates.size()),
+                [&](int64_t k) { return candidates[k]; }, new_faces);
+    }
+
+    const scalar_t* points_;
+    int64_t n_;
+    double eps_ = 0;
+    std::vector<HullFace> faces_;
+    /// Faces with points in front of them, in the order of processing.
+    std::vector<int32_t> stack_;
+    std::vector<int64_t> visited_;
+    int64_t visit_stamp_ = 0;
+};
+
+}  // namespace
+
+void ComputeConvexHullCPU(const core::Tensor& points,
+                          bool joggle_inputs,
+                          bool prefilter,
+                          core::Tensor& point_indices,
+                          core::Tensor& triangles) {
+    const int64_t n = points.GetLength();
+    if (n < 4) {
+        utility::LogError(
+                "Cannot compute the convex hull of less than 4 points, but "
+                "got {} points.",
+                n);
+    }
+    const core::Tensor points_c = points.Contiguous();
+    if (joggle_inputs) {
+        // Perturb a copy of the points relative to their magnitude, as the
+        // 'QJ' option of Qhull.
+        std::vector<double> joggled =
+                points_c.To(core::Float64).ToFlatVector<double>();
+        double max_abs = 0;
+        for (const double x : joggled) {
+            max_abs = std::max(max_abs, std::abs(x));
+        }
+        const double amplitude = kJoggleAmplitude * std::max(max_abs, 1.0);
+        utility::random::UniformRealGenerator<double> generator(-amplitude,
+                                                                amplitude);
+        for (double& x : joggled) {
+            x += generator();
+        }
+        QuickHull<double> hull(joggled.data(), n);
+        hull.Compute(prefilter);
+        hull.GetResult(point_indices, triangles);
+        return;
+    }
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points_c.GetDtype(), [&]() {
+        QuickHull<scalar_t> hull(points_c.GetDataPtr<scalar_t>(), n);
+        hull.Compute(prefilter);
+        hull.GetResult(point_indices, triangles);
+    });
+}
+
+}  // namespace pointcloud
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
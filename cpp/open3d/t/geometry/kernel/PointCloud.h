@@ -98,6 +98,61 @@ void ComputeBoundaryPointsCPU(const core::Tensor& points,
                               core::Tensor& mask,
                               double angle_threshold);
 
+/// \brief DBSCAN clustering of \p points with a uniform grid of cell size
+/// \p eps and a lock-free union-find over the core points.
+///
+/// Clusters are numbered in the order of their smallest core point index and
+/// border points are assigned to the cluster with the smallest number among
+/// their core neighbors. The labels are therefore independent of the thread
+/// scheduling. \p labels is an Int32 tensor of shape {N}, -1 is noise.
+void ClusterDBSCANCPU(const core::Tensor& points,
+                      double eps,
+                      size_t min_points,
+                      core::Tensor& labels,
+                      bool print_progress);
+
+/// \brief RANSAC segmentation of up to \p max_planes planes.
+///
+/// Hypotheses are generated and scored in batches over a structure of arrays
+/// copy of \p points, with adaptive termination after each batch and
+/// iterated least squares refinement (LO-RANSAC) of every new best model.
+/// After each plane the remaining points are compacted in place, so that the
+/// next plane is searched among the remaining points only. The result only
+/// depends on the random seed, not on the number of threads.
+///
+/// \param plane_models Float64 tensor of shape {P, 4} with the planes.
+/// \param labels Int32 tensor of shape {N} with the index of the plane of
+/// each point, or -1 if the point is not an inlier of any plane.
+void SegmentPlanesCPU(const core::Tensor& points,
+                      double distance_threshold,
+                      int ransac_n,
+                      int num_iterations,
+                      double probability,
+                      int max_planes,
+                      int64_t min_inliers,
+                      core::Tensor& plane_models,
+                      core::Tensor& labels);
+
+/// \brief Parallel 3D Quickhull of Float32 or Float64 \p points, which are
+/// read in place.
+///
+/// With \p prefilter the hull is started from the extreme points along the
+/// axes and the diagonals, and all the points inside of them are discarded
+/// in one parallel pass. Points within the rounding error of a face are not
+/// hull vertices. With \p joggle_inputs a randomly perturbed copy of the
+/// points is used instead, as Qhull's 'QJ' option. Throws if the points do
+/// not span a volume.
+///
+/// \param point_indices Int64 tensor of shape {V} with the sorted indices of
+/// the points that are hull vertices.
+/// \param triangles Int64 tensor of shape {T, 3} with the hull triangles as
+/// indices into \p point_indices, counter-clockwise seen from the outside.
+void ComputeConvexHullCPU(const core::Tensor& points,
+                          bool joggle_inputs,
+                          bool prefilter,
+                          core::Tensor& point_indices,
+                          core::Tensor& triangles);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -149,78 +204,38 @@ void ComputeBoundaryPointsCUDA(const core::Tensor& points,
                                double angle_threshold);
 #endif
 
-void EstimateCovariancesUsingHybridSearchCPU(const core::Tensor& points,
-                                             core::Tensor& covariances,
-                                             const double& radius,
-                                             const int64_t& max_nn);
-
-void EstimateCovariancesUsingKNNSearchCPU(const core::Tensor& points,
-                                          core::Tensor& covariances,
-                                          const int64_t& max_nn);
-
-void EstimateCovariancesUsingRadiusSearchCPU(const core::Tensor& points,
-                                             core::Tensor& covariances,
-                                             const double& radius);
+void EstimateCovariancesCPU(const core::Tensor& points,
+                            const core::Tensor& indices,
+                            const core::Tensor& counts,
+                            core::Tensor& covariances);
 
 void EstimateNormalsFromCovariancesCPU(const core::Tensor& covariances,
                                        core::Tensor& normals,
                                        const bool has_normals);
 
-void EstimateColorGradientsUsingHybridSearchCPU(const core::Tensor& points,
-                                                const core::Tensor& normals,
-                                                const core::Tensor& colors,
-                                                core::Tensor& color_gradient,
-                                                const double& radius,
-                                                const int64_t& max_nn);
-
-void EstimateColorGradientsUsingKNNSearchCPU(const core::Tensor& points,
-                                             const core::Tensor& normals,
-                                             const core::Tensor& colors,
-                                             core::Tensor& color_gradient,
-                                             const int64_t& max_nn);
-
-void EstimateColorGradientsUsingRadiusSearchCPU(const core::Tensor& points,
-                                                const core::Tensor& normals,
-                                                const core::Tensor& colors,
-                                                core::Tensor& color_gradient,
-                                                const double& radius);
+void EstimateColorGradientsCPU(const core::Tensor& points,
+                               const core::Tensor& normals,
+                               const core::Tensor& colors,
+                               const core::Tensor& indices,
+                               const core::Tensor& counts,
+                               core::Tensor& color_gradients);
 
 #ifdef BUILD_CUDA_MODULE
-void EstimateCovariancesUsingHybridSearchCUDA(const core::Tensor& points,
-                                              core::Tensor& covariances,
-                                              const double& radius,
-                                              const int64_t& max_nn);
-
-void EstimateCovariancesUsingKNNSearchCUDA(const core::Tensor& points,
-                                           core::Tensor& covariances,
-                                           const int64_t& max_nn);
-
-void EstimateCovariancesUsingRadiusSearchCUDA(const core::Tensor& points,
-                                              core::Tensor& covariances,
-                                              const double& radius);
+void EstimateCovariancesCUDA(const core::Tensor& points,
+                             const core::Tensor& indices,
+                             const core::Tensor& counts,
+                             core::Tensor& covariances);
 
 void EstimateNormalsFromCovariancesCUDA(const core::Tensor& covariances,
                                         core::Tensor& normals,
                                         const bool has_normals);
 
-void EstimateColorGradientsUsingHybridSearchCUDA(const core::Tensor& points,
-                                                 const core::Tensor& normals,
-                                                 const core::Tensor& colors,
-                                                 core::Tensor& color_gradient,
-                                                 const double& radius,
-                                                 const int64_t& max_nn);
-
-void EstimateColorGradientsUsingKNNSearchCUDA(const core::Tensor& points,
-                                              const core::Tensor& normals,
-                                              const core::Tensor& colors,
-                                              core::Tensor& color_gradient,
-                                              const int64_t& max_nn);
-
-void EstimateColorGradientsUsingRadiusSearchCUDA(const core::Tensor& points,
-                                                 const core::Tensor& normals,
-                                                 const core::Tensor& colors,
-                                                 core::Tensor& color_gradient,
-                                                 const double& radius);
+void EstimateColorGradientsCUDA(const core::Tensor& points,
+                                const core::Tensor& normals,
+                                const core::Tensor& colors,
+                                const core::Tensor& indices,
+                                const core::Tensor& counts,
+                                core::Tensor& color_gradients);
 #endif
 
 }  // namespace pointcloud
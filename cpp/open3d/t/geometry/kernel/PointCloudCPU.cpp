@@ -5,7 +5,22 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <tuple>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+#include "open3d/utility/ProgressBar.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace t {
@@ -80,6 +95,740 @@ void ProjectCPU(
     });
 }
 
+namespace {
+
+/// Grid cell coordinates of a point, the sort key of the DBSCAN grid.
+struct CellPoint {
+    int32_t x, y, z;
+    int32_t index;
+
+    bool operator<(const CellPoint& other) const {
+        return std::tie(x, y, z, index) <
+               std::tie(other.x, other.y, other.z, other.index);
+    }
+};
+
+/// Uniform grid with cell size eps. The points are stored sorted by cell so
+/// that the points of a cell, and of consecutive cells along z, are
+/// contiguous in memory. Cells with the same x and y form a column.
+struct DBSCANGrid {
+    /// Points in cell order.
+    std::vector<double> points;
+    /// Original index of each point in cell order.
+    std::vector<int32_t> indices;
+    /// The points of cell c are in [cell_splits[c], cell_splits[c + 1]).
+    std::vector<int32_t> cell_splits;
+    /// z coordinate of each cell.
+    std::vector<int32_t> cell_z;
+    /// x and y coordinates of each column.
+    std::vector<std::pair<int32_t, int32_t>> column_xy;
+    /// The cells of column k are in [column_splits[k], column_splits[k + 1]).
+    std::vector<int32_t> column_splits;
+    /// Origin of cell (0, 0, 0).
+    double min_bound[3];
+    double eps;
+};
+
+/// Point ranges of the up to 9 rows of 3 cells along z around a cell.
+struct DBSCANNeighborRanges {
+    int32_t begin[9];
+    int32_t end[9];
+    /// Column offsets of the ranges.
+    int dx[9];
+    int dy[9];
+    int num_ranges;
+    /// Lower x and y bounds of the column of the cell.
+    double x_lo;
+    double y_lo;
+};
+
+template <class scalar_t>
+void BuildDBSCANGrid(const scalar_t* points_ptr,
+                     int64_t n,
+                     const double* min_bound,
+                     double eps,
+                     DBSCANGrid& grid) {
+    const double inv_eps = 1.0 / eps;
+    std::copy(min_bound, min_bound + 3, grid.min_bound);
+    grid.eps = eps;
+    std::vector<CellPoint> cell_points(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        const scalar_t* p = points_ptr + 3 * i;
+        cell_points[i] = {
+                static_cast<int32_t>(std::floor((p[0] - min_bound[0]) *
+                                                inv_eps)),
+                static_cast<int32_t>(std::floor((p[1] - min_bound[1]) *
+                                                inv_eps)),
+                static_cast<int32_t>(std::floor((p[2] - min_bound[2]) *
+                                                inv_eps)),
+                static_cast<int32_t>(i)};
+    }
+    tbb::parallel_sort(cell_points.begin(), cell_points.end());
+
+    grid.points.resize(3 * n);
+    grid.indices.resize(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t s = 0; s < n; ++s) {
+        const int32_t i = cell_points[s].index;
+        grid.indices[s] = i;
+        grid.points[3 * s + 0] = points_ptr[3 * i + 0];
+        grid.points[3 * s + 1] = points_ptr[3 * i + 1];
+        grid.points[3 * s + 2] = points_ptr[3 * i + 2];
+    }
+
+    for (int64_t s = 0; s < n; ++s) {
+        const CellPoint& cp = cell_points[s];
+        const bool new_column = s == 0 || cell_points[s - 1].x != cp.x ||
+                                cell_points[s - 1].y != cp.y;
+        if (new_column) {
+            grid.column_xy.emplace_back(cp.x, cp.y);
+            grid.column_splits.push_back(
+                    static_cast<int32_t>(grid.cell_z.size()));
+        }
+        if (new_column || cell_points[s - 1].z != cp.z) {
+            grid.cell_z.push_back(cp.z);
+            grid.cell_splits.push_back(static_cast<int32_t>(s));
+        }
+    }
+    grid.cell_splits.push_back(static_cast<int32_t>(n));
+    grid.column_splits.push_back(static_cast<int32_t>(grid.cell_z.size()));
+}
+
+/// Calls func(c, ranges) for all cells c in parallel. The cells of a column
+/// are visited in order, which allows to find the neighboring cells with a
+/// sweep along z instead of a search per cell.
+template <class func_t>
+void ForEachDBSCANCell(const DBSCANGrid& grid,
+                       utility::ProgressBar& progress_bar,
+                       func_t func) {
+    const int64_t num_columns = static_cast<int64_t>(grid.column_xy.size());
+#pragma omp parallel for schedule(dynamic, 16) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < num_columns; ++k) {
+        // Cells of the neighboring columns that have not been passed yet.
+        int32_t cell_begin[9], cell_end[9];
+        DBSCANNeighborRanges ranges;
+        ranges.x_lo = grid.min_bound[0] + grid.column_xy[k].first * grid.eps;
+        ranges.y_lo = grid.min_bound[1] + grid.column_xy[k].second * grid.eps;
+        int num_columns_nb = 0;
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                const std::pair<int32_t, int32_t> xy(
+                        grid.column_xy[k].first + dx,
+                        grid.column_xy[k].second + dy);
+                auto it = std::lower_bound(grid.column_xy.begin(),
+                                           grid.column_xy.end(), xy);
+                if (it != grid.column_xy.end() && *it == xy) {
+                    const int64_t kk = it - grid.column_xy.begin();
+                    cell_begin[num_columns_nb] = grid.column_splits[kk];
+                    cell_end[num_columns_nb] = grid.column_splits[kk + 1];
+                    ranges.dx[num_columns_nb] = dx;
+                    ranges.dy[num_columns_nb] = dy;
+                    ++num_columns_nb;
+                }
+            }
+        }
+
+        ranges.num_ranges = num_columns_nb;
+        for (int32_t c = grid.column_splits[k]; c < grid.column_splits[k + 1];
+             ++c) {
+            const int32_t z = grid.cell_z[c];
+            for (int m = 0; m < num_columns_nb; ++m) {
+                while (cell_begin[m] < cell_end[m] &&
+                       grid.cell_z[cell_begin[m]] < z - 1) {
+                    ++cell_begin[m];
+                }
+                int32_t last = cell_begin[m];
+                while (last < cell_end[m] && grid.cell_z[last] <= z + 1) {
+                    ++last;
+                }
+                ranges.begin[m] = grid.cell_splits[cell_begin[m]];
+                ranges.end[m] = grid.cell_splits[last];
+            }
+            func(c, ranges);
+        }
+        ++progress_bar;
+    }
+}
+
+/// Calls func(t) for all points t (in cell order) closer than eps to the point
+/// s until func returns false. Points at distance eps are not neighbors, as in
+/// the radius search of nanoflann.
+template <class func_t>
+void ForEachDBSCANNeighbor(const DBSCANGrid& grid,
+                           const DBSCANNeighborRanges& ranges,
+                           int32_t s,
+                           double eps2,
+                           func_t func) {
+    const double* p = grid.points.data() + 3 * s;
+    // Distances of the point to the neighboring columns in x and y. Columns
+    // that are farther away than eps are skipped. The tolerance keeps pairs
+    // close to distance eps symmetric under rounding.
+    const double gap_x[3] = {std::max(0.0, p[0] - ranges.x_lo), 0.0,
+                             std::max(0.0, ranges.x_lo + grid.eps - p[0])};
+    const double gap_y[3] = {std::max(0.0, p[1] - ranges.y_lo), 0.0,
+                             std::max(0.0, ranges.y_lo + grid.eps - p[1])};
+    const double max_gap2 = eps2 * (1.0 + 1e-9);
+    for (int m = 0; m < ranges.num_ranges; ++m) {
+        const double gx = gap_x[ranges.dx[m] + 1];
+        const double gy = gap_y[ranges.dy[m] + 1];
+        if (gx * gx + gy * gy > max_gap2) {
+            continue;
+        }
+        for (int32_t t = ranges.begin[m]; t < ranges.end[m]; ++t) {
+            const double* q = grid.points.data() + 3 * t;
+            const double d0 = p[0] - q[0];
+            const double d1 = p[1] - q[1];
+            const double d2 = p[2] - q[2];
+            if (d0 * d0 + d1 * d1 + d2 * d2 < eps2 && !func(t)) {
+                return;
+            }
+        }
+    }
+}
+
+/// Lock-free find with path halving.
+int32_t FindRoot(std::atomic<int32_t>* parent, int32_t x) {
+    while (true) {
+        int32_t p = parent[x].load();
+        if (p == x) {
+            return x;
+        }
+        const int32_t gp = parent[p].load();
+        if (gp == p) {
+            return p;
+        }
+        parent[x].compare_exchange_weak(p, gp);
+        x = gp;
+    }
+}
+
+/// Lock-free union. The larger root is always linked below the smaller one,
+/// so the root of each set is its smallest element.
+void UnionRoots(std::atomic<int32_t>* parent, int32_t a, int32_t b) {
+    while (true) {
+        a = FindRoot(parent, a);
+        b = FindRoot(parent, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            std::swap(a, b);
+        }
+        int32_t expected = a;
+        if (parent[a].compare_exchange_strong(expected, b)) {
+            return;
+        }
+    }
+}
+
+}  // namespace
+
+void ClusterDBSCANCPU(const core::Tensor& points,
+                      double eps,
+                      size_t min_points,
+                      core::Tensor& labels,
+                      bool print_progress) {
+    const int64_t n = points.GetLength();
+    labels = core::Tensor::Full({n}, -1, core::Int32, points.GetDevice());
+    if (n == 0) {
+        return;
+    }
+    if (eps <= 0) {
+        utility::LogError("eps must be positive, but got {}.", eps);
+    }
+    if (n > std::numeric_limits<int32_t>::max()) {
+        utility::LogError("ClusterDBSCAN supports at most {} points.",
+                          std::numeric_limits<int32_t>::max());
+    }
+
+    const core::Tensor points_c = points.Contiguous();
+    const std::vector<double> min_bound =
+            points_c.Min({0}).To(core::Float64).ToFlatVector<double>();
+    const std::vector<double> max_bound =
+            points_c.Max({0}).To(core::Float64).ToFlatVector<double>();
+    for (int k = 0; k < 3; ++k) {
+        if ((max_bound[k] - min_bound[k]) / eps >=
+            std::numeric_limits<int32_t>::max() - 2) {
+            utility::LogError(
+                    "eps {} is too small for the extent of the point cloud.",
+                    eps);
+        }
+    }
+
+    utility::LogDebug("Build DBSCAN grid.");
+    DBSCANGrid grid;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points_c.GetDtype(), [&]() {
+        BuildDBSCANGrid(points_c.GetDataPtr<scalar_t>(), n, min_bound.data(),
+                        eps, grid);
+    });
+    const double eps2 = eps * eps;
+    utility::LogDebug("Done Build DBSCAN grid: {:d} cells.",
+                      grid.cell_z.size());
+
+    utility::OMPProgressBar progress_bar(3 * grid.column_xy.size(),
+                                         "Clustering", print_progress);
+
+    // Core points, in cell order. The point itself counts as neighbor.
+    std::vector<uint8_t> is_core(n, 0);
+    ForEachDBSCANCell(
+            grid, progress_bar,
+            [&](int32_t c, const DBSCANNeighborRanges& ranges) {
+                for (int32_t s = grid.cell_splits[c];
+                     s < grid.cell_splits[c + 1]; ++s) {
+                    size_t count = 0;
+                    if (min_points > 0) {
+                        ForEachDBSCANNeighbor(
+                                grid, ranges, s, eps2, [&](int32_t) {
+                                    return ++count < min_points;
+                                });
+                    }
+                    is_core[s] = count >= min_points;
+                }
+            });
+
+    // Union all pairs of neighboring core points. Sets are identified by
+    // their smallest original point index.
+    std::unique_ptr<std::atomic<int32_t>[]> parent(
+            new std::atomic<int32_t>[n]);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        parent[i].store(static_cast<int32_t>(i));
+    }
+    ForEachDBSCANCell(
+            grid, progress_bar,
+            [&](int32_t c, const DBSCANNeighborRanges& ranges) {
+                for (int32_t s = grid.cell_splits[c];
+                     s < grid.cell_splits[c + 1]; ++s) {
+                    if (!is_core[s]) {
+                        continue;
+                    }
+                    const int32_t i = grid.indices[s];
+                    ForEachDBSCANNeighbor(
+                            grid, ranges, s, eps2, [&](int32_t t) {
+                                const int32_t j = grid.indices[t];
+                                if (is_core[t] && j < i) {
+                                    UnionRoots(parent.get(), i, j);
+                                }
+                                return true;
+                            });
+                }
+            });
+
+    // Root of the cluster of each point. Border points join the cluster with
+    // the smallest root among their core neighbors, all others are noise.
+    const int32_t no_root = std::numeric_limits<int32_t>::max();
+    std::vector<int32_t> roots(n, -1);
+    ForEachDBSCANCell(
+            grid, progress_bar,
+            [&](int32_t c, const DBSCANNeighborRanges& ranges) {
+                for (int32_t s = grid.cell_splits[c];
+                     s < grid.cell_splits[c + 1]; ++s) {
+                    const int32_t i = grid.indices[s];
+                    if (is_core[s]) {
+                        roots[i] = FindRoot(parent.get(), i);
+                        continue;
+                    }
+                    int32_t root = no_root;
+                    ForEachDBSCANNeighbor(
+                            grid, ranges, s, eps2, [&](int32_t t) {
+                                if (is_core[t]) {
+                                    root = std::min(
+                                            root,
+                                            FindRoot(parent.get(),
+                                                     grid.indices[t]));
+                                }
+                                return true;
+                            });
+                    if (root != no_root) {
+                        roots[i] = root;
+                    }
+                }
+            });
+    parent.reset();
+
+    // Number the clusters in the order of their roots.
+    std::vector<int32_t> is_root(n), cluster_ids(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        is_root[i] = roots[i] == i ? 1 : 0;
+    }
+    utility::InclusivePrefixSum(is_root.data(), is_root.data() + n,
+                                cluster_ids.data());
+    int32_t* labels_ptr = labels.GetDataPtr<int32_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        labels_ptr[i] = roots[i] < 0 ? -1 : cluster_ids[roots[i]] - 1;
+    }
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_ids.back());
+}
+
+namespace {
+
+/// Number of RANSAC hypotheses that are generated and scored together. The
+/// batch size does not depend on the number of threads to keep the results
+/// reproducible.
+constexpr int kRANSACBatchSize = 32;
+
+/// Maximum number of least squares refinements of a new best model.
+constexpr int kRANSACMaxLocalIterations = 8;
+
+/// Inlier count and summed squared point-to-plane distance of a plane model.
+struct RANSACScore {
+    int64_t inliers = 0;
+    double error = 0;
+
+    bool IsBetterThan(const RANSACScore& other) const {
+        return inliers > other.inliers ||
+               (inliers == other.inliers && error < other.error);
+    }
+};
+
+/// The points that have not been assigned to a plane yet, in structure of
+/// arrays layout.
+template <class scalar_t>
+struct PlanePoints {
+    scalar_t* x;
+    scalar_t* y;
+    scalar_t* z;
+    /// Original index of each point.
+    int64_t* indices;
+    int64_t size;
+
+    Eigen::Vector3d operator[](int64_t i) const {
+        return Eigen::Vector3d(x[i], y[i], z[i]);
+    }
+};
+
+/// Scores a plane model. The loop is written with independent lanes so that
+/// it is vectorized by the compiler.
+template <class scalar_t>
+RANSACScore ScorePlane(const PlanePoints<scalar_t>& points,
+                       const Eigen::Vector4d& plane,
+                       double distance_threshold) {
+    constexpr int kLanes = 8;
+    const scalar_t a = static_cast<scalar_t>(plane(0));
+    const scalar_t b = static_cast<scalar_t>(plane(1));
+    const scalar_t c = static_cast<scalar_t>(plane(2));
+    const scalar_t d = static_cast<scalar_t>(plane(3));
+    const scalar_t threshold = static_cast<scalar_t>(distance_threshold);
+
+    int32_t counts[kLanes] = {};
+    scalar_t errors[kLanes] = {};
+    const int64_t n = points.size;
+    const int64_t n_vec = n - n % kLanes;
+    for (int64_t i = 0; i < n_vec; i += kLanes) {
+        for (int l = 0; l < kLanes; ++l) {
+            const scalar_t dist = a * points.x[i + l] + b * points.y[i + l] +
+                                  c * points.z[i + l] + d;
+            const bool inlier = std::abs(dist) < threshold;
+            counts[l] += inlier;
+            errors[l] += inlier ? dist * dist : scalar_t(0);
+        }
+    }
+    RANSACScore score;
+    for (int l = 0; l < kLanes; ++l) {
+        score.inliers += counts[l];
+        score.error += errors[l];
+    }
+    for (int64_t i = n_vec; i < n; ++i) {
+        const scalar_t dist =
+                a * points.x[i] + b * points.y[i] + c * points.z[i] + d;
+        if (std::abs(dist) < threshold) {
+            ++score.inliers;
+            score.error += dist * dist;
+        }
+    }
+    return score;
+}
+
+/// Plane through the centroid with the normal of the smallest variance.
+/// Returns the invalid plane (0, 0, 0, 0) if the points do not span a plane.
+///
+/// Reference:
+/// https://www.ilikebigbits.com/2015_03_04_plane_from_points.html
+Eigen::Vector4d PlaneFromMoments(const Eigen::Vector3d& centroid,
+                                 double xx,
+                                 double xy,
+                                 double xz,
+                                 double yy,
+                                 double yz,
+                                 double zz) {
+    const double det_x = yy * zz - yz * yz;
+    const double det_y = xx * zz - xz * xz;
+    const double det_z = xx * yy - xy * xy;
+
+    Eigen::Vector3d abc;
+    if (det_x > det_y && det_x > det_z) {
+        abc = Eigen::Vector3d(det_x, xz * yz - xy * zz, xy * yz - xz * yy);
+    } else if (det_y > det_z) {
+        abc = Eigen::Vector3d(xz * yz - xy * zz, det_y, xy * xz - yz * xx);
+    } else {
+        abc = Eigen::Vector3d(xy * yz - xz * yy, xy * xz - yz * xx, det_z);
+    }
+    const double norm = abc.norm();
+    if (norm == 0 || !std::isfinite(norm)) {
+        return Eigen::Vector4d::Zero();
+    }
+    abc /= norm;
+    return Eigen::Vector4d(abc(0), abc(1), abc(2), -abc.dot(centroid));
+}
+
+/// Least squares plane of the sampled points.
+template <class scalar_t>
+Eigen::Vector4d FitPlaneToSample(const PlanePoints<scalar_t>& points,
+                                 const int64_t* sample,
+                                 int ransac_n) {
+    if (ransac_n == 3) {
+        const Eigen::Vector3d p0 = points[sample[0]];
+        Eigen::Vector3d abc =
+                (points[sample[1]] - p0).cross(points[sample[2]] - p0);
+        const double norm = abc.norm();
+        if (norm == 0) {
+            return Eigen::Vector4d::Zero();
+        }
+        abc /= norm;
+        return Eigen::Vector4d(abc(0), abc(1), abc(2), -abc.dot(p0));
+    }
+
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (int k = 0; k < ransac_n; ++k) {
+        centroid += points[sample[k]];
+    }
+    centroid /= ransac_n;
+    double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+    for (int k = 0; k < ransac_n; ++k) {
+        const Eigen::Vector3d r = points[sample[k]] - centroid;
+        xx += r(0) * r(0);
+        xy += r(0) * r(1);
+        xz += r(0) * r(2);
+        yy += r(1) * r(1);
+        yz += r(1) * r(2);
+        zz += r(2) * r(2);
+    }
+    return PlaneFromMoments(centroid, xx, xy, xz, yy, yz, zz);
+}
+
+/// Least squares plane of the inliers of \p plane.
+template <class scalar_t>
+Eigen::Vector4d FitPlaneToInliers(const PlanePoints<scalar_t>& points,
+                                  const Eigen::Vector4d& plane,
+                                  double distance_threshold) {
+    const auto is_inlier = [&](int64_t i) {
+        return std::abs(plane(0) * points.x[i] + plane(1) * points.y[i] +
+                        plane(2) * points.z[i] + plane(3)) <
+               distance_threshold;
+    };
+
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    int64_t count = 0;
+    for (int64_t i = 0; i < points.size; ++i) {
+        if (is_inlier(i)) {
+            centroid += points[i];
+            ++count;
+        }
+    }
+    if (count < 3) {
+        return Eigen::Vector4d::Zero();
+    }
+    centroid /= double(count);
+
+    double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+    for (int64_t i = 0; i < points.size; ++i) {
+        if (is_inlier(i)) {
+            const Eigen::Vector3d r = points[i] - centroid;
+            xx += r(0) * r(0);
+            xy += r(0) * r(1);
+            xz += r(0) * r(2);
+            yy += r(1) * r(1);
+            yz += r(1) * r(2);
+            zz += r(2) * r(2);
+        }
+    }
+    return PlaneFromMoments(centroid, xx, xy, xz, yy, yz, zz);
+}
+
+/// LO-RANSAC for a single plane among \p points.
+template <class scalar_t>
+RANSACScore FindPlane(const PlanePoints<scalar_t>& points,
+                      double distance_threshold,
+                      int ransac_n,
+                      int num_iterations,
+                      double probability,
+                      Eigen::Vector4d& best_plane) {
+    RANSACScore best;
+    best_plane = Eigen::Vector4d::Zero();
+    double max_iterations = num_iterations;
+    int iteration = 0;
+
+    std::vector<int64_t> samples(kRANSACBatchSize * ransac_n);
+    std::vector<Eigen::Vector4d> planes(kRANSACBatchSize);
+    std::vector<RANSACScore> scores(kRANSACBatchSize);
+    while (iteration < num_iterations && iteration < max_iterations) {
+        const int batch_size =
+                std::min(kRANSACBatchSize, num_iterations - iteration);
+
+        // Draw the samples sequentially, so that they only depend on the
+        // random seed.
+        for (int h = 0; h < batch_size; ++h) {
+            int64_t* sample = samples.data() + h * ransac_n;
+            for (int k = 0; k < ransac_n;) {
+                sample[k] = utility::random::RandUint32() % points.size;
+                if (std::find(sample, sample + k, sample[k]) == sample + k) {
+                    ++k;
+                }
+            }
+        }
+
+#pragma omp parallel for schedule(dynamic, 1) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int h = 0; h < batch_size; ++h) {
+            planes[h] = FitPlaneToSample(points, samples.data() + h * ransac_n,
+                                         ransac_n);
+            scores[h] = planes[h].isZero(0)
+                                ? RANSACScore{-1, 0}
+                                : ScorePlane(points, planes[h],
+                                             distance_threshold);
+        }
+        iteration += batch_size;
+
+        bool improved = false;
+        for (int h = 0; h < batch_size; ++h) {
+            if (scores[h].inliers >= 0 && scores[h].IsBetterThan(best)) {
+                best = scores[h];
+                best_plane = planes[h];
+                improved = true;
+            }
+        }
+        if (!improved) {
+            continue;
+        }
+
+        // Local optimization: refit the plane to its inliers while this
+        // improves the score.
+        for (int k = 0; k < kRANSACMaxLocalIterations; ++k) {
+            const Eigen::Vector4d plane =
+                    FitPlaneToInliers(points, best_plane, distance_threshold);
+            if (plane.isZero(0)) {
+                break;
+            }
+            const RANSACScore score =
+                    ScorePlane(points, plane, distance_threshold);
+            if (!score.IsBetterThan(best)) {
+                break;
+            }
+            best = score;
+            best_plane = plane;
+        }
+
+        const double fitness = double(best.inliers) / double(points.size);
+        max_iterations = fitness < 1.0
+                                 ? std::log(1 - probability) /
+                                           std::log(1 - std::pow(fitness,
+                                                                 ransac_n))
+                                 : 0;
+    }
+
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
+            "{:d}",
+            best.inliers, double(best.inliers) / double(points.size),
+            best.inliers > 0 ? std::sqrt(best.error / double(best.inliers))
+                             : 0.0,
+            iteration);
+    return best;
+}
+
+}  // namespace
+
+void SegmentPlanesCPU(const core::Tensor& points,
+                      double distance_threshold,
+                      int ransac_n,
+                      int num_iterations,
+                      double probability,
+                      int max_planes,
+                      int64_t min_inliers,
+                      core::Tensor& plane_models,
+                      core::Tensor& labels) {
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 and <= 1.0");
+    }
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    const int64_t n = points.GetLength();
+    if (n < ransac_n) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+
+    labels = core::Tensor::Full({n}, -1, core::Int32, points.GetDevice());
+    int32_t* labels_ptr = labels.GetDataPtr<int32_t>();
+    std::vector<double> planes;
+
+    // Structure of arrays copy of the points, compacted in place after each
+    // plane.
+    core::Tensor points_soa = points.T().Contiguous();
+    std::vector<int64_t> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        scalar_t* soa_ptr = points_soa.GetDataPtr<scalar_t>();
+        PlanePoints<scalar_t> remaining{soa_ptr, soa_ptr + n, soa_ptr + 2 * n,
+                                        indices.data(), n};
+        for (int p = 0; p < max_planes && remaining.size >= ransac_n; ++p) {
+            Eigen::Vector4d plane;
+            const RANSACScore score =
+                    FindPlane(remaining, distance_threshold, ransac_n,
+                              num_iterations, probability, plane);
+            if (plane.isZero(0) || score.inliers < min_inliers) {
+                break;
+            }
+
+            // Improve the plane using the final inliers.
+            const Eigen::Vector4d refined =
+                    FitPlaneToInliers(remaining, plane, distance_threshold);
+            const Eigen::Vector4d& plane_model =
+                    refined.isZero(0) ? plane : refined;
+            planes.insert(planes.end(), plane_model.data(),
+                          plane_model.data() + 4);
+
+            // Assign the inliers and move all other points to the front.
+            const scalar_t a = static_cast<scalar_t>(plane(0));
+            const scalar_t b = static_cast<scalar_t>(plane(1));
+            const scalar_t c = static_cast<scalar_t>(plane(2));
+            const scalar_t d = static_cast<scalar_t>(plane(3));
+            const scalar_t threshold =
+                    static_cast<scalar_t>(distance_threshold);
+            int64_t num_remaining = 0;
+            for (int64_t i = 0; i < remaining.size; ++i) {
+                const scalar_t dist = a * remaining.x[i] + b * remaining.y[i] +
+                                      c * remaining.z[i] + d;
+                if (std::abs(dist) < threshold) {
+                    labels_ptr[remaining.indices[i]] = p;
+                } else {
+                    remaining.x[num_remaining] = remaining.x[i];
+                    remaining.y[num_remaining] = remaining.y[i];
+                    remaining.z[num_remaining] = remaining.z[i];
+                    remaining.indices[num_remaining] = remaining.indices[i];
+                    ++num_remaining;
+                }
+            }
+            remaining.size = num_remaining;
+        }
+    });
+
+    const int64_t num_planes = static_cast<int64_t>(planes.size()) / 4;
+    plane_models = core::Tensor(planes, {num_planes, 4}, core::Float64,
+                                points.GetDevice());
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
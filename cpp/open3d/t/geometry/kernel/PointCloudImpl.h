@@ -17,7 +17,6 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/linalg/kernel/Matrix.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
-#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
@@ -555,75 +554,22 @@ OPEN3D_HOST_DEVICE void EstimatePointWiseRobustNormalizedCovarianceKernel(
 }
 
 #if defined(__CUDACC__)
-void EstimateCovariancesUsingHybridSearchCUDA
+void EstimateCovariancesCUDA
 #else
-void EstimateCovariancesUsingHybridSearchCPU
+void EstimateCovariancesCPU
 #endif
         (const core::Tensor& points,
-         core::Tensor& covariances,
-         const double& radius,
-         const int64_t& max_nn) {
-    core::Dtype dtype = points.GetDtype();
-    int64_t n = points.GetLength();
-
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-    bool check = tree.HybridIndex(radius);
-    if (!check) {
-        utility::LogError("Building FixedRadiusIndex failed.");
-    }
-
-    core::Tensor indices, distance, counts;
-    std::tie(indices, distance, counts) =
-            tree.HybridSearch(points, radius, max_nn);
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
-        int32_t* neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
-        int32_t* neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
-        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
-
-        core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    // NNS [Hybrid Search].
-                    const int32_t neighbour_offset = max_nn * workload_idx;
-                    // Count of valid correspondences per point.
-                    const int32_t neighbour_count =
-                            neighbour_counts_ptr[workload_idx];
-                    // Covariance is of shape {3, 3}, so it has an
-                    // offset factor of 9 x workload_idx.
-                    const int32_t covariances_offset = 9 * workload_idx;
-
-                    EstimatePointWiseRobustNormalizedCovarianceKernel(
-                            points_ptr,
-                            neighbour_indices_ptr + neighbour_offset,
-                            neighbour_count,
-                            covariances_ptr + covariances_offset);
-                });
-    });
-
-    core::cuda::Synchronize(points.GetDevice());
-}
-
-#if defined(__CUDACC__)
-void EstimateCovariancesUsingRadiusSearchCUDA
-#else
-void EstimateCovariancesUsingRadiusSearchCPU
-#endif
-        (const core::Tensor& points,
-         core::Tensor& covariances,
-         const double& radius) {
+         const core::Tensor& indices,
+         const core::Tensor& counts,
+         core::Tensor& covariances) {
     core::Dtype dtype = points.GetDtype();
     int64_t n = points.GetLength();
 
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-    bool check = tree.FixedRadiusIndex(radius);
-    if (!check) {
-        utility::LogError("Building Radius-Index failed.");
-    }
-
-    core::Tensor indices, distance, counts;
-    std::tie(indices, distance, counts) =
-            tree.FixedRadiusSearch(points, radius);
+    // Radius search results in 1D indices and row splits as counts. KNN and
+    // hybrid search results in 2D indices and the number of neighbors per
+    // point as counts.
+    const bool is_radius_search = indices.NumDims() == 1;
+    const int64_t nn_size = is_radius_search ? 0 : indices.GetShape(1);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
@@ -633,14 +579,19 @@ void EstimateCovariancesUsingRadiusSearchCPU
 
         core::ParallelFor(
                 points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    const int32_t neighbour_offset =
-                            neighbour_counts_ptr[workload_idx];
+                    const int64_t neighbour_offset =
+                            is_radius_search
+                                    ? neighbour_counts_ptr[workload_idx]
+                                    : nn_size * workload_idx;
+                    // Count of valid correspondences per point.
                     const int32_t neighbour_count =
-                            (neighbour_counts_ptr[workload_idx + 1] -
-                             neighbour_counts_ptr[workload_idx]);
+                            is_radius_search
+                                    ? (neighbour_counts_ptr[workload_idx + 1] -
+                                       neighbour_counts_ptr[workload_idx])
+                                    : neighbour_counts_ptr[workload_idx];
                     // Covariance is of shape {3, 3}, so it has an offset
                     // factor of 9 x workload_idx.
-                    const int32_t covariances_offset = 9 * workload_idx;
+                    const int64_t covariances_offset = 9 * workload_idx;
 
                     EstimatePointWiseRobustNormalizedCovarianceKernel(
                             points_ptr,
@@ -653,59 +604,6 @@ void EstimateCovariancesUsingRadiusSearchCPU
     core::cuda::Synchronize(points.GetDevice());
 }
 
-#if defined(__CUDACC__)
-void EstimateCovariancesUsingKNNSearchCUDA
-#else
-void EstimateCovariancesUsingKNNSearchCPU
-#endif
-        (const core::Tensor& points,
-         core::Tensor& covariances,
-         const int64_t& max_nn) {
-    core::Dtype dtype = points.GetDtype();
-    int64_t n = points.GetLength();
-
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-    bool check = tree.KnnIndex();
-    if (!check) {
-        utility::LogError("Building KNN-Index failed.");
-    }
-
-    core::Tensor indices, distance;
-    std::tie(indices, distance) = tree.KnnSearch(points, max_nn);
-
-    indices = indices.Contiguous();
-    int32_t nn_count = static_cast<int32_t>(indices.GetShape()[1]);
-
-    if (nn_count < 3) {
-        utility::LogError(
-                "Not enough neighbors to compute Covariances / Normals. "
-                "Try "
-                "increasing the max_nn parameter.");
-    }
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        auto points_ptr = points.GetDataPtr<scalar_t>();
-        auto neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
-        auto covariances_ptr = covariances.GetDataPtr<scalar_t>();
-
-        core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    // NNS [KNN Search].
-                    const int32_t neighbour_offset = nn_count * workload_idx;
-                    // Covariance is of shape {3, 3}, so it has an offset
-                    // factor of 9 x workload_idx.
-                    const int32_t covariances_offset = 9 * workload_idx;
-
-                    EstimatePointWiseRobustNormalizedCovarianceKernel(
-                            points_ptr,
-                            neighbour_indices_ptr + neighbour_offset, nn_count,
-                            covariances_ptr + covariances_offset);
-                });
-    });
-
-    core::cuda::Synchronize(points.GetDevice());
-}
-
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE void ComputeEigenvector0(const scalar_t* A,
                                             const scalar_t eval0,
@@ -1126,138 +1024,24 @@ OPEN3D_HOST_DEVICE void EstimatePointWiseColorGradientKernel(
 }
 
 #if defined(__CUDACC__)
-void EstimateColorGradientsUsingHybridSearchCUDA
+void EstimateColorGradientsCUDA
 #else
-void EstimateColorGradientsUsingHybridSearchCPU
+void EstimateColorGradientsCPU
 #endif
         (const core::Tensor& points,
          const core::Tensor& normals,
          const core::Tensor& colors,
-         core::Tensor& color_gradients,
-         const double& radius,
-         const int64_t& max_nn) {
-    core::Dtype dtype = points.GetDtype();
-    int64_t n = points.GetLength();
-
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-
-    bool check = tree.HybridIndex(radius);
-    if (!check) {
-        utility::LogError("NearestNeighborSearch::HybridIndex is not set.");
-    }
-
-    core::Tensor indices, distance, counts;
-    std::tie(indices, distance, counts) =
-            tree.HybridSearch(points, radius, max_nn);
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        auto points_ptr = points.GetDataPtr<scalar_t>();
-        auto normals_ptr = normals.GetDataPtr<scalar_t>();
-        auto colors_ptr = colors.GetDataPtr<scalar_t>();
-        auto neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
-        auto neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
-        auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
-
-        core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    // NNS [Hybrid Search].
-                    int32_t neighbour_offset = max_nn * workload_idx;
-                    // Count of valid correspondences per point.
-                    int32_t neighbour_count =
-                            neighbour_counts_ptr[workload_idx];
-                    int32_t idx_offset = 3 * workload_idx;
-
-                    EstimatePointWiseColorGradientKernel(
-                            points_ptr, normals_ptr, colors_ptr, idx_offset,
-                            neighbour_indices_ptr + neighbour_offset,
-                            neighbour_count, color_gradients_ptr);
-                });
-    });
-
-    core::cuda::Synchronize(points.GetDevice());
-}
-
-#if defined(__CUDACC__)
-void EstimateColorGradientsUsingKNNSearchCUDA
-#else
-void EstimateColorGradientsUsingKNNSearchCPU
-#endif
-        (const core::Tensor& points,
-         const core::Tensor& normals,
-         const core::Tensor& colors,
-         core::Tensor& color_gradients,
-         const int64_t& max_nn) {
-    core::Dtype dtype = points.GetDtype();
-    int64_t n = points.GetLength();
-
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-
-    bool check = tree.KnnIndex();
-    if (!check) {
-        utility::LogError("KnnIndex is not set.");
-    }
-
-    core::Tensor indices, distance;
-    std::tie(indices, distance) = tree.KnnSearch(points, max_nn);
-
-    indices = indices.To(core::Int32).Contiguous();
-    int64_t nn_count = indices.GetShape()[1];
-
-    if (nn_count < 4) {
-        utility::LogError(
-                "Not enough neighbors to compute Covariances / Normals. "
-                "Try "
-                "changing the search parameter.");
-    }
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        auto points_ptr = points.GetDataPtr<scalar_t>();
-        auto normals_ptr = normals.GetDataPtr<scalar_t>();
-        auto colors_ptr = colors.GetDataPtr<scalar_t>();
-        auto neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
-        auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
-
-        core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    int32_t neighbour_offset = max_nn * workload_idx;
-                    int32_t idx_offset = 3 * workload_idx;
-
-                    EstimatePointWiseColorGradientKernel(
-                            points_ptr, normals_ptr, colors_ptr, idx_offset,
-                            neighbour_indices_ptr + neighbour_offset, nn_count,
-                            color_gradients_ptr);
-                });
-    });
-
-    core::cuda::Synchronize(points.GetDevice());
-}
-
-#if defined(__CUDACC__)
-void EstimateColorGradientsUsingRadiusSearchCUDA
-#else
-void EstimateColorGradientsUsingRadiusSearchCPU
-#endif
-        (const core::Tensor& points,
-         const core::Tensor& normals,
-         const core::Tensor& colors,
-         core::Tensor& color_gradients,
-         const double& radius) {
+         const core::Tensor& indices,
+         const core::Tensor& counts,
+         core::Tensor& color_gradients) {
     core::Dtype dtype = points.GetDtype();
     int64_t n = points.GetLength();
 
-    core::nns::NearestNeighborSearch tree(points, core::Int32);
-
-    bool check = tree.FixedRadiusIndex(radius);
-    if (!check) {
-        utility::LogError("RadiusIndex is not set.");
-    }
-
-    core::Tensor indices, distance, counts;
-    std::tie(indices, distance, counts) =
-            tree.FixedRadiusSearch(points, radius);
-
-    indices = indices.To(core::Int32).Contiguous();
-    counts = counts.Contiguous();
+    // Radius search results in 1D indices and row splits as counts. KNN and
+    // hybrid search results in 2D indices and the number of neighbors per
+    // point as counts.
+    const bool is_radius_search = indices.NumDims() == 1;
+    const int64_t nn_size = is_radius_search ? 0 : indices.GetShape(1);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         auto points_ptr = points.GetDataPtr<scalar_t>();
@@ -1269,12 +1053,16 @@ void EstimateColorGradientsUsingRadiusSearchCPU
 
         core::ParallelFor(
                 points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    int32_t neighbour_offset =
-                            neighbour_counts_ptr[workload_idx];
+                    const int64_t neighbour_offset =
+                            is_radius_search
+                                    ? neighbour_counts_ptr[workload_idx]
+                                    : nn_size * workload_idx;
                     // Count of valid correspondences per point.
                     const int32_t neighbour_count =
-                            (neighbour_counts_ptr[workload_idx + 1] -
-                             neighbour_counts_ptr[workload_idx]);
+                            is_radius_search
+                                    ? (neighbour_counts_ptr[workload_idx + 1] -
+                                       neighbour_counts_ptr[workload_idx])
+                                    : neighbour_counts_ptr[workload_idx];
                     int32_t idx_offset = 3 * workload_idx;
 
                     EstimatePointWiseColorGradientKernel(
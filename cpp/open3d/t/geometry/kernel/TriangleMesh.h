@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 
 namespace open3d {
@@ -40,6 +42,96 @@ std::array<core::Tensor, 3> SamplePointsUniformlyCPU(
         const core::Tensor& albedo,
         size_t number_of_points);
 
+/// \brief Quadric error metric decimation by Garland and Heckbert.
+///
+/// Meshes with more than \p max_partition_triangles triangles are split into
+/// spatial partitions with PCAPartition. The partitions are decimated in
+/// parallel while the vertices shared between partitions are locked. The
+/// triangles inside a partition are reduced by the target ratio. Then a
+/// serial seam pass with a single queue over all remaining edges collapses
+/// the edges at the partition boundaries until the target is reached. The
+/// result does not depend on the number of threads.
+///
+/// \param vertices Float64 tensor of shape {N, 3}.
+/// \param triangles Int32 tensor of shape {M, 3}.
+/// \param vertex_attrs Float64 tensors of shape {N, C}, which are averaged
+/// when an edge is collapsed.
+/// \param preserve_volume If true, the collapsed vertex is constrained to
+/// preserve the volume enclosed by its neighboring triangles.
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  const std::vector<core::Tensor>& vertex_attrs,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  bool preserve_volume,
+                                  int max_partition_triangles,
+                                  core::Tensor& out_vertices,
+                                  core::Tensor& out_triangles,
+                                  std::vector<core::Tensor>& out_vertex_attrs);
+
+enum class BooleanOperation { Union, Intersection, Difference };
+
+/// \brief Boolean operation of the volumes enclosed by two triangle meshes.
+///
+/// The candidate triangle pairs are found with a parallel BVH traversal and
+/// the intersection curves are computed with exact orientation predicates.
+/// Coplanar and other degenerate configurations are resolved by translating
+/// the second mesh by a fraction of \p tolerance and by simulation of
+/// simplicity. The triangles are split along the curves and the patches
+/// between the curves are classified with the generalized winding number of
+/// the other mesh. Output vertices within \p tolerance are merged.
+///
+/// \param vertices_a, vertices_b Float64 tensors of shape {N, 3}.
+/// \param triangles_a, triangles_b Int64 tensors of shape {M, 3}.
+/// \param vertices Float64 tensor of shape {V, 3}.
+/// \param triangles Int64 tensor of shape {T, 3}.
+/// \param vertex_sources Int64 tensor of shape {V, 2} with the two vertices of
+/// the concatenation of \p vertices_a and \p vertices_b that each vertex is
+/// interpolated from.
+/// \param vertex_weights Float64 tensor of shape {V} with the weight of the
+/// first source vertex.
+void BooleanOperationCPU(const core::Tensor& vertices_a,
+                         const core::Tensor& triangles_a,
+                         const core::Tensor& vertices_b,
+                         const core::Tensor& triangles_b,
+                         BooleanOperation operation,
+                         double tolerance,
+                         core::Tensor& vertices,
+                         core::Tensor& triangles,
+                         core::Tensor& vertex_sources,
+                         core::Tensor& vertex_weights);
+
+/// \brief Clips the triangles with the plane through \p point and keeps the
+/// part on the side of \p normal. The new vertices on the plane are shared by
+/// the triangles of the cut edges.
+///
+/// \param vertices Float64 tensor of shape {N, 3}.
+/// \param triangles Int64 tensor of shape {M, 3}.
+/// \param point, normal Float64 tensors of shape {3}.
+/// \param vertex_sources, vertex_weights As in BooleanOperationCPU(), with
+/// indices into \p vertices.
+/// \param triangle_sources Int64 tensor of shape {T} with the clipped triangle
+/// of each triangle.
+void ClipPlaneCPU(const core::Tensor& vertices,
+                  const core::Tensor& triangles,
+                  const core::Tensor& point,
+                  const core::Tensor& normal,
+                  core::Tensor& out_triangles,
+                  core::Tensor& vertex_sources,
+                  core::Tensor& vertex_weights,
+                  core::Tensor& triangle_sources);
+
+/// \brief Triangulates the boundary loops whose bounding sphere has a radius
+/// of at most \p hole_size by ear clipping.
+///
+/// \param out_triangles Int64 tensor with the triangles followed by the
+/// triangles of the holes.
+void FillHolesCPU(const core::Tensor& vertices,
+                  const core::Tensor& triangles,
+                  double hole_size,
+                  core::Tensor& out_triangles);
+
 #ifdef BUILD_CUDA_MODULE
 void NormalizeNormalsCUDA(core::Tensor& normals);
 
@@ -0,0 +1,1679 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+namespace {
+
+/// Number of triangle pairs or vertices per chunk of the parallel loops.
+constexpr int64_t kPairsPerChunk = 1 << 12;
+
+/// Translation of the second boolean operand relative to the tolerance, and
+/// its bounds relative to the size of the meshes.
+constexpr double kRelativeOffset = 0.1;
+constexpr double kMinOffset = 1e-10;
+constexpr double kMaxOffset = 1e-6;
+
+/// Far BVH nodes are approximated in the winding number if the distance is
+/// larger than this factor times the radius of the node.
+constexpr double kWindingNumberBeta = 2.0;
+
+// Error bounds of the floating point filters, cf. "Adaptive Precision
+// Floating-Point Arithmetic and Fast Robust Geometric Predicates" by Shewchuk.
+constexpr double kEpsilon = DBL_EPSILON / 2;
+constexpr double kOrient2dBound = (3.0 + 16.0 * kEpsilon) * kEpsilon;
+constexpr double kOrient3dBound = (7.0 + 56.0 * kEpsilon) * kEpsilon;
+
+/// Exact sum of nonoverlapping doubles in increasing order of magnitude,
+/// without zeros. The sign of the sum is the sign of the last component.
+using Expansion = std::vector<double>;
+
+/// x + y = a + b exactly, where x = fl(a + b).
+inline void TwoSum(double a, double b, double &x, double &y) {
+    x = a + b;
+    const double b_virtual = x - a;
+    const double a_virtual = x - b_virtual;
+    y = (a - a_virtual) + (b - b_virtual);
+}
+
+Expansion Grow(const Expansion &e, double b) {
+    Expansion h;
+    h.reserve(e.size() + 1);
+    double q = b;
+    for (const double e_i : e) {
+        double x, y;
+        TwoSum(q, e_i, x, y);
+        if (y != 0) {
+            h.push_back(y);
+        }
+        q = x;
+    }
+    if (q != 0) {
+        h.push_back(q);
+    }
+    return h;
+}
+
+Expansion Add(const Expansion &e, const Expansion &f) {
+    Expansion h = e;
+    for (const double f_i : f) {
+        h = Grow(h, f_i);
+    }
+    return h;
+}
+
+Expansion Negate(Expansion e) {
+    for (double &e_i : e) {
+        e_i = -e_i;
+    }
+    return e;
+}
+
+Expansion Multiply(const Expansion &e, const Expansion &f) {
+    Expansion h;
+    for (const double e_i : e) {
+        for (const double f_j : f) {
+            const double x = e_i * f_j;
+            h = Grow(Grow(h, std::fma(e_i, f_j, -x)), x);
+        }
+    }
+    return h;
+}
+
+/// Exact a - b.
+Expansion Difference(double a, double b) { return Grow(Expansion{a}, -b); }
+
+int Sign(const Expansion &e) {
+    if (e.empty()) {
+        return 0;
+    }
+    return e.back() > 0 ? 1 : -1;
+}
+
+int Sign(double x) { return (x > 0) - (x < 0); }
+
+/// Sign of det[b - a, c - a, d - a], which is positive if d is on the side of
+/// the plane through a, b and c that (b - a) x (c - a) points to.
+int Orient3d(const Eigen::Vector3d &a,
+             const Eigen::Vector3d &b,
+             const Eigen::Vector3d &c,
+             const Eigen::Vector3d &d) {
+    const Eigen::Vector3d u = b - a;
+    const Eigen::Vector3d v = c - a;
+    const Eigen::Vector3d w = d - a;
+    const double det = u(0) * (v(1) * w(2) - v(2) * w(1)) +
+                       u(1) * (v(2) * w(0) - v(0) * w(2)) +
+                       u(2) * (v(0) * w(1) - v(1) * w(0));
+    const double permanent =
+            std::abs(u(0)) *
+                    (std::abs(v(1) * w(2)) + std::abs(v(2) * w(1))) +
+            std::abs(u(1)) *
+                    (std::abs(v(2) * w(0)) + std::abs(v(0) * w(2))) +
+            std::abs(u(2)) * (std::abs(v(0) * w(1)) + std::abs(v(1) * w(0)));
+    const double bound = kOrient3dBound * permanent;
+    if (det > bound || -det > bound) {
+        return Sign(det);
+    }
+
+    std::array<Expansion, 3> ue, ve, we;
+    for (int i = 0; i < 3; ++i) {
+        ue[i] = Difference(b(i), a(i));
+        ve[i] = Difference(c(i), a(i));
+        we[i] = Difference(d(i), a(i));
+    }
+    auto minor = [&](int i, int j) {
+        return Add(Multiply(ve[i], we[j]), Negate(Multiply(ve[j], we[i])));
+    };
+    return Sign(Add(Add(Multiply(ue[0], minor(1, 2)),
+                        Multiply(ue[1], minor(2, 0))),
+                    Multiply(ue[2], minor(0, 1))));
+}
+
+/// Sign of the first nonzero component of (p1 - p0) x (q1 - q0).
+int CrossProductSign(const Eigen::Vector3d &p0,
+                     const Eigen::Vector3d &p1,
+                     const Eigen::Vector3d &q0,
+                     const Eigen::Vector3d &q1) {
+    static constexpr int kAxes[3][2] = {{1, 2}, {2, 0}, {0, 1}};
+    for (const auto &axes : kAxes) {
+        const int i = axes[0];
+        const int j = axes[1];
+        const double left = (p1(i) - p0(i)) * (q1(j) - q0(j));
+        const double right = (p1(j) - p0(j)) * (q1(i) - q0(i));
+        const double det = left - right;
+        const double bound =
+                kOrient2dBound * (std::abs(left) + std::abs(right));
+        int sign;
+        if (det > bound || -det > bound) {
+            sign = Sign(det);
+        } else {
+            sign = Sign(Add(Multiply(Difference(p1(i), p0(i)),
+                                     Difference(q1(j), q0(j))),
+                            Negate(Multiply(Difference(p1(j), p0(j)),
+                                            Difference(q1(i), q0(i))))));
+        }
+        if (sign != 0) {
+            return sign;
+        }
+    }
+    return 0;
+}
+
+// The predicates between the two meshes of a boolean operation simulate that
+// the second mesh is translated by the infinitesimal (e, e^2, e^3), cf.
+// "Simulation of Simplicity" by Edelsbrunner and Muecke. Then no vertex of
+// one mesh is on the plane of a triangle of the other mesh, and an edge that
+// crosses the plane of a triangle is not coplanar with its edges.
+
+/// Side of vertex b of the second mesh of the plane of triangle a.
+int SideOfFirst(const Eigen::Vector3d &a0,
+                const Eigen::Vector3d &a1,
+                const Eigen::Vector3d &a2,
+                const Eigen::Vector3d &b) {
+    const int sign = Orient3d(a0, a1, a2, b);
+    return sign != 0 ? sign : CrossProductSign(a0, a1, a0, a2);
+}
+
+/// Side of vertex a of the first mesh of the plane of triangle b.
+int SideOfSecond(const Eigen::Vector3d &b0,
+                 const Eigen::Vector3d &b1,
+                 const Eigen::Vector3d &b2,
+                 const Eigen::Vector3d &a) {
+    const int sign = Orient3d(b0, b1, b2, a);
+    return sign != 0 ? sign : -CrossProductSign(b0, b1, b0, b2);
+}
+
+/// Orientation of edge (p, q) of the first mesh and edge (r, s) of the
+/// second mesh.
+int EdgeOrientation(const Eigen::Vector3d &p,
+                    const Eigen::Vector3d &q,
+                    const Eigen::Vector3d &r,
+                    const Eigen::Vector3d &s) {
+    const int sign = Orient3d(p, q, r, s);
+    return sign != 0 ? sign : CrossProductSign(p, q, s, r);
+}
+
+double Cross2d(const Eigen::Vector2d &a, const Eigen::Vector2d &b) {
+    return a(0) * b(1) - a(1) * b(0);
+}
+
+/// Returns true if \p p is inside or on the counter-clockwise triangle (a, b,
+/// c).
+bool PointInTriangle2d(const Eigen::Vector2d &p,
+                       const Eigen::Vector2d &a,
+                       const Eigen::Vector2d &b,
+                       const Eigen::Vector2d &c) {
+    return Cross2d(b - a, p - a) >= 0 && Cross2d(c - b, p - b) >= 0 &&
+           Cross2d(a - c, p - c) >= 0;
+}
+
+bool PointInPolygon2d(const Eigen::Vector2d &p,
+                      const std::vector<Eigen::Vector2d> &points,
+                      const std::vector<int> &polygon) {
+    bool inside = false;
+    const size_t n = polygon.size();
+    for (size_t i = 0, j = n - 1; i < n; j = i++) {
+        const Eigen::Vector2d &a = points[polygon[i]];
+        const Eigen::Vector2d &b = points[polygon[j]];
+        if ((a(1) > p(1)) != (b(1) > p(1)) &&
+            p(0) < (b(0) - a(0)) * (p(1) - a(1)) / (b(1) - a(1)) + a(0)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+bool SegmentsCross2d(const Eigen::Vector2d &a,
+                     const Eigen::Vector2d &b,
+                     const Eigen::Vector2d &c,
+                     const Eigen::Vector2d &d) {
+    return Cross2d(b - a, c - a) * Cross2d(b - a, d - a) < 0 &&
+           Cross2d(d - c, a - c) * Cross2d(d - c, b - c) < 0;
+}
+
+double SignedArea2d(const std::vector<Eigen::Vector2d> &points,
+                    const std::vector<int> &polygon) {
+    double area = 0;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        area += Cross2d(points[polygon[i]],
+                        points[polygon[(i + 1) % polygon.size()]]);
+    }
+    return 0.5 * area;
+}
+
+/// Triangulates the counter-clockwise \p polygon of indices into \p points by
+/// ear clipping and appends the triangles to \p triangles. An index may occur
+/// several times, as in polygons with bridged holes. If there is no ear in a
+/// degenerate polygon, the most convex vertex is clipped.
+void TriangulatePolygon(const std::vector<Eigen::Vector2d> &points,
+                        const std::vector<int> &polygon,
+                        std::vector<std::array<int, 3>> &triangles) {
+    const int n = static_cast<int>(polygon.size());
+    if (n < 3) {
+        return;
+    }
+    std::vector<int> prev(n), next(n);
+    for (int i = 0; i < n; ++i) {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+    auto area = [&](int i) {
+        const Eigen::Vector2d &a = points[polygon[prev[i]]];
+        return Cross2d(points[polygon[i]] - a, points[polygon[next[i]]] - a);
+    };
+    auto is_ear = [&](int i, bool strict) {
+        const double ear_area = area(i);
+        if (ear_area < 0 || (strict && ear_area <= 0)) {
+            return false;
+        }
+        const int ia = polygon[prev[i]];
+        const int ib = polygon[i];
+        const int ic = polygon[next[i]];
+        for (int j = next[next[i]]; j != prev[i]; j = next[j]) {
+            const int id = polygon[j];
+            // Only reflex vertices can be inside of an ear.
+            if (id == ia || id == ib || id == ic || area(j) > 0) {
+                continue;
+            }
+            if (PointInTriangle2d(points[id], points[ia], points[ib],
+                                  points[ic])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto clip = [&](int i) {
+        triangles.push_back({polygon[prev[i]], polygon[i], polygon[next[i]]});
+        next[prev[i]] = next[i];
+        prev[next[i]] = prev[i];
+        return prev[i];
+    };
+
+    int remaining = n;
+    int i = 0;
+    int num_tested = 0;
+    bool strict = true;
+    while (remaining > 3) {
+        if (is_ear(i, strict)) {
+            i = clip(i);
+            --remaining;
+            num_tested = 0;
+            strict = true;
+            continue;
+        }
+        i = next[i];
+        if (++num_tested < remaining) {
+            continue;
+        }
+        num_tested = 0;
+        if (strict) {
+            strict = false;
+            continue;
+        }
+        int best = i;
+        for (int j = next[i]; j != i; j = next[j]) {
+            if (area(j) > area(best)) {
+                best = j;
+            }
+        }
+        i = clip(best);
+        --remaining;
+        strict = true;
+    }
+    triangles.push_back({polygon[prev[i]], polygon[i], polygon[next[i]]});
+}
+
+/// Connects the clockwise \p holes to the counter-clockwise \p outer polygon,
+/// such that the result can be triangulated with TriangulatePolygon().
+std::vector<int> BridgeHoles(const std::vector<Eigen::Vector2d> &points,
+                             std::vector<int> outer,
+                             std::vector<std::vector<int>> holes) {
+    auto rightmost = [&](const std::vector<int> &hole) {
+        return static_cast<int>(
+                std::max_element(hole.begin(), hole.end(),
+                                 [&](int lhs, int rhs) {
+                                     return points[lhs](0) < points[rhs](0);
+                                 }) -
+                hole.begin());
+    };
+    std::sort(holes.begin(), holes.end(),
+              [&](const std::vector<int> &lhs, const std::vector<int> &rhs) {
+                  return points[lhs[rightmost(lhs)]](0) >
+                         points[rhs[rightmost(rhs)]](0);
+              });
+    for (size_t h = 0; h < holes.size(); ++h) {
+        const std::vector<int> &hole = holes[h];
+        const int m = rightmost(hole);
+        const Eigen::Vector2d &pm = points[hole[m]];
+        auto crosses = [&](const std::vector<int> &polygon, int id) {
+            for (size_t k = 0; k < polygon.size(); ++k) {
+                const int a = polygon[k];
+                const int b = polygon[(k + 1) % polygon.size()];
+                if (a != id && b != id && a != hole[m] && b != hole[m] &&
+                    SegmentsCross2d(pm, points[id], points[a], points[b])) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        // Bridge to the closest vertex of the outer polygon that is visible.
+        std::vector<int> candidates(outer.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::sort(candidates.begin(), candidates.end(), [&](int lhs, int rhs) {
+            return (points[outer[lhs]] - pm).squaredNorm() <
+                   (points[outer[rhs]] - pm).squaredNorm();
+        });
+        int bridge = candidates[0];
+        for (const int k : candidates) {
+            bool visible = !crosses(outer, outer[k]);
+            for (size_t g = h; visible && g < holes.size(); ++g) {
+                visible = !crosses(holes[g], outer[k]);
+            }
+            if (visible) {
+                bridge = k;
+                break;
+            }
+        }
+        std::vector<int> merged(outer.begin(), outer.begin() + bridge + 1);
+        for (size_t k = 0; k <= hole.size(); ++k) {
+            merged.push_back(hole[(m + k) % hole.size()]);
+        }
+        merged.insert(merged.end(), outer.begin() + bridge, outer.end());
+        outer = std::move(merged);
+    }
+    return outer;
+}
+
+/// Generalized winding number of a triangle mesh. Far nodes of the BVH are
+/// approximated by their dipole, cf. "Fast Winding Numbers for Soups and
+/// Clouds" by Barill et al.
+class WindingNumber {
+public:
+    WindingNumber(const open3d::geometry::TriangleMeshBVH &bvh,
+                  const std::vector<Eigen::Vector3d> &vertices,
+                  const std::vector<Eigen::Vector3i> &triangles)
+        : bvh_(bvh), vertices_(vertices), triangles_(triangles) {
+        const auto &nodes = bvh.GetNodes();
+        const auto &indices = bvh.GetTriangleIndices();
+        const size_t num_nodes = nodes.size();
+        area_normals_.resize(num_nodes);
+        centers_.resize(num_nodes);
+        radii_.resize(num_nodes);
+        std::vector<double> areas(num_nodes);
+        // Children are stored after their parent.
+        for (size_t i = num_nodes; i-- > 0;) {
+            const auto &node = nodes[i];
+            Eigen::Vector3d area_normal = Eigen::Vector3d::Zero();
+            Eigen::Vector3d weighted_center = Eigen::Vector3d::Zero();
+            double area = 0;
+            if (node.IsLeaf()) {
+                for (int k = node.begin_; k < node.end_; ++k) {
+                    const Eigen::Vector3i &triangle = triangles[indices[k]];
+                    const Eigen::Vector3d &v0 = vertices[triangle(0)];
+                    const Eigen::Vector3d &v1 = vertices[triangle(1)];
+                    const Eigen::Vector3d &v2 = vertices[triangle(2)];
+                    const Eigen::Vector3d n = 0.5 * (v1 - v0).cross(v2 - v0);
+                    area_normal += n;
+                    weighted_center += n.norm() * (v0 + v1 + v2) / 3;
+                    area += n.norm();
+                }
+            } else {
+                for (const int child : {node.left_, node.right_}) {
+                    area_normal += area_normals_[child];
+                    weighted_center += areas[child] * centers_[child];
+                    area += areas[child];
+                }
+            }
+            area_normals_[i] = area_normal;
+            areas[i] = area;
+            centers_[i] = area > 0 ? Eigen::Vector3d(weighted_center / area)
+                                   : 0.5 * (node.min_bound_ + node.max_bound_);
+            radii_[i] = (node.max_bound_ - centers_[i])
+                                .cwiseAbs()
+                                .cwiseMax((centers_[i] - node.min_bound_)
+                                                  .cwiseAbs())
+                                .norm();
+        }
+    }
+
+    double operator()(const Eigen::Vector3d &p) const {
+        const auto &nodes = bvh_.GetNodes();
+        const auto &indices = bvh_.GetTriangleIndices();
+        if (nodes.empty()) {
+            return 0;
+        }
+        double solid_angle = 0;
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            const int i = stack.back();
+            stack.pop_back();
+            const Eigen::Vector3d d = centers_[i] - p;
+            const double distance = d.norm();
+            if (distance > kWindingNumberBeta * radii_[i]) {
+                solid_angle += d.dot(area_normals_[i]) /
+                               (distance * distance * distance);
+                continue;
+            }
+            const auto &node = nodes[i];
+            if (!node.IsLeaf()) {
+                stack.push_back(node.left_);
+                stack.push_back(node.right_);
+                continue;
+            }
+            for (int k = node.begin_; k < node.end_; ++k) {
+                const Eigen::Vector3i &triangle = triangles_[indices[k]];
+                const Eigen::Vector3d a = vertices_[triangle(0)] - p;
+                const Eigen::Vector3d b = vertices_[triangle(1)] - p;
+                const Eigen::Vector3d c = vertices_[triangle(2)] - p;
+                const double la = a.norm();
+                const double lb = b.norm();
+                const double lc = c.norm();
+                solid_angle +=
+                        2 * std::atan2(a.dot(b.cross(c)),
+                                       la * lb * lc + a.dot(b) * lc +
+                                               b.dot(c) * la + c.dot(a) * lb);
+            }
+        }
+        return solid_angle / (4 * M_PI);
+    }
+
+private:
+    const open3d::geometry::TriangleMeshBVH &bvh_;
+    const std::vector<Eigen::Vector3d> &vertices_;
+    const std::vector<Eigen::Vector3i> &triangles_;
+    std::vector<Eigen::Vector3d> area_normals_;
+    std::vector<Eigen::Vector3d> centers_;
+    std::vector<double> radii_;
+};
+
+/// Operand of a boolean operation with merged duplicate vertices and without
+/// degenerate triangles.
+struct Operand {
+    /// Vertices used by the predicates, which are translated for the second
+    /// operand.
+    std::vector<Eigen::Vector3d> vertices;
+    /// Untranslated vertices.
+    std::vector<Eigen::Vector3d> positions;
+    std::vector<Eigen::Vector3i> triangles;
+    /// Index of an input vertex for each vertex.
+    std::vector<int64_t> sources;
+};
+
+Operand CreateOperand(const core::Tensor &vertices,
+                      const core::Tensor &triangles,
+                      const Eigen::Vector3d &translation) {
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles.GetLength();
+    const double *vertex_ptr = vertices.GetDataPtr<double>();
+    const int64_t *triangle_ptr = triangles.GetDataPtr<int64_t>();
+    auto position = [&](int64_t i) {
+        return Eigen::Vector3d(vertex_ptr[3 * i], vertex_ptr[3 * i + 1],
+                               vertex_ptr[3 * i + 2]);
+    };
+
+    // Merge vertices with equal coordinates, as vtkCleanPolyData.
+    std::vector<int64_t> order(num_vertices);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(),
+                       [&](int64_t lhs, int64_t rhs) {
+                           const Eigen::Vector3d p = position(lhs);
+                           const Eigen::Vector3d q = position(rhs);
+                           return std::make_tuple(p(0), p(1), p(2), lhs) <
+                                  std::make_tuple(q(0), q(1), q(2), rhs);
+                       });
+    Operand operand;
+    std::vector<int> vertex_map(num_vertices);
+    for (int64_t k = 0; k < num_vertices; ++k) {
+        const int64_t i = order[k];
+        if (k == 0 || position(i) != position(order[k - 1])) {
+            operand.sources.push_back(i);
+            operand.positions.push_back(position(i));
+            operand.vertices.push_back(position(i) + translation);
+        }
+        vertex_map[i] = static_cast<int>(operand.sources.size()) - 1;
+    }
+
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        const Eigen::Vector3i triangle(vertex_map[triangle_ptr[3 * i]],
+                                       vertex_map[triangle_ptr[3 * i + 1]],
+                                       vertex_map[triangle_ptr[3 * i + 2]]);
+        const Eigen::Vector3d &v0 = operand.vertices[triangle(0)];
+        if (CrossProductSign(v0, operand.vertices[triangle(1)], v0,
+                             operand.vertices[triangle(2)]) != 0) {
+            operand.triangles.push_back(triangle);
+        }
+    }
+    return operand;
+}
+
+/// Point where an edge of one operand crosses a triangle of the other.
+struct Crossing {
+    /// Operand of the edge, the edge (v0 < v1) and the crossed triangle.
+    int operand;
+    int v0;
+    int v1;
+    int triangle;
+    /// Position v0 + t (v1 - v0) with the translated vertices.
+    double t;
+    Eigen::Vector3d position;
+
+    std::tuple<int, int, int, int> Key() const {
+        return std::make_tuple(operand, v0, v1, triangle);
+    }
+};
+
+/// Segment of the intersection of triangle a of the first operand and
+/// triangle b of the second operand.
+struct Segment {
+    int triangle_a;
+    int triangle_b;
+    Crossing ends[2];
+};
+
+/// Triangle of the split operands with global vertex indices: the vertices
+/// of the first operand, of the second operand and the crossings.
+struct SplitTriangle {
+    std::array<int64_t, 3> vertices;
+    int operand;
+};
+
+/// Mesh arrangement of two operands. The triangles are split along the
+/// intersection curves and the patches between the curves are classified as
+/// inside or outside of the other operand.
+class MeshArrangement {
+public:
+    /// \param num_input_vertices_a Number of input vertices of the first
+    /// operand, which is the offset of the second operand in the sources.
+    MeshArrangement(Operand &&a, Operand &&b, int64_t num_input_vertices_a)
+        : operands_{{std::move(a), std::move(b)}},
+          num_input_vertices_a_(num_input_vertices_a) {
+        offsets_[0] = 0;
+        offsets_[1] = static_cast<int64_t>(operands_[0].vertices.size());
+        offsets_[2] = offsets_[1] +
+                      static_cast<int64_t>(operands_[1].vertices.size());
+        for (int i = 0; i < 2; ++i) {
+            bvhs_[i].SetTriangles(operands_[i].vertices,
+                                  operands_[i].triangles);
+        }
+    }
+
+    void ComputeIntersections() {
+        const std::vector<Eigen::Vector2i> pairs =
+                bvhs_[0].GetOverlappingTriangleBounds(bvhs_[1]);
+        const int64_t num_pairs = static_cast<int64_t>(pairs.size());
+
+        const int64_t num_chunks =
+                (num_pairs + kPairsPerChunk - 1) / kPairsPerChunk;
+        std::vector<std::vector<Segment>> chunk_segments(num_chunks);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t end =
+                    std::min(num_pairs, (chunk + 1) * kPairsPerChunk);
+            for (int64_t i = chunk * kPairsPerChunk; i < end; ++i) {
+                Segment segment;
+                if (IntersectTriangles(pairs[i](0), pairs[i](1), segment)) {
+                    chunk_segments[chunk].push_back(segment);
+                }
+            }
+        }
+        for (const auto &segments : chunk_segments) {
+            segments_.insert(segments_.end(), segments.begin(),
+                             segments.end());
+        }
+
+        // Crossings with the same key are the same point of the curves.
+        const int64_t num_ends = 2 * static_cast<int64_t>(segments_.size());
+        std::vector<int64_t> order(num_ends);
+        std::iota(order.begin(), order.end(), 0);
+        auto end_key = [&](int64_t i) {
+            return segments_[i / 2].ends[i % 2].Key();
+        };
+        tbb::parallel_sort(order.begin(), order.end(),
+                           [&](int64_t lhs, int64_t rhs) {
+                               return end_key(lhs) < end_key(rhs);
+                           });
+        segment_points_.resize(num_ends);
+        for (int64_t k = 0; k < num_ends; ++k) {
+            if (k == 0 || end_key(order[k]) != end_key(order[k - 1])) {
+                crossings_.push_back(
+                        segments_[order[k] / 2].ends[order[k] % 2]);
+            }
+            segment_points_[order[k]] =
+                    offsets_[2] + static_cast<int64_t>(crossings_.size()) - 1;
+        }
+    }
+
+    /// Splits all triangles along the segments.
+    void SplitTriangles() {
+        // Segments of each triangle in CSR format.
+        std::array<std::vector<std::pair<int, int>>, 2> triangle_segments;
+        for (int s = 0; s < static_cast<int>(segments_.size()); ++s) {
+            triangle_segments[0].emplace_back(segments_[s].triangle_a, s);
+            triangle_segments[1].emplace_back(segments_[s].triangle_b, s);
+        }
+        for (int i = 0; i < 2; ++i) {
+            tbb::parallel_sort(triangle_segments[i].begin(),
+                               triangle_segments[i].end());
+            const int num_triangles =
+                    static_cast<int>(operands_[i].triangles.size());
+            std::vector<int> begin(num_triangles + 1, 0);
+            for (const auto &ts : triangle_segments[i]) {
+                ++begin[ts.first + 1];
+            }
+            std::partial_sum(begin.begin(), begin.end(), begin.begin());
+
+            std::vector<std::vector<std::array<int64_t, 3>>> split(
+                    num_triangles);
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int t = 0; t < num_triangles; ++t) {
+                std::vector<int> segments;
+                for (int k = begin[t]; k < begin[t + 1]; ++k) {
+                    segments.push_back(triangle_segments[i][k].second);
+                }
+                Split(i, t, segments, split[t]);
+            }
+            for (int t = 0; t < num_triangles; ++t) {
+                for (const auto &triangle : split[t]) {
+                    triangles_.push_back({triangle, i});
+                }
+            }
+        }
+    }
+
+    /// Returns true for each split triangle, if it is inside the other
+    /// operand. Split triangles that are connected without crossing a curve
+    /// form a patch and are classified together.
+    std::vector<bool> ClassifyTriangles() const {
+        const int64_t num_triangles = static_cast<int64_t>(triangles_.size());
+        std::vector<std::pair<uint64_t, int64_t>> edges;
+        edges.reserve(3 * num_triangles);
+        for (int64_t i = 0; i < num_triangles; ++i) {
+            const auto &v = triangles_[i].vertices;
+            for (int k = 0; k < 3; ++k) {
+                edges.emplace_back(EdgeKey(v[k], v[(k + 1) % 3]), i);
+            }
+        }
+        tbb::parallel_sort(edges.begin(), edges.end());
+        std::vector<uint64_t> curve_edges;
+        for (size_t s = 0; s < segments_.size(); ++s) {
+            curve_edges.push_back(EdgeKey(segment_points_[2 * s],
+                                          segment_points_[2 * s + 1]));
+        }
+        tbb::parallel_sort(curve_edges.begin(), curve_edges.end());
+
+        std::vector<int64_t> parents(num_triangles);
+        std::iota(parents.begin(), parents.end(), 0);
+        auto find = [&](int64_t i) {
+            while (parents[i] != i) {
+                parents[i] = parents[parents[i]];
+                i = parents[i];
+            }
+            return i;
+        };
+        for (size_t begin = 0, end = 0; begin < edges.size(); begin = end) {
+            while (end < edges.size() &&
+                   edges[end].first == edges[begin].first) {
+                ++end;
+            }
+            if (std::binary_search(curve_edges.begin(), curve_edges.end(),
+                                   edges[begin].first)) {
+                continue;
+            }
+            for (size_t k = begin + 1; k < end; ++k) {
+                const int64_t i = edges[begin].second;
+                const int64_t j = edges[k].second;
+                if (triangles_[i].operand == triangles_[j].operand) {
+                    const int64_t root_i = find(i);
+                    const int64_t root_j = find(j);
+                    parents[std::max(root_i, root_j)] =
+                            std::min(root_i, root_j);
+                }
+            }
+        }
+
+        // The winding number is evaluated at the centroid of the largest
+        // triangle of each patch.
+        std::vector<int64_t> patches;
+        std::vector<int64_t> patch_of(num_triangles);
+        std::vector<double> areas(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_triangles; ++i) {
+            const auto &v = triangles_[i].vertices;
+            areas[i] = (Vertex(v[1]) - Vertex(v[0]))
+                               .cross(Vertex(v[2]) - Vertex(v[0]))
+                               .norm();
+        }
+        std::unordered_map<int64_t, int64_t> patch_index;
+        for (int64_t i = 0; i < num_triangles; ++i) {
+            const int64_t root = find(i);
+            auto it = patch_index.find(root);
+            if (it == patch_index.end()) {
+                it = patch_index.emplace(root, patches.size()).first;
+                patches.push_back(i);
+            } else if (areas[i] > areas[patches[it->second]]) {
+                patches[it->second] = i;
+            }
+            patch_of[i] = it->second;
+        }
+        const int64_t num_patches = static_cast<int64_t>(patches.size());
+        const std::array<WindingNumber, 2> winding_numbers = {
+                WindingNumber(bvhs_[0], operands_[0].vertices,
+                              operands_[0].triangles),
+                WindingNumber(bvhs_[1], operands_[1].vertices,
+                              operands_[1].triangles)};
+        std::vector<char> patch_inside(num_patches);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t p = 0; p < num_patches; ++p) {
+            const SplitTriangle &triangle = triangles_[patches[p]];
+            const Eigen::Vector3d centroid = (Vertex(triangle.vertices[0]) +
+                                              Vertex(triangle.vertices[1]) +
+                                              Vertex(triangle.vertices[2])) /
+                                             3;
+            patch_inside[p] =
+                    winding_numbers[1 - triangle.operand](centroid) > 0.5;
+        }
+
+        std::vector<bool> inside(num_triangles);
+        for (int64_t i = 0; i < num_triangles; ++i) {
+            inside[i] = patch_inside[patch_of[i]];
+        }
+        return inside;
+    }
+
+    const std::vector<SplitTriangle> &GetTriangles() const {
+        return triangles_;
+    }
+
+    int64_t GetNumVertices() const {
+        return offsets_[2] + static_cast<int64_t>(crossings_.size());
+    }
+
+    /// Returns the untranslated position of vertex \p i, and its sources as
+    /// indices into the concatenated inputs with the weight of the first.
+    Eigen::Vector3d GetPosition(int64_t i,
+                                int64_t &source0,
+                                int64_t &source1,
+                                double &weight) const {
+        if (i < offsets_[2]) {
+            const int operand = i < offsets_[1] ? 0 : 1;
+            const int64_t v = i - offsets_[operand];
+            source0 = source1 = OriginalIndex(operand, v);
+            weight = 1;
+            return operands_[operand].positions[v];
+        }
+        const Crossing &crossing = crossings_[i - offsets_[2]];
+        const Operand &operand = operands_[crossing.operand];
+        source0 = OriginalIndex(crossing.operand, crossing.v0);
+        source1 = OriginalIndex(crossing.operand, crossing.v1);
+        weight = 1 - crossing.t;
+        return weight * operand.positions[crossing.v0] +
+               crossing.t * operand.positions[crossing.v1];
+    }
+
+private:
+    static uint64_t EdgeKey(int64_t i, int64_t j) {
+        return (static_cast<uint64_t>(std::min(i, j)) << 32) |
+               static_cast<uint64_t>(std::max(i, j));
+    }
+
+    int64_t OriginalIndex(int operand, int64_t v) const {
+        return operands_[operand].sources[v] +
+               (operand == 0 ? 0 : num_input_vertices_a_);
+    }
+
+    /// Translated position of global vertex \p i.
+    const Eigen::Vector3d &Vertex(int64_t i) const {
+        if (i < offsets_[1]) {
+            return operands_[0].vertices[i];
+        }
+        if (i < offsets_[2]) {
+            return operands_[1].vertices[i - offsets_[1]];
+        }
+        return crossings_[i - offsets_[2]].position;
+    }
+
+    /// Computes the crossing of edge (v0, v1) of \p operand with the plane
+    /// of \p triangle of the other operand.
+    Crossing MakeCrossing(int operand, int v0, int v1, int triangle) const {
+        const Operand &edge_operand = operands_[operand];
+        const Operand &other = operands_[1 - operand];
+        const Eigen::Vector3i &t = other.triangles[triangle];
+        const Eigen::Vector3d &t0 = other.vertices[t(0)];
+        const Eigen::Vector3d normal =
+                (other.vertices[t(1)] - t0).cross(other.vertices[t(2)] - t0);
+        const Eigen::Vector3d &p = edge_operand.vertices[v0];
+        const Eigen::Vector3d &q = edge_operand.vertices[v1];
+        const double dp = normal.dot(p - t0);
+        const double dq = normal.dot(q - t0);
+        Crossing crossing;
+        crossing.operand = operand;
+        crossing.v0 = v0;
+        crossing.v1 = v1;
+        crossing.triangle = triangle;
+        crossing.t = dp != dq ? std::min(std::max(dp / (dp - dq), 0.0), 1.0)
+                              : 0.5;
+        crossing.position = p + crossing.t * (q - p);
+        return crossing;
+    }
+
+    /// Computes the segment of the intersection of triangle \p ta of the
+    /// first operand and \p tb of the second operand. Returns false if the
+    /// triangles do not intersect.
+    bool IntersectTriangles(int ta, int tb, Segment &segment) const {
+        const Eigen::Vector3i &fa = operands_[0].triangles[ta];
+        const Eigen::Vector3i &fb = operands_[1].triangles[tb];
+        const std::vector<Eigen::Vector3d> &va = operands_[0].vertices;
+        const std::vector<Eigen::Vector3d> &vb = operands_[1].vertices;
+        const Eigen::Vector3d *a[3] = {&va[fa(0)], &va[fa(1)], &va[fa(2)]};
+        const Eigen::Vector3d *b[3] = {&vb[fb(0)], &vb[fb(1)], &vb[fb(2)]};
+
+        int side_a[3], side_b[3];
+        for (int i = 0; i < 3; ++i) {
+            side_a[i] = SideOfSecond(*b[0], *b[1], *b[2], *a[i]);
+        }
+        if (side_a[0] == side_a[1] && side_a[1] == side_a[2]) {
+            return false;
+        }
+        for (int i = 0; i < 3; ++i) {
+            side_b[i] = SideOfFirst(*a[0], *a[1], *a[2], *b[i]);
+        }
+        if (side_b[0] == side_b[1] && side_b[1] == side_b[2]) {
+            return false;
+        }
+
+        // In general position, two crossings of an edge of one triangle with
+        // the other triangle are the ends of the segment.
+        int num_ends = 0;
+        for (int i = 0; i < 3; ++i) {
+            const int j = (i + 1) % 3;
+            if (side_a[i] == side_a[j]) {
+                continue;
+            }
+            int orientations[3];
+            for (int k = 0; k < 3; ++k) {
+                orientations[k] =
+                        EdgeOrientation(*a[i], *a[j], *b[k], *b[(k + 1) % 3]);
+            }
+            if (orientations[0] != 0 && orientations[0] == orientations[1] &&
+                orientations[1] == orientations[2]) {
+                if (num_ends == 2) {
+                    return false;
+                }
+                segment.ends[num_ends++] = MakeCrossing(
+                        0, std::min(fa(i), fa(j)), std::max(fa(i), fa(j)), tb);
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            const int j = (i + 1) % 3;
+            if (side_b[i] == side_b[j]) {
+                continue;
+            }
+            int orientations[3];
+            for (int k = 0; k < 3; ++k) {
+                orientations[k] =
+                        EdgeOrientation(*a[k], *a[(k + 1) % 3], *b[i], *b[j]);
+            }
+            if (orientations[0] != 0 && orientations[0] == orientations[1] &&
+                orientations[1] == orientations[2]) {
+                if (num_ends == 2) {
+                    return false;
+                }
+                segment.ends[num_ends++] = MakeCrossing(
+                        1, std::min(fb(i), fb(j)), std::max(fb(i), fb(j)), ta);
+            }
+        }
+        segment.triangle_a = ta;
+        segment.triangle_b = tb;
+        return num_ends == 2;
+    }
+
+    /// Splits triangle \p t of \p operand along \p segments. The faces of the
+    /// planar graph of the edges and the segments are triangulated in the
+    /// projection to the dominant plane of the triangle.
+    void Split(int operand,
+               int t,
+               const std::vector<int> &segments,
+               std::vector<std::array<int64_t, 3>> &result) const {
+        const Eigen::Vector3i &triangle = operands_[operand].triangles[t];
+        const int64_t offset = offsets_[operand];
+        if (segments.empty()) {
+            result.push_back({offset + triangle(0), offset + triangle(1),
+                              offset + triangle(2)});
+            return;
+        }
+
+        const Eigen::Vector3d &v0 = Vertex(offset + triangle(0));
+        const Eigen::Vector3d normal = (Vertex(offset + triangle(1)) - v0)
+                                               .cross(Vertex(offset +
+                                                             triangle(2)) -
+                                                      v0);
+        int axis;
+        normal.cwiseAbs().maxCoeff(&axis);
+        int x = (axis + 1) % 3;
+        int y = (axis + 2) % 3;
+        if (normal(axis) < 0) {
+            std::swap(x, y);
+        }
+
+        std::vector<int64_t> vertices;
+        std::vector<Eigen::Vector2d> points;
+        std::unordered_map<int64_t, int> local;
+        std::array<std::vector<std::pair<double, int>>, 3> edge_points;
+        auto add_vertex = [&](int64_t i) {
+            auto it = local.find(i);
+            if (it != local.end()) {
+                return it->second;
+            }
+            const int l = static_cast<int>(vertices.size());
+            local.emplace(i, l);
+            vertices.push_back(i);
+            points.emplace_back(Vertex(i)(x), Vertex(i)(y));
+            if (i >= offsets_[2]) {
+                const Crossing &crossing = crossings_[i - offsets_[2]];
+                for (int k = 0; crossing.operand == operand && k < 3; ++k) {
+                    const int p = triangle(k);
+                    const int q = triangle((k + 1) % 3);
+                    if (std::min(p, q) == crossing.v0 &&
+                        std::max(p, q) == crossing.v1) {
+                        edge_points[k].emplace_back(
+                                p == crossing.v0 ? crossing.t : 1 - crossing.t,
+                                l);
+                        break;
+                    }
+                }
+            }
+            return l;
+        };
+        for (int k = 0; k < 3; ++k) {
+            add_vertex(offset + triangle(k));
+        }
+        std::vector<std::pair<int, int>> edges;
+        for (const int s : segments) {
+            edges.emplace_back(add_vertex(segment_points_[2 * s]),
+                               add_vertex(segment_points_[2 * s + 1]));
+        }
+        for (int k = 0; k < 3; ++k) {
+            std::sort(edge_points[k].begin(), edge_points[k].end());
+            int prev = k;
+            for (const auto &edge_point : edge_points[k]) {
+                edges.emplace_back(prev, edge_point.second);
+                prev = edge_point.second;
+            }
+            edges.emplace_back(prev, (k + 1) % 3);
+        }
+
+        // Remove dangling segments, which only occur for open operands.
+        const int num_local = static_cast<int>(vertices.size());
+        std::vector<std::vector<int>> incident(num_local);
+        for (int e = 0; e < static_cast<int>(edges.size()); ++e) {
+            incident[edges[e].first].push_back(e);
+            incident[edges[e].second].push_back(e);
+        }
+        std::vector<int> degrees(num_local);
+        std::vector<char> removed(edges.size(), 0);
+        std::vector<int> dangling;
+        for (int v = 0; v < num_local; ++v) {
+            degrees[v] = static_cast<int>(incident[v].size());
+            if (degrees[v] == 1) {
+                dangling.push_back(v);
+            }
+        }
+        while (!dangling.empty()) {
+            const int v = dangling.back();
+            dangling.pop_back();
+            for (const int e : incident[v]) {
+                if (removed[e]) {
+                    continue;
+                }
+                removed[e] = 1;
+                --degrees[v];
+                const int u = edges[e].first == v ? edges[e].second
+                                                  : edges[e].first;
+                if (--degrees[u] == 1) {
+                    dangling.push_back(u);
+                }
+            }
+        }
+
+        // Neighbors of each vertex in counter-clockwise order.
+        std::vector<std::vector<int>> neighbors(num_local);
+        for (int e = 0; e < static_cast<int>(edges.size()); ++e) {
+            if (!removed[e]) {
+                neighbors[edges[e].first].push_back(edges[e].second);
+                neighbors[edges[e].second].push_back(edges[e].first);
+            }
+        }
+        for (int v = 0; v < num_local; ++v) {
+            std::vector<std::pair<double, int>> angles;
+            for (const int u : neighbors[v]) {
+                const Eigen::Vector2d d = points[u] - points[v];
+                angles.emplace_back(std::atan2(d(1), d(0)), u);
+            }
+            std::sort(angles.begin(), angles.end());
+            for (size_t k = 0; k < angles.size(); ++k) {
+                neighbors[v][k] = angles[k].second;
+            }
+        }
+
+        // Trace the faces with the face on the left of each half-edge. The
+        // bounded faces are counter-clockwise. The other clockwise cycles are
+        // the outside of the triangle and holes, i.e. closed curves inside of
+        // a face.
+        std::vector<std::vector<char>> visited(num_local);
+        size_t num_half_edges = 0;
+        for (int v = 0; v < num_local; ++v) {
+            visited[v].assign(neighbors[v].size(), 0);
+            num_half_edges += neighbors[v].size();
+        }
+        std::vector<std::vector<int>> faces, holes;
+        std::vector<double> face_areas;
+        for (int v = 0; v < num_local; ++v) {
+            for (size_t slot = 0; slot < neighbors[v].size(); ++slot) {
+                if (visited[v][slot]) {
+                    continue;
+                }
+                std::vector<int> cycle;
+                int u = v;
+                size_t s = slot;
+                while (!visited[u][s] && cycle.size() <= num_half_edges) {
+                    visited[u][s] = 1;
+                    cycle.push_back(u);
+                    const int w = neighbors[u][s];
+                    const size_t deg = neighbors[w].size();
+                    const size_t back = std::find(neighbors[w].begin(),
+                                                  neighbors[w].end(), u) -
+                                        neighbors[w].begin();
+                    s = (back + deg - 1) % deg;
+                    u = w;
+                }
+                if (cycle.size() < 3) {
+                    continue;
+                }
+                const double area = SignedArea2d(points, cycle);
+                if (area > 0) {
+                    faces.push_back(cycle);
+                    face_areas.push_back(area);
+                } else if (std::find(cycle.begin(), cycle.end(), 0) ==
+                           cycle.end()) {
+                    holes.push_back(cycle);
+                }
+            }
+        }
+
+        // Each hole belongs to the smallest face that contains it.
+        std::vector<std::vector<std::vector<int>>> face_holes(faces.size());
+        for (const auto &hole : holes) {
+            int best = -1;
+            for (int f = 0; f < static_cast<int>(faces.size()); ++f) {
+                if ((best < 0 || face_areas[f] < face_areas[best]) &&
+                    PointInPolygon2d(points[hole[0]], points, faces[f])) {
+                    best = f;
+                }
+            }
+            if (best >= 0) {
+                face_holes[best].push_back(hole);
+            }
+        }
+        std::vector<std::array<int, 3>> local_triangles;
+        for (size_t f = 0; f < faces.size(); ++f) {
+            TriangulatePolygon(points,
+                               face_holes[f].empty()
+                                       ? faces[f]
+                                       : BridgeHoles(points, faces[f],
+                                                     face_holes[f]),
+                               local_triangles);
+        }
+        for (const auto &local_triangle : local_triangles) {
+            result.push_back({vertices[local_triangle[0]],
+                              vertices[local_triangle[1]],
+                              vertices[local_triangle[2]]});
+        }
+    }
+
+    std::array<Operand, 2> operands_;
+    int64_t num_input_vertices_a_;
+    std::array<open3d::geometry::TriangleMeshBVH, 2> bvhs_;
+    std::array<int64_t, 3> offsets_;
+    std::vector<Segment> segments_;
+    /// Global vertex index of the ends of the segments.
+    std::vector<int64_t> segment_points_;
+    std::vector<Crossing> crossings_;
+    std::vector<SplitTriangle> triangles_;
+};
+
+/// Merges vertices within \p tolerance, or with equal positions if
+/// \p tolerance is 0, into the vertex with the smallest index. Returns the
+/// representative of each vertex.
+std::vector<int64_t> MergeVertices(
+        const std::vector<Eigen::Vector3d> &positions, double tolerance) {
+    const int64_t n = static_cast<int64_t>(positions.size());
+
+    // With cells of twice the tolerance, the neighbors of a vertex are in
+    // the 2x2x2 cells on the side of the vertex in its cell.
+    using Cell = std::array<int64_t, 3>;
+    const double cell_size = tolerance > 0 ? 2 * tolerance : 1.0;
+    std::vector<std::pair<Cell, int64_t>> cells(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            cells[i].first[k] = static_cast<int64_t>(
+                    std::floor(positions[i](k) / cell_size));
+        }
+        cells[i].second = i;
+    }
+    tbb::parallel_sort(cells.begin(), cells.end());
+
+    const int64_t num_chunks = (n + kPairsPerChunk - 1) / kPairsPerChunk;
+    std::vector<std::vector<std::pair<int64_t, int64_t>>> chunk_pairs(
+            num_chunks);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const int64_t end = std::min(n, (chunk + 1) * kPairsPerChunk);
+        for (int64_t i = chunk * kPairsPerChunk; i < end; ++i) {
+            Cell cell, side;
+            for (int k = 0; k < 3; ++k) {
+                const double scaled = positions[i](k) / cell_size;
+                cell[k] = static_cast<int64_t>(std::floor(scaled));
+                side[k] = scaled - cell[k] < 0.5 ? -1 : 1;
+            }
+            for (int corner = 0; corner < 8; ++corner) {
+                Cell neighbor = cell;
+                for (int k = 0; k < 3; ++k) {
+                    if (corner & (1 << k)) {
+                        neighbor[k] += side[k];
+                    }
+                }
+                for (auto it = std::lower_bound(
+                             cells.begin(), cells.end(),
+                             std::make_pair(neighbor, int64_t(0)));
+                     it != cells.end() && it->first == neighbor &&
+                     it->second < i;
+                     ++it) {
+                    if ((positions[i] - positions[it->second]).norm() <=
+                        tolerance) {
+                        chunk_pairs[chunk].emplace_back(i, it->second);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<int64_t> parents(n);
+    std::iota(parents.begin(), parents.end(), 0);
+    auto find = [&](int64_t i) {
+        while (parents[i] != i) {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    };
+    for (const auto &pairs : chunk_pairs) {
+        for (const auto &pair : pairs) {
+            const int64_t root_i = find(pair.first);
+            const int64_t root_j = find(pair.second);
+            parents[std::max(root_i, root_j)] = std::min(root_i, root_j);
+        }
+    }
+    std::vector<int64_t> representatives(n);
+    for (int64_t i = 0; i < n; ++i) {
+        representatives[i] = find(i);
+    }
+    return representatives;
+}
+
+}  // namespace
+
+void BooleanOperationCPU(const core::Tensor &vertices_a,
+                         const core::Tensor &triangles_a,
+                         const core::Tensor &vertices_b,
+                         const core::Tensor &triangles_b,
+                         BooleanOperation operation,
+                         double tolerance,
+                         core::Tensor &vertices,
+                         core::Tensor &triangles,
+                         core::Tensor &vertex_sources,
+                         core::Tensor &vertex_weights) {
+    // The second operand is translated by a fraction of the tolerance to
+    // avoid coincident vertices of the intersection curves, which are merged
+    // again within the tolerance.
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector3d max_bound = -min_bound;
+    for (const core::Tensor *v : {&vertices_a, &vertices_b}) {
+        const double *ptr = v->GetDataPtr<double>();
+        for (int64_t i = 0; i < v->GetLength(); ++i) {
+            const Eigen::Map<const Eigen::Vector3d> p(ptr + 3 * i);
+            min_bound = min_bound.cwiseMin(p);
+            max_bound = max_bound.cwiseMax(p);
+        }
+    }
+    const double size =
+            (max_bound - min_bound).cwiseMax(0.0).norm() + DBL_MIN;
+    const double offset =
+            std::min(std::max(kRelativeOffset * tolerance, kMinOffset * size),
+                     kMaxOffset * size);
+    const Eigen::Vector3d translation =
+            offset * Eigen::Vector3d(1.0, 0.7548776662, 0.5698402910)
+                             .normalized();
+
+    MeshArrangement arrangement(
+            CreateOperand(vertices_a, triangles_a, Eigen::Vector3d::Zero()),
+            CreateOperand(vertices_b, triangles_b, translation),
+            vertices_a.GetLength());
+    arrangement.ComputeIntersections();
+    arrangement.SplitTriangles();
+    const std::vector<bool> inside = arrangement.ClassifyTriangles();
+
+    // Select the triangles. The triangles of the second operand are flipped
+    // for the difference.
+    std::vector<std::array<int64_t, 3>> selected;
+    const auto &split_triangles = arrangement.GetTriangles();
+    for (size_t i = 0; i < split_triangles.size(); ++i) {
+        const SplitTriangle &triangle = split_triangles[i];
+        bool keep = false;
+        switch (operation) {
+            case BooleanOperation::Union:
+                keep = !inside[i];
+                break;
+            case BooleanOperation::Intersection:
+                keep = inside[i];
+                break;
+            case BooleanOperation::Difference:
+                keep = triangle.operand == 0 ? !inside[i] : inside[i];
+                break;
+        }
+        if (!keep) {
+            continue;
+        }
+        std::array<int64_t, 3> v = triangle.vertices;
+        if (operation == BooleanOperation::Difference &&
+            triangle.operand == 1) {
+            std::swap(v[1], v[2]);
+        }
+        selected.push_back(v);
+    }
+
+    // Compact the vertices and merge them within the tolerance.
+    std::vector<int64_t> vertex_map(arrangement.GetNumVertices(), -1);
+    for (const auto &triangle : selected) {
+        for (const int64_t v : triangle) {
+            vertex_map[v] = 0;
+        }
+    }
+    std::vector<Eigen::Vector3d> positions;
+    std::vector<int64_t> sources;
+    std::vector<double> weights;
+    for (int64_t v = 0; v < static_cast<int64_t>(vertex_map.size()); ++v) {
+        if (vertex_map[v] < 0) {
+            continue;
+        }
+        vertex_map[v] = static_cast<int64_t>(positions.size());
+        int64_t source0, source1;
+        double weight;
+        positions.push_back(
+                arrangement.GetPosition(v, source0, source1, weight));
+        sources.push_back(source0);
+        sources.push_back(source1);
+        weights.push_back(weight);
+    }
+    const std::vector<int64_t> representatives =
+            MergeVertices(positions, tolerance);
+
+    // Remove degenerate triangles and pairs of opposite triangles.
+    std::vector<std::pair<std::array<int64_t, 3>, int>> keyed;
+    for (const auto &triangle : selected) {
+        std::array<int64_t, 3> v;
+        for (int k = 0; k < 3; ++k) {
+            v[k] = representatives[vertex_map[triangle[k]]];
+        }
+        if (v[0] == v[1] || v[1] == v[2] || v[2] == v[0]) {
+            continue;
+        }
+        std::array<int64_t, 3> key = v;
+        std::sort(key.begin(), key.end());
+        const int rotation =
+                static_cast<int>(std::find(v.begin(), v.end(), key[0]) -
+                                 v.begin());
+        const bool even = v[(rotation + 1) % 3] == key[1];
+        keyed.emplace_back(key, even ? 1 : -1);
+    }
+    std::sort(keyed.begin(), keyed.end());
+    std::vector<std::array<int64_t, 3>> result;
+    for (size_t begin = 0, end = 0; begin < keyed.size(); begin = end) {
+        int orientation = 0;
+        for (end = begin;
+             end < keyed.size() && keyed[end].first == keyed[begin].first;
+             ++end) {
+            orientation += keyed[end].second;
+        }
+        if (orientation != 0) {
+            std::array<int64_t, 3> v = keyed[begin].first;
+            if (orientation < 0) {
+                std::swap(v[1], v[2]);
+            }
+            result.push_back(v);
+        }
+    }
+
+    std::vector<int64_t> output_map(positions.size(), -1);
+    int64_t num_vertices = 0;
+    for (const auto &triangle : result) {
+        for (const int64_t v : triangle) {
+            output_map[v] = 0;
+        }
+    }
+    for (auto &index : output_map) {
+        if (index == 0) {
+            index = num_vertices++;
+        }
+    }
+    const int64_t num_triangles = static_cast<int64_t>(result.size());
+    vertices = core::Tensor({num_vertices, 3}, core::Float64);
+    vertex_sources = core::Tensor({num_vertices, 2}, core::Int64);
+    vertex_weights = core::Tensor({num_vertices}, core::Float64);
+    triangles = core::Tensor({num_triangles, 3}, core::Int64);
+    double *vertex_ptr = vertices.GetDataPtr<double>();
+    int64_t *source_ptr = vertex_sources.GetDataPtr<int64_t>();
+    double *weight_ptr = vertex_weights.GetDataPtr<double>();
+    int64_t *triangle_ptr = triangles.GetDataPtr<int64_t>();
+    for (size_t v = 0; v < positions.size(); ++v) {
+        const int64_t i = output_map[v];
+        if (i < 0) {
+            continue;
+        }
+        Eigen::Map<Eigen::Vector3d>(vertex_ptr + 3 * i) = positions[v];
+        source_ptr[2 * i] = sources[2 * v];
+        source_ptr[2 * i + 1] = sources[2 * v + 1];
+        weight_ptr[i] = weights[v];
+    }
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            triangle_ptr[3 * i + k] = output_map[result[i][k]];
+        }
+    }
+}
+
+void ClipPlaneCPU(const core::Tensor &vertices,
+                  const core::Tensor &triangles,
+                  const core::Tensor &point,
+                  const core::Tensor &normal,
+                  core::Tensor &out_triangles,
+                  core::Tensor &vertex_sources,
+                  core::Tensor &vertex_weights,
+                  core::Tensor &triangle_sources) {
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles.GetLength();
+    const double *vertex_ptr = vertices.GetDataPtr<double>();
+    const int64_t *triangle_ptr = triangles.GetDataPtr<int64_t>();
+    const Eigen::Map<const Eigen::Vector3d> origin(point.GetDataPtr<double>());
+    const Eigen::Map<const Eigen::Vector3d> direction(
+            normal.GetDataPtr<double>());
+
+    std::vector<double> distances(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_vertices; ++i) {
+        distances[i] = direction.dot(
+                Eigen::Map<const Eigen::Vector3d>(vertex_ptr + 3 * i) - origin);
+    }
+
+    // Clip each triangle to a polygon of input vertices (>= 0) and vertices
+    // on cut edges (< 0), which are shared by the triangles of the edge.
+    std::vector<int64_t> polygons;
+    std::vector<int64_t> polygon_begin = {0};
+    std::vector<int64_t> sources;
+    std::vector<std::pair<int64_t, int64_t>> cut_edges;
+    std::unordered_map<uint64_t, int64_t> cut_index;
+    std::vector<int64_t> vertex_map(num_vertices, -1);
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const int64_t begin = static_cast<int64_t>(polygons.size());
+        for (int k = 0; k < 3; ++k) {
+            const int64_t v = triangle_ptr[3 * t + k];
+            const int64_t w = triangle_ptr[3 * t + (k + 1) % 3];
+            if (distances[v] >= 0) {
+                polygons.push_back(v);
+            }
+            if ((distances[v] > 0 && distances[w] < 0) ||
+                (distances[v] < 0 && distances[w] > 0)) {
+                const uint64_t key =
+                        (static_cast<uint64_t>(std::min(v, w)) << 32) |
+                        static_cast<uint64_t>(std::max(v, w));
+                auto it = cut_index.find(key);
+                if (it == cut_index.end()) {
+                    it = cut_index.emplace(key, cut_edges.size()).first;
+                    cut_edges.emplace_back(std::min(v, w), std::max(v, w));
+                }
+                polygons.push_back(-1 - it->second);
+            }
+        }
+        if (static_cast<int64_t>(polygons.size()) - begin < 3) {
+            polygons.resize(begin);
+            continue;
+        }
+        for (int64_t k = begin; k < static_cast<int64_t>(polygons.size());
+             ++k) {
+            if (polygons[k] >= 0) {
+                vertex_map[polygons[k]] = 0;
+            }
+        }
+        polygon_begin.push_back(static_cast<int64_t>(polygons.size()));
+        sources.push_back(t);
+    }
+
+    // Keep the used input vertices in their order, followed by the vertices
+    // on the cut edges.
+    int64_t num_out_vertices = 0;
+    for (auto &index : vertex_map) {
+        if (index == 0) {
+            index = num_out_vertices++;
+        }
+    }
+    const int64_t num_kept = num_out_vertices;
+    num_out_vertices += static_cast<int64_t>(cut_edges.size());
+    vertex_sources = core::Tensor({num_out_vertices, 2}, core::Int64);
+    vertex_weights = core::Tensor({num_out_vertices}, core::Float64);
+    int64_t *source_ptr = vertex_sources.GetDataPtr<int64_t>();
+    double *weight_ptr = vertex_weights.GetDataPtr<double>();
+    for (int64_t v = 0; v < num_vertices; ++v) {
+        if (vertex_map[v] >= 0) {
+            source_ptr[2 * vertex_map[v]] = v;
+            source_ptr[2 * vertex_map[v] + 1] = v;
+            weight_ptr[vertex_map[v]] = 1;
+        }
+    }
+    for (size_t e = 0; e < cut_edges.size(); ++e) {
+        const int64_t i = num_kept + static_cast<int64_t>(e);
+        const double dv = distances[cut_edges[e].first];
+        const double dw = distances[cut_edges[e].second];
+        source_ptr[2 * i] = cut_edges[e].first;
+        source_ptr[2 * i + 1] = cut_edges[e].second;
+        weight_ptr[i] = 1 - dv / (dv - dw);
+    }
+
+    // Triangulate the polygons with at most 4 vertices as fans.
+    std::vector<int64_t> out;
+    std::vector<int64_t> out_sources;
+    auto out_index = [&](int64_t v) {
+        return v >= 0 ? vertex_map[v] : num_kept - 1 - v;
+    };
+    for (size_t p = 0; p + 1 < polygon_begin.size(); ++p) {
+        for (int64_t k = polygon_begin[p] + 1; k + 1 < polygon_begin[p + 1];
+             ++k) {
+            out.push_back(out_index(polygons[polygon_begin[p]]));
+            out.push_back(out_index(polygons[k]));
+            out.push_back(out_index(polygons[k + 1]));
+            out_sources.push_back(sources[p]);
+        }
+    }
+    const int64_t num_out_triangles = static_cast<int64_t>(out_sources.size());
+    out_triangles = core::Tensor(std::move(out), {num_out_triangles, 3},
+                                 core::Int64);
+    triangle_sources = core::Tensor(std::move(out_sources),
+                                    {num_out_triangles}, core::Int64);
+}
+
+void FillHolesCPU(const core::Tensor &vertices,
+                  const core::Tensor &triangles,
+                  double hole_size,
+                  core::Tensor &out_triangles) {
+    const int64_t num_triangles = triangles.GetLength();
+    const double *vertex_ptr = vertices.GetDataPtr<double>();
+    const int64_t *triangle_ptr = triangles.GetDataPtr<int64_t>();
+    auto position = [&](int64_t i) {
+        return Eigen::Map<const Eigen::Vector3d>(vertex_ptr + 3 * i);
+    };
+    auto key = [](int64_t v, int64_t w) {
+        return (static_cast<uint64_t>(v) << 32) | static_cast<uint64_t>(w);
+    };
+
+    // Boundary half-edges are the half-edges without an opposite half-edge.
+    std::unordered_set<uint64_t> half_edges;
+    half_edges.reserve(3 * num_triangles);
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        half_edges.insert(
+                key(triangle_ptr[i], triangle_ptr[i - i % 3 + (i + 1) % 3]));
+    }
+    std::unordered_map<int64_t, std::vector<int64_t>> boundary;
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        const int64_t v = triangle_ptr[i];
+        const int64_t w = triangle_ptr[i - i % 3 + (i + 1) % 3];
+        if (half_edges.count(key(w, v)) == 0) {
+            boundary[v].push_back(w);
+        }
+    }
+
+    // Trace the boundary loops. The triangles of a hole are oriented opposite
+    // to the boundary half-edges.
+    std::vector<std::vector<int64_t>> holes;
+    for (auto &start : boundary) {
+        while (!start.second.empty()) {
+            std::vector<int64_t> loop = {start.first};
+            int64_t v = start.first;
+            bool closed = false;
+            while (true) {
+                auto it = boundary.find(v);
+                if (it == boundary.end() || it->second.empty()) {
+                    break;
+                }
+                v = it->second.back();
+                it->second.pop_back();
+                if (v == start.first) {
+                    closed = true;
+                    break;
+                }
+                loop.push_back(v);
+            }
+            if (!closed || loop.size() < 3) {
+                continue;
+            }
+            Eigen::Vector3d min_bound = position(loop[0]);
+            Eigen::Vector3d max_bound = min_bound;
+            for (const int64_t u : loop) {
+                min_bound = min_bound.cwiseMin(position(u));
+                max_bound = max_bound.cwiseMax(position(u));
+            }
+            const Eigen::Vector3d center = 0.5 * (min_bound + max_bound);
+            double radius = 0;
+            for (const int64_t u : loop) {
+                radius = std::max(radius, (position(u) - center).norm());
+            }
+            if (radius <= hole_size) {
+                std::reverse(loop.begin(), loop.end());
+                holes.push_back(std::move(loop));
+            }
+        }
+    }
+
+    // Triangulate the holes in the plane of their Newell normal.
+    const int64_t num_holes = static_cast<int64_t>(holes.size());
+    std::vector<std::vector<std::array<int, 3>>> hole_triangles(num_holes);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t h = 0; h < num_holes; ++h) {
+        const std::vector<int64_t> &loop = holes[h];
+        const int n = static_cast<int>(loop.size());
+        Eigen::Vector3d center = Eigen::Vector3d::Zero();
+        for (const int64_t v : loop) {
+            center += position(v);
+        }
+        center /= n;
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        for (int i = 0; i < n; ++i) {
+            normal += (position(loop[i]) - center)
+                              .cross(position(loop[(i + 1) % n]) - center);
+        }
+        if (normal.squaredNorm() == 0) {
+            for (int i = 1; i + 1 < n; ++i) {
+                hole_triangles[h].push_back({0, i, i + 1});
+            }
+            continue;
+        }
+        int axis;
+        normal.cwiseAbs().minCoeff(&axis);
+        const Eigen::Vector3d u =
+                normal.cross(Eigen::Vector3d::Unit(axis)).normalized();
+        const Eigen::Vector3d w = normal.normalized().cross(u);
+        std::vector<Eigen::Vector2d> points(n);
+        std::vector<int> polygon(n);
+        for (int i = 0; i < n; ++i) {
+            const Eigen::Vector3d d = position(loop[i]) - center;
+            points[i] = Eigen::Vector2d(d.dot(u), d.dot(w));
+            polygon[i] = i;
+        }
+        TriangulatePolygon(points, polygon, hole_triangles[h]);
+    }
+
+    std::vector<int64_t> out(triangle_ptr, triangle_ptr + 3 * num_triangles);
+    for (int64_t h = 0; h < num_holes; ++h) {
+        for (const auto &triangle : hole_triangles[h]) {
+            for (const int k : triangle) {
+                out.push_back(holes[h][k]);
+            }
+        }
+    }
+    const int64_t num_out = static_cast<int64_t>(out.size()) / 3;
+    out_triangles = core::Tensor(std::move(out), {num_out, 3}, core::Int64);
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
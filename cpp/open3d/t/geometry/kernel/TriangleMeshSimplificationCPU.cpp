@@ -0,0 +1,779 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/kernel/PCAPartition.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+namespace {
+
+/// Error quadric that is used to minimize the squared distance of a point to
+/// its neighbouring triangle planes.
+/// Cf. "Surface Simplification Using Quadric Error Metrics" by Garland and
+/// Heckbert.
+struct Quadric {
+    Quadric() : A(Eigen::Matrix3d::Zero()), b(Eigen::Vector3d::Zero()), c(0) {}
+
+    Quadric(const Eigen::Vector4d& plane, double weight) {
+        const Eigen::Vector3d n = plane.head<3>();
+        A = weight * n * n.transpose();
+        b = weight * plane(3) * n;
+        c = weight * plane(3) * plane(3);
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        A += other.A;
+        b += other.b;
+        c += other.c;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const {
+        Quadric res(*this);
+        res += other;
+        return res;
+    }
+
+    double Eval(const Eigen::Vector3d& v) const {
+        return v.dot(A * v) + 2 * b.dot(v) + c;
+    }
+
+    bool IsInvertible() const { return std::fabs(A.determinant()) > 1e-4; }
+
+    Eigen::Matrix3d A;
+    Eigen::Vector3d b;
+    double c;
+};
+
+/// Plane through the three points with unit normal or zero if the points are
+/// co-linear.
+Eigen::Vector4d ComputeTrianglePlane(const Eigen::Vector3d& p0,
+                                     const Eigen::Vector3d& p1,
+                                     const Eigen::Vector3d& p2) {
+    Eigen::Vector3d n = (p1 - p0).cross(p2 - p0);
+    const double norm = n.norm();
+    if (norm == 0) {
+        return Eigen::Vector4d::Zero();
+    }
+    n /= norm;
+    return Eigen::Vector4d(n(0), n(1), n(2), -n.dot(p0));
+}
+
+/// Queue entry for the edge (v0, v1) with v0 < v1. Ties are broken by the
+/// vertex indices so that the collapse order is fully deterministic.
+struct CostEdge {
+    double cost;
+    int v0;
+    int v1;
+
+    bool operator>(const CostEdge& other) const {
+        return std::tie(cost, v0, v1) >
+               std::tie(other.cost, other.v0, other.v1);
+    }
+};
+
+typedef std::priority_queue<CostEdge,
+                            std::vector<CostEdge>,
+                            std::greater<CostEdge>>
+        EdgeQueue;
+
+/// Partition id of vertices whose triangles belong to more than one
+/// partition. These vertices are locked during the parallel phase.
+constexpr int kSeamVertex = -1;
+
+/// Incremental edge collapse on a mesh that may be split into partitions.
+///
+/// The triangles of each vertex are stored in a CSR table. When v1 is
+/// collapsed into v0 the triangle list of v1 is appended to the list of v0 by
+/// linking the vertices, so that no memory is allocated during the
+/// decimation. Edges whose both vertices belong to the same partition only
+/// touch triangles, vertices and quadrics of that partition and can be
+/// collapsed concurrently with the edges of other partitions.
+class QuadricDecimator {
+public:
+    QuadricDecimator(double* vertices,
+                     int num_vertices,
+                     int* triangles,
+                     int64_t num_triangles,
+                     const std::vector<std::pair<double*, int64_t>>& attrs,
+                     double maximum_error,
+                     double boundary_weight,
+                     bool preserve_volume)
+        : vertices_(vertices),
+          num_vertices_(num_vertices),
+          triangles_(triangles),
+          num_triangles_(num_triangles),
+          attrs_(attrs),
+          maximum_error_(maximum_error),
+          preserve_volume_(preserve_volume),
+          vertex_offsets_(num_vertices + 1, 0),
+          vertex_triangles_(3 * num_triangles),
+          next_(num_vertices, -1),
+          tail_(num_vertices),
+          vertex_partition_(num_vertices, 0),
+          vertex_deleted_(num_vertices, 0),
+          triangle_deleted_(num_triangles, 0),
+          Qs_(num_vertices) {
+        // Map vertices to triangles.
+        std::vector<int64_t> counts(num_vertices, 0);
+        for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+            ++counts[triangles_[i]];
+        }
+        utility::InclusivePrefixSum(counts.data(), counts.data() + num_vertices,
+                                    &vertex_offsets_[1]);
+        std::copy(vertex_offsets_.begin(), vertex_offsets_.end() - 1,
+                  counts.begin());
+        for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+            vertex_triangles_[counts[triangles_[i]]++] = int(i / 3);
+        }
+        for (int v = 0; v < num_vertices; ++v) {
+            tail_[v] = v;
+        }
+
+        // Compute the error metric per vertex. For boundary edges add the
+        // quadric of the plane through the edge perpendicular to the
+        // triangle.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int v = 0; v < num_vertices; ++v) {
+            Quadric& Q = Qs_[v];
+            for (int64_t i = vertex_offsets_[v]; i < vertex_offsets_[v + 1];
+                 ++i) {
+                const int* tria = Triangle(vertex_triangles_[i]);
+                const Eigen::Vector3d& p0 = Vertex(tria[0]);
+                const Eigen::Vector3d& p1 = Vertex(tria[1]);
+                const Eigen::Vector3d& p2 = Vertex(tria[2]);
+                const double area = 0.5 * (p1 - p0).cross(p2 - p0).norm();
+                Q += Quadric(ComputeTrianglePlane(p0, p1, p2), area);
+
+                for (int k = 0; k < 3; ++k) {
+                    const int a = tria[k];
+                    const int b = tria[(k + 1) % 3];
+                    if ((a != v && b != v) || !IsBoundaryEdge(a, b)) {
+                        continue;
+                    }
+                    const Eigen::Vector3d& pa = Vertex(a);
+                    const Eigen::Vector3d& pb = Vertex(b);
+                    const Eigen::Vector3d& pc = Vertex(tria[(k + 2) % 3]);
+                    const Eigen::Vector3d pcp = (pc - pa).cross(pc - pb);
+                    Q += Quadric(ComputeTrianglePlane(pa, pb, pa + pcp),
+                                 area * boundary_weight);
+                }
+            }
+        }
+    }
+
+    /// Assigns each vertex to the partition of its triangles or marks it as
+    /// seam vertex. Returns the vertices of each partition and the seam
+    /// vertices as last list.
+    std::vector<std::vector<int>> SetPartitions(const int* triangle_partition,
+                                                int num_partitions) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int v = 0; v < num_vertices_; ++v) {
+            int partition = 0;
+            for (int64_t i = vertex_offsets_[v]; i < vertex_offsets_[v + 1];
+                 ++i) {
+                const int p = triangle_partition[vertex_triangles_[i]];
+                if (i == vertex_offsets_[v]) {
+                    partition = p;
+                } else if (p != partition) {
+                    partition = kSeamVertex;
+                    break;
+                }
+            }
+            vertex_partition_[v] = partition;
+        }
+
+        std::vector<std::vector<int>> partition_vertices(num_partitions + 1);
+        for (int v = 0; v < num_vertices_; ++v) {
+            const int p = vertex_partition_[v];
+            partition_vertices[p == kSeamVertex ? num_partitions : p]
+                    .push_back(v);
+        }
+        return partition_vertices;
+    }
+
+    /// Returns true if any vertex of the triangle is a seam vertex.
+    bool IsSeamTriangle(int64_t tidx) const {
+        const int* tria = Triangle(tidx);
+        return vertex_partition_[tria[0]] == kSeamVertex ||
+               vertex_partition_[tria[1]] == kSeamVertex ||
+               vertex_partition_[tria[2]] == kSeamVertex;
+    }
+
+    /// Collects the edges of the non-deleted triangles of \p vertices and
+    /// computes their costs. If \p partition is not negative, only edges
+    /// whose both vertices belong to this partition are collected.
+    std::vector<CostEdge> CollectEdges(const std::vector<int>& vertices,
+                                       int partition) const {
+        std::vector<std::pair<int, int>> edges;
+        for (int v : vertices) {
+            if (vertex_deleted_[v]) {
+                continue;
+            }
+            ForEachTriangle(v, [&](int tidx) {
+                const int* tria = Triangle(tidx);
+                for (int k = 0; k < 3; ++k) {
+                    const int u = tria[k];
+                    if (u != v && IsCollapsible(u, partition)) {
+                        edges.emplace_back(std::min(u, v), std::max(u, v));
+                    }
+                }
+            });
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        std::vector<CostEdge> cost_edges(edges.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < int64_t(edges.size()); ++i) {
+            const int vidx0 = edges[i].first;
+            const int vidx1 = edges[i].second;
+            cost_edges[i] = {ComputeCost(vidx0, vidx1).first, vidx0, vidx1};
+        }
+        return cost_edges;
+    }
+
+    /// Collapses the edges in \p queue in the order of increasing cost until
+    /// the number of triangles has been reduced to \p target_num_triangles.
+    /// If \p partition is not negative, only edges whose both vertices belong
+    /// to this partition are collapsed.
+    ///
+    /// \return The number of remaining triangles.
+    int64_t Run(EdgeQueue& queue,
+                int partition,
+                int64_t num_triangles,
+                int64_t target_num_triangles) {
+        std::vector<std::pair<int, int>> vertex_counts;
+        while (num_triangles > target_num_triangles && !queue.empty()) {
+            const CostEdge edge = queue.top();
+            queue.pop();
+            if (edge.cost > maximum_error_) {
+                break;
+            }
+
+            // Test if the edge has been updated (reinserted into the queue).
+            const int vidx0 = edge.v0;
+            const int vidx1 = edge.v1;
+            if (vertex_deleted_[vidx0] || vertex_deleted_[vidx1]) {
+                continue;
+            }
+            const auto cost_vbar = ComputeCost(vidx0, vidx1);
+            if (cost_vbar.first != edge.cost) {
+                // With volume preservation the cost also depends on the
+                // neighbors, which may have moved without touching this edge.
+                if (preserve_volume_) {
+                    queue.push({cost_vbar.first, vidx0, vidx1});
+                }
+                continue;
+            }
+
+            const Eigen::Vector3d& vbar = cost_vbar.second;
+            if (CreatesInvalidTriangle(vidx0, vidx1, vbar, vertex_counts)) {
+                continue;
+            }
+            num_triangles -= Collapse(vidx0, vidx1, vbar);
+
+            // Update edge costs for all triangles connecting to vidx0.
+            ForEachTriangle(vidx0, [&](int tidx) {
+                const int* tria = Triangle(tidx);
+                for (int k = 0; k < 3; ++k) {
+                    const int u = tria[k];
+                    if (u == vidx0 || !IsCollapsible(u, partition)) {
+                        continue;
+                    }
+                    const int min = std::min(u, vidx0);
+                    const int max = std::max(u, vidx0);
+                    queue.push({ComputeCost(min, max).first, min, max});
+                }
+            });
+        }
+        return num_triangles;
+    }
+
+    /// Removes the deleted vertices and triangles and writes the result to
+    /// the output tensors.
+    void Compact(core::Tensor& out_vertices,
+                 core::Tensor& out_triangles,
+                 std::vector<core::Tensor>& out_attrs) const {
+        std::vector<int64_t> vertex_map(num_vertices_);
+        std::vector<int64_t> triangle_map(num_triangles_);
+        {
+            std::vector<int64_t> keep(std::max<int64_t>(num_vertices_,
+                                                        num_triangles_));
+            for (int v = 0; v < num_vertices_; ++v) {
+                keep[v] = !vertex_deleted_[v];
+            }
+            utility::InclusivePrefixSum(keep.data(),
+                                        keep.data() + num_vertices_,
+                                        vertex_map.data());
+            for (int64_t t = 0; t < num_triangles_; ++t) {
+                keep[t] = !triangle_deleted_[t];
+            }
+            utility::InclusivePrefixSum(keep.data(),
+                                        keep.data() + num_triangles_,
+                                        triangle_map.data());
+        }
+        const int64_t num_out_vertices =
+                num_vertices_ > 0 ? vertex_map.back() : 0;
+        const int64_t num_out_triangles =
+                num_triangles_ > 0 ? triangle_map.back() : 0;
+
+        out_vertices =
+                core::Tensor::Empty({num_out_vertices, 3}, core::Float64);
+        out_triangles =
+                core::Tensor::Empty({num_out_triangles, 3}, core::Int32);
+        out_attrs.clear();
+        for (const auto& attr : attrs_) {
+            out_attrs.push_back(core::Tensor::Empty(
+                    {num_out_vertices, attr.second}, core::Float64));
+        }
+        double* out_vertices_ptr = out_vertices.GetDataPtr<double>();
+        int* out_triangles_ptr = out_triangles.GetDataPtr<int>();
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int v = 0; v < num_vertices_; ++v) {
+            if (vertex_deleted_[v]) {
+                continue;
+            }
+            const int64_t dst = vertex_map[v] - 1;
+            std::copy_n(vertices_ + 3 * v, 3, out_vertices_ptr + 3 * dst);
+            for (size_t a = 0; a < attrs_.size(); ++a) {
+                const int64_t cols = attrs_[a].second;
+                std::copy_n(attrs_[a].first + cols * v, cols,
+                            out_attrs[a].GetDataPtr<double>() + cols * dst);
+            }
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_triangles_; ++t) {
+            if (triangle_deleted_[t]) {
+                continue;
+            }
+            const int64_t dst = triangle_map[t] - 1;
+            for (int k = 0; k < 3; ++k) {
+                out_triangles_ptr[3 * dst + k] =
+                        int(vertex_map[triangles_[3 * t + k]] - 1);
+            }
+        }
+    }
+
+private:
+    Eigen::Vector3d& Vertex(int v) {
+        return *reinterpret_cast<Eigen::Vector3d*>(vertices_ + 3 * v);
+    }
+
+    const Eigen::Vector3d& Vertex(int v) const {
+        return *reinterpret_cast<const Eigen::Vector3d*>(vertices_ + 3 * v);
+    }
+
+    int* Triangle(int64_t tidx) { return triangles_ + 3 * tidx; }
+
+    const int* Triangle(int64_t tidx) const { return triangles_ + 3 * tidx; }
+
+    /// Calls \p func for all non-deleted triangles of vertex \p v.
+    template <typename Func>
+    void ForEachTriangle(int v, Func func) const {
+        for (int u = v; u >= 0; u = next_[u]) {
+            for (int64_t i = vertex_offsets_[u]; i < vertex_offsets_[u + 1];
+                 ++i) {
+                const int tidx = vertex_triangles_[i];
+                if (!triangle_deleted_[tidx]) {
+                    func(tidx);
+                }
+            }
+        }
+    }
+
+    /// Returns true if the edge (a, b) of the input mesh has only one
+    /// triangle. Only valid before any edge has been collapsed.
+    bool IsBoundaryEdge(int a, int b) const {
+        int count = 0;
+        for (int64_t i = vertex_offsets_[a]; i < vertex_offsets_[a + 1]; ++i) {
+            const int* tria = Triangle(vertex_triangles_[i]);
+            count += tria[0] == b || tria[1] == b || tria[2] == b;
+        }
+        return count == 1;
+    }
+
+    bool IsCollapsible(int v, int partition) const {
+        return partition < 0 || vertex_partition_[v] == partition;
+    }
+
+    /// Computes the linear constraint g^T vbar = h that keeps the volume
+    /// enclosed by the triangles around the edge (vidx0, vidx1) unchanged
+    /// when the edge is collapsed to vbar. Returns false if the constraint is
+    /// degenerate.
+    bool ComputeVolumeConstraint(int vidx0,
+                                 int vidx1,
+                                 Eigen::Vector3d& g,
+                                 double& h) const {
+        // Signed tetrahedron volumes are computed w.r.t. vidx0 for accuracy.
+        const Eigen::Vector3d origin = Vertex(vidx0);
+        g.setZero();
+        h = 0;
+        double magnitude = 0;
+        for (int vidx : {vidx0, vidx1}) {
+            ForEachTriangle(vidx, [&](int tidx) {
+                const int* tria = Triangle(tidx);
+                const bool has_both = (tria[0] == vidx0 || tria[1] == vidx0 ||
+                                       tria[2] == vidx0) &&
+                                      (tria[0] == vidx1 || tria[1] == vidx1 ||
+                                       tria[2] == vidx1);
+                if (has_both && vidx == vidx1) {
+                    return;
+                }
+                const Eigen::Vector3d q[3] = {Vertex(tria[0]) - origin,
+                                              Vertex(tria[1]) - origin,
+                                              Vertex(tria[2]) - origin};
+                h += q[0].dot(q[1].cross(q[2]));
+                if (has_both) {
+                    return;
+                }
+                const int i = tria[0] == vidx ? 0 : (tria[1] == vidx ? 1 : 2);
+                const Eigen::Vector3d n = q[(i + 1) % 3].cross(q[(i + 2) % 3]);
+                g += n;
+                magnitude += n.norm();
+            });
+        }
+        if (!(g.norm() > 1e-12 * magnitude)) {
+            return false;
+        }
+        h += g.dot(origin);
+        return true;
+    }
+
+    /// Returns the cost and the optimal position of the collapsed edge.
+    std::pair<double, Eigen::Vector3d> ComputeCost(int vidx0, int vidx1) const {
+        const Quadric Qbar = Qs_[vidx0] + Qs_[vidx1];
+        Eigen::Vector3d g;
+        double h = 0;
+        const bool constrained =
+                preserve_volume_ && ComputeVolumeConstraint(vidx0, vidx1, g, h);
+
+        if (Qbar.IsInvertible()) {
+            const auto ldlt = Qbar.A.ldlt();
+            Eigen::Vector3d vbar = -ldlt.solve(Qbar.b);
+            if (constrained) {
+                // Minimum of the quadric on the plane g^T v = h.
+                const Eigen::Vector3d Ag = ldlt.solve(g);
+                const double gAg = g.dot(Ag);
+                if (gAg > 0) {
+                    vbar += Ag * ((h - g.dot(vbar)) / gAg);
+                }
+            }
+            return std::make_pair(Qbar.Eval(vbar), vbar);
+        }
+
+        Eigen::Vector3d v0 = Vertex(vidx0);
+        Eigen::Vector3d v1 = Vertex(vidx1);
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        if (constrained) {
+            const double g2 = g.squaredNorm();
+            for (Eigen::Vector3d* v : {&v0, &v1, &vmid}) {
+                *v += g * ((h - g.dot(*v)) / g2);
+            }
+        }
+        const double cost0 = Qbar.Eval(v0);
+        const double cost1 = Qbar.Eval(v1);
+        const double costmid = Qbar.Eval(vmid);
+        const double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            return std::make_pair(cost, vmid);
+        } else if (cost == cost0) {
+            return std::make_pair(cost, v0);
+        }
+        return std::make_pair(cost, v1);
+    }
+
+    /// Returns true if collapsing the edge flips a triangle normal, creates a
+    /// (nearly) degenerate triangle or a non-manifold edge.
+    bool CreatesInvalidTriangle(
+            int vidx0,
+            int vidx1,
+            const Eigen::Vector3d& vbar,
+            std::vector<std::pair<int, int>>& vertex_counts) const {
+        const double degenerate_ratio_threshold = 0.001;
+        bool invalid = false;
+        vertex_counts.clear();
+        for (int vidx : {vidx1, vidx0}) {
+            ForEachTriangle(vidx, [&](int tidx) {
+                if (invalid) {
+                    return;
+                }
+                const int* tria = Triangle(tidx);
+                const bool has_vidx0 = vidx0 == tria[0] || vidx0 == tria[1] ||
+                                       vidx0 == tria[2];
+                const bool has_vidx1 = vidx1 == tria[0] || vidx1 == tria[1] ||
+                                       vidx1 == tria[2];
+                if (has_vidx0 && has_vidx1) {
+                    return;
+                }
+
+                Eigen::Vector3d verts[3] = {Vertex(tria[0]), Vertex(tria[1]),
+                                            Vertex(tria[2])};
+                Eigen::Vector3d norm_before =
+                        (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+                const double area_before = 0.5 * norm_before.norm();
+                norm_before /= norm_before.norm();
+
+                for (int i = 0; i < 3; ++i) {
+                    if (tria[i] == vidx) {
+                        verts[i] = vbar;
+                        continue;
+                    }
+                    auto it = std::find_if(
+                            vertex_counts.begin(), vertex_counts.end(),
+                            [&](const std::pair<int, int>& vertex_count) {
+                                return vertex_count.first == tria[i];
+                            });
+                    if (it == vertex_counts.end()) {
+                        vertex_counts.emplace_back(tria[i], 1);
+                    } else {
+                        invalid |= it->second >= 2;
+                        it->second += 1;
+                    }
+                }
+
+                Eigen::Vector3d norm_after =
+                        (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+                const double area_after = 0.5 * norm_after.norm();
+                norm_after /= norm_after.norm();
+                // Disallow flipping the triangle normal.
+                invalid |= norm_before.dot(norm_after) < 0;
+                // Disallow creating very small triangles (possibly
+                // degenerate).
+                invalid |= area_after <
+                           degenerate_ratio_threshold * area_before;
+            });
+            if (invalid) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Collapses vidx1 into vidx0 at position vbar. Returns the number of
+    /// deleted triangles.
+    int Collapse(int vidx0, int vidx1, const Eigen::Vector3d& vbar) {
+        // Connect triangles from vidx1 to vidx0, or mark deleted.
+        int num_deleted = 0;
+        ForEachTriangle(vidx1, [&](int tidx) {
+            int* tria = Triangle(tidx);
+            if (vidx0 == tria[0] || vidx0 == tria[1] || vidx0 == tria[2]) {
+                triangle_deleted_[tidx] = 1;
+                ++num_deleted;
+                return;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (tria[k] == vidx1) {
+                    tria[k] = vidx0;
+                }
+            }
+        });
+        next_[tail_[vidx0]] = vidx1;
+        tail_[vidx0] = tail_[vidx1];
+
+        // Update vertex vidx0 to vbar.
+        Vertex(vidx0) = vbar;
+        Qs_[vidx0] += Qs_[vidx1];
+        for (const auto& attr : attrs_) {
+            double* a0 = attr.first + attr.second * vidx0;
+            const double* a1 = attr.first + attr.second * vidx1;
+            for (int64_t k = 0; k < attr.second; ++k) {
+                a0[k] = 0.5 * (a0[k] + a1[k]);
+            }
+        }
+        vertex_deleted_[vidx1] = 1;
+        return num_deleted;
+    }
+
+    double* vertices_;
+    int num_vertices_;
+    int* triangles_;
+    int64_t num_triangles_;
+    std::vector<std::pair<double*, int64_t>> attrs_;
+    double maximum_error_;
+    bool preserve_volume_;
+
+    /// CSR table of the triangles of each vertex of the input mesh.
+    std::vector<int64_t> vertex_offsets_;
+    std::vector<int> vertex_triangles_;
+    /// Linked list of the vertices that have been collapsed into a vertex.
+    std::vector<int> next_;
+    std::vector<int> tail_;
+
+    std::vector<int> vertex_partition_;
+    // Bytes instead of std::vector<bool> for concurrent writes.
+    std::vector<uint8_t> vertex_deleted_;
+    std::vector<uint8_t> triangle_deleted_;
+    std::vector<Quadric> Qs_;
+};
+
+}  // namespace
+
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  const std::vector<core::Tensor>& vertex_attrs,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  bool preserve_volume,
+                                  int max_partition_triangles,
+                                  core::Tensor& out_vertices,
+                                  core::Tensor& out_triangles,
+                                  std::vector<core::Tensor>& out_vertex_attrs) {
+    core::AssertTensorDtype(vertices, core::Float64);
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int32);
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    if (max_partition_triangles <= 0) {
+        utility::LogError("max_partition_triangles must be > 0, but is {}.",
+                          max_partition_triangles);
+    }
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles.GetLength();
+    if (num_vertices > std::numeric_limits<int>::max()) {
+        utility::LogError("Too many vertices ({}).", num_vertices);
+    }
+
+    // The decimation works in place on copies of the inputs.
+    core::Tensor work_vertices = vertices.Contiguous().Clone();
+    core::Tensor work_triangles = triangles.Contiguous().Clone();
+    std::vector<core::Tensor> work_attrs;
+    std::vector<std::pair<double*, int64_t>> attrs;
+    for (const core::Tensor& attr : vertex_attrs) {
+        core::AssertTensorDtype(attr, core::Float64);
+        core::AssertTensorShape(attr, {num_vertices, utility::nullopt});
+        work_attrs.push_back(attr.Contiguous().Clone());
+        attrs.emplace_back(work_attrs.back().GetDataPtr<double>(),
+                           attr.GetShape(1));
+    }
+    if (num_triangles == 0 || target_number_of_triangles >= num_triangles) {
+        out_vertices = work_vertices;
+        out_triangles = work_triangles;
+        out_vertex_attrs = work_attrs;
+        return;
+    }
+    target_number_of_triangles =
+            std::max<int64_t>(target_number_of_triangles, 0);
+
+    QuadricDecimator decimator(work_vertices.GetDataPtr<double>(),
+                               int(num_vertices),
+                               work_triangles.GetDataPtr<int>(), num_triangles,
+                               attrs, maximum_error, boundary_weight,
+                               preserve_volume);
+
+    // Partition the triangles spatially by their centers.
+    int num_partitions = 1;
+    core::Tensor partition_ids =
+            core::Tensor::Zeros({num_triangles}, core::Int32);
+    if (num_triangles > max_partition_triangles) {
+        core::Tensor centers =
+                core::Tensor::Empty({num_triangles, 3}, core::Float32);
+        const double* vertices_ptr = work_vertices.GetDataPtr<double>();
+        const int* triangles_ptr = work_triangles.GetDataPtr<int>();
+        float* centers_ptr = centers.GetDataPtr<float>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_triangles; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                centers_ptr[3 * t + k] =
+                        float((vertices_ptr[3 * triangles_ptr[3 * t] + k] +
+                               vertices_ptr[3 * triangles_ptr[3 * t + 1] + k] +
+                               vertices_ptr[3 * triangles_ptr[3 * t + 2] + k]) /
+                              3);
+            }
+        }
+        std::tie(num_partitions, partition_ids) =
+                pcapartition::PCAPartition(centers, max_partition_triangles);
+    }
+    const int* partition_ptr = partition_ids.GetDataPtr<int>();
+    const std::vector<std::vector<int>> partition_vertices =
+            decimator.SetPartitions(partition_ptr, num_partitions);
+
+    // Every partition is reduced by the target ratio, except for the
+    // triangles at the seams, which are reduced in the seam pass.
+    std::vector<int64_t> partition_triangles(num_partitions, 0);
+    std::vector<int64_t> partition_seam_triangles(num_partitions, 0);
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        ++partition_triangles[partition_ptr[t]];
+        partition_seam_triangles[partition_ptr[t]] +=
+                decimator.IsSeamTriangle(t);
+    }
+    const double ratio = double(target_number_of_triangles) / num_triangles;
+
+    std::vector<int64_t> remaining_triangles(num_partitions);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int p = 0; p < num_partitions; ++p) {
+        const int64_t num_inner =
+                partition_triangles[p] - partition_seam_triangles[p];
+        const int64_t target =
+                num_partitions == 1
+                        ? target_number_of_triangles
+                        : partition_seam_triangles[p] +
+                                  int64_t(std::ceil(ratio * num_inner));
+        EdgeQueue queue(std::greater<CostEdge>(),
+                        decimator.CollectEdges(partition_vertices[p], p));
+        remaining_triangles[p] =
+                decimator.Run(queue, p, partition_triangles[p], target);
+    }
+    int64_t num_remaining = 0;
+    for (int64_t n : remaining_triangles) {
+        num_remaining += n;
+    }
+
+    if (num_partitions > 1) {
+        // Seam pass with all vertices unlocked. The queue contains all
+        // remaining edges, such that the edges at the seams compete with the
+        // remaining edges inside the partitions.
+        utility::LogDebug(
+                "[SimplifyQuadricDecimation] {} partitions, {} seam vertices, "
+                "{} triangles before the seam pass.",
+                num_partitions, partition_vertices.back().size(),
+                num_remaining);
+        std::vector<int> all_vertices(num_vertices);
+        std::iota(all_vertices.begin(), all_vertices.end(), 0);
+        EdgeQueue queue(std::greater<CostEdge>(),
+                        decimator.CollectEdges(all_vertices, -1));
+        decimator.Run(queue, -1, num_remaining, target_number_of_triangles);
+    }
+
+    decimator.Compact(out_vertices, out_triangles, out_vertex_attrs);
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -81,27 +81,73 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
     }
 }
 
-#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(WEIGHT_DTYPE, COLOR_DTYPE, ...)    \
+#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(TSDF_DTYPE, WEIGHT_DTYPE,          \
+                                         COLOR_DTYPE, ...)                  \
     [&] {                                                                   \
-        if (WEIGHT_DTYPE == open3d::core::Float32 &&                        \
+        if (TSDF_DTYPE == open3d::core::Float32 &&                          \
+            WEIGHT_DTYPE == open3d::core::Float32 &&                        \
             COLOR_DTYPE == open3d::core::Float32) {                         \
+            using tsdf_t = float;                                           \
             using weight_t = float;                                         \
             using color_t = float;                                          \
             return __VA_ARGS__();                                           \
-        } else if (WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
+        } else if (TSDF_DTYPE == open3d::core::Float32 &&                   \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
                    COLOR_DTYPE == open3d::core::UInt16) {                   \
+            using tsdf_t = float;                                           \
             using weight_t = uint16_t;                                      \
             using color_t = uint16_t;                                       \
             return __VA_ARGS__();                                           \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                     \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
+                   COLOR_DTYPE == open3d::core::UInt8) {                    \
+            using tsdf_t = int16_t;                                         \
+            using weight_t = uint16_t;                                      \
+            using color_t = uint8_t;                                        \
+            return __VA_ARGS__();                                           \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                     \
+                   WEIGHT_DTYPE == open3d::core::UInt8 &&                   \
+                   COLOR_DTYPE == open3d::core::UInt8) {                    \
+            using tsdf_t = int16_t;                                         \
+            using weight_t = uint8_t;                                       \
+            using color_t = uint8_t;                                        \
+            return __VA_ARGS__();                                           \
         } else {                                                            \
             utility::LogError(                                              \
                     "Unsupported value data type combination. Expected "    \
-                    "(float, float) or (uint16, uint16), but received ({} " \
-                    "{}).",                                                 \
-                    WEIGHT_DTYPE.ToString(), COLOR_DTYPE.ToString());       \
+                    "(float, float, float), (float, uint16, uint16), "      \
+                    "(int16, uint16, uint8) or (int16, uint8, uint8), but " \
+                    "received ({} {} {}).",                                 \
+                    TSDF_DTYPE.ToString(), WEIGHT_DTYPE.ToString(),         \
+                    COLOR_DTYPE.ToString());                                \
         }                                                                   \
     }()
 
+/// Value dtypes of the blocks. Without colors, the color dtype of the
+/// supported combination with the tsdf and weight dtypes is used.
+static void GetValueDtypes(const TensorMap& block_value_map,
+                           core::Dtype& tsdf_dtype,
+                           core::Dtype& weight_dtype,
+                           core::Dtype& color_dtype) {
+    tsdf_dtype = core::Float32;
+    weight_dtype = core::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
+    if (block_value_map.Contains("weight")) {
+        weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        color_dtype = block_value_map.at("color").GetDtype();
+    } else if (tsdf_dtype == core::Int16) {
+        color_dtype = core::UInt8;
+    } else if (weight_dtype == core::UInt16) {
+        color_dtype = core::UInt16;
+    } else {
+        color_dtype = core::Float32;
+    }
+}
+
 #define DISPATCH_INPUT_DTYPE_TO_TEMPLATE(DEPTH_DTYPE, COLOR_DTYPE, ...)        \
     [&] {                                                                      \
         if (DEPTH_DTYPE == open3d::core::Float32 &&                            \
@@ -135,15 +181,9 @@ void Integrate(const core::Tensor& depth,
                float sdf_trunc,
                float depth_scale,
                float depth_max) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     core::Dtype input_depth_dtype = depth.GetDtype();
     core::Dtype input_color_dtype = (input_depth_dtype == core::Dtype::Float32)
@@ -157,7 +197,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCPU<input_depth_t, input_color_t,
                                              tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -172,7 +213,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCUDA<input_depth_t, input_color_t,
                                               tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -225,6 +267,7 @@ void EstimateRange(const core::Tensor& block_keys,
 
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              const TensorMap& block_value_map,
+             const core::Tensor& block_keys,
              const core::Tensor& range_map,
              TensorMap& renderings_map,
              const core::Tensor& intrinsic,
@@ -239,37 +282,31 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              float weight_threshold,
              float trunc_voxel_multiplier,
              int range_map_down_factor) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (hashmap->IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCPU<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, depth_scale, depth_min, depth_max,
-                            weight_threshold, trunc_voxel_multiplier,
-                            range_map_down_factor);
+                            hashmap, block_value_map, block_keys, range_map,
+                            renderings_map, intrinsic, extrinsic, h, w,
+                            block_resolution, voxel_size, depth_scale,
+                            depth_min, depth_max, weight_threshold,
+                            trunc_voxel_multiplier, range_map_down_factor);
                 });
 
     } else if (hashmap->IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCUDA<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, depth_scale, depth_min, depth_max,
-                            weight_threshold, trunc_voxel_multiplier,
-                            range_map_down_factor);
+                            hashmap, block_value_map, block_keys, range_map,
+                            renderings_map, intrinsic, extrinsic, h, w,
+                            block_resolution, voxel_size, depth_scale,
+                            depth_min, depth_max, weight_threshold,
+                            trunc_voxel_multiplier, range_map_down_factor);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -291,19 +328,13 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float voxel_size,
                        float weight_threshold,
                        int& valid_size) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (block_indices.IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCPU<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -314,7 +345,7 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     } else if (block_indices.IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -337,40 +368,38 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
+                         core::Tensor& triangle_block_indices,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         index_t num_surface_blocks,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
                          int& vertex_count) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (block_indices.IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCPU<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
+                            vertices, triangles, triangle_block_indices,
+                            vertex_normals, vertex_colors, num_surface_blocks,
                             block_resolution, voxel_size, weight_threshold,
                             vertex_count);
                 });
     } else if (block_indices.IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
+                            vertices, triangles, triangle_block_indices,
+                            vertex_normals, vertex_colors, num_surface_blocks,
                             block_resolution, voxel_size, weight_threshold,
                             vertex_count);
                 });
@@ -76,6 +76,7 @@ void EstimateRange(const core::Tensor& block_keys,
 
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              const TensorMap& block_value_map,
+             const core::Tensor& block_keys,
              const core::Tensor& range_map,
              TensorMap& renderings_map,
              const core::Tensor& intrinsic,
@@ -112,8 +113,10 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
+                         core::Tensor& triangle_block_indices,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         index_t num_surface_blocks,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
@@ -181,6 +184,7 @@ void EstimateRangeCPU(const core::Tensor& block_keys,
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCPU(std::shared_ptr<core::HashMap>& hashmap,
                 const TensorMap& block_value_map,
+                const core::Tensor& block_keys,
                 const core::Tensor& range_map,
                 TensorMap& renderings_map,
                 const core::Tensor& intrinsic,
@@ -219,8 +223,10 @@ void ExtractTriangleMeshCPU(const core::Tensor& block_indices,
                             const TensorMap& block_value_map,
                             core::Tensor& vertices,
                             core::Tensor& triangles,
+                            core::Tensor& triangle_block_indices,
                             core::Tensor& vertex_normals,
                             core::Tensor& vertex_colors,
+                            index_t num_surface_blocks,
                             index_t block_resolution,
                             float voxel_size,
                             float weight_threshold,
@@ -288,6 +294,7 @@ void EstimateRangeCUDA(const core::Tensor& block_keys,
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCUDA(std::shared_ptr<core::HashMap>& hashmap,
                  const TensorMap& block_value_map,
+                 const core::Tensor& block_keys,
                  const core::Tensor& range_map,
                  TensorMap& renderings_map,
                  const core::Tensor& intrinsic,
@@ -326,8 +333,10 @@ void ExtractTriangleMeshCUDA(const core::Tensor& block_indices,
                              const TensorMap& block_value_map,
                              core::Tensor& vertices,
                              core::Tensor& triangles,
+                             core::Tensor& triangle_block_indices,
                              core::Tensor& vertex_normals,
                              core::Tensor& vertex_colors,
+                             index_t num_surface_blocks,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
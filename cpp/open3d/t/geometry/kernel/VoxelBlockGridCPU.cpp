@@ -216,20 +216,30 @@ template void IntegrateCPU<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCPU<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<float, float, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
     std::shared_ptr<core::HashMap> &hashmap, const TensorMap &block_value_map, \
-            const core::Tensor &range_map, TensorMap &renderings_map,          \
-            const core::Tensor &intrinsic, const core::Tensor &extrinsic,      \
-            index_t h, index_t w, index_t block_resolution, float voxel_size,  \
-            float depth_scale, float depth_min, float depth_max,               \
-            float weight_threshold, float trunc_voxel_multiplier,              \
-            int range_map_down_factor
+            const core::Tensor &block_keys, const core::Tensor &range_map,     \
+            TensorMap &renderings_map, const core::Tensor &intrinsic,          \
+            const core::Tensor &extrinsic, index_t h, index_t w,               \
+            index_t block_resolution, float voxel_size, float depth_scale,     \
+            float depth_min, float depth_max, float weight_threshold,          \
+            float trunc_voxel_multiplier, int range_map_down_factor
 
 template void RayCastCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
+template void RayCastCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void RayCastCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -243,6 +253,8 @@ template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -252,12 +264,15 @@ template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
             const core::Tensor &nb_block_masks,                               \
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
+            core::Tensor &triangle_block_indices,                             \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            index_t num_surface_blocks, index_t block_resolution,             \
+            float voxel_size, float weight_threshold, index_t &vertex_count
 
 template void ExtractTriangleMeshCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -242,20 +242,30 @@ template void IntegrateCUDA<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
     std::shared_ptr<core::HashMap> &hashmap, const TensorMap &block_value_map, \
-            const core::Tensor &range_map, TensorMap &renderings_map,          \
-            const core::Tensor &intrinsic, const core::Tensor &extrinsic,      \
-            index_t h, index_t w, index_t block_resolution, float voxel_size,  \
-            float depth_scale, float depth_min, float depth_max,               \
-            float weight_threshold, float trunc_voxel_multiplier,              \
-            int range_map_down_factor
+            const core::Tensor &block_keys, const core::Tensor &range_map,     \
+            TensorMap &renderings_map, const core::Tensor &intrinsic,          \
+            const core::Tensor &extrinsic, index_t h, index_t w,               \
+            index_t block_resolution, float voxel_size, float depth_scale,     \
+            float depth_min, float depth_max, float weight_threshold,          \
+            float trunc_voxel_multiplier, int range_map_down_factor
 
 template void RayCastCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -269,6 +279,8 @@ template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -280,8 +292,10 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
                              const std::vector<core::Tensor> &block_values,
                              core::Tensor &vertices,
                              core::Tensor &triangles,
+                             core::Tensor &triangle_block_indices,
                              core::Tensor &vertex_normals,
                              core::Tensor &vertex_colors,
+                             index_t num_surface_blocks,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
@@ -293,12 +307,15 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
             const core::Tensor &nb_block_masks,                               \
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
+            core::Tensor &triangle_block_indices,                             \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            index_t num_surface_blocks, index_t block_resolution,             \
+            float voxel_size, float weight_threshold, index_t &vertex_count
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -5,8 +5,11 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -30,6 +33,39 @@ namespace voxel_grid {
 using index_t = int;
 using ArrayIndexer = TArrayIndexer<index_t>;
 
+// Voxel value codecs. TSDF values are normalized by the truncation distance
+// to [-1, 1] and stored as float or as int16 scaled by 32767. Weights and
+// colors (in [0, 255]) keep their units, integer storage rounds and
+// saturates.
+inline OPEN3D_HOST_DEVICE float DecodeTSDF(float tsdf) { return tsdf; }
+
+inline OPEN3D_HOST_DEVICE float DecodeTSDF(int16_t tsdf) {
+    return static_cast<float>(tsdf) * (1.0f / 32767.0f);
+}
+
+inline OPEN3D_HOST_DEVICE void EncodeTSDF(float tsdf, float* tsdf_ptr) {
+    *tsdf_ptr = tsdf;
+}
+
+inline OPEN3D_HOST_DEVICE void EncodeTSDF(float tsdf, int16_t* tsdf_ptr) {
+    tsdf = tsdf < -1.0f ? -1.0f : (tsdf > 1.0f ? 1.0f : tsdf);
+    *tsdf_ptr = static_cast<int16_t>(roundf(tsdf * 32767.0f));
+}
+
+inline OPEN3D_HOST_DEVICE void EncodeValue(float value, float* value_ptr) {
+    *value_ptr = value;
+}
+
+inline OPEN3D_HOST_DEVICE void EncodeValue(float value, uint16_t* value_ptr) {
+    value = value < 0.0f ? 0.0f : (value > 65535.0f ? 65535.0f : value);
+    *value_ptr = static_cast<uint16_t>(value + 0.5f);
+}
+
+inline OPEN3D_HOST_DEVICE void EncodeValue(float value, uint8_t* value_ptr) {
+    value = value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value);
+    *value_ptr = static_cast<uint8_t>(value + 0.5f);
+}
+
 #if defined(__CUDACC__)
 void GetVoxelCoordinatesAndFlattenedIndicesCUDA
 #else
@@ -131,9 +167,12 @@ inline OPEN3D_DEVICE void DeviceGetNormal(
     index_t vyn = GetLinearIdx(xo, yo - 1, zo);
     index_t vzp = GetLinearIdx(xo, yo, zo + 1);
     index_t vzn = GetLinearIdx(xo, yo, zo - 1);
-    if (vxp >= 0 && vxn >= 0) n[0] = tsdf_base_ptr[vxp] - tsdf_base_ptr[vxn];
-    if (vyp >= 0 && vyn >= 0) n[1] = tsdf_base_ptr[vyp] - tsdf_base_ptr[vyn];
-    if (vzp >= 0 && vzn >= 0) n[2] = tsdf_base_ptr[vzp] - tsdf_base_ptr[vzn];
+    auto GetTSDF = [&] OPEN3D_DEVICE(index_t linear_idx) -> float {
+        return DecodeTSDF(tsdf_base_ptr[linear_idx]);
+    };
+    if (vxp >= 0 && vxn >= 0) n[0] = GetTSDF(vxp) - GetTSDF(vxn);
+    if (vyp >= 0 && vyn >= 0) n[1] = GetTSDF(vyp) - GetTSDF(vyn);
+    if (vzp >= 0 && vzn >= 0) n[2] = GetTSDF(vzp) - GetTSDF(vzn);
 };
 
 template <typename input_depth_t,
@@ -257,9 +296,10 @@ void IntegrateCPU
         tsdf_t* tsdf_ptr = tsdf_base_ptr + linear_idx;
         weight_t* weight_ptr = weight_base_ptr + linear_idx;
 
-        float inv_wsum = 1.0f / (*weight_ptr + 1);
         float weight = *weight_ptr;
-        *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
+        float inv_wsum = 1.0f / (weight + 1);
+        EncodeTSDF((weight * DecodeTSDF(*tsdf_ptr) + sdf) * inv_wsum,
+                   tsdf_ptr);
 
         if (integrate_color) {
             color_t* color_ptr = color_base_ptr + 3 * linear_idx;
@@ -279,13 +319,14 @@ void IntegrateCPU
                         color_indexer.GetDataPtr<input_color_t>(ui, vi);
 
                 for (index_t i = 0; i < 3; ++i) {
-                    color_ptr[i] = (weight * color_ptr[i] +
-                                    input_color_ptr[i] * color_multiplier) *
-                                   inv_wsum;
+                    EncodeValue((weight * color_ptr[i] +
+                                 input_color_ptr[i] * color_multiplier) *
+                                        inv_wsum,
+                                color_ptr + i);
                 }
             }
         }
-        *weight_ptr = weight + 1;
+        EncodeValue(weight + 1, weight_ptr);
     });
 
 #if defined(__CUDACC__)
@@ -313,9 +354,10 @@ void EstimateRangeCPU
 
     // TODO(wei): reserve it in a reusable buffer
 
-    // Every 2 channels: (min, max)
-    int h_down = h / down_factor;
-    int w_down = w / down_factor;
+    // Every 2 channels: (min, max). Rounded up so that every pixel has a
+    // range when the image size is not a multiple of down_factor.
+    int h_down = (h + down_factor - 1) / down_factor;
+    int w_down = (w + down_factor - 1) / down_factor;
     range_minmax_map = core::Tensor({h_down, w_down, 2}, core::Float32,
                                     block_keys.GetDevice());
     NDArrayIndexer range_map_indexer(range_minmax_map, 2);
@@ -327,130 +369,144 @@ void EstimateRangeCPU
         fragment_buffer.NumElements() == 0) {
         // Rough heuristic; should tend to overallocate
         const int reserve_frag_buffer_size =
-                h_down * w_down / (fragment_size * fragment_size) / voxel_size;
+                static_cast<int>(h_down * w_down /
+                                 float(fragment_size * fragment_size) /
+                                 voxel_size) +
+                1;
         fragment_buffer = core::Tensor({reserve_frag_buffer_size, 6},
                                        core::Float32, block_keys.GetDevice());
     }
 
-    const int frag_buffer_size = fragment_buffer.NumElements() / 6;
-
-    NDArrayIndexer frag_buffer_indexer(fragment_buffer, 1);
     NDArrayIndexer block_keys_indexer(block_keys, 1);
     TransformIndexer w2c_transform_indexer(intrinsics, extrinsics);
-#if defined(__CUDACC__)
-    core::Tensor count(std::vector<int>{0}, {1}, core::Int32,
-                       block_keys.GetDevice());
-    int* count_ptr = count.GetDataPtr<int>();
-#else
-    std::atomic<int> count_atomic(0);
-    std::atomic<int>* count_ptr = &count_atomic;
-#endif
 
 #ifndef __CUDACC__
     using std::max;
     using std::min;
 #endif
 
-    // Pass 0: iterate over blocks, fill-in an rendering fragment array
-    core::ParallelFor(
-            block_keys.GetDevice(), block_keys.GetLength(),
-            [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                int* key = block_keys_indexer.GetDataPtr<int>(workload_idx);
-
-                int u_min = w_down - 1, v_min = h_down - 1, u_max = 0,
-                    v_max = 0;
-                float z_min = depth_max, z_max = depth_min;
-
-                float xc, yc, zc, u, v;
-
-                // Project 8 corners to low-res image and form a rectangle
-                for (int i = 0; i < 8; ++i) {
-                    float xw = (key[0] + ((i & 1) > 0)) * block_resolution *
-                               voxel_size;
-                    float yw = (key[1] + ((i & 2) > 0)) * block_resolution *
-                               voxel_size;
-                    float zw = (key[2] + ((i & 4) > 0)) * block_resolution *
-                               voxel_size;
-
-                    w2c_transform_indexer.RigidTransform(xw, yw, zw, &xc, &yc,
-                                                         &zc);
-                    if (zc <= 0) continue;
-
-                    // Project to the down sampled image buffer
-                    w2c_transform_indexer.Project(xc, yc, zc, &u, &v);
-                    u /= down_factor;
-                    v /= down_factor;
-
-                    v_min = min(static_cast<int>(floorf(v)), v_min);
-                    v_max = max(static_cast<int>(ceilf(v)), v_max);
-
-                    u_min = min(static_cast<int>(floorf(u)), u_min);
-                    u_max = max(static_cast<int>(ceilf(u)), u_max);
-
-                    z_min = min(z_min, zc);
-                    z_max = max(z_max, zc);
-                }
+    // Pass 0: iterate over blocks, fill-in an rendering fragment array. If
+    // the fragment buffer is too small, it is reallocated to the number of
+    // fragments and the pass is repeated once, so that the range map is
+    // complete.
+    int frag_buffer_size = 0;
+    int frag_count = 0;
+    NDArrayIndexer frag_buffer_indexer;
+    while (true) {
+        frag_buffer_size = fragment_buffer.NumElements() / 6;
+        frag_buffer_indexer = NDArrayIndexer(fragment_buffer, 1);
+#if defined(__CUDACC__)
+        core::Tensor count(std::vector<int>{0}, {1}, core::Int32,
+                           block_keys.GetDevice());
+        int* count_ptr = count.GetDataPtr<int>();
+#else
+        std::atomic<int> count_atomic(0);
+        std::atomic<int>* count_ptr = &count_atomic;
+#endif
 
-                v_min = max(0, v_min);
-                v_max = min(h_down - 1, v_max);
+        core::ParallelFor(
+                block_keys.GetDevice(), block_keys.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int* key =
+                            block_keys_indexer.GetDataPtr<int>(workload_idx);
+
+                    int u_min = w_down - 1, v_min = h_down - 1, u_max = 0,
+                        v_max = 0;
+                    float z_min = depth_max, z_max = depth_min;
+
+                    float xc, yc, zc, u, v;
+
+                    // Project 8 corners to low-res image and form a
+                    // rectangle
+                    for (int i = 0; i < 8; ++i) {
+                        float xw = (key[0] + ((i & 1) > 0)) *
+                                   block_resolution * voxel_size;
+                        float yw = (key[1] + ((i & 2) > 0)) *
+                                   block_resolution * voxel_size;
+                        float zw = (key[2] + ((i & 4) > 0)) *
+                                   block_resolution * voxel_size;
+
+                        w2c_transform_indexer.RigidTransform(xw, yw, zw, &xc,
+                                                             &yc, &zc);
+                        if (zc <= 0) continue;
+
+                        // Project to the down sampled image buffer
+                        w2c_transform_indexer.Project(xc, yc, zc, &u, &v);
+                        u /= down_factor;
+                        v /= down_factor;
+
+                        v_min = min(static_cast<int>(floorf(v)), v_min);
+                        v_max = max(static_cast<int>(ceilf(v)), v_max);
+
+                        u_min = min(static_cast<int>(floorf(u)), u_min);
+                        u_max = max(static_cast<int>(ceilf(u)), u_max);
+
+                        z_min = min(z_min, zc);
+                        z_max = max(z_max, zc);
+                    }
 
-                u_min = max(0, u_min);
-                u_max = min(w_down - 1, u_max);
+                    v_min = max(0, v_min);
+                    v_max = min(h_down - 1, v_max);
 
-                if (v_min >= v_max || u_min >= u_max || z_min >= z_max) return;
+                    u_min = max(0, u_min);
+                    u_max = min(w_down - 1, u_max);
 
-                // Divide the rectangle into small 16x16 fragments
-                int frag_v_count =
-                        ceilf(float(v_max - v_min + 1) / float(fragment_size));
-                int frag_u_count =
-                        ceilf(float(u_max - u_min + 1) / float(fragment_size));
+                    if (v_min >= v_max || u_min >= u_max || z_min >= z_max) {
+                        return;
+                    }
 
-                int frag_count = frag_v_count * frag_u_count;
-                int frag_count_start = OPEN3D_ATOMIC_ADD(count_ptr, frag_count);
-                int frag_count_end = frag_count_start + frag_count;
-                if (frag_count_end >= frag_buffer_size) {
-                    return;
-                }
+                    // Divide the rectangle into small 16x16 fragments
+                    int frag_v_count = ceilf(float(v_max - v_min + 1) /
+                                             float(fragment_size));
+                    int frag_u_count = ceilf(float(u_max - u_min + 1) /
+                                             float(fragment_size));
+
+                    int frag_count = frag_v_count * frag_u_count;
+                    int frag_count_start =
+                            OPEN3D_ATOMIC_ADD(count_ptr, frag_count);
+                    int frag_count_end = frag_count_start + frag_count;
+                    if (frag_count_end >= frag_buffer_size) {
+                        return;
+                    }
 
-                int offset = 0;
-                for (int frag_v = 0; frag_v < frag_v_count; ++frag_v) {
-                    for (int frag_u = 0; frag_u < frag_u_count;
-                         ++frag_u, ++offset) {
-                        float* frag_ptr = frag_buffer_indexer.GetDataPtr<float>(
-                                frag_count_start + offset);
-                        // zmin, zmax
-                        frag_ptr[0] = z_min;
-                        frag_ptr[1] = z_max;
-
-                        // vmin, umin
-                        frag_ptr[2] = v_min + frag_v * fragment_size;
-                        frag_ptr[3] = u_min + frag_u * fragment_size;
-
-                        // vmax, umax
-                        frag_ptr[4] = min(frag_ptr[2] + fragment_size - 1,
-                                          static_cast<float>(v_max));
-                        frag_ptr[5] = min(frag_ptr[3] + fragment_size - 1,
-                                          static_cast<float>(u_max));
+                    int offset = 0;
+                    for (int frag_v = 0; frag_v < frag_v_count; ++frag_v) {
+                        for (int frag_u = 0; frag_u < frag_u_count;
+                             ++frag_u, ++offset) {
+                            float* frag_ptr =
+                                    frag_buffer_indexer.GetDataPtr<float>(
+                                            frag_count_start + offset);
+                            // zmin, zmax
+                            frag_ptr[0] = z_min;
+                            frag_ptr[1] = z_max;
+
+                            // vmin, umin
+                            frag_ptr[2] = v_min + frag_v * fragment_size;
+                            frag_ptr[3] = u_min + frag_u * fragment_size;
+
+                            // vmax, umax
+                            frag_ptr[4] = min(frag_ptr[2] + fragment_size - 1,
+                                              static_cast<float>(v_max));
+                            frag_ptr[5] = min(frag_ptr[3] + fragment_size - 1,
+                                              static_cast<float>(u_max));
+                        }
                     }
-                }
-            });
+                });
 #if defined(__CUDACC__)
-    int needed_frag_count = count[0].Item<int>();
+        frag_count = count[0].Item<int>();
 #else
-    int needed_frag_count = (*count_ptr).load();
+        frag_count = (*count_ptr).load();
 #endif
+        if (frag_count < frag_buffer_size) break;
 
-    int frag_count = needed_frag_count;
-    if (frag_count >= frag_buffer_size) {
-        utility::LogWarning(
-                "Could not generate full range map; allocated {} fragments but "
-                "needed {}",
-                frag_buffer_size, frag_count);
-        frag_count = frag_buffer_size - 1;
-    } else {
-        utility::LogDebug("EstimateRange Allocated {} fragments and needed {}",
-                          frag_buffer_size, frag_count);
+        utility::LogDebug(
+                "Reallocating {} fragments for EstimateRange (was {})",
+                frag_count + 1, frag_buffer_size);
+        fragment_buffer = core::Tensor({frag_count + 1, 6}, core::Float32,
+                                       block_keys.GetDevice());
     }
+    utility::LogDebug("EstimateRange Allocated {} fragments and needed {}",
+                      frag_buffer_size, frag_count);
 
     // Pass 0.5: Fill in range map to prepare for atomic min/max
     core::ParallelFor(block_keys.GetDevice(), h_down * w_down,
@@ -501,14 +557,6 @@ void EstimateRangeCPU
 #if defined(__CUDACC__)
     core::cuda::Synchronize();
 #endif
-
-    if (needed_frag_count != frag_count) {
-        utility::LogInfo("Reallocating {} fragments for EstimateRange (was {})",
-                         needed_frag_count, frag_count);
-
-        fragment_buffer = core::Tensor({needed_frag_count, 6}, core::Float32,
-                                       block_keys.GetDevice());
-    }
 }
 
 struct MiniVecCache {
@@ -532,6 +580,216 @@ struct MiniVecCache {
     }
 };
 
+#if !defined(__CUDACC__)
+/// Occupancy of the ray cast blocks of a CPU hash map for empty space
+/// skipping. The ray cast blocks are looked up in a dense grid of buffer
+/// indices over their bounding box if the box is small enough, the other
+/// blocks in the hash map. A coarse bitmap marks the super blocks of
+/// 2^coarse_shift blocks per axis that contain ray cast blocks, so that rays
+/// cross empty super blocks in a single step. The grid is built from the ray
+/// cast blocks only, such that its cost does not grow with the hash map.
+template <typename HashMapImpl>
+class BlockOccupancyGrid {
+public:
+    /// \p block_keys are the keys of the \p num_blocks ray cast blocks and
+    /// \p buf_indices their buffer indices, valid where \p masks is true.
+    BlockOccupancyGrid(const HashMapImpl* hashmap_impl,
+                       const index_t* block_keys,
+                       const index_t* buf_indices,
+                       const bool* masks,
+                       int64_t num_blocks,
+                       float block_size)
+        : hashmap_impl_(hashmap_impl), block_size_(block_size) {
+        index_t max_key[3];
+        for (int i = 0; i < 3; ++i) {
+            min_key_[i] = std::numeric_limits<index_t>::max();
+            max_key[i] = std::numeric_limits<index_t>::lowest();
+        }
+        bool empty = true;
+        for (int64_t k = 0; k < num_blocks; ++k) {
+            if (!masks[k]) continue;
+            empty = false;
+            for (int i = 0; i < 3; ++i) {
+                min_key_[i] = std::min(min_key_[i], block_keys[3 * k + i]);
+                max_key[i] = std::max(max_key[i], block_keys[3 * k + i]);
+            }
+        }
+        if (empty) {
+            for (int i = 0; i < 3; ++i) {
+                min_key_[i] = 0;
+                max_key[i] = -1;
+            }
+        }
+
+        int64_t num_grid_blocks = 1;
+        for (int i = 0; i < 3; ++i) {
+            dims_[i] = static_cast<int64_t>(max_key[i]) - min_key_[i] + 1;
+            num_grid_blocks *= dims_[i];
+        }
+        int64_t num_coarse_blocks = num_grid_blocks;
+        do {
+            ++coarse_shift_;
+            num_coarse_blocks = 1;
+            for (int i = 0; i < 3; ++i) {
+                coarse_dims_[i] = (dims_[i] >> coarse_shift_) + 1;
+                num_coarse_blocks *= coarse_dims_[i];
+            }
+        } while (coarse_shift_ < kMinCoarseShift ||
+                 num_coarse_blocks > kMaxDenseBlocks);
+        coarse_bits_.resize((num_coarse_blocks + 63) / 64, 0);
+
+        if (num_grid_blocks <= kMaxDenseBlocks) {
+            block_buf_indices_.resize(num_grid_blocks, -1);
+        }
+        for (int64_t k = 0; k < num_blocks; ++k) {
+            if (!masks[k]) continue;
+            int64_t b[3];
+            for (int i = 0; i < 3; ++i) {
+                b[i] = static_cast<int64_t>(block_keys[3 * k + i]) -
+                       min_key_[i];
+            }
+            const int64_t coarse_idx = CoarseIndex(b);
+            coarse_bits_[coarse_idx / 64] |= uint64_t(1) << (coarse_idx % 64);
+            if (!block_buf_indices_.empty()) {
+                block_buf_indices_[(b[2] * dims_[1] + b[1]) * dims_[0] +
+                                   b[0]] = buf_indices[k];
+            }
+        }
+    }
+
+    /// Returns the buffer index of the block, or -1 if it is not active.
+    index_t Find(index_t x_b, index_t y_b, index_t z_b) const {
+        if (!block_buf_indices_.empty()) {
+            const int64_t b[3] = {static_cast<int64_t>(x_b) - min_key_[0],
+                                  static_cast<int64_t>(y_b) - min_key_[1],
+                                  static_cast<int64_t>(z_b) - min_key_[2]};
+            if (b[0] >= 0 && b[0] < dims_[0] && b[1] >= 0 &&
+                b[1] < dims_[1] && b[2] >= 0 && b[2] < dims_[2]) {
+                const int64_t idx = (b[2] * dims_[1] + b[1]) * dims_[0] + b[0];
+                if (block_buf_indices_[idx] >= 0) {
+                    return block_buf_indices_[idx];
+                }
+            }
+        }
+        auto iter = hashmap_impl_->find(Key(x_b, y_b, z_b));
+        return iter == hashmap_impl_->end() ? -1 : iter->second;
+    }
+
+    /// Returns the ray parameter after the inactive block at o + t d, where
+    /// the ray leaves the block, its super block if the super block is
+    /// empty, or enters the bounding box if the ray is outside of it. Returns
+    /// infinity if the ray misses the bounding box.
+    float SkipEmpty(float x_o,
+                    float y_o,
+                    float z_o,
+                    float x_d,
+                    float y_d,
+                    float z_d,
+                    float t) const {
+        const float o[3] = {x_o, y_o, z_o};
+        const float d[3] = {x_d, y_d, z_d};
+        // Step a tiny bit further to land inside the next block.
+        const float eps = 1e-4f * block_size_;
+
+        int64_t b[3];
+        bool inside = true;
+        for (int i = 0; i < 3; ++i) {
+            b[i] = static_cast<int64_t>(floorf((o[i] + t * d[i]) /
+                                               block_size_)) -
+                   min_key_[i];
+            inside = inside && b[i] >= 0 && b[i] < dims_[i];
+        }
+
+        int64_t lo[3], hi[3];
+        if (!inside) {
+            for (int i = 0; i < 3; ++i) {
+                lo[i] = 0;
+                hi[i] = dims_[i];
+            }
+            float t_enter, t_exit;
+            IntersectBox(o, d, lo, hi, t_enter, t_exit);
+            if (t_enter > t_exit || t_exit <= t) {
+                return std::numeric_limits<float>::infinity();
+            }
+            return std::max(t_enter, t) + eps;
+        }
+
+        if (IsCoarseBlockActive(b)) {
+            for (int i = 0; i < 3; ++i) {
+                lo[i] = b[i];
+                hi[i] = b[i] + 1;
+            }
+        } else {
+            for (int i = 0; i < 3; ++i) {
+                lo[i] = (b[i] >> coarse_shift_) << coarse_shift_;
+                hi[i] = lo[i] + (int64_t(1) << coarse_shift_);
+            }
+        }
+        float t_enter, t_exit;
+        IntersectBox(o, d, lo, hi, t_enter, t_exit);
+        return std::max(t_exit, t) + eps;
+    }
+
+private:
+    using Key = typename HashMapImpl::key_type;
+
+    /// Coarse blocks are at least 4^3 blocks.
+    static constexpr int kMinCoarseShift = 2;
+    /// Max number of entries of the dense block and coarse block grids.
+    static constexpr int64_t kMaxDenseBlocks = int64_t(1) << 22;
+
+    int64_t CoarseIndex(const int64_t* b) const {
+        return ((b[2] >> coarse_shift_) * coarse_dims_[1] +
+                (b[1] >> coarse_shift_)) *
+                       coarse_dims_[0] +
+               (b[0] >> coarse_shift_);
+    }
+
+    bool IsCoarseBlockActive(const int64_t* b) const {
+        const int64_t coarse_idx = CoarseIndex(b);
+        return (coarse_bits_[coarse_idx / 64] >> (coarse_idx % 64)) & 1;
+    }
+
+    /// Intersects the ray with the box of the blocks [lo, hi) relative to
+    /// min_key_ with the slab method.
+    void IntersectBox(const float* o,
+                      const float* d,
+                      const int64_t* lo,
+                      const int64_t* hi,
+                      float& t_enter,
+                      float& t_exit) const {
+        t_enter = std::numeric_limits<float>::lowest();
+        t_exit = std::numeric_limits<float>::max();
+        for (int i = 0; i < 3; ++i) {
+            const float p_lo = (lo[i] + min_key_[i]) * block_size_;
+            const float p_hi = (hi[i] + min_key_[i]) * block_size_;
+            if (d[i] == 0) {
+                if (o[i] < p_lo || o[i] >= p_hi) {
+                    t_exit = std::numeric_limits<float>::lowest();
+                }
+                continue;
+            }
+            float t0 = (p_lo - o[i]) / d[i];
+            float t1 = (p_hi - o[i]) / d[i];
+            if (t0 > t1) std::swap(t0, t1);
+            t_enter = std::max(t_enter, t0);
+            t_exit = std::min(t_exit, t1);
+        }
+    }
+
+    const HashMapImpl* hashmap_impl_;
+    float block_size_;
+
+    index_t min_key_[3];
+    int64_t dims_[3];
+    int coarse_shift_ = 0;
+    int64_t coarse_dims_[3];
+    std::vector<uint64_t> coarse_bits_;
+    /// Empty if the bounding box is too large for a dense grid.
+    std::vector<index_t> block_buf_indices_;
+};
+#endif
+
 template <typename tsdf_t, typename weight_t, typename color_t>
 #if defined(__CUDACC__)
 void RayCastCUDA
@@ -540,6 +798,7 @@ void RayCastCPU
 #endif
         (std::shared_ptr<core::HashMap>& hashmap,
          const TensorMap& block_value_map,
+         const core::Tensor& block_keys,
          const core::Tensor& range,
          TensorMap& renderings_map,
          const core::Tensor& intrinsic,
@@ -576,7 +835,7 @@ void RayCastCPU
         utility::LogError(
                 "Unsupported backend: CPU raycasting only supports TBB.");
     }
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
+    auto hashmap_impl = cpu_hashmap->GetImpl();
 #endif
 
     core::Device device = hashmap->GetDevice();
@@ -669,7 +928,6 @@ void RayCastCPU
 
     index_t rows = h;
     index_t cols = w;
-    index_t n = rows * cols;
 
     float block_size = voxel_size * block_resolution;
     index_t resolution2 = block_resolution * block_resolution;
@@ -678,9 +936,24 @@ void RayCastCPU
 #ifndef __CUDACC__
     using std::max;
     using std::sqrt;
+
+    // Rays skip the space outside of the ray cast blocks with the occupancy
+    // grid on CPU.
+    core::Tensor block_buf_indices, block_masks;
+    hashmap->Find(block_keys, block_buf_indices, block_masks);
+    BlockOccupancyGrid<typename decltype(hashmap_impl)::element_type>
+            occupancy_grid(hashmap_impl.get(),
+                           block_keys.GetDataPtr<index_t>(),
+                           block_buf_indices.GetDataPtr<index_t>(),
+                           block_masks.GetDataPtr<bool>(),
+                           block_keys.GetLength(), block_size);
+    const auto* occupancy = &occupancy_grid;
 #endif
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+    // Casts the ray of a pixel. The cache of the last block lookup is shared
+    // by the pixels of a tile on CPU.
+    auto ray_cast_pixel = [=] OPEN3D_DEVICE(index_t workload_idx,
+                                            MiniVecCache& cache) {
         auto GetLinearIdxAtP = [&] OPEN3D_DEVICE(
                                        index_t x_b, index_t y_b, index_t z_b,
                                        index_t x_v, index_t y_v, index_t z_v,
@@ -702,9 +975,14 @@ void RayCastCPU
 
                 index_t block_buf_idx = cache.Check(key[0], key[1], key[2]);
                 if (block_buf_idx < 0) {
+#if defined(__CUDACC__)
                     auto iter = hashmap_impl.find(key);
                     if (iter == hashmap_impl.end()) return -1;
                     block_buf_idx = iter->second;
+#else
+                    block_buf_idx = occupancy->Find(key[0], key[1], key[2]);
+                    if (block_buf_idx < 0) return -1;
+#endif
                     cache.Update(key[0], key[1], key[2], block_buf_idx);
                 }
 
@@ -726,12 +1004,16 @@ void RayCastCPU
             index_t y_b = static_cast<index_t>(floorf(y_g / block_size));
             index_t z_b = static_cast<index_t>(floorf(z_g / block_size));
 
-            Key key(x_b, y_b, z_b);
             index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
             if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
+#if defined(__CUDACC__)
+                auto iter = hashmap_impl.find(Key(x_b, y_b, z_b));
                 if (iter == hashmap_impl.end()) return -1;
                 block_buf_idx = iter->second;
+#else
+                block_buf_idx = occupancy->Find(x_b, y_b, z_b);
+                if (block_buf_idx < 0) return -1;
+#endif
                 cache.Update(x_b, y_b, z_b, block_buf_idx);
             }
 
@@ -873,7 +1155,6 @@ void RayCastCPU
         float y_d = (y_g - y_o);
         float z_d = (z_g - z_o);
 
-        MiniVecCache cache{0, 0, 0, -1};
         bool surface_found = false;
         while (t < t_max) {
             index_t linear_idx =
@@ -881,10 +1162,14 @@ void RayCastCPU
 
             if (linear_idx < 0) {
                 t_prev = t;
+#if defined(__CUDACC__)
                 t += block_size;
+#else
+                t = occupancy->SkipEmpty(x_o, y_o, z_o, x_d, y_d, z_d, t);
+#endif
             } else {
                 tsdf_prev = tsdf;
-                tsdf = tsdf_base_ptr[linear_idx];
+                tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
                 w = weight_base_ptr[linear_idx];
                 if (tsdf_prev > 0 && w >= weight_threshold && tsdf <= 0) {
                     surface_found = true;
@@ -924,13 +1209,16 @@ void RayCastCPU
             float y_v = (y_g - float(y_b) * block_size) / voxel_size;
             float z_v = (z_g - float(z_b) * block_size) / voxel_size;
 
-            Key key(x_b, y_b, z_b);
-
             index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
             if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
+#if defined(__CUDACC__)
+                auto iter = hashmap_impl.find(Key(x_b, y_b, z_b));
                 if (iter == hashmap_impl.end()) return;
                 block_buf_idx = iter->second;
+#else
+                block_buf_idx = occupancy->Find(x_b, y_b, z_b);
+                if (block_buf_idx < 0) return;
+#endif
                 cache.Update(x_b, y_b, z_b, block_buf_idx);
             }
 
@@ -968,7 +1256,7 @@ void RayCastCPU
                         index_ptr[k] = linear_idx_k;
                     }
 
-                    float tsdf_k = tsdf_base_ptr[linear_idx_k];
+                    float tsdf_k = DecodeTSDF(tsdf_base_ptr[linear_idx_k]);
                     float interp_ratio_dx = ry * rz * (2 * dx_v - 1);
                     float interp_ratio_dy = rx * rz * (2 * dy_v - 1);
                     float interp_ratio_dz = rx * ry * (2 * dz_v - 1);
@@ -1024,10 +1312,33 @@ void RayCastCPU
                 }
             }
         }  // surface-found
-    });
+    };
 
 #if defined(__CUDACC__)
+    core::ParallelFor(device, rows * cols,
+                      [=] OPEN3D_DEVICE(index_t workload_idx) {
+                          MiniVecCache cache{0, 0, 0, -1};
+                          ray_cast_pixel(workload_idx, cache);
+                      });
     core::cuda::Synchronize();
+#else
+    // Neighboring rays mostly visit the same blocks, so each thread casts the
+    // rays of a tile of pixels.
+    constexpr index_t kTileSize = 8;
+    const index_t tile_rows = (rows + kTileSize - 1) / kTileSize;
+    const index_t tile_cols = (cols + kTileSize - 1) / kTileSize;
+    core::ParallelFor(device, tile_rows * tile_cols, [&](index_t tile_idx) {
+        const index_t y0 = (tile_idx / tile_cols) * kTileSize;
+        const index_t x0 = (tile_idx % tile_cols) * kTileSize;
+        const index_t y1 = std::min(y0 + kTileSize, rows);
+        const index_t x1 = std::min(x0 + kTileSize, cols);
+        MiniVecCache cache{0, 0, 0, -1};
+        for (index_t y = y0; y < y1; ++y) {
+            for (index_t x = x0; x < x1; ++x) {
+                ray_cast_pixel(y * cols + x, cache);
+            }
+        }
+    });
 #endif
 }
 
@@ -1120,7 +1431,7 @@ void ExtractPointCloudCPU
             voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
             index_t linear_idx = block_idx * resolution3 + voxel_idx;
-            float tsdf_o = tsdf_base_ptr[linear_idx];
+            float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
             float weight_o = weight_base_ptr[linear_idx];
             if (weight_o <= weight_threshold) return;
 
@@ -1131,7 +1442,7 @@ void ExtractPointCloudCPU
                                      zv + (i == 2), workload_block_idx);
                 if (linear_idx_i < 0) continue;
 
-                float tsdf_i = tsdf_base_ptr[linear_idx_i];
+                float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
                 float weight_i = weight_base_ptr[linear_idx_i];
                 if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                     OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1201,7 +1512,7 @@ void ExtractPointCloudCPU
         voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
         float weight_o = weight_base_ptr[linear_idx];
         if (weight_o <= weight_threshold) return;
 
@@ -1221,7 +1532,7 @@ void ExtractPointCloudCPU
                                  workload_block_idx);
             if (linear_idx_i < 0) continue;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                 float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
@@ -1302,8 +1613,10 @@ void ExtractTriangleMeshCPU
          const TensorMap& block_value_map,
          core::Tensor& vertices,
          core::Tensor& triangles,
+         core::Tensor& triangle_block_indices,
          core::Tensor& vertex_normals,
          core::Tensor& vertex_colors,
+         index_t num_surface_blocks,
          index_t block_resolution,
          float voxel_size,
          float weight_threshold,
@@ -1359,10 +1672,17 @@ void ExtractTriangleMeshCPU
     }
 
     index_t n = n_blocks * resolution3;
+    // Only the cubes of the first num_surface_blocks blocks are triangulated.
+    // The remaining blocks only hold the vertices on their edges, so they
+    // must include all the active blocks in the positive directions.
+    if (num_surface_blocks < 0 || num_surface_blocks > n_blocks) {
+        num_surface_blocks = n_blocks;
+    }
+    index_t n_surface = num_surface_blocks * resolution3;
     // Pass 0: analyze mesh structure, set up one-on-one correspondences
     // from edges to vertices.
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_surface, [=] OPEN3D_DEVICE(index_t widx) {
         auto GetLinearIdx = [&] OPEN3D_DEVICE(
                                     index_t xo, index_t yo, index_t zo,
                                     index_t curr_block_idx) -> index_t {
@@ -1389,7 +1709,7 @@ void ExtractTriangleMeshCPU
                                  zv + vtx_shifts[i][2], workload_block_idx);
             if (linear_idx_i < 0) return;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i <= weight_threshold) return;
 
@@ -1553,7 +1873,7 @@ void ExtractTriangleMeshCPU
 
         // Obtain voxel ptr
         index_t linear_idx = resolution3 * block_idx + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
 
         float no[3] = {0}, ne[3] = {0};
 
@@ -1568,9 +1888,9 @@ void ExtractTriangleMeshCPU
             index_t linear_idx_e =
                     GetLinearIdx(xv + (e == 0), yv + (e == 1), zv + (e == 2),
                                  workload_block_idx);
-            OPEN3D_ASSERT(linear_idx_e > 0 &&
+            OPEN3D_ASSERT(linear_idx_e >= 0 &&
                           "Internal error: GetVoxelAt returns nullptr.");
-            float tsdf_e = tsdf_base_ptr[linear_idx_e];
+            float tsdf_e = DecodeTSDF(tsdf_base_ptr[linear_idx_e]);
             float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
             index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1619,6 +1939,10 @@ void ExtractTriangleMeshCPU
     index_t triangle_count = vertex_count * 3;
     triangles = core::Tensor({triangle_count, 3}, core::Int32, device);
     ArrayIndexer triangle_indexer(triangles, 1);
+    triangle_block_indices =
+            core::Tensor({triangle_count}, core::Int32, device);
+    index_t* triangle_block_indices_ptr =
+            triangle_block_indices.GetDataPtr<index_t>();
 
 #if defined(__CUDACC__)
     count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
@@ -1626,7 +1950,7 @@ void ExtractTriangleMeshCPU
 #else
     (*count_ptr) = 0;
 #endif
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_surface, [=] OPEN3D_DEVICE(index_t widx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
         index_t workload_block_idx = widx / resolution3;
         index_t voxel_idx = widx % resolution3;
@@ -1646,6 +1970,7 @@ void ExtractTriangleMeshCPU
             if (tri_table[table_idx][tri] == -1) return;
 
             index_t tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            triangle_block_indices_ptr[tri_idx] = workload_block_idx;
 
             for (index_t vertex = 0; vertex < 3; ++vertex) {
                 index_t edge = tri_table[table_idx][tri + vertex];
@@ -1685,6 +2010,7 @@ void ExtractTriangleMeshCPU
 #endif
     utility::LogDebug("Total triangle count = {}", triangle_count);
     triangles = triangles.Slice(0, 0, triangle_count);
+    triangle_block_indices = triangle_block_indices.Slice(0, 0, triangle_count);
 }
 
 }  // namespace voxel_grid
@@ -41,7 +41,15 @@ core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
     core::Tensor indices, distance2, counts;
     core::nns::NearestNeighborSearch tree(input.GetPointPositions(),
                                           core::Int32);
-    if (radius.has_value() && max_nn.has_value()) {
+    if (input.HasNeighborhoodCache() &&
+        input.GetNeighborhoodCache().Matches(max_nn, radius)) {
+        const geometry::NeighborhoodCache &cache = input.GetNeighborhoodCache();
+        indices = cache.GetIndices();
+        distance2 = cache.GetDistances();
+        counts = cache.GetCounts();
+        utility::LogDebug("Use {} for computing FPFH feature.",
+                          cache.ToString());
+    } else if (radius.has_value() && max_nn.has_value()) {
         bool check = tree.HybridIndex(radius.value());
         if (!check) {
             utility::LogError("Building HybridIndex failed.");
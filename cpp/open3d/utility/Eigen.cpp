@@ -285,14 +285,21 @@ Eigen::Vector3d ColorToDouble(const Eigen::Vector3uint8 &rgb) {
 template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
                                   const std::vector<IdxType> &indices) {
-    if (indices.empty()) {
+    return ComputeCovariance(points, indices.data(), indices.size());
+}
+
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const IdxType *const indices,
+                                  size_t num_indices) {
+    if (num_indices == 0) {
         return Eigen::Matrix3d::Identity();
     }
     Eigen::Matrix3d covariance;
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
-    for (const auto &idx : indices) {
-        const Eigen::Vector3d &point = points[idx];
+    for (size_t i = 0; i < num_indices; ++i) {
+        const Eigen::Vector3d &point = points[indices[i]];
         cumulants(0) += point(0);
         cumulants(1) += point(1);
         cumulants(2) += point(2);
@@ -303,7 +310,7 @@ Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
         cumulants(7) += point(1) * point(2);
         cumulants(8) += point(2) * point(2);
     }
-    cumulants /= (double)indices.size();
+    cumulants /= (double)num_indices;
     covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
     covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
     covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
@@ -361,6 +368,14 @@ template std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
 template Eigen::Matrix3d ComputeCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<int> &indices);
+template Eigen::Matrix3d ComputeCovariance(
+        const std::vector<Eigen::Vector3d> &points,
+        const size_t *const indices,
+        size_t num_indices);
+template Eigen::Matrix3d ComputeCovariance(
+        const std::vector<Eigen::Vector3d> &points,
+        const int *const indices,
+        size_t num_indices);
 template std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<int> &indices);
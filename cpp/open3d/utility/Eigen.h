@@ -118,6 +118,14 @@ template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
                                   const std::vector<IdxType> &indices);
 
+/// Function to compute the covariance matrix of the points indexed by the
+/// contiguous range [indices, indices + num_indices), e.g. one row of a CSR
+/// neighbor list.
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const IdxType *const indices,
+                                  size_t num_indices);
+
 /// Function to compute the mean and covariance matrix of a set of points.
 template <typename IdxType>
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
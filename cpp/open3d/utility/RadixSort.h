@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace utility {
+
+/// \brief Stable LSD radix sort of \p keys and \p values by the lowest \p
+/// num_bits bits of the keys, 8 bits per pass.
+///
+/// Every block of the input has its own histogram, such that the scatter of
+/// each pass is parallel and stable. Passes in which all keys share the same
+/// digit are skipped.
+template <typename T>
+void RadixSort(std::vector<uint64_t> &keys,
+               std::vector<T> &values,
+               int num_bits) {
+    constexpr int kRadixBits = 8;
+    constexpr int64_t kRadix = int64_t(1) << kRadixBits;
+    constexpr int64_t kBlockSize = 1 << 16;
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int64_t num_blocks =
+            std::max<int64_t>(1, (n + kBlockSize - 1) / kBlockSize);
+    std::vector<uint64_t> keys_tmp(n);
+    std::vector<T> values_tmp(n);
+    std::vector<int64_t> offsets(num_blocks * kRadix);
+
+    for (int shift = 0; shift < num_bits; shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            int64_t *histogram = offsets.data() + b * kRadix;
+            const int64_t end = std::min(n, (b + 1) * kBlockSize);
+            for (int64_t i = b * kBlockSize; i < end; ++i) {
+                ++histogram[(keys[i] >> shift) & (kRadix - 1)];
+            }
+        }
+
+        // Digit major exclusive prefix sum over the block histograms.
+        bool skip = false;
+        int64_t sum = 0;
+        for (int64_t digit = 0; digit < kRadix; ++digit) {
+            const int64_t digit_begin = sum;
+            for (int64_t b = 0; b < num_blocks; ++b) {
+                const int64_t count = offsets[b * kRadix + digit];
+                offsets[b * kRadix + digit] = sum;
+                sum += count;
+            }
+            skip = skip || sum - digit_begin == n;
+        }
+        if (skip) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            int64_t *offset = offsets.data() + b * kRadix;
+            const int64_t end = std::min(n, (b + 1) * kBlockSize);
+            for (int64_t i = b * kBlockSize; i < end; ++i) {
+                const int64_t pos = offset[(keys[i] >> shift) & (kRadix - 1)]++;
+                keys_tmp[pos] = keys[i];
+                values_tmp[pos] = values[i];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
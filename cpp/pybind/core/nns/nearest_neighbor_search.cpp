@@ -162,16 +162,13 @@ Returns:
     nns.def(
             "fixed_radius_search",
             [](NearestNeighborSearch &self, Tensor query_points, double radius,
-               utility::optional<bool> sort) {
-                if (!sort.has_value()) {
-                    return self.FixedRadiusSearch(query_points, radius, true);
-                } else {
-                    return self.FixedRadiusSearch(query_points, radius,
-                                                  sort.value());
-                }
+               utility::optional<bool> sort, int max_neighbors) {
+                return self.FixedRadiusSearch(query_points, radius,
+                                              sort.value_or(true),
+                                              max_neighbors);
             },
             py::arg("query_points"), py::arg("radius"),
-            py::arg("sort") = py::none(),
+            py::arg("sort") = py::none(), py::arg("max_neighbors") = 0,
             R"(Perform fixed-radius search.
 
 Note:
@@ -184,6 +181,9 @@ Args:
             for convenience, which may cause the index to be rebuilt for GPU 
             devices.
         sort (bool, optional): Sort the results by distance. Default is True.
+        max_neighbors (int, optional): If positive, only the max_neighbors
+            nearest neighbors within the radius are returned for each query,
+            sorted by distance. Default is 0, which returns all neighbors.
 
 Returns:
         Tuple of Tensors (indices, splits, distances).
@@ -107,6 +107,9 @@ void pybind_kdtreeflann_definitions(py::module &m) {
     static const std::unordered_map<std::string, std::string>
             map_kd_tree_flann_method_docs = {
                     {"query", "The input query point."},
+                    {"queries",
+                     "The input query points stored as columns of a matrix."},
+                    {"search_param", "KDTree search parameter."},
                     {"radius", "Search radius."},
                     {"max_nn",
                      "At maximum, ``max_nn`` neighbors will be searched."},
@@ -249,7 +252,26 @@ void pybind_kdtreeflann_definitions(py::module &m) {
                                     "search_hybrid_vector_xd() error!");
                         return std::make_tuple(k, indices, distance2);
                     },
-                    "query"_a, "radius"_a, "max_nn"_a);
+                    "query"_a, "radius"_a, "max_nn"_a)
+            .def(
+                    "batch_search",
+                    [](const KDTreeFlann &tree, const Eigen::MatrixXd &queries,
+                       const KDTreeSearchParam &param) {
+                        std::vector<size_t> offsets;
+                        std::vector<int> indices;
+                        std::vector<double> distance2;
+                        if (!tree.BatchSearch(queries, param, offsets, indices,
+                                              distance2))
+                            throw std::runtime_error("batch_search() error!");
+                        return std::make_tuple(offsets, indices, distance2);
+                    },
+                    "Search the neighbors of all columns of ``queries`` in "
+                    "parallel. Returns ``(offsets, indices, distance2)`` in "
+                    "CSR layout: the neighbors of query ``i`` are "
+                    "``indices[offsets[i]:offsets[i + 1]]``.",
+                    "queries"_a, "search_param"_a);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "batch_search",
+                                    map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_3d",
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_xd",
@@ -9,6 +9,8 @@
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
+#include "open3d/geometry/TriangleMeshDeformation.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
@@ -24,6 +26,20 @@ void pybind_trianglemesh_declarations(py::module &m) {
                          "and triangles represented by the indices to the "
                          "vertices. Optionally, the mesh may also contain "
                          "triangle normals, vertex normals and vertex colors.");
+    py::class_<TriangleMeshBVH, std::shared_ptr<TriangleMeshBVH>>
+            trianglemeshbvh(
+                    m, "TriangleMeshBVH",
+                    "Bounding volume hierarchy over the triangles of a mesh "
+                    "for triangle-triangle intersection queries. Build it "
+                    "once to run several queries on the same mesh.");
+    py::class_<DeformAsRigidAsPossibleContext,
+               std::shared_ptr<DeformAsRigidAsPossibleContext>>
+            deform_context(
+                    m, "DeformAsRigidAsPossibleContext",
+                    "Reusable state for repeated as-rigid-as-possible "
+                    "deformations of the same mesh with the same constrained "
+                    "vertices. The system matrix is factorized once and each "
+                    "deformation starts from the previous solution.");
 }
 void pybind_trianglemesh_definitions(py::module &m) {
     auto trianglemesh =
@@ -194,6 +210,10 @@ void pybind_trianglemesh_definitions(py::module &m) {
             .def("is_intersecting", &TriangleMesh::IsIntersecting,
                  "Tests if the triangle mesh is intersecting the other "
                  "triangle mesh.")
+            .def("get_intersecting_triangles",
+                 &TriangleMesh::GetIntersectingTriangles,
+                 "Returns a list of index pairs of intersecting triangles of "
+                 "the mesh and the other triangle mesh.")
             .def("is_orientable", &TriangleMesh::IsOrientable,
                  "Tests if the triangle mesh is orientable.")
             .def("is_watertight", &TriangleMesh::IsWatertight,
@@ -340,7 +360,7 @@ void pybind_trianglemesh_definitions(py::module &m) {
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "pcd"_a, "radii"_a, "n_threads"_a = -1)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -351,6 +371,19 @@ void pybind_trianglemesh_definitions(py::module &m) {
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
                         "linear_fit"_a = false, "n_threads"_a = -1)
+            .def_static("create_from_point_cloud_poisson_streaming",
+                        &TriangleMesh::CreateFromPointCloudPoissonStreaming,
+                        "Function that computes a triangle mesh from an "
+                        "oriented point cloud file that does not fit into "
+                        "memory. The points are read in chunks and split into "
+                        "overlapping tiles with a bounded number of points. "
+                        "Each tile is solved with the Screened Poisson "
+                        "Reconstruction and the tiles are stitched into one "
+                        "mesh without cracks.",
+                        "filename"_a, "depth"_a = 8,
+                        "max_points_per_tile"_a = 4000000, "overlap"_a = 0.25,
+                        "scale"_a = 1.1, "temp_directory"_a = "",
+                        "n_threads"_a = -1)
             .def_static(
                     "create_from_oriented_bounding_box",
                     &TriangleMesh::CreateFromOrientedBoundingBox,
@@ -511,6 +544,9 @@ void pybind_trianglemesh_definitions(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "is_intersecting",
             {{"other", "Other triangle mesh to test intersection with."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "get_intersecting_triangles",
+            {{"other", "Other triangle mesh to test intersection with."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "is_orientable");
     docstring::ClassMethodDocInject(m, "TriangleMesh", "is_watertight");
     docstring::ClassMethodDocInject(m, "TriangleMesh", "orient_triangles");
@@ -670,7 +706,11 @@ void pybind_trianglemesh_definitions(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
-              "reconstruction."}});
+              "reconstruction."},
+             {"n_threads",
+              "Number of threads used for reconstruction. Set to -1 to "
+              "automatically determine it. The mesh does not depend on the "
+              "number of threads."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -695,6 +735,26 @@ void pybind_trianglemesh_definitions(py::module &m) {
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
               "automatically determine it."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_streaming",
+            {{"filename",
+              "Point cloud file with normals. Supported formats are xyz, "
+              "xyzn, xyzrgb and ply."},
+             {"depth", "Maximum depth of the octree of each tile."},
+             {"max_points_per_tile",
+              "Maximum number of points of a tile including its overlap."},
+             {"overlap",
+              "Width of the margin around each tile relative to the tile "
+              "size, in [0, 0.5)."},
+             {"scale",
+              "Ratio between the edge length of the reconstruction cube of a "
+              "tile and its extended cube."},
+             {"temp_directory",
+              "Directory for temporary files. The system temporary directory "
+              "is used if empty."},
+             {"n_threads",
+              "Number of threads used for reconstruction. Set to -1 to "
+              "automatically determine it."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_oriented_bounding_box",
             {{"obox", "OrientedBoundingBox object to create mesh of."},
@@ -792,6 +852,89 @@ void pybind_trianglemesh_definitions(py::module &m) {
              {"flatness", "Controls the flatness/height of the Mobius strip."},
              {"width", "Width of the Mobius strip."},
              {"scale", "Scale the complete Mobius strip."}});
+
+    // open3d.geometry.TriangleMeshBVH
+    auto trianglemeshbvh =
+            static_cast<py::class_<TriangleMeshBVH,
+                                   std::shared_ptr<TriangleMeshBVH>>>(
+                    m.attr("TriangleMeshBVH"));
+    trianglemeshbvh.def(py::init<>())
+            .def(py::init<const TriangleMesh &>(), "mesh"_a)
+            .def(py::init<const std::vector<Eigen::Vector3d> &,
+                          const std::vector<Eigen::Vector3i> &>(),
+                 "vertices"_a, "triangles"_a)
+            .def("__repr__",
+                 [](const TriangleMeshBVH &bvh) {
+                     return fmt::format(
+                             "TriangleMeshBVH with {} nodes and {} triangles.",
+                             bvh.GetNodes().size(),
+                             bvh.GetTriangleIndices().size());
+                 })
+            .def("set_triangle_mesh", &TriangleMeshBVH::SetTriangleMesh,
+                 "Builds the BVH from a triangle mesh.", "mesh"_a)
+            .def("set_triangles", &TriangleMeshBVH::SetTriangles,
+                 "Builds the BVH from vertices and triangles.", "vertices"_a,
+                 "triangles"_a)
+            .def("get_self_intersecting_triangles",
+                 &TriangleMeshBVH::GetSelfIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns all pairs of intersecting triangles (i, j), i < j, "
+                 "sorted lexicographically. Triangles that share a vertex are "
+                 "not tested.")
+            .def("is_self_intersecting", &TriangleMeshBVH::IsSelfIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Tests if any two triangles that do not share a vertex "
+                 "intersect.")
+            .def("get_intersecting_triangles",
+                 &TriangleMeshBVH::GetIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns all pairs (i, j) such that triangle i of this BVH "
+                 "intersects triangle j of the other BVH.",
+                 "other"_a)
+            .def("is_intersecting", &TriangleMeshBVH::IsIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Tests if any triangle of this BVH intersects a triangle of "
+                 "the other BVH.",
+                 "other"_a)
+            .def("is_empty", &TriangleMeshBVH::IsEmpty,
+                 "Returns True if the BVH contains no triangles.");
+
+    // open3d.geometry.DeformAsRigidAsPossibleContext
+    auto deform_context =
+            static_cast<py::class_<DeformAsRigidAsPossibleContext,
+                                   std::shared_ptr<
+                                           DeformAsRigidAsPossibleContext>>>(
+                    m.attr("DeformAsRigidAsPossibleContext"));
+    deform_context
+            .def(py::init<const TriangleMesh &, const std::vector<int> &,
+                          MeshBase::DeformAsRigidAsPossibleEnergy, double>(),
+                 "mesh"_a, "constraint_vertex_indices"_a,
+                 py::arg_v("energy",
+                           MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                           "DeformAsRigidAsPossibleEnergy.Spokes"),
+                 "smoothed_alpha"_a = 0.01)
+            .def("__repr__",
+                 [](const DeformAsRigidAsPossibleContext &context) {
+                     return fmt::format(
+                             "DeformAsRigidAsPossibleContext with {} vertices "
+                             "and {} constraints.",
+                             context.GetVertices().size(),
+                             context.GetNumConstraints());
+                 })
+            .def("deform", &DeformAsRigidAsPossibleContext::Deform,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Deforms the mesh such that the constrained vertices are at "
+                 "the given positions, starting from the previous solution.",
+                 "constraint_vertex_positions"_a, "max_iter"_a)
+            .def("reset", &DeformAsRigidAsPossibleContext::Reset,
+                 "Discards the previous solution, the next deformation starts "
+                 "from the rest pose.")
+            .def("get_energy", &DeformAsRigidAsPossibleContext::GetEnergy,
+                 "Returns the energy after the last deformation, or -1.")
+            .def_property_readonly(
+                    "num_constraints",
+                    &DeformAsRigidAsPossibleContext::GetNumConstraints,
+                    "Number of constrained vertices.");
 }
 
 }  // namespace geometry
@@ -71,6 +71,9 @@ void pybind_geometry_declarations(py::module& m) {
     pybind_image_declarations(m_geometry);
     pybind_boundingvolume_declarations(m_geometry);
     pybind_voxel_block_grid_declarations(m_geometry);
+    pybind_linear_octree_declarations(m_geometry);
+    pybind_multi_resolution_voxel_block_grid_declarations(m_geometry);
+    pybind_streaming_voxel_down_sampler_declarations(m_geometry);
     pybind_raycasting_scene_declarations(m_geometry);
 }
 
@@ -120,6 +123,9 @@ void pybind_geometry_definitions(py::module& m) {
     pybind_image_definitions(m_geometry);
     pybind_boundingvolume_definitions(m_geometry);
     pybind_voxel_block_grid_definitions(m_geometry);
+    pybind_linear_octree_definitions(m_geometry);
+    pybind_multi_resolution_voxel_block_grid_definitions(m_geometry);
+    pybind_streaming_voxel_down_sampler_definitions(m_geometry);
     pybind_raycasting_scene_definitions(m_geometry);
 }
 
@@ -44,6 +44,9 @@ void pybind_trianglemesh_declarations(py::module& m);
 void pybind_image_declarations(py::module& m);
 void pybind_boundingvolume_declarations(py::module& m);
 void pybind_voxel_block_grid_declarations(py::module& m);
+void pybind_linear_octree_declarations(py::module& m);
+void pybind_multi_resolution_voxel_block_grid_declarations(py::module& m);
+void pybind_streaming_voxel_down_sampler_declarations(py::module& m);
 void pybind_raycasting_scene_declarations(py::module& m);
 
 void pybind_geometry_definitions(py::module& m);
@@ -56,6 +59,9 @@ void pybind_trianglemesh_definitions(py::module& m);
 void pybind_image_definitions(py::module& m);
 void pybind_boundingvolume_definitions(py::module& m);
 void pybind_voxel_block_grid_definitions(py::module& m);
+void pybind_linear_octree_definitions(py::module& m);
+void pybind_multi_resolution_voxel_block_grid_definitions(py::module& m);
+void pybind_streaming_voxel_down_sampler_definitions(py::module& m);
 void pybind_raycasting_scene_definitions(py::module& m);
 
 }  // namespace geometry
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/LinearOctree.h"
+
+#include "pybind/core/tensor_type_caster.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_linear_octree_declarations(py::module& m) {
+    py::class_<LinearOctree> linear_octree(m, "LinearOctree", R"doc(
+Pointer-free octree stored as arrays of Morton codes.
+
+The octree covers the cube [origin, origin + size) and all leaves are at
+max_depth, like the legacy open3d.geometry.Octree. The nodes are stored level
+by level, sorted by their Morton code within each level, such that the
+children and the points of a node are contiguous ranges. All tensors live on
+the CPU.
+
+Example::
+
+    import open3d as o3d
+
+    pcd = o3d.t.io.read_point_cloud("fragment.ply")
+    octree = o3d.t.geometry.LinearOctree.create_from_point_cloud(pcd, 8)
+    leaves = octree.locate_leaves(pcd.point.positions)
+    legacy_octree = octree.to_legacy()
+)doc");
+}
+
+void pybind_linear_octree_definitions(py::module& m) {
+    auto linear_octree =
+            static_cast<py::class_<LinearOctree>>(m.attr("LinearOctree"));
+    linear_octree.def(py::init<>(), "Constructs an empty octree.")
+            .def("__repr__", &LinearOctree::ToString)
+            .def_static("create_from_point_cloud",
+                        &LinearOctree::CreateFromPointCloud,
+                        py::call_guard<py::gil_scoped_release>(), "pcd"_a,
+                        "max_depth"_a, "size_expand"_a = 0.01,
+                        R"doc(
+Builds the octree of a point cloud. The bounds are computed as in the legacy
+Octree.convert_from_point_cloud(). If the point cloud has colors, the color of
+a leaf is the color of its point with the largest index.
+
+Args:
+    pcd (open3d.t.geometry.PointCloud): Input point cloud.
+    max_depth (int): Depth of the leaves, at most 21.
+    size_expand (float): A small expansion size such that the octree is
+        slightly bigger than the original point cloud bounds.
+
+Returns:
+    open3d.t.geometry.LinearOctree
+)doc")
+            .def_static("create_from_voxel_grid",
+                        &LinearOctree::CreateFromVoxelGrid, "voxel_grid"_a,
+                        "max_depth"_a,
+                        "Builds the octree of the voxel centers of a legacy "
+                        "VoxelGrid. The color of a leaf is the mean color of "
+                        "its voxels.")
+            .def_static("from_legacy", &LinearOctree::FromLegacy, "octree"_a,
+                        "Creates a LinearOctree from a legacy Octree.")
+            .def("to_legacy", &LinearOctree::ToLegacy,
+                 "Converts to a legacy Octree.")
+            .def("to_voxel_grid", &LinearOctree::ToVoxelGrid,
+                 "Converts the leaves to a legacy VoxelGrid.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no nodes.")
+            .def_property_readonly("num_nodes", &LinearOctree::GetNumNodes)
+            .def_property_readonly("num_leaves", &LinearOctree::GetNumLeaves)
+            .def_property_readonly("origin", &LinearOctree::GetOrigin,
+                                   "Min bound of the octree.")
+            .def_property_readonly("size", &LinearOctree::GetSize,
+                                   "Edge length of the root cube.")
+            .def_property_readonly("max_depth", &LinearOctree::GetMaxDepth)
+            .def_property_readonly("codes", &LinearOctree::GetCodes,
+                                   "UInt64 Morton codes of the nodes.")
+            .def_property_readonly(
+                    "level_splits", &LinearOctree::GetLevelSplits,
+                    "The nodes of depth d are [level_splits[d], "
+                    "level_splits[d + 1]).")
+            .def_property_readonly("child_ranges",
+                                   &LinearOctree::GetChildRanges,
+                                   "Range [begin, end) of the child nodes of "
+                                   "each node, of shape (num_nodes, 2).")
+            .def_property_readonly(
+                    "point_ranges", &LinearOctree::GetPointRanges,
+                    "Range [begin, end) of the points of each node in "
+                    "point_indices, of shape (num_nodes, 2).")
+            .def_property_readonly("point_indices",
+                                   &LinearOctree::GetPointIndices,
+                                   "Point indices sorted by leaf.")
+            .def_property_readonly("leaf_colors", &LinearOctree::GetLeafColors,
+                                   "Float64 colors of the leaves.")
+            .def("get_node_size", &LinearOctree::GetNodeSize, "depth"_a,
+                 "Returns the edge length of the nodes at depth.")
+            .def("get_node_depth", &LinearOctree::GetNodeDepth,
+                 "node_index"_a, "Returns the depth of a node.")
+            .def("get_node_origins", &LinearOctree::GetNodeOrigins,
+                 "Returns the min bound of all nodes.")
+            .def("get_point_indices_of_node",
+                 &LinearOctree::GetPointIndicesOfNode, "node_index"_a,
+                 "Returns the indices of the points of a node.")
+            .def("traverse", &LinearOctree::Traverse, "f"_a,
+                 "DFS traversal from the root. f is called with the node "
+                 "index and the depth of the node. If f returns True, the "
+                 "children of the node will not be traversed.")
+            .def("locate_leaves", &LinearOctree::LocateLeaves,
+                 py::call_guard<py::gil_scoped_release>(), "query_points"_a,
+                 "Returns the node index of the leaf containing each query "
+                 "point, or -1 if there is no such leaf.")
+            .def("find_leaves_in_box", &LinearOctree::FindLeavesInBox,
+                 "min_bound"_a, "max_bound"_a,
+                 "Returns the sorted node indices of all leaves that "
+                 "intersect the box [min_bound, max_bound].");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
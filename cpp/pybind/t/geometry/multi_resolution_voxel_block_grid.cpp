@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+#include "pybind/core/tensor_converter.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_multi_resolution_voxel_block_grid_declarations(py::module& m) {
+    py::class_<MultiResolutionVoxelBlockGrid> mr_vbg(
+            m, "MultiResolutionVoxelBlockGrid", R"doc(
+A TSDF volume whose voxel blocks have different voxel sizes.
+
+Each block carries a level l and has the voxel size voxel_size * 2^l, the
+blocks of each level are stored in a separate VoxelBlockGrid. The level of an
+observation is chosen at integration time by its depth: level 0 takes the
+depths below level_depth and level l > 0 takes the depths in
+[level_depth * 2^(l - 1), level_depth * 2^l), the last level takes all the
+remaining depths. Neighboring depth bands overlap by the fraction
+level_overlap of the band boundary. ray_cast() blends the levels in the
+overlaps and extract_triangle_mesh() stitches the seams between the levels.
+block_resolution must be divisible by 2^(num_levels - 1).
+
+All the levels have to be integrated with the same trunc_voxel_multiplier.
+
+Example::
+
+    import open3d as o3d
+
+    vbg = o3d.t.geometry.MultiResolutionVoxelBlockGrid(
+        attr_names=("tsdf", "weight", "color"),
+        attr_dtypes=(o3d.core.float32, o3d.core.uint16, o3d.core.uint16),
+        attr_channels=((1), (1), (3)),
+        voxel_size=0.01,
+        num_levels=3,
+        level_depth=1.5)
+    for depth, color, extrinsic in frames:
+        block_coords = vbg.compute_unique_block_coordinates(
+            depth, intrinsic, extrinsic)
+        vbg.integrate(block_coords, depth, color, intrinsic, extrinsic)
+    mesh = vbg.extract_triangle_mesh()
+)doc");
+}
+
+void pybind_multi_resolution_voxel_block_grid_definitions(py::module& m) {
+    auto mr_vbg = static_cast<py::class_<MultiResolutionVoxelBlockGrid>>(
+            m.attr("MultiResolutionVoxelBlockGrid"));
+    mr_vbg.def(py::init<const std::vector<std::string>&,
+                        const std::vector<core::Dtype>&,
+                        const std::vector<core::SizeVector>&, float, int64_t,
+                        int64_t, int64_t, float, float, const core::Device&>(),
+               "attr_names"_a, "attr_dtypes"_a, "attr_channels"_a,
+               "voxel_size"_a = 0.0058, "block_resolution"_a = 16,
+               "block_count"_a = 10000, "num_levels"_a = 3,
+               "level_depth"_a = 1.0f, "level_overlap"_a = 0.2f,
+               "device"_a = core::Device("CPU:0"));
+
+    mr_vbg.def_property_readonly("num_levels",
+                                 &MultiResolutionVoxelBlockGrid::GetNumLevels,
+                                 "Number of levels.");
+    mr_vbg.def("level", &MultiResolutionVoxelBlockGrid::GetLevel,
+               py::return_value_policy::reference_internal,
+               "Get the voxel block grid of a level.", "level"_a);
+    mr_vbg.def("voxel_size", &MultiResolutionVoxelBlockGrid::GetVoxelSize,
+               "Get the voxel size of a level.", "level"_a);
+    mr_vbg.def("depth_range", &MultiResolutionVoxelBlockGrid::GetDepthRange,
+               "Get the depth band (min, max) in meters that is integrated "
+               "into a level, including the overlaps.",
+               "level"_a);
+
+    mr_vbg.def("compute_unique_block_coordinates",
+               &MultiResolutionVoxelBlockGrid::GetUniqueBlockCoordinates,
+               "Get the active block coordinates of each level from a depth "
+               "image. Each level only takes the depths in its depth band.",
+               "depth"_a, "intrinsic"_a, "extrinsic"_a,
+               "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+               "trunc_voxel_multiplier"_a = 8.0f);
+
+    mr_vbg.def("integrate",
+               py::overload_cast<const std::vector<core::Tensor>&,
+                                 const Image&, const Image&,
+                                 const core::Tensor&, const core::Tensor&,
+                                 float, float, float>(
+                       &MultiResolutionVoxelBlockGrid::Integrate),
+               "Specific operation for TSDF volumes."
+               "Integrate an RGB-D frame into each level in its block "
+               "coordinates, using only the depths in its depth band.",
+               "block_coords"_a, "depth"_a, "color"_a, "intrinsic"_a,
+               "extrinsic"_a, "depth_scale"_a.noconvert() = 1000.0f,
+               "depth_max"_a.noconvert() = 3.0f,
+               "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
+    mr_vbg.def("integrate",
+               py::overload_cast<const std::vector<core::Tensor>&,
+                                 const Image&, const core::Tensor&,
+                                 const core::Tensor&, float, float, float>(
+                       &MultiResolutionVoxelBlockGrid::Integrate),
+               "Specific operation for TSDF volumes."
+               "Similar to RGB-D integration, but only applied to depth "
+               "images.",
+               "block_coords"_a, "depth"_a, "intrinsic"_a, "extrinsic"_a,
+               "depth_scale"_a.noconvert() = 1000.0f,
+               "depth_max"_a.noconvert() = 3.0f,
+               "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
+    mr_vbg.def("ray_cast", &MultiResolutionVoxelBlockGrid::RayCast,
+               "Specific operation for TSDF volumes."
+               "Ray cast each level in its depth band and blend the levels. "
+               "Supported attributes: vertex, depth, color, normal. The depth "
+               "is always returned.",
+               "block_coords"_a, "intrinsic"_a, "extrinsic"_a, "width"_a,
+               "height"_a,
+               "render_attributes"_a =
+                       std::vector<std::string>{"depth", "color"},
+               "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+               "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f,
+               "trunc_voxel_multiplier"_a = 8.0f,
+               "range_map_down_factor"_a = 8);
+
+    mr_vbg.def("extract_triangle_mesh",
+               &MultiResolutionVoxelBlockGrid::ExtractTriangleMesh,
+               "Specific operation for TSDF volumes."
+               "Extract a mesh of all the levels with Marching Cubes, with "
+               "the seams between the levels stitched. The stitching runs on "
+               "the host.",
+               "weight_threshold"_a = 3.0f);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
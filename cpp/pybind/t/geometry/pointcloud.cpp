@@ -95,12 +95,55 @@ The attributes of the point cloud have different levels::
     pcd.point.intensities = o3d.core.Tensor([0.3, 0.1, 0.4], dtype, device)
     pcd.point.labels = o3d.core.Tensor([3, 1, 4], o3d.core.int32, device)
 )");
+    py::class_<NeighborhoodCache> neighborhood_cache(
+            m, "NeighborhoodCache",
+            "Neighbors of all points of a point cloud, computed once with "
+            "PointCloud.compute_neighborhood_cache() and reused by all "
+            "operations with the same search parameters.");
+    py::enum_<NeighborhoodCache::SearchType>(
+            neighborhood_cache, "SearchType",
+            "Search type used to compute the neighbors.")
+            .value("KNN", NeighborhoodCache::SearchType::KNN)
+            .value("Radius", NeighborhoodCache::SearchType::Radius)
+            .value("Hybrid", NeighborhoodCache::SearchType::Hybrid)
+            .export_values();
 }
 void pybind_pointcloud_definitions(py::module& m) {
     auto pointcloud =
             static_cast<py::class_<PointCloud, PyGeometry<PointCloud>,
                                    std::shared_ptr<PointCloud>, Geometry,
                                    DrawableGeometry>>(m.attr("PointCloud"));
+    auto neighborhood_cache = static_cast<py::class_<NeighborhoodCache>>(
+            m.attr("NeighborhoodCache"));
+    neighborhood_cache
+            .def(py::init<const core::Tensor&, const utility::optional<int>,
+                          const utility::optional<double>>(),
+                 py::call_guard<py::gil_scoped_release>(), "points"_a,
+                 "max_nn"_a = 30, "radius"_a = py::none(),
+                 "Computes the neighbors of all points. It uses KNN search if "
+                 "only max_nn is provided, Radius search if only radius is "
+                 "provided and Hybrid search if both are provided.")
+            .def("__repr__", &NeighborhoodCache::ToString)
+            .def_property_readonly("search_type",
+                                   &NeighborhoodCache::GetSearchType)
+            .def_property_readonly("max_nn", &NeighborhoodCache::GetMaxNN)
+            .def_property_readonly("radius", &NeighborhoodCache::GetRadius)
+            .def_property_readonly(
+                    "indices", &NeighborhoodCache::GetIndices,
+                    "Int32 neighbor indices of shape (n, k) for KNN and "
+                    "Hybrid search and (num_neighbors,) for Radius search.")
+            .def_property_readonly("distances",
+                                   &NeighborhoodCache::GetDistances,
+                                   "Squared distances to the neighbors.")
+            .def_property_readonly(
+                    "counts", &NeighborhoodCache::GetCounts,
+                    "Number of neighbors of each point for KNN and Hybrid "
+                    "search and row splits of shape (n + 1,) for Radius "
+                    "search.")
+            .def("is_valid", &NeighborhoodCache::IsValid,
+                 "Returns True if the points the cache has been computed for "
+                 "still exist and have not been modified.");
+
     // Constructors.
     pointcloud
             .def(py::init<const core::Device&>(),
@@ -318,6 +361,28 @@ Return:
             "max_nn parameter is provided, Radius search (Not recommended to "
             "use on GPU) if only radius is provided and Hybrid Search "
             "(Recommended) if radius parameter is also provided.");
+    pointcloud.def(
+            "compute_neighborhood_cache",
+            &PointCloud::ComputeNeighborhoodCache,
+            py::call_guard<py::gil_scoped_release>(), py::arg("max_nn") = 30,
+            py::arg("radius") = py::none(),
+            "Computes the neighbors of all points and attaches them to the "
+            "point cloud. estimate_normals, estimate_color_gradients, "
+            "compute_boundary_points, remove_radius_outliers, "
+            "remove_statistical_outliers and "
+            "pipelines.registration.compute_fpfh_feature reuse the cached "
+            "neighbors if their search parameters are compatible. The cache "
+            "is dropped if the positions are replaced and becomes invalid if "
+            "they are modified in place, which is checked with a hash of the "
+            "positions on every access.");
+    pointcloud.def("has_neighborhood_cache", &PointCloud::HasNeighborhoodCache,
+                   "Returns True if a neighborhood cache is attached and valid "
+                   "for the current positions.");
+    pointcloud.def("get_neighborhood_cache", &PointCloud::GetNeighborhoodCache,
+                   "Returns the attached neighborhood cache.");
+    pointcloud.def("clear_neighborhood_cache",
+                   &PointCloud::ClearNeighborhoodCache,
+                   "Detaches the neighborhood cache from the point cloud.");
     pointcloud.def("orient_normals_to_align_with_direction",
                    &PointCloud::OrientNormalsToAlignWithDirection,
                    "Function to orient the normals of a point cloud.",
@@ -457,8 +522,8 @@ Example:
 the remaining points. Based on Katz et al. 'Direct Visibility of Point Sets',
 2007. Additional information about the choice of radius for noisy point clouds
 can be found in Mehra et. al. 'Visibility of Noisy Point Cloud Data', 2010.
-This is a wrapper for a CPU implementation and a copy of the point cloud data
-and resulting visible triangle mesh and indiecs will be made.
+The convex hull of the flipped points is computed on the CPU, with the
+Quickhull of compute_convex_hull().
 
 Args:
     camera_location: All points not visible from that location will be removed.
@@ -495,8 +560,11 @@ Example:
             "min_points"_a, "print_progress"_a = false,
             R"(Cluster PointCloud using the DBSCAN algorithm  Ester et al.,'A
 Density-Based Algorithm for Discovering Clusters in Large Spatial Databases
-with Noise', 1996. This is a wrapper for a CPU implementation and a copy of the
-point cloud data and resulting labels will be made.
+with Noise', 1996. Core points are found with a uniform grid and merged into
+clusters with a parallel union-find. Clusters are numbered in the order of their
+smallest core point index, so the labels are deterministic. The clustering runs
+on the CPU, for other devices a copy of the point cloud data and resulting
+labels will be made.
 
 Args:
     eps: Density parameter that is used to find neighbouring points.
@@ -531,8 +599,10 @@ Example:
             "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
             "num_iterations"_a = 100, "probability"_a = 0.999,
             R"(Segments a plane in the point cloud using the RANSAC algorithm.
-This is a wrapper for a CPU implementation and a copy of the point cloud data and
-resulting plane model and inlier indiecs will be made.
+Hypotheses are scored in batches and every new best model is refined with least
+squares on its inliers (LO-RANSAC). The segmentation runs on the CPU, for other
+devices a copy of the point cloud data and resulting plane model and inlier
+indices will be made.
 
 Args:
     distance_threshold (default 0.01): Max distance a point can be from the plane model, and still be considered an inlier.
@@ -559,18 +629,56 @@ Example:
         inlier_cloud = inlier_cloud.paint_uniform_color([1.0, 0, 0])
         outlier_cloud = pcd.select_by_index(inliers, invert=True)
         o3d.visualization.draw([inlier_cloud, outlier_cloud]))");
+    pointcloud.def(
+            "segment_planes", &PointCloud::SegmentPlanes, "max_planes"_a,
+            "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+            "num_iterations"_a = 100, "probability"_a = 0.999,
+            "min_inliers"_a = 1,
+            R"(Segments up to max_planes planes one after another using the RANSAC
+algorithm of segment_plane. Each plane is searched among the points that are not
+inliers of the previous planes.
+
+Args:
+    max_planes: Maximum number of planes.
+
+    distance_threshold (default 0.01): Max distance a point can be from the plane model, and still be considered an inlier.
+
+    ransac_n (default 3): Number of initial points to be considered inliers in each iteration.
+
+    num_iterations (default 100): Maximum number of iterations per plane.
+
+    probability (default 0.999): Expected probability of finding the optimal plane.
+
+    min_inliers (default 1): The search stops if the best plane has less inliers.
+
+Return:
+    Tuple of the plane models as float64 tensor of shape (P, 4) and an int32
+    tensor with the plane index of each point, -1 for points that are not on
+    any plane, on the same device as the point cloud.
+
+Example:
+
+    We use Redwood dataset to segment its three largest planes::
+
+        sample_pcd_data = o3d.data.PCDPointCloud()
+        pcd = o3d.t.io.read_point_cloud(sample_pcd_data.path)
+        plane_models, labels = pcd.segment_planes(max_planes=3,
+                                                  distance_threshold=0.01,
+                                                  num_iterations=1000)
+        for i in range(plane_models.shape[0]):
+            print(plane_models[i], (labels == i).sum().item()))");
     pointcloud.def(
             "compute_convex_hull", &PointCloud::ComputeConvexHull,
             "joggle_inputs"_a = false,
-            R"doc(Compute the convex hull of a triangle mesh using qhull. This runs on the CPU.
+            R"doc(Compute the convex hull of a point cloud with a parallel Quickhull. This runs on the CPU. The points inside the hull of the extreme points along the axes and diagonals are discarded in a first parallel pass.
 
 Args:
-    joggle_inputs (default False): Handle precision problems by randomly perturbing the input data. Set to True if perturbing the input is acceptable but you need convex simplicial output. If False, neighboring facets may be merged in case of precision problems. See `QHull docs <http://www.qhull.org/html/qh-impre.htm#joggle>`__ for more details.
+    joggle_inputs (default False): Handle precision problems by randomly perturbing the input data, as the 'QJ' option of `QHull <http://www.qhull.org/html/qh-impre.htm#joggle>`__. Set to True if perturbing the input is acceptable, e.g. for degenerate input. If False, points within the rounding error of a hull face are not hull vertices and degenerate input raises an exception.
 
 Return:
-    TriangleMesh representing the convexh hull. This contains an
-    extra vertex property `point_indices` that contains the index of the
-    corresponding vertex in the original mesh.
+    TriangleMesh representing the convex hull. This contains an
+    extra int32 vertex property `point_indices` that contains the index of the
+    corresponding point in the point cloud, in increasing order.
 
 Example:
     We will load the Eagle dataset, compute and display it's convex hull::
@@ -630,6 +738,9 @@ Example:
 
     docstring::ClassMethodDocInject(m, "PointCloud", "estimate_normals",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "PointCloud",
+                                    "compute_neighborhood_cache",
+                                    map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_depth_image",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_rgbd_image",
@@ -69,9 +69,10 @@ Args:
 
     raycasting_scene.def(
             "add_triangles",
-            py::overload_cast<const core::Tensor&, const core::Tensor&>(
+            py::overload_cast<const core::Tensor&, const core::Tensor&, bool>(
                     &RaycastingScene::AddTriangles),
-            "vertex_positions"_a, "triangle_indices"_a, R"doc(
+            "vertex_positions"_a, "triangle_indices"_a, "dynamic"_a = false,
+            R"doc(
 Add a triangle mesh to the scene.
 
 Args:
@@ -79,24 +80,87 @@ Args:
         Float32.
     triangles (open3d.core.Tensor): Triangles as Tensor of dim {M,3} and dtype
         UInt32.
+    dynamic (bool): If True, the mesh gets its own refittable acceleration
+        structure, which is instanced in the scene. This makes
+        update_vertex_positions() and set_geometry_transform() cheap, but the
+        queries are slower than for static meshes.
 
 Returns:
     The geometry ID of the added mesh.
 )doc");
 
     raycasting_scene.def("add_triangles",
-                         py::overload_cast<const TriangleMesh&>(
+                         py::overload_cast<const TriangleMesh&, bool>(
                                  &RaycastingScene::AddTriangles),
-                         "mesh"_a, R"doc(
+                         "mesh"_a, "dynamic"_a = false, R"doc(
 Add a triangle mesh to the scene.
 
 Args:
     mesh (open3d.t.geometry.TriangleMesh): A triangle mesh.
+    dynamic (bool): If True, the mesh gets its own refittable acceleration
+        structure, which is instanced in the scene.
 
 Returns:
     The geometry ID of the added mesh.
 )doc");
 
+    raycasting_scene.def("remove_geometry", &RaycastingScene::RemoveGeometry,
+                         "geom_id"_a, R"doc(
+Removes a geometry from the scene. The ID may be reused by geometries added
+later.
+
+Args:
+    geom_id (int): The ID of the geometry.
+)doc");
+
+    raycasting_scene.def("update_vertex_positions",
+                         &RaycastingScene::UpdateVertexPositions, "geom_id"_a,
+                         "vertex_positions"_a, R"doc(
+Updates the vertex positions of a triangle mesh.
+
+The acceleration structure of a dynamic mesh is refitted instead of rebuilt,
+which is much faster than removing and adding the mesh. The quality of a
+refitted structure degrades if the deformation moves nearby triangles far
+apart. Add the mesh again in this case. The acceleration structure of the
+scene is rebuilt for static meshes.
+
+Args:
+    geom_id (int): The ID of the geometry.
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32 with the same number of vertices as the mesh.
+)doc");
+
+    raycasting_scene.def("set_geometry_transform",
+                         &RaycastingScene::SetGeometryTransform, "geom_id"_a,
+                         "transformation"_a, R"doc(
+Sets the rigid transformation of a dynamic geometry.
+
+Dynamic meshes are instanced in the scene. Changing the transformation only
+updates the top level of the acceleration structure, which is much cheaper
+than updating the vertex positions.
+
+Args:
+    geom_id (int): The ID of a geometry added with dynamic=True.
+    transformation (open3d.core.Tensor): Rigid 4x4 transformation from the
+        mesh to the scene.
+)doc");
+
+    raycasting_scene.def("get_geometry_transform",
+                         &RaycastingScene::GetGeometryTransform, "geom_id"_a,
+                         "Returns the 4x4 Float32 transformation of a "
+                         "geometry. Static geometries have the identity "
+                         "transformation.");
+
+    raycasting_scene.def("set_geometry_enabled",
+                         &RaycastingScene::SetGeometryEnabled, "geom_id"_a,
+                         "enabled"_a,
+                         "Enables or disables a geometry. Disabled geometries "
+                         "are ignored by all queries.");
+
+    raycasting_scene.def("is_geometry_enabled",
+                         &RaycastingScene::IsGeometryEnabled, "geom_id"_a,
+                         "Returns True if the geometry is enabled.");
+
     raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
                          "nthreads"_a = 0,
                          R"doc(
@@ -138,6 +202,37 @@ Returns:
         A tensor with the normals of the hit triangles. The shape is {.., 3}.
 )doc");
 
+    raycasting_scene.def(
+            "render_depth_batch",
+            py::overload_cast<const core::Tensor&, const core::Tensor&, int,
+                              int, const std::vector<std::string>&, const int>(
+                    &RaycastingScene::RenderDepthBatch),
+            "intrinsic_matrices"_a, "extrinsic_matrices"_a, "width_px"_a,
+            "height_px"_a, "output_names"_a = std::vector<std::string>{"t_hit"},
+            "nthreads"_a = 0, R"doc(
+Renders images of a batch of pinhole cameras.
+
+This is equivalent to casting the rays of create_rays_pinhole() for each
+camera, but the rays are generated on the fly and cast as coherent packets of
+neighboring pixels, and only the requested outputs are computed.
+
+Args:
+    intrinsic_matrices (open3d.core.Tensor): The upper triangular intrinsic
+        matrix with shape {3,3}, or one matrix per camera with shape {B,3,3}.
+    extrinsic_matrices (open3d.core.Tensor): The 4x4 world to camera SE(3)
+        transformations with shape {B,4,4}, or {4,4} for a single camera.
+    width_px (int): The width of the images in pixels.
+    height_px (int): The height of the images in pixels.
+    output_names (List[str]): The requested outputs, any of t_hit,
+        geometry_ids, primitive_ids, primitive_uvs and primitive_normals.
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A dictionary with the requested outputs of cast_rays() with an additional
+    leading batch dimension, e.g., t_hit has the shape {B,height_px,width_px}
+    and is the depth of the pixels.
+)doc");
+
     raycasting_scene.def("test_occlusions", &RaycastingScene::TestOcclusions,
                          "rays"_a, "tnear"_a = 0.f,
                          "tfar"_a = std::numeric_limits<float>::infinity(),
@@ -399,6 +494,40 @@ Returns:
     or 1. A point is occupied or inside if the value is 1.
 )doc");
 
+    raycasting_scene.def("compute_narrow_band_signed_distance",
+                         &RaycastingScene::ComputeNarrowBandSignedDistance,
+                         "voxel_size"_a, "block_resolution"_a = 8,
+                         "trunc_voxel_multiplier"_a = 4.0, "nthreads"_a = 0,
+                         "nsamples"_a = 1,
+                         R"doc(
+Computes a sparse truncated signed distance field in a narrow band around the
+surfaces of the scene.
+
+Instead of evaluating a dense grid, the bounding box of the scene is
+subdivided hierarchically and only cells close to the surface are refined
+down to voxel blocks. The memory scales with the area of the surfaces instead
+of the volume. The same assumptions as for compute_signed_distance() apply.
+
+Args:
+    voxel_size (float): The size of the voxels.
+
+    block_resolution (int): The number of voxels of a block per axis.
+
+    trunc_voxel_multiplier (float): The truncation distance in voxels.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+    nsamples (int): The number of rays used for determining the inside.
+        This must be an odd number.
+
+Returns:
+    A open3d.t.geometry.VoxelBlockGrid on the CPU with the Float32 attributes
+    'tsdf' and 'weight'. The tsdf is the signed distance divided by the
+    truncation distance. Voxels within the band have the weight 1 and all
+    other voxels have the tsdf 1 and the weight 0. Surfaces can be extracted
+    with extract_triangle_mesh(weight_threshold=0).
+)doc");
+
     raycasting_scene.def_static(
             "create_rays_pinhole",
             py::overload_cast<const core::Tensor&, const core::Tensor&, int,
@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/StreamingVoxelDownSampler.h"
+
+#include "pybind/core/tensor_type_caster.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_streaming_voxel_down_sampler_declarations(py::module& m) {
+    py::class_<StreamingVoxelDownSampler> sampler(
+            m, "StreamingVoxelDownSampler", R"doc(
+Voxel downsampling of point clouds that do not fit into memory.
+
+The point cloud is passed in chunks with add_chunk() or add_file(). The point
+count and the attribute sums of each voxel are accumulated in a hash map. When
+the hash map holds more than max_voxels voxels, the voxels of the tiles that
+have not been touched by the last chunk are spilled to disk. extract() merges
+the spilled tiles and returns the same point cloud as
+PointCloud.voxel_down_sample() with the "mean" reduction, up to the order of
+the points and rounding.
+
+Example::
+
+    import open3d as o3d
+
+    sampler = o3d.t.geometry.StreamingVoxelDownSampler(0.05)
+    for file_name in ["scan_0.ply", "scan_1.ply"]:
+        sampler.add_file(file_name, dtype=o3d.core.float64)
+    pcd_down = sampler.extract()
+)doc");
+}
+
+void pybind_streaming_voxel_down_sampler_definitions(py::module& m) {
+    auto sampler = static_cast<py::class_<StreamingVoxelDownSampler>>(
+            m.attr("StreamingVoxelDownSampler"));
+    sampler.def(py::init<double, int64_t, const std::string&, int64_t,
+                         const core::Device&>(),
+                "voxel_size"_a, "max_voxels"_a = 1 << 24,
+                "spill_dir"_a = "", "tile_size"_a = 256,
+                "device"_a = core::Device("CPU:0"), R"doc(
+Args:
+    voxel_size (float): Voxel size. A positive number.
+    max_voxels (int): Max number of voxels that are accumulated in memory
+        before finished tiles are spilled to disk.
+    spill_dir (str): Directory for the spilled tiles. The system temp
+        directory is used if empty.
+    tile_size (int): Edge length of the spill tiles in voxels.
+    device (open3d.core.Device): Device of the accumulation.
+)doc")
+            .def("__repr__", &StreamingVoxelDownSampler::ToString)
+            .def("add_chunk", &StreamingVoxelDownSampler::AddChunk,
+                 py::call_guard<py::gil_scoped_release>(), "chunk"_a,
+                 "Accumulates the points of a chunk. All chunks must have "
+                 "the same point attributes.")
+            .def("add_file", &StreamingVoxelDownSampler::AddFile,
+                 py::call_guard<py::gil_scoped_release>(), "filename"_a,
+                 "chunk_size"_a = 1 << 22, "dtype"_a = core::Float32,
+                 "format"_a = "auto",
+                 "Accumulates the points of a xyz, xyzn, xyzrgb or ply file, "
+                 "which is read in chunks of chunk_size points. Returns True "
+                 "if the file has been read successfully.")
+            .def("extract", &StreamingVoxelDownSampler::Extract,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns the downsampled point cloud of all points added so "
+                 "far and resets the sampler.")
+            .def("reset", &StreamingVoxelDownSampler::Reset,
+                 "Discards all accumulated points and spilled tiles.")
+            .def_property_readonly("num_points",
+                                   &StreamingVoxelDownSampler::GetNumPoints,
+                                   "Number of points added since the last "
+                                   "reset.")
+            .def_property_readonly(
+                    "num_voxels_in_memory",
+                    &StreamingVoxelDownSampler::GetNumVoxelsInMemory,
+                    "Number of voxels accumulated in memory.")
+            .def_property_readonly(
+                    "num_spilled_tiles",
+                    &StreamingVoxelDownSampler::GetNumSpilledTiles,
+                    "Number of tiles that have been spilled to disk.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -217,18 +217,15 @@ Returns:
     triangle_mesh.def(
             "compute_convex_hull", &TriangleMesh::ComputeConvexHull,
             "joggle_inputs"_a = false,
-            R"(Compute the convex hull of a point cloud using qhull. This runs on the CPU.
+            R"(Compute the convex hull of the mesh vertices with a parallel Quickhull. This runs on the CPU.
 
 Args:
     joggle_inputs (bool with default False): Handle precision problems by
-        randomly perturbing the input data. Set to True if perturbing the input
-        iis acceptable but you need convex simplicial output. If False,
-        neighboring facets may be merged in case of precision problems. See
-        `QHull docs <http://www.qhull.org/html/qh-impre.htm#joggle`__ for more
-        details.
+        randomly perturbing the input data, as the 'QJ' option of
+        `QHull <http://www.qhull.org/html/qh-impre.htm#joggle>`__.
 
 Returns:
-    TriangleMesh representing the convexh hull. This contains an
+    TriangleMesh representing the convex hull. This contains an
     extra vertex property "point_indices" that contains the index of the
     corresponding vertex in the original mesh.
 
@@ -282,6 +279,8 @@ Example:
 This method clips the triangle mesh with the specified plane.
 Parts of the mesh on the positive side of the plane will be kept and triangles
 intersected by the plane will be cut.
+The new vertices on the plane are shared by the cut triangles and their
+attributes are interpolated. Triangle attributes are preserved.
 
 Args:
     point (open3d.core.Tensor): A point on the plane.
@@ -339,6 +338,32 @@ This example shows how to create a hemisphere from a sphere::
     contours = mesh.slice_plane([0,0,0], [0,1,0], np.linspace(0,0.2))
     o3d.visualization.draw([{'name': 'bunny', 'geometry': contours}])
 
+)");
+
+    triangle_mesh.def("get_self_intersecting_triangles",
+                      &TriangleMesh::GetSelfIntersectingTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      R"(Returns all pairs of intersecting triangles of the mesh.
+
+Triangles that share a vertex are not tested. The candidate pairs are found
+with a bounding volume hierarchy, see open3d.geometry.TriangleMeshBVH.
+
+Returns:
+    Int64 tensor of shape (n, 2) on the CPU with the triangle indices (i, j),
+    i < j, sorted lexicographically.
+)");
+
+    triangle_mesh.def("get_intersecting_triangles",
+                      &TriangleMesh::GetIntersectingTriangles,
+                      py::call_guard<py::gil_scoped_release>(), "other"_a,
+                      R"(Returns all pairs of intersecting triangles of this mesh and other.
+
+Args:
+    other (open3d.t.geometry.TriangleMesh): The other triangle mesh.
+
+Returns:
+    Int64 tensor of shape (n, 2) on the CPU with the index of the triangle of
+    this mesh and the index of the triangle of other, sorted lexicographically.
 )");
 
     // Triangle Mesh's creation APIs.
@@ -554,6 +579,56 @@ Example:
         o3d.visualization.draw([{'name': 'text', 'geometry': mesh}])
 )");
 
+    triangle_mesh.def_static(
+            "create_from_point_cloud_poisson_streaming",
+            &TriangleMesh::CreateFromPointCloudPoissonStreaming, "filename"_a,
+            "depth"_a = 8, "max_points_per_tile"_a = 4000000,
+            "overlap"_a = 0.25, "scale"_a = 1.1, "temp_directory"_a = "",
+            "n_threads"_a = -1, "float_dtype"_a = core::Float32,
+            "int_dtype"_a = core::Int64, "device"_a = core::Device("CPU:0"),
+            R"(Create a mesh from an oriented point cloud file that does not fit
+into memory with the Screened Poisson Reconstruction in overlapping tiles.
+
+The file is read in chunks and the bounding box is split into cubic tiles, so
+that no tile including its overlap contains more than max_points_per_tile
+points. Every tile is solved separately and the implicit functions of the
+tiles are sampled on a global lattice, where every node takes its value from
+the tile containing it. A single marching cubes pass over the lattice gives a
+mesh without cracks between tiles.
+
+Args:
+    filename (str): Point cloud file with normals (xyz, xyzn, xyzrgb or ply).
+    depth (int): Maximum depth of the octree of each tile.
+    max_points_per_tile (int): Maximum number of points of a tile including
+        its overlap.
+    overlap (float): Width of the margin around each tile relative to the tile
+        size, in [0, 0.5).
+    scale (float): Ratio between the edge length of the reconstruction cube of
+        a tile and its extended cube.
+    temp_directory (str): Directory for temporary files. The system temporary
+        directory is used if empty.
+    n_threads (int): Number of threads, -1 to use all cores.
+    float_dtype (o3d.core.Dtype): Float32 or Float64, used to store floating
+        point values, e.g. vertices, normals.
+    int_dtype (o3d.core.Dtype): Int32 or Int64, used to store index values,
+        e.g. triangles.
+    device (o3d.core.Device): The device where the resulting TriangleMesh
+        resides.
+
+Returns:
+    The reconstructed TriangleMesh with vertex normals.
+
+Example:
+
+    This example reconstructs a mesh from a point cloud file in tiles of at
+    most 100000 points::
+
+        import open3d as o3d
+
+        mesh = o3d.t.geometry.TriangleMesh.create_from_point_cloud_poisson_streaming(
+            "scan.ply", depth=8, max_points_per_tile=100000)
+)");
+
     triangle_mesh.def_static(
             "create_isosurfaces",
             // Accept anything for contour_values that pybind can convert to
@@ -618,10 +693,13 @@ This example shows how to convert a mesh to a signed distance field (SDF) and ba
     triangle_mesh.def(
             "simplify_quadric_decimation",
             &TriangleMesh::SimplifyQuadricDecimation, "target_reduction"_a,
-            "preserve_volume"_a = true,
+            "preserve_volume"_a = true, "max_partition_triangles"_a = 65536,
             R"(Function to simplify mesh using Quadric Error Metric Decimation by Garland and Heckbert.
 
-This function always uses the CPU device.
+This function always uses the CPU device. Meshes with more than
+max_partition_triangles triangles are split into spatial partitions that are
+decimated in parallel, followed by a pass over the partition seams. Float
+vertex attributes are averaged, other attributes are dropped.
 
 Args:
     target_reduction (float): The factor of triangles to delete, i.e., setting
@@ -632,6 +710,9 @@ Args:
     preserve_volume (bool): If set to True this enables volume preservation
         which reduces the error in triangle normal direction.
 
+    max_partition_triangles (int): The maximum number of triangles of a
+        partition.
+
 Returns:
     Simplified TriangleMesh.
 
@@ -650,14 +731,19 @@ Example:
             R"(Computes the mesh that encompasses the union of the volumes of two meshes.
 Both meshes should be manifold.
 
-This function always uses the CPU device.
+The intersection curves of the two meshes are computed with exact predicates
+and the parts of the surfaces are classified with the winding number of the
+other mesh. Vertex attributes present in both meshes with the same dtype and
+shape are interpolated, triangle attributes are not preserved. The computation
+runs on the CPU and the result is on the device of this mesh.
 
 Args:
     mesh (open3d.t.geometry.TriangleMesh): This is the second operand for the
         boolean operation.
 
     tolerance (float): Threshold which determines when point distances are
-        considered to be 0.
+        considered to be 0. Vertices of the result closer than the tolerance
+        are merged.
 
 Returns:
     The mesh describing the union volume.
@@ -681,14 +767,19 @@ Example:
             R"(Computes the mesh that encompasses the intersection of the volumes of two meshes.
 Both meshes should be manifold.
 
-This function always uses the CPU device.
+The intersection curves of the two meshes are computed with exact predicates
+and the parts of the surfaces are classified with the winding number of the
+other mesh. Vertex attributes present in both meshes with the same dtype and
+shape are interpolated, triangle attributes are not preserved. The computation
+runs on the CPU and the result is on the device of this mesh.
 
 Args:
     mesh (open3d.t.geometry.TriangleMesh): This is the second operand for the
         boolean operation.
 
     tolerance (float): Threshold which determines when point distances are
-        considered to be 0.
+        considered to be 0. Vertices of the result closer than the tolerance
+        are merged.
 
 Returns:
     The mesh describing the intersection volume.
@@ -712,14 +803,19 @@ Example:
             R"(Computes the mesh that encompasses the volume after subtracting the volume of the second operand.
 Both meshes should be manifold.
 
-This function always uses the CPU device.
+The intersection curves of the two meshes are computed with exact predicates
+and the parts of the surfaces are classified with the winding number of the
+other mesh. Vertex attributes present in both meshes with the same dtype and
+shape are interpolated, triangle attributes are not preserved. The computation
+runs on the CPU and the result is on the device of this mesh.
 
 Args:
     mesh (open3d.t.geometry.TriangleMesh): This is the second operand for the
         boolean operation.
 
     tolerance (float): Threshold which determines when point distances are
-        considered to be 0.
+        considered to be 0. Vertices of the result closer than the tolerance
+        are merged.
 
 Returns:
     The mesh describing the difference volume.
@@ -750,7 +846,9 @@ Example:
                       "hole_size"_a = 1e6,
                       R"(Fill holes by triangulating boundary edges.
 
-This function always uses the CPU device.
+Each boundary loop is triangulated by ear clipping in the plane of its average
+normal. Vertex attributes are preserved, triangle attributes are not. The
+computation runs on the CPU.
 
 Args:
     hole_size (float): This is the approximate threshold for filling holes.
@@ -186,6 +186,19 @@ void pybind_voxel_block_grid_definitions(py::module& m) {
             "Specific operation for TSDF volumes."
             "Extract triangle mesh at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_vertex_number"_a = -1);
+    vbg.def("extract_triangle_mesh_incremental",
+            &VoxelBlockGrid::ExtractTriangleMeshIncremental,
+            "Specific operation for TSDF volumes."
+            "Re-mesh the blocks marked as dirty by integrate since the last "
+            "call and their neighbors. Returns a tuple of the Int32 block "
+            "coordinates (N, 3) and a list of N triangle mesh chunks, one "
+            "per block, to replace the chunks of these blocks in a cached "
+            "mesh.",
+            "weight_threshold"_a = 3.0f);
+    vbg.def("num_dirty_blocks", &VoxelBlockGrid::GetNumDirtyBlocks,
+            "Returns the number of blocks marked as dirty by integrate.");
+    vbg.def("clear_dirty_blocks", &VoxelBlockGrid::ClearDirtyBlocks,
+            "Clear the dirty marks, e.g. after caching a full mesh.");
 
     // Device transfers.
     vbg.def("to", &VoxelBlockGrid::To,
@@ -209,6 +222,23 @@ void pybind_voxel_block_grid_definitions(py::module& m) {
             "will be performed.",
             "device_id"_a = 0);
 
+    vbg.def("enable_paging", &VoxelBlockGrid::EnablePaging,
+            "Enable paging of voxel blocks to disk to bound the memory usage. "
+            "When more than max_resident_blocks blocks are in memory, the "
+            "blocks of the least recently touched pages of page_size^3 blocks "
+            "are compressed and moved to a temporary directory below "
+            "page_dir. Blocks are paged back in when "
+            "compute_unique_block_coordinates, integrate or ray_cast touch "
+            "them. While paging is enabled, all other functions only see the "
+            "blocks in memory.",
+            "max_resident_blocks"_a, "page_dir"_a = "", "page_size"_a = 8);
+    vbg.def("disable_paging", &VoxelBlockGrid::DisablePaging,
+            "Page all blocks back in and disable paging.");
+    vbg.def("is_paging_enabled", &VoxelBlockGrid::IsPagingEnabled,
+            "Returns true if paging is enabled.");
+    vbg.def("num_paged_out_blocks", &VoxelBlockGrid::GetNumPagedOutBlocks,
+            "Returns the number of blocks that are paged out to disk.");
+
     vbg.def("save", &VoxelBlockGrid::Save,
             "Save the voxel block grid to a npz file.", "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
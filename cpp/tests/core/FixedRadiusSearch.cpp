@@ -0,0 +1,286 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/FixedRadiusSearchImpl.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+template <class T, class TIndex>
+class VectorAllocator {
+public:
+    void AllocIndices(TIndex** ptr, size_t num) {
+        indices_.resize(num);
+        *ptr = indices_.data();
+    }
+
+    void AllocIndices(TIndex** ptr, size_t num, TIndex value) {
+        indices_.assign(num, value);
+        *ptr = indices_.data();
+    }
+
+    void AllocDistances(T** ptr, size_t num) {
+        distances_.resize(num);
+        *ptr = distances_.data();
+    }
+
+    void AllocDistances(T** ptr, size_t num, T value) {
+        distances_.assign(num, value);
+        *ptr = distances_.data();
+    }
+
+    void AllocCounts(TIndex** ptr, size_t num, TIndex value) {
+        counts_.assign(num, value);
+        *ptr = counts_.data();
+    }
+
+    std::vector<TIndex> indices_;
+    std::vector<T> distances_;
+    std::vector<TIndex> counts_;
+};
+
+// Random points with two batch items and the spatial hash table for them.
+struct SearchData {
+    SearchData(int num_points, int num_queries, float radius)
+        : radius(radius) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> dist(0.f, 1.f);
+        points.resize(num_points * 3);
+        queries.resize(num_queries * 3);
+        for (float& v : points) v = dist(rng);
+        for (float& v : queries) v = dist(rng);
+        // Let the first query of the second batch item coincide with a point.
+        std::copy_n(points.begin() + (num_points / 2) * 3, 3,
+                    queries.begin() + (num_queries / 2) * 3);
+
+        points_row_splits = {0, num_points / 2, num_points};
+        queries_row_splits = {0, num_queries / 2, num_queries};
+        hash_table_splits = {0, uint32_t(num_points / 2),
+                             uint32_t(num_points)};
+        hash_table_cell_splits.resize(hash_table_splits.back() + 1);
+        hash_table_index.resize(num_points);
+        core::nns::impl::BuildSpatialHashTableCPU(
+                num_points, points.data(), radius, points_row_splits.size(),
+                points_row_splits.data(), hash_table_splits.data(),
+                hash_table_cell_splits.size(), hash_table_cell_splits.data(),
+                hash_table_index.data());
+    }
+
+    template <class ALLOCATOR>
+    void Search(core::nns::Metric metric,
+                bool ignore_query_point,
+                int max_neighbors,
+                bool single_pass,
+                std::vector<int64_t>& row_splits,
+                ALLOCATOR& allocator) const {
+        row_splits.resize(queries.size() / 3 + 1);
+        core::nns::impl::FixedRadiusSearchCPU<float, int32_t>(
+                row_splits.data(), points.size() / 3, points.data(),
+                queries.size() / 3, queries.data(), radius,
+                points_row_splits.size(), points_row_splits.data(),
+                queries_row_splits.size(), queries_row_splits.data(),
+                hash_table_splits.data(), hash_table_cell_splits.size(),
+                hash_table_cell_splits.data(), hash_table_index.data(), metric,
+                ignore_query_point, true, allocator, max_neighbors,
+                single_pass);
+    }
+
+    // Returns the sorted (distance, index) pairs of all neighbors of query i.
+    std::vector<std::pair<float, int32_t>> BruteForce(int64_t i) const {
+        const int batch = i < queries_row_splits[1] ? 0 : 1;
+        std::vector<std::pair<float, int32_t>> result;
+        for (int64_t j = points_row_splits[batch];
+             j < points_row_splits[batch + 1]; ++j) {
+            float d = 0;
+            for (int k = 0; k < 3; ++k) {
+                const float diff = points[j * 3 + k] - queries[i * 3 + k];
+                d += diff * diff;
+            }
+            if (d <= radius * radius) {
+                result.emplace_back(d, int32_t(j));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    float radius;
+    std::vector<float> points;
+    std::vector<float> queries;
+    std::vector<int64_t> points_row_splits;
+    std::vector<int64_t> queries_row_splits;
+    std::vector<uint32_t> hash_table_splits;
+    std::vector<uint32_t> hash_table_cell_splits;
+    std::vector<uint32_t> hash_table_index;
+};
+
+}  // namespace
+
+TEST(FixedRadiusSearch, SinglePassMatchesTwoPass) {
+    const SearchData data(2000, 3000, 0.08f);
+
+    for (auto metric : {core::nns::L1, core::nns::L2, core::nns::Linf}) {
+        for (bool ignore_query_point : {false, true}) {
+            std::vector<int64_t> row_splits, gt_row_splits;
+            VectorAllocator<float, int32_t> allocator, gt_allocator;
+            data.Search(metric, ignore_query_point, 0, true, row_splits,
+                        allocator);
+            data.Search(metric, ignore_query_point, 0, false, gt_row_splits,
+                        gt_allocator);
+
+            EXPECT_EQ(row_splits, gt_row_splits);
+            EXPECT_EQ(allocator.indices_, gt_allocator.indices_);
+            EXPECT_EQ(allocator.distances_, gt_allocator.distances_);
+            EXPECT_GT(row_splits.back(), 0);
+        }
+    }
+}
+
+TEST(FixedRadiusSearch, BruteForce) {
+    const SearchData data(1000, 500, 0.1f);
+
+    std::vector<int64_t> row_splits;
+    VectorAllocator<float, int32_t> allocator;
+    data.Search(core::nns::L2, false, 0, true, row_splits, allocator);
+
+    for (size_t i = 0; i + 1 < row_splits.size(); ++i) {
+        std::vector<std::pair<int32_t, float>> result, gt;
+        for (int64_t j = row_splits[i]; j < row_splits[i + 1]; ++j) {
+            result.emplace_back(allocator.indices_[j],
+                                allocator.distances_[j]);
+        }
+        for (const auto& neighbor : data.BruteForce(i)) {
+            gt.emplace_back(neighbor.second, neighbor.first);
+        }
+        std::sort(result.begin(), result.end());
+        std::sort(gt.begin(), gt.end());
+        ASSERT_EQ(result.size(), gt.size());
+        for (size_t k = 0; k < gt.size(); ++k) {
+            EXPECT_EQ(result[k].first, gt[k].first);
+            EXPECT_NEAR(result[k].second, gt[k].second, 1e-6);
+        }
+    }
+}
+
+TEST(FixedRadiusSearch, MaxNeighbors) {
+    const SearchData data(2000, 1000, 0.1f);
+    const int max_neighbors = 3;
+
+    std::vector<int64_t> all_row_splits;
+    VectorAllocator<float, int32_t> all_allocator;
+    data.Search(core::nns::L2, false, 0, true, all_row_splits, all_allocator);
+
+    for (bool single_pass : {true, false}) {
+        std::vector<int64_t> row_splits;
+        VectorAllocator<float, int32_t> allocator;
+        data.Search(core::nns::L2, false, max_neighbors, single_pass,
+                    row_splits, allocator);
+
+        ASSERT_EQ(row_splits.size(), all_row_splits.size());
+        for (size_t i = 0; i + 1 < row_splits.size(); ++i) {
+            const int64_t count = row_splits[i + 1] - row_splits[i];
+            const int64_t all_count = all_row_splits[i + 1] - all_row_splits[i];
+            EXPECT_EQ(count, std::min<int64_t>(all_count, max_neighbors));
+            // The returned neighbors are the nearest ones of the uncapped
+            // result, sorted by distance.
+            std::vector<std::pair<float, int32_t>> nearest;
+            for (int64_t j = all_row_splits[i]; j < all_row_splits[i + 1];
+                 ++j) {
+                nearest.emplace_back(all_allocator.distances_[j],
+                                     all_allocator.indices_[j]);
+            }
+            std::sort(nearest.begin(), nearest.end());
+            for (int64_t k = 0; k < count; ++k) {
+                EXPECT_EQ(allocator.indices_[row_splits[i] + k],
+                          nearest[k].second);
+                EXPECT_EQ(allocator.distances_[row_splits[i] + k],
+                          nearest[k].first);
+            }
+        }
+    }
+}
+
+TEST(FixedRadiusSearch, IndexMaxNeighbors) {
+    const SearchData data(2000, 1000, 0.1f);
+    const int64_t num_points = data.points.size() / 3;
+    const int64_t num_queries = data.queries.size() / 3;
+    const core::Tensor points(data.points, {num_points, 3}, core::Float32);
+    const core::Tensor queries(data.queries, {num_queries, 3}, core::Float32);
+    const int max_neighbors = 4;
+
+    core::nns::FixedRadiusIndex index(points, data.radius, core::Int64);
+    core::Tensor all_indices, all_distances, all_row_splits;
+    std::tie(all_indices, all_distances, all_row_splits) =
+            index.SearchRadius(queries, data.radius);
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(queries, data.radius, true, max_neighbors);
+
+    ASSERT_EQ(row_splits.GetLength(), num_queries + 1);
+    for (int64_t i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<float, int64_t>> nearest;
+        for (int64_t j = all_row_splits[i].Item<int64_t>();
+             j < all_row_splits[i + 1].Item<int64_t>(); ++j) {
+            nearest.emplace_back(all_distances[j].Item<float>(),
+                                 all_indices[j].Item<int64_t>());
+        }
+        std::sort(nearest.begin(), nearest.end());
+        nearest.resize(std::min<size_t>(nearest.size(), max_neighbors));
+
+        const int64_t begin = row_splits[i].Item<int64_t>();
+        ASSERT_EQ(row_splits[i + 1].Item<int64_t>() - begin,
+                  int64_t(nearest.size()));
+        for (size_t k = 0; k < nearest.size(); ++k) {
+            EXPECT_EQ(indices[begin + k].Item<int64_t>(), nearest[k].second);
+            EXPECT_EQ(distances[begin + k].Item<float>(), nearest[k].first);
+        }
+    }
+}
+
+TEST(FixedRadiusSearch, HybridSearch) {
+    const SearchData data(1000, 500, 0.1f);
+    const int max_knn = 5;
+
+    VectorAllocator<float, int32_t> allocator;
+    core::nns::impl::HybridSearchCPU<float, int32_t>(
+            data.points.size() / 3, data.points.data(), data.queries.size() / 3,
+            data.queries.data(), data.radius, max_knn,
+            data.points_row_splits.size(), data.points_row_splits.data(),
+            data.queries_row_splits.size(), data.queries_row_splits.data(),
+            data.hash_table_splits.data(), data.hash_table_cell_splits.size(),
+            data.hash_table_cell_splits.data(), data.hash_table_index.data(),
+            core::nns::L2, allocator);
+
+    ASSERT_EQ(allocator.indices_.size(), data.queries.size() / 3 * max_knn);
+    for (size_t i = 0; i < data.queries.size() / 3; ++i) {
+        const std::vector<std::pair<float, int32_t>> gt = data.BruteForce(i);
+        const size_t count = std::min<size_t>(gt.size(), max_knn);
+        ASSERT_EQ(size_t(allocator.counts_[i]), count);
+        for (size_t k = 0; k < size_t(max_knn); ++k) {
+            const size_t idx = i * max_knn + k;
+            if (k < count) {
+                EXPECT_NEAR(allocator.distances_[idx], gt[k].first, 1e-6);
+            } else {
+                EXPECT_EQ(allocator.indices_[idx], -1);
+                EXPECT_EQ(allocator.distances_[idx], 0.f);
+            }
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
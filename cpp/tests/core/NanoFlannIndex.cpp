@@ -7,8 +7,11 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
@@ -16,6 +19,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Random.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -117,6 +121,51 @@ TEST(NanoFlannIndex, SearchKnn) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
+TEST(NanoFlannIndex, SearchKnnManyQueries) {
+    // Many queries, such that the results are written by several parallel
+    // blocks. Compare with a brute force search.
+    const int64_t num_points = 1000;
+    const int64_t num_queries = 5000;
+    const int knn = 8;
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(0.0, 1.0);
+    std::vector<double> points(num_points * 3);
+    std::vector<double> queries(num_queries * 3);
+    for (double &v : points) v = uniform();
+    for (double &v : queries) v = uniform();
+
+    core::nns::NanoFlannIndex index(
+            core::Tensor(points, {num_points, 3}, core::Float64),
+            core::Int64);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(
+            core::Tensor(queries, {num_queries, 3}, core::Float64), knn);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+    EXPECT_EQ(distances.GetShape(), core::SizeVector({num_queries, knn}));
+
+    std::vector<int64_t> gt_indices;
+    std::vector<double> gt_distances;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<double, int64_t>> dists(num_points);
+        for (int64_t j = 0; j < num_points; ++j) {
+            double dist = 0;
+            for (int k = 0; k < 3; ++k) {
+                const double d = queries[i * 3 + k] - points[j * 3 + k];
+                dist += d * d;
+            }
+            dists[j] = {dist, j};
+        }
+        std::partial_sort(dists.begin(), dists.begin() + knn, dists.end());
+        for (int k = 0; k < knn; ++k) {
+            gt_distances.push_back(dists[k].first);
+            gt_indices.push_back(dists[k].second);
+        }
+    }
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), gt_indices);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor(gt_distances, {num_queries, knn}, core::Float64)));
+}
+
 TEST(NanoFlannIndex, SearchRadius) {
     // Define test data.
     core::Device device = core::Device("CPU:0");
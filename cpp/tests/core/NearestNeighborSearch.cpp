@@ -236,6 +236,15 @@ TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
     EXPECT_EQ(distances.GetShape(), shape);
     EXPECT_TRUE(indices.AllClose(gt_indices));
     EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // If max_neighbors == 1, only the nearest neighbor is returned.
+    result = nns64.FixedRadiusSearch(query_points, 0.1, true, 1);
+    EXPECT_TRUE(std::get<0>(result).AllClose(
+            core::Tensor::Init<int64_t>({1}, device)));
+    EXPECT_TRUE(std::get<1>(result).AllClose(
+            core::Tensor::Init<double>({0.00626358}, device)));
+    EXPECT_TRUE(std::get<2>(result).AllClose(
+            core::Tensor::Init<int64_t>({0, 1}, device)));
 }
 
 TEST(NearestNeighborSearch, MultiRadiusSearch) {
@@ -125,5 +125,78 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, BatchSearch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    Eigen::Map<const Eigen::MatrixXd> queries((const double *)pc.points_.data(),
+                                              3, pc.points_.size());
+
+    geometry::KDTreeSearchParamKNN knn(30);
+    geometry::KDTreeSearchParamRadius radius(2.5);
+    geometry::KDTreeSearchParamHybrid hybrid(2.5, 15);
+    std::vector<const geometry::KDTreeSearchParam *> params = {&knn, &radius,
+                                                               &hybrid};
+
+    for (const auto *param : params) {
+        std::vector<size_t> offsets;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        EXPECT_TRUE(
+                kdtree.BatchSearch(queries, *param, offsets, indices, distance2));
+        EXPECT_EQ(offsets.size(), pc.points_.size() + 1);
+        EXPECT_EQ(offsets.back(), indices.size());
+        EXPECT_EQ(offsets.back(), distance2.size());
+
+        for (size_t i = 0; i < pc.points_.size(); ++i) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            int k = kdtree.Search(pc.points_[i], *param, ref_indices,
+                                  ref_distance2);
+            EXPECT_EQ(size_t(k), offsets[i + 1] - offsets[i]);
+            ExpectEQ(ref_indices,
+                     std::vector<int>(indices.begin() + offsets[i],
+                                      indices.begin() + offsets[i + 1]));
+            ExpectEQ(ref_distance2,
+                     std::vector<double>(distance2.begin() + offsets[i],
+                                         distance2.begin() + offsets[i + 1]));
+        }
+    }
+}
+
+TEST(KDTreeFlann, BatchSearchInvalid) {
+    geometry::PointCloud pc;
+    pc.points_.resize(10);
+    Rand(pc.points_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+
+    // Dimension mismatch.
+    Eigen::MatrixXd queries = Eigen::MatrixXd::Zero(2, 4);
+    EXPECT_FALSE(
+            kdtree.BatchSearchKNN(queries, 3, offsets, indices, distance2));
+    EXPECT_EQ(offsets, std::vector<size_t>(5, 0));
+    EXPECT_TRUE(indices.empty());
+    EXPECT_TRUE(distance2.empty());
+
+    // Empty tree.
+    geometry::KDTreeFlann empty_kdtree;
+    queries = Eigen::MatrixXd::Zero(3, 4);
+    EXPECT_FALSE(empty_kdtree.BatchSearchRadius(queries, 1.0, offsets,
+                                                indices, distance2));
+    EXPECT_EQ(offsets, std::vector<size_t>(5, 0));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -796,6 +796,48 @@ TEST(PointCloud, VoxelDownSample) {
              covariances_down);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {
+            // voxel_{0, 0, 2}
+            {0.6, 0.5, 2.3},
+            // voxel_{0, 0, 0}
+            {0.1, 0.2, 0.3},
+            {0.7, 0.6, 0.5},
+            // voxel_{0, 0, 2}
+            {0.4, 0.3, 2.7},
+    };
+    pcd.colors_ = {
+            {0.0, 0.0, 0.1},
+            {0.2, 0.2, 0.2},
+            {0.4, 0.4, 0.4},
+            {0.2, 0.2, 0.3},
+    };
+
+    std::shared_ptr<geometry::PointCloud> pc_down;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(pc_down, cubic_id, original_indices) =
+            pcd.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                        Eigen::Vector3d(3, 3, 3));
+
+    // The voxels are sorted by index, the points of a voxel keep their order.
+    ExpectEQ(pc_down->points_, std::vector<Eigen::Vector3d>({
+                                       {0.4, 0.4, 0.4},
+                                       {0.5, 0.4, 2.5},
+                               }));
+    ExpectEQ(pc_down->colors_, std::vector<Eigen::Vector3d>({
+                                       {0.3, 0.3, 0.3},
+                                       {0.1, 0.1, 0.2},
+                               }));
+    EXPECT_EQ(original_indices,
+              std::vector<std::vector<int>>({{1, 2}, {0, 3}}));
+    Eigen::MatrixXi cubic_id_gt(2, 8);
+    cubic_id_gt << 1, -1, -1, -1, -1, -1, -1, 2,  //
+            -1, -1, -1, 0, 3, -1, -1, -1;
+    EXPECT_EQ(cubic_id, cubic_id_gt);
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -9,6 +9,9 @@
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Random.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -1799,6 +1802,32 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    // More than 65536 triangles, i.e. the mesh is decimated in partitions.
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 130);
+    mesh->PaintUniformColor({1, 0, 0});
+    const int target = int(mesh->triangles_.size() / 10);
+
+    auto simplified = mesh->SimplifyQuadricDecimation(
+            target, std::numeric_limits<double>::infinity(), 1.0);
+    EXPECT_EQ(int(simplified->triangles_.size()), target);
+    EXPECT_EQ(simplified->vertex_colors_.size(), simplified->vertices_.size());
+    EXPECT_TRUE(simplified->IsEdgeManifold());
+    EXPECT_TRUE(simplified->IsWatertight());
+    for (size_t i = 0; i < simplified->vertices_.size(); ++i) {
+        EXPECT_NEAR(simplified->vertices_[i].norm(), 1.0, 2e-3);
+        ExpectEQ(simplified->vertex_colors_[i], Eigen::Vector3d(1, 0, 0));
+    }
+
+    // The maximum error stops the decimation of the flat box faces.
+    auto box = geometry::TriangleMesh::CreateBox()->SubdivideMidpoint(3);
+    simplified = box->SimplifyQuadricDecimation(12, 0.0, 1.0);
+    EXPECT_EQ(simplified->triangles_.size(), 12u);
+    EXPECT_EQ(simplified->vertices_.size(), 8u);
+    simplified = box->SimplifyQuadricDecimation(12, -1.0, 1.0);
+    EXPECT_EQ(simplified->triangles_.size(), box->triangles_.size());
+}
+
 TEST(TriangleMesh, SelectByIndex) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {360.784314, 717.647059, 800.000000},
@@ -2350,6 +2379,88 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonStreaming) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 60);
+    sphere->ComputeVertexNormals();
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertex_normals_;
+    const std::string filename = utility::filesystem::JoinPath(
+            utility::filesystem::GetTempDirectoryPath(), "poisson_sphere.ply");
+    EXPECT_TRUE(io::WritePointCloud(filename, pcd));
+
+    // A single tile and several tiles that are stitched.
+    for (size_t max_points_per_tile : {size_t(100000), size_t(1500)}) {
+        auto mesh = geometry::TriangleMesh::
+                CreateFromPointCloudPoissonStreaming(
+                        filename, 6, max_points_per_tile, 0.25, 1.1f, "", 1);
+        EXPECT_GT(mesh->triangles_.size(), 1000);
+        EXPECT_TRUE(mesh->IsWatertight());
+        EXPECT_TRUE(mesh->IsOrientable());
+        EXPECT_TRUE(mesh->HasVertexNormals());
+        double mean_dev = 0;
+        for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+            const Eigen::Vector3d& v = mesh->vertices_[i];
+            EXPECT_NEAR(v.norm(), 1.0, 0.1);
+            mean_dev += std::abs(v.norm() - 1.0);
+            // Normals point outwards.
+            EXPECT_GT(mesh->vertex_normals_[i].dot(v), 0);
+        }
+        EXPECT_LT(mean_dev / mesh->vertices_.size(), 0.02);
+    }
+    utility::filesystem::RemoveFile(filename);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Random points on the upper half of the unit sphere, such that
+    // the mesh has a border.
+    utility::random::Seed(0);
+    utility::random::NormalGenerator<double> normal(0.0, 1.0);
+    const int num_points = 6000;
+    geometry::PointCloud pcd;
+    for (int i = 0; i < num_points; ++i) {
+        Eigen::Vector3d p(normal(), normal(), normal());
+        p.normalize();
+        p.z() = std::abs(p.z());
+        pcd.normals_.push_back(p);
+        pcd.points_.push_back(p);
+    }
+    const double radius = 2.0 * std::sqrt(4.0 * M_PI / num_points);
+    const std::vector<double> radii = {radius, 2.0 * radius};
+
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            geometry::PointCloud(pcd.points_), radii));
+
+    // The partitioned reconstruction stitches the cells.
+    auto mesh_serial = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, 1);
+    auto mesh_parallel =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd, radii,
+                                                                     4);
+    for (const auto& mesh : {mesh_serial, mesh_parallel}) {
+        EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+        EXPECT_GT(mesh->triangles_.size(), size_t(1.9 * num_points));
+        EXPECT_TRUE(mesh->IsEdgeManifold(true));
+        EXPECT_TRUE(mesh->IsOrientable());
+        // Triangle normals agree with the point normals.
+        mesh->ComputeTriangleNormals();
+        for (size_t i = 0; i < mesh->triangles_.size(); ++i) {
+            EXPECT_GT(mesh->triangle_normals_[i].dot(
+                              pcd.normals_[mesh->triangles_[i](0)]),
+                      0);
+        }
+    }
+    // The cells do not depend on the number of threads, so the triangles
+    // are the same as in the serial run.
+    EXPECT_EQ(mesh_parallel->triangles_, mesh_serial->triangles_);
+    EXPECT_EQ(mesh_parallel->triangle_normals_,
+              mesh_serial->triangle_normals_);
+    auto mesh_default =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd,
+                                                                     radii);
+    EXPECT_EQ(mesh_default->triangles_, mesh_serial->triangles_);
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshAdjacency.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshAdjacency, DefaultConstructor) {
+    geometry::TriangleMeshAdjacency adjacency;
+    EXPECT_EQ(adjacency.GetNumVertices(), 0u);
+    EXPECT_EQ(adjacency.GetNumEdges(), 0u);
+    EXPECT_EQ(adjacency.GetEdgeIndex(0, 1), -1);
+
+    adjacency.Compute({}, 3);
+    EXPECT_EQ(adjacency.GetNumVertices(), 3u);
+    EXPECT_EQ(adjacency.GetNumEdges(), 0u);
+    EXPECT_EQ(adjacency.GetNumNeighbors(2), 0);
+
+    EXPECT_ANY_THROW(geometry::TriangleMeshAdjacency({{0, 1, 3}}, 3));
+}
+
+TEST(TriangleMeshAdjacency, Box) {
+    const auto box = geometry::TriangleMesh::CreateBox();
+    const geometry::TriangleMeshAdjacency adjacency(*box);
+    ASSERT_EQ(adjacency.GetNumVertices(), 8u);
+    ASSERT_EQ(adjacency.GetNumEdges(), 18u);
+
+    const auto &edges = adjacency.GetEdges();
+    EXPECT_TRUE(std::is_sorted(
+            edges.begin(), edges.end(),
+            [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+            }));
+    for (int eidx = 0; eidx < 18; ++eidx) {
+        EXPECT_LT(edges[eidx](0), edges[eidx](1));
+        EXPECT_EQ(adjacency.GetNumEdgeTriangles(eidx), 2);
+        EXPECT_EQ(adjacency.GetEdgeIndex(edges[eidx](0), edges[eidx](1)),
+                  eidx);
+        EXPECT_EQ(adjacency.GetEdgeIndex(edges[eidx](1), edges[eidx](0)),
+                  eidx);
+    }
+    EXPECT_EQ(adjacency.GetEdgeIndex(0, 7), -1);
+
+    for (size_t tidx = 0; tidx < box->triangles_.size(); ++tidx) {
+        const Eigen::Vector3i &triangle = box->triangles_[tidx];
+        for (int k = 0; k < 3; ++k) {
+            const int eidx = adjacency.GetTriangleEdges()[tidx](k);
+            EXPECT_EQ(edges[eidx],
+                      geometry::TriangleMesh::GetOrderedEdge(
+                              triangle(k), triangle((k + 1) % 3)));
+        }
+    }
+}
+
+TEST(TriangleMeshAdjacency, CompareToMaps) {
+    // Sphere with a duplicated and a degenerate triangle.
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 30);
+    mesh->triangles_.push_back(mesh->triangles_[10]);
+    mesh->triangles_.emplace_back(5, 5, 6);
+    const geometry::TriangleMeshAdjacency adjacency(*mesh);
+
+    const auto edges_to_triangles = mesh->GetEdgeToTrianglesMap();
+    ASSERT_EQ(adjacency.GetNumEdges(), edges_to_triangles.size());
+    for (int eidx = 0; eidx < int(adjacency.GetNumEdges()); ++eidx) {
+        const auto &edge = adjacency.GetEdges()[eidx];
+        std::vector<int> expected = edges_to_triangles.at(edge);
+        std::sort(expected.begin(), expected.end());
+        const std::vector<int> triangles(
+                adjacency.GetEdgeTriangles().begin() +
+                        adjacency.GetEdgeTriangleOffsets()[eidx],
+                adjacency.GetEdgeTriangles().begin() +
+                        adjacency.GetEdgeTriangleOffsets()[eidx + 1]);
+        EXPECT_EQ(triangles, expected);
+    }
+
+    mesh->ComputeAdjacencyList();
+    for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
+        std::vector<int> expected(mesh->adjacency_list_[vidx].begin(),
+                                  mesh->adjacency_list_[vidx].end());
+        std::sort(expected.begin(), expected.end());
+        const std::vector<int> neighbors(
+                adjacency.GetNeighbors().begin() +
+                        adjacency.GetNeighborOffsets()[vidx],
+                adjacency.GetNeighbors().begin() +
+                        adjacency.GetNeighborOffsets()[vidx + 1]);
+        EXPECT_EQ(neighbors, expected);
+        for (int k = adjacency.GetNeighborOffsets()[vidx];
+             k < adjacency.GetNeighborOffsets()[vidx + 1]; ++k) {
+            EXPECT_EQ(adjacency.GetEdges()[adjacency.GetNeighborEdges()[k]],
+                      geometry::TriangleMesh::GetOrderedEdge(
+                              vidx, adjacency.GetNeighbors()[k]));
+        }
+    }
+    // The degenerate triangle makes vertex 5 its own neighbor.
+    EXPECT_GE(adjacency.GetEdgeIndex(5, 5), 0);
+}
+
+TEST(TriangleMeshAdjacency, FiltersSetAdjacencyList) {
+    const auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto expected = std::make_shared<geometry::TriangleMesh>(*mesh);
+    expected->ComputeAdjacencyList();
+
+    // The filters compute the adjacency list of their output.
+    for (const auto &filtered :
+         {mesh->FilterSharpen(1, 1.0), mesh->FilterSmoothSimple(1),
+          mesh->FilterSmoothLaplacian(1, 0.5),
+          mesh->FilterSmoothTaubin(1, 0.5, -0.53)}) {
+        EXPECT_EQ(filtered->adjacency_list_, expected->adjacency_list_);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <vector>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Random.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Random triangle soup of small triangles, where consecutive triangles share
+/// a vertex.
+geometry::TriangleMesh CreateRandomTriangles(int num_triangles,
+                                             double triangle_size,
+                                             int seed) {
+    utility::random::Seed(seed);
+    utility::random::UniformRealGenerator<double> uniform(-1.0, 1.0);
+    geometry::TriangleMesh mesh;
+    for (int i = 0; i < num_triangles; ++i) {
+        const int v0 = static_cast<int>(mesh.vertices_.size());
+        const Eigen::Vector3d center(uniform(), uniform(), uniform());
+        mesh.vertices_.push_back(center);
+        for (int k = 0; k < 2; ++k) {
+            mesh.vertices_.push_back(
+                    center + triangle_size * Eigen::Vector3d(uniform(),
+                                                             uniform(),
+                                                             uniform()));
+        }
+        mesh.triangles_.emplace_back(v0, v0 + 1, v0 + 2);
+        if (i % 2 == 1) {
+            mesh.triangles_.emplace_back(v0 - 1, v0, v0 + 1);
+        }
+    }
+    return mesh;
+}
+
+std::vector<Eigen::Vector2i> BruteForceIntersectingTriangles(
+        const geometry::TriangleMesh &mesh0,
+        const geometry::TriangleMesh &mesh1,
+        bool self) {
+    std::vector<Eigen::Vector2i> pairs;
+    for (size_t i = 0; i < mesh0.triangles_.size(); ++i) {
+        const Eigen::Vector3i &tria_p = mesh0.triangles_[i];
+        for (size_t j = self ? i + 1 : 0; j < mesh1.triangles_.size(); ++j) {
+            const Eigen::Vector3i &tria_q = mesh1.triangles_[j];
+            bool share_vertex = false;
+            for (int k = 0; k < 3 && self; ++k) {
+                share_vertex = share_vertex || tria_p(k) == tria_q(0) ||
+                               tria_p(k) == tria_q(1) || tria_p(k) == tria_q(2);
+            }
+            if (!share_vertex &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh0.vertices_[tria_p(0)], mesh0.vertices_[tria_p(1)],
+                        mesh0.vertices_[tria_p(2)], mesh1.vertices_[tria_q(0)],
+                        mesh1.vertices_[tria_q(1)],
+                        mesh1.vertices_[tria_q(2)])) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    return pairs;
+}
+
+}  // namespace
+
+TEST(TriangleMeshBVH, DefaultConstructor) {
+    geometry::TriangleMeshBVH bvh;
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_FALSE(bvh.IsSelfIntersecting());
+    EXPECT_FALSE(bvh.SetTriangleMesh(geometry::TriangleMesh()));
+    EXPECT_TRUE(bvh.GetSelfIntersectingTriangles().empty());
+    EXPECT_FALSE(bvh.IsIntersecting(
+            geometry::TriangleMeshBVH(*geometry::TriangleMesh::CreateBox())));
+}
+
+TEST(TriangleMeshBVH, Nodes) {
+    const geometry::TriangleMesh mesh =
+            CreateRandomTriangles(5000, 0.05, /*seed=*/0);
+    const geometry::TriangleMeshBVH bvh(mesh);
+    const auto &nodes = bvh.GetNodes();
+    const auto &indices = bvh.GetTriangleIndices();
+    ASSERT_FALSE(bvh.IsEmpty());
+    EXPECT_EQ(nodes[0].begin_, 0);
+    EXPECT_EQ(nodes[0].end_, static_cast<int>(mesh.triangles_.size()));
+
+    // Each node is a leaf with at most kMaxLeafSize triangles or is split in
+    // two children whose bounds are inside of its bounds.
+    size_t num_leaf_triangles = 0;
+    std::vector<int> counts(mesh.triangles_.size(), 0);
+    for (const auto &node : nodes) {
+        if (node.IsLeaf()) {
+            EXPECT_LE(node.end_ - node.begin_,
+                      geometry::TriangleMeshBVH::kMaxLeafSize);
+            num_leaf_triangles += node.end_ - node.begin_;
+            for (int k = node.begin_; k < node.end_; ++k) {
+                counts[indices[k]]++;
+                for (int v = 0; v < 3; ++v) {
+                    const Eigen::Vector3d &vertex =
+                            mesh.vertices_[mesh.triangles_[indices[k]](v)];
+                    EXPECT_TRUE((vertex.array() >= node.min_bound_.array())
+                                        .all());
+                    EXPECT_TRUE((vertex.array() <= node.max_bound_.array())
+                                        .all());
+                }
+            }
+            continue;
+        }
+        const auto &left = nodes[node.left_];
+        const auto &right = nodes[node.right_];
+        EXPECT_EQ(left.begin_, node.begin_);
+        EXPECT_EQ(left.end_, right.begin_);
+        EXPECT_EQ(right.end_, node.end_);
+        for (const auto *child : {&left, &right}) {
+            EXPECT_TRUE((child->min_bound_.array() >= node.min_bound_.array())
+                                .all());
+            EXPECT_TRUE((child->max_bound_.array() <= node.max_bound_.array())
+                                .all());
+        }
+    }
+    EXPECT_EQ(num_leaf_triangles, mesh.triangles_.size());
+    EXPECT_EQ(counts, std::vector<int>(mesh.triangles_.size(), 1));
+}
+
+TEST(TriangleMeshBVH, GetSelfIntersectingTriangles) {
+    const geometry::TriangleMesh mesh =
+            CreateRandomTriangles(1500, 0.1, /*seed=*/1);
+    const std::vector<Eigen::Vector2i> expected =
+            BruteForceIntersectingTriangles(mesh, mesh, true);
+    ASSERT_GT(expected.size(), 0u);
+
+    const geometry::TriangleMeshBVH bvh(mesh);
+    ExpectEQ(bvh.GetSelfIntersectingTriangles(), expected);
+    EXPECT_TRUE(bvh.IsSelfIntersecting());
+    ExpectEQ(mesh.GetSelfIntersectingTriangles(), expected);
+
+    // Coincident triangles.
+    geometry::TriangleMesh mesh_coincident;
+    mesh_coincident.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0},
+                                 {0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    for (int i = 0; i < 20; ++i) {
+        mesh_coincident.triangles_.emplace_back(0, 1, 2);
+        mesh_coincident.triangles_.emplace_back(3, 4, 5);
+    }
+    EXPECT_EQ(geometry::TriangleMeshBVH(mesh_coincident)
+                      .GetSelfIntersectingTriangles()
+                      .size(),
+              400u);
+}
+
+TEST(TriangleMeshBVH, GetIntersectingTriangles) {
+    const geometry::TriangleMesh mesh0 =
+            CreateRandomTriangles(1000, 0.1, /*seed=*/2);
+    const geometry::TriangleMesh mesh1 =
+            CreateRandomTriangles(700, 0.1, /*seed=*/3);
+    const std::vector<Eigen::Vector2i> expected =
+            BruteForceIntersectingTriangles(mesh0, mesh1, false);
+    ASSERT_GT(expected.size(), 0u);
+
+    const geometry::TriangleMeshBVH bvh0(mesh0);
+    const geometry::TriangleMeshBVH bvh1(mesh1);
+    ExpectEQ(bvh0.GetIntersectingTriangles(bvh1), expected);
+    EXPECT_TRUE(bvh0.IsIntersecting(bvh1));
+    ExpectEQ(mesh0.GetIntersectingTriangles(mesh1), expected);
+    EXPECT_TRUE(mesh0.IsIntersecting(mesh1));
+
+    geometry::TriangleMesh mesh_far = mesh1;
+    mesh_far.Translate(Eigen::Vector3d(0, 0, 3));
+    EXPECT_FALSE(bvh0.IsIntersecting(geometry::TriangleMeshBVH(mesh_far)));
+    EXPECT_TRUE(mesh0.GetIntersectingTriangles(mesh_far).empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
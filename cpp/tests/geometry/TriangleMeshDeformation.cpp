@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshDeformation.h"
+
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Sphere whose bottom vertices are fixed and whose top vertices are handles
+/// that are moved up by \p offset.
+void CreateSphereConstraints(const geometry::TriangleMesh &mesh,
+                             double offset,
+                             std::vector<int> &constraint_ids,
+                             std::vector<Eigen::Vector3d> &constraint_pos) {
+    constraint_ids.clear();
+    constraint_pos.clear();
+    for (size_t i = 0; i < mesh.vertices_.size(); ++i) {
+        const Eigen::Vector3d &v = mesh.vertices_[i];
+        if (v.z() < -0.8) {
+            constraint_ids.push_back(int(i));
+            constraint_pos.push_back(v);
+        } else if (v.z() > 0.8) {
+            constraint_ids.push_back(int(i));
+            constraint_pos.push_back(v + Eigen::Vector3d(0, 0, offset));
+        }
+    }
+}
+
+}  // namespace
+
+TEST(TriangleMeshDeformation, Deform) {
+    const auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    CreateSphereConstraints(*sphere, 0.2, constraint_ids, constraint_pos);
+
+    using Energy = geometry::MeshBase::DeformAsRigidAsPossibleEnergy;
+    for (Energy energy : {Energy::Spokes, Energy::Smoothed}) {
+        geometry::DeformAsRigidAsPossibleContext context(
+                *sphere, constraint_ids, energy);
+        EXPECT_EQ(context.GetNumConstraints(), constraint_ids.size());
+        EXPECT_EQ(context.GetEnergy(), -1);
+
+        // A cold start gives the same result as DeformAsRigidAsPossible.
+        auto mesh = context.Deform(constraint_pos, 10);
+        auto mesh_gt = sphere->DeformAsRigidAsPossible(
+                constraint_ids, constraint_pos, 10, energy);
+        ExpectEQ(mesh->vertices_, mesh_gt->vertices_, 1e-8);
+        ExpectEQ(mesh->triangles_, sphere->triangles_);
+        ExpectEQ(context.GetVertices(), mesh->vertices_);
+        EXPECT_GT(context.GetEnergy(), 0);
+        for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+            ExpectEQ(mesh->vertices_[constraint_ids[idx]],
+                     constraint_pos[idx]);
+        }
+
+        context.Reset();
+        ExpectEQ(context.Deform(constraint_pos, 10)->vertices_,
+                 mesh_gt->vertices_, 1e-8);
+    }
+
+    geometry::DeformAsRigidAsPossibleContext context(*sphere, constraint_ids);
+    EXPECT_ANY_THROW(context.Deform({}, 1));
+    EXPECT_ANY_THROW(geometry::DeformAsRigidAsPossibleContext(*sphere, {-1}));
+}
+
+TEST(TriangleMeshDeformation, WarmStart) {
+    const auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+
+    // Move the handles in small steps, as in an interactive session. Each
+    // step starts from the previous solution and converges in a few
+    // iterations, while a cold start with the same number of iterations is
+    // further away from the converged solution.
+    CreateSphereConstraints(*sphere, 0.0, constraint_ids, constraint_pos);
+    geometry::DeformAsRigidAsPossibleContext warm(*sphere, constraint_ids);
+    geometry::DeformAsRigidAsPossibleContext cold(*sphere, constraint_ids);
+    warm.Deform(constraint_pos, 1);
+    for (int step = 1; step <= 5; ++step) {
+        CreateSphereConstraints(*sphere, 0.1 * step, constraint_ids,
+                                constraint_pos);
+        auto mesh_warm = warm.Deform(constraint_pos, 3);
+        cold.Reset();
+        auto mesh_cold = cold.Deform(constraint_pos, 3);
+        auto mesh_converged = sphere->DeformAsRigidAsPossible(
+                constraint_ids, constraint_pos, 100);
+
+        double error_warm = 0;
+        double error_cold = 0;
+        for (size_t i = 0; i < sphere->vertices_.size(); ++i) {
+            error_warm = std::max(error_warm, (mesh_warm->vertices_[i] -
+                                               mesh_converged->vertices_[i])
+                                                      .norm());
+            error_cold = std::max(error_cold, (mesh_cold->vertices_[i] -
+                                               mesh_converged->vertices_[i])
+                                                      .norm());
+        }
+        EXPECT_LT(error_warm, error_cold);
+        EXPECT_LE(warm.GetEnergy(), cold.GetEnergy());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -475,6 +475,53 @@ TEST(ReadWritePC, InMemoryXYZ) {
     delete[] buf;
 }
 
+TEST(ReadWritePC, ReadInChunks) {
+    geometry::PointCloud pc;
+    RandPC(pc, 101);
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+
+    for (const std::string filename :
+         {"chunksb.ply", "chunksa.ply", "chunks.xyz", "chunks.xyzn",
+          "chunks.xyzrgb"}) {
+        const std::string path = tmp_path + "/" + filename;
+        EXPECT_TRUE(WritePointCloud(
+                path, pc, {filename == "chunksa.ply", false, false}));
+        geometry::PointCloud pc_ref;
+        EXPECT_TRUE(ReadPointCloud(path, pc_ref));
+
+        for (size_t chunk_size : {1, 7, 101, 1000}) {
+            geometry::PointCloud pc_chunks;
+            size_t num_chunks = 0;
+            EXPECT_TRUE(io::ReadPointCloudInChunks(
+                    path, chunk_size,
+                    [&](const geometry::PointCloud &chunk) {
+                        EXPECT_LE(chunk.points_.size(), chunk_size);
+                        pc_chunks += chunk;
+                        ++num_chunks;
+                        return true;
+                    }));
+            EXPECT_EQ(num_chunks, (pc.points_.size() + chunk_size - 1) /
+                                          chunk_size);
+            ExpectEQ(pc_chunks.points_, pc_ref.points_);
+            ExpectEQ(pc_chunks.normals_, pc_ref.normals_);
+            ExpectEQ(pc_chunks.colors_, pc_ref.colors_);
+        }
+
+        // Reading stops as soon as the callback returns false.
+        size_t num_points = 0;
+        EXPECT_TRUE(io::ReadPointCloudInChunks(
+                path, 10, [&](const geometry::PointCloud &chunk) {
+                    num_points += chunk.points_.size();
+                    return false;
+                }));
+        EXPECT_EQ(num_points, 10);
+    }
+
+    EXPECT_FALSE(io::ReadPointCloudInChunks(
+            tmp_path + "/chunks.pcd", 10,
+            [](const geometry::PointCloud &) { return true; }));
+}
+
 TEST(PointCloudIO, DISABLED_CreatePointCloudFromFile) { NotImplemented(); }
 
 TEST(PointCloudIO, DISABLED_CreatePointCloudFromMemory) { NotImplemented(); }
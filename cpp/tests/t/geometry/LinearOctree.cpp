@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Random.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+t::geometry::PointCloud CreateRandomPointCloud(int64_t num_points) {
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(-1.0, 1.0);
+    std::vector<double> points(num_points * 3);
+    std::vector<double> colors(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        // Cluster half of the points, such that the octree is unbalanced.
+        const double scale = i % 2 == 0 ? 1.0 : 0.1;
+        for (int k = 0; k < 3; ++k) {
+            points[3 * i + k] = scale * uniform();
+            colors[3 * i + k] = 0.5 * (uniform() + 1.0);
+        }
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Float64));
+    pcd.SetPointColors(core::Tensor(colors, {num_points, 3}, core::Float64));
+    return pcd;
+}
+
+}  // namespace
+
+TEST(LinearOctree, DefaultConstructor) {
+    t::geometry::LinearOctree octree;
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_EQ(octree.GetNumNodes(), 0);
+    EXPECT_EQ(octree.GetNumLeaves(), 0);
+    EXPECT_FALSE(octree.HasPointIndices());
+    EXPECT_FALSE(octree.HasLeafColors());
+}
+
+TEST(LinearOctree, CreateFromPointCloud) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(2000);
+    const geometry::PointCloud pcd_legacy = pcd.ToLegacy();
+
+    for (int max_depth : {0, 1, 4, 7}) {
+        const auto octree =
+                t::geometry::LinearOctree::CreateFromPointCloud(pcd, max_depth);
+        geometry::Octree octree_legacy(max_depth);
+        octree_legacy.ConvertFromPointCloud(pcd_legacy);
+
+        EXPECT_TRUE(octree.HasPointIndices());
+        EXPECT_TRUE(octree.HasLeafColors());
+        EXPECT_EQ(octree.GetPointIndices().GetLength(), 2000);
+        EXPECT_TRUE(octree.ToLegacy() == octree_legacy);
+
+        // Same nodes in the same DFS order as the legacy octree.
+        size_t num_legacy_nodes = 0;
+        octree_legacy.Traverse(
+                [&](const std::shared_ptr<geometry::OctreeNode> &,
+                    const std::shared_ptr<geometry::OctreeNodeInfo> &) {
+                    ++num_legacy_nodes;
+                    return false;
+                });
+        std::vector<int64_t> visited;
+        octree.Traverse([&](int64_t node, int depth) {
+            EXPECT_EQ(octree.GetNodeDepth(node), depth);
+            visited.push_back(node);
+            return false;
+        });
+        EXPECT_EQ(visited.size(), num_legacy_nodes);
+        EXPECT_EQ(static_cast<int64_t>(visited.size()), octree.GetNumNodes());
+
+        // The root contains all points and the children of a node partition
+        // its points.
+        const int64_t *child_ranges =
+                octree.GetChildRanges().GetDataPtr<int64_t>();
+        const int64_t *point_ranges =
+                octree.GetPointRanges().GetDataPtr<int64_t>();
+        EXPECT_EQ(point_ranges[0], 0);
+        EXPECT_EQ(point_ranges[1], 2000);
+        for (int64_t node = 0; node < octree.GetNumNodes(); ++node) {
+            if (octree.GetNodeDepth(node) == max_depth) {
+                EXPECT_EQ(child_ranges[2 * node], child_ranges[2 * node + 1]);
+                continue;
+            }
+            int64_t begin = point_ranges[2 * node];
+            for (int64_t child = child_ranges[2 * node];
+                 child < child_ranges[2 * node + 1]; ++child) {
+                EXPECT_EQ(point_ranges[2 * child], begin);
+                begin = point_ranges[2 * child + 1];
+            }
+            EXPECT_EQ(begin, point_ranges[2 * node + 1]);
+        }
+
+        // Round trip through the legacy octree.
+        const auto octree_from_legacy =
+                t::geometry::LinearOctree::FromLegacy(octree_legacy);
+        EXPECT_TRUE(octree_from_legacy.GetCodes().AllEqual(octree.GetCodes()));
+        EXPECT_TRUE(octree_from_legacy.GetLevelSplits().AllEqual(
+                octree.GetLevelSplits()));
+        EXPECT_TRUE(octree_from_legacy.GetPointIndices().AllEqual(
+                octree.GetPointIndices()));
+        EXPECT_TRUE(octree_from_legacy.GetLeafColors().AllClose(
+                octree.GetLeafColors()));
+    }
+}
+
+TEST(LinearOctree, LocateLeaves) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    const auto octree =
+            t::geometry::LinearOctree::CreateFromPointCloud(pcd, 6);
+
+    const core::Tensor leaves = octree.LocateLeaves(pcd.GetPointPositions());
+    const int64_t *leaves_ptr = leaves.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_GE(leaves_ptr[i], 0);
+        EXPECT_EQ(octree.GetNodeDepth(leaves_ptr[i]), 6);
+        const core::Tensor indices =
+                octree.GetPointIndicesOfNode(leaves_ptr[i]);
+        const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        EXPECT_TRUE(std::find(indices_ptr, indices_ptr + indices.GetLength(),
+                              i) != indices_ptr + indices.GetLength());
+    }
+
+    // Outside of the bounds and inside of the bounds but in an empty leaf.
+    const core::Tensor queries = core::Tensor::Init<float>(
+            {{10.f, 0.f, 0.f}, {0.f, -10.f, 0.f}, {0.5f, 0.5f, 0.5f}});
+    EXPECT_TRUE(octree.LocateLeaves(queries).AllEqual(
+            core::Tensor::Init<int64_t>({-1, -1, -1})));
+}
+
+TEST(LinearOctree, FindLeavesInBox) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    const auto octree =
+            t::geometry::LinearOctree::CreateFromPointCloud(pcd, 5);
+    const core::Tensor min_bound = core::Tensor::Init<double>({-0.2, 0, -1});
+    const core::Tensor max_bound = core::Tensor::Init<double>({0.3, 0.5, 0.1});
+
+    // Brute force over all leaves.
+    const core::Tensor node_origins = octree.GetNodeOrigins();
+    const double *origins = node_origins.GetDataPtr<double>();
+    const double leaf_size = octree.GetNodeSize(5);
+    const double box_min[3] = {-0.2, 0, -1};
+    const double box_max[3] = {0.3, 0.5, 0.1};
+    std::vector<int64_t> expected;
+    const int64_t leaf_begin = octree.GetLevelSplits()[5].Item<int64_t>();
+    for (int64_t node = leaf_begin; node < octree.GetNumNodes(); ++node) {
+        bool intersects = true;
+        for (int k = 0; k < 3; ++k) {
+            intersects = intersects && origins[3 * node + k] <= box_max[k] &&
+                         box_min[k] < origins[3 * node + k] + leaf_size;
+        }
+        if (intersects) {
+            expected.push_back(node);
+        }
+    }
+
+    const core::Tensor leaves = octree.FindLeavesInBox(min_bound, max_bound);
+    EXPECT_GT(expected.size(), 0u);
+    EXPECT_EQ(leaves.ToFlatVector<int64_t>(), expected);
+}
+
+TEST(LinearOctree, VoxelGrid) {
+    utility::random::Seed(0);
+    utility::random::UniformIntGenerator<int> uniform(0, 15);
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.1;
+    voxel_grid.origin_ = Eigen::Vector3d(-1, 0.5, 2);
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(15, 15, 15),
+                                        Eigen::Vector3d(1, 0, 0)));
+    for (int i = 0; i < 200; ++i) {
+        const Eigen::Vector3i index(uniform(), uniform(), uniform());
+        voxel_grid.AddVoxel(
+                geometry::Voxel(index, index.cast<double>() / 15.0));
+    }
+
+    const auto octree =
+            t::geometry::LinearOctree::CreateFromVoxelGrid(voxel_grid, 4);
+    EXPECT_FALSE(octree.HasPointIndices());
+    EXPECT_EQ(octree.GetNumLeaves(),
+              static_cast<int64_t>(voxel_grid.voxels_.size()));
+    EXPECT_TRUE(octree.ToLegacy() == *voxel_grid.ToOctree(4));
+
+    const geometry::VoxelGrid voxel_grid_out = octree.ToVoxelGrid();
+    EXPECT_NEAR(voxel_grid_out.voxel_size_, voxel_grid.voxel_size_, 1e-12);
+    EXPECT_TRUE(voxel_grid_out.origin_.isApprox(voxel_grid.origin_));
+    ASSERT_EQ(voxel_grid_out.voxels_.size(), voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        ASSERT_TRUE(voxel_grid_out.voxels_.count(it.first));
+        EXPECT_TRUE(voxel_grid_out.voxels_.at(it.first).color_.isApprox(
+                it.second.color_));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
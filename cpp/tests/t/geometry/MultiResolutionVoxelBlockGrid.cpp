@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using namespace t::geometry;
+
+class MultiResolutionVoxelBlockGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(MultiResolutionVoxelBlockGrid,
+                         MultiResolutionVoxelBlockGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+namespace {
+
+const int kWidth = 320;
+const int kHeight = 240;
+
+core::Tensor GetIntrinsic() {
+    return core::Tensor::Init<double>(
+            {{200, 0, 160}, {0, 200, 120}, {0, 0, 1}});
+}
+
+core::Tensor GetExtrinsic(double x) {
+    core::Tensor extrinsic = core::Tensor::Eye(4, core::Float64, core::Device());
+    extrinsic[0][3] = -x;
+    return extrinsic;
+}
+
+/// Depth of the slanted plane z = 1.2 + 0.82 x seen from the camera at
+/// (camera_x, 0, 0), which ranges from 0.72 to 3.5 across the image.
+float GetPlaneDepth(int u, double camera_x) {
+    return static_cast<float>((1.2 + 0.82 * camera_x) /
+                              (1.0 - 0.82 * (u - 160) / 200.0));
+}
+
+Image GetPlaneDepthImage(double camera_x, const core::Device &device) {
+    std::vector<float> depth(kWidth * kHeight);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            depth[v * kWidth + u] = GetPlaneDepth(u, camera_x);
+        }
+    }
+    return Image(core::Tensor(depth, {kHeight, kWidth, 1}, core::Float32,
+                              device));
+}
+
+/// Writes the TSDF of a sphere into the blocks of a level near the sphere.
+/// The blocks of level 0 are in x < 0 and y < 0, the blocks of level 1 in
+/// x < 0 and y >= 0 and the blocks of level 2 in x >= 0, so that each pair of
+/// levels has a common boundary.
+void WriteSphere(MultiResolutionVoxelBlockGrid &vbg,
+                 int64_t level,
+                 int64_t block_resolution,
+                 const Eigen::Vector3d &center,
+                 double radius,
+                 double trunc_voxel_multiplier,
+                 const core::Device &device) {
+    const double voxel_size = vbg.GetVoxelSize(level);
+    const double block_size = voxel_size * block_resolution;
+    const double sdf_trunc = voxel_size * trunc_voxel_multiplier;
+    const int extent =
+            static_cast<int>(std::ceil((radius + sdf_trunc) / block_size)) + 1;
+    std::vector<int> keys;
+    for (int z = -extent; z < extent; ++z) {
+        for (int y = -extent; y < extent; ++y) {
+            for (int x = -extent; x < extent; ++x) {
+                const int block_level = x >= 0 ? 2 : (y >= 0 ? 1 : 0);
+                const Eigen::Vector3d block_center =
+                        (Eigen::Vector3d(x, y, z).array() + 0.5) * block_size;
+                if (block_level == level &&
+                    std::abs((block_center - center).norm() - radius) <
+                            block_size + sdf_trunc) {
+                    keys.insert(keys.end(), {x, y, z});
+                }
+            }
+        }
+    }
+
+    VoxelBlockGrid &grid = vbg.GetLevel(level);
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = grid.GetHashMap().Activate(core::Tensor(
+            keys, {int64_t(keys.size()) / 3, 3}, core::Int32, device));
+    core::Tensor voxel_coords, flattened_indices;
+    std::tie(voxel_coords, flattened_indices) =
+            grid.GetVoxelCoordinatesAndFlattenedIndices(buf_indices);
+    const core::Tensor offsets = voxel_coords -
+                                 core::Tensor::Init<float>(
+                                         {{float(center.x()), float(center.y()),
+                                           float(center.z())}},
+                                         device);
+    const core::Tensor distances =
+            (offsets * offsets).Sum({1}).Sqrt() - float(radius);
+    grid.GetAttribute("tsdf").View({-1}).IndexSet(
+            {flattened_indices},
+            (distances / float(sdf_trunc)).Clip(-1.0f, 1.0f));
+    grid.GetAttribute("weight").View({-1}).IndexSet(
+            {flattened_indices},
+            core::Tensor::Full({flattened_indices.GetLength()}, 10.0f,
+                               core::Float32, device));
+}
+
+}  // namespace
+
+TEST_P(MultiResolutionVoxelBlockGridPermuteDevices, Integrate) {
+    const core::Device device = GetParam();
+    MultiResolutionVoxelBlockGrid vbg({"tsdf", "weight"},
+                                      {core::Float32, core::Float32},
+                                      {{1}, {1}}, 0.01, 8, 1000, 3, 1.0, 0.2,
+                                      device);
+    EXPECT_EQ(vbg.GetNumLevels(), 3);
+    EXPECT_FLOAT_EQ(vbg.GetVoxelSize(2), 0.04);
+    EXPECT_FLOAT_EQ(vbg.GetDepthRange(1).first, 0.8);
+    EXPECT_FLOAT_EQ(vbg.GetDepthRange(1).second, 2.4);
+    EXPECT_TRUE(std::isinf(vbg.GetDepthRange(2).second));
+
+    const core::Tensor intrinsic = GetIntrinsic();
+    for (int i = 0; i < 4; ++i) {
+        const Image depth = GetPlaneDepthImage(0.02 * i, device);
+        const core::Tensor extrinsic = GetExtrinsic(0.02 * i);
+        std::vector<core::Tensor> block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, 1.0f, 4.0f, 4.0f);
+        ASSERT_EQ(block_coords.size(), 3);
+        vbg.Integrate(block_coords, depth, intrinsic, extrinsic, 1.0f, 4.0f,
+                      4.0f);
+    }
+    for (int64_t level = 0; level < 3; ++level) {
+        EXPECT_GT(vbg.GetLevel(level).GetHashMap().Size(), 0);
+    }
+
+    // Ray casting blends the levels without gaps at the level boundaries.
+    const Image depth = GetPlaneDepthImage(0.03, device);
+    const core::Tensor extrinsic = GetExtrinsic(0.03);
+    std::vector<core::Tensor> block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, 1.0f, 4.0f, 4.0f);
+    TensorMap renderings = vbg.RayCast(
+            block_coords, intrinsic, extrinsic, kWidth, kHeight,
+            {"depth", "normal"}, 1.0f, 0.1f, 4.0f, 3.0f, 4.0f);
+    EXPECT_TRUE(renderings.Contains("normal"));
+    const std::vector<float> rendered_depth =
+            renderings["depth"].ToFlatVector<float>();
+    int64_t num_valid = 0, num_pixels = 0;
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 5; u < kWidth - 5; ++u) {
+            const float d = rendered_depth[v * kWidth + u];
+            const float d_gt = GetPlaneDepth(u, 0.03);
+            ++num_pixels;
+            if (d > 0) {
+                ++num_valid;
+                EXPECT_NEAR(d, d_gt, 0.05 * d_gt);
+            }
+        }
+    }
+    EXPECT_GT(num_valid, 0.95 * num_pixels);
+
+    // Between the depths 0.8 and 2.4, which cover both level boundaries, the
+    // mesh has the area of the plane, so there are neither holes nor
+    // overlapping levels.
+    const TriangleMesh mesh = vbg.ExtractTriangleMesh(3.0f);
+    const std::vector<float> vertices =
+            mesh.GetVertexPositions().ToFlatVector<float>();
+    const std::vector<int64_t> triangles =
+            mesh.GetTriangleIndices().To(core::Int64).ToFlatVector<int64_t>();
+    ASSERT_GT(triangles.size(), 0);
+    double area = 0;
+    for (size_t i = 0; i < triangles.size(); i += 3) {
+        Eigen::Vector3d p[3];
+        for (int k = 0; k < 3; ++k) {
+            const float *vertex = &vertices[3 * triangles[i + k]];
+            p[k] = Eigen::Vector3d(vertex[0], vertex[1], vertex[2]);
+        }
+        const double z = (p[0].z() + p[1].z() + p[2].z()) / 3.0;
+        if (z >= 0.8 && z < 2.4) {
+            area += 0.5 * (p[1] - p[0]).cross(p[2] - p[0]).norm();
+        }
+        // All the vertices are on the plane.
+        EXPECT_NEAR(p[0].z(), 1.2 + 0.82 * p[0].x(), 0.04);
+    }
+    // The plane between the depths z0 and z1 covers the image height 1.2 z
+    // and the x range (z1 - z0) / 0.82 with a slope of 0.82.
+    const double area_gt =
+            1.2 * std::sqrt(1 + 0.82 * 0.82) / 0.82 * (2.4 * 2.4 - 0.8 * 0.8) /
+            2.0;
+    EXPECT_NEAR(area, area_gt, 0.05 * area_gt);
+}
+
+TEST_P(MultiResolutionVoxelBlockGridPermuteDevices,
+       ExtractTriangleMeshWatertight) {
+    const core::Device device = GetParam();
+    MultiResolutionVoxelBlockGrid vbg({"tsdf", "weight"},
+                                      {core::Float32, core::Float32},
+                                      {{1}, {1}}, 0.02, 8, 1000, 3, 1.0, 0.2,
+                                      device);
+    // The sphere does not pass close to a voxel, where Marching Cubes creates
+    // degenerate triangles.
+    const Eigen::Vector3d center(0.0031, -0.0057, 0.0023);
+    const double radius = 0.377;
+    for (int64_t level = 0; level < 3; ++level) {
+        WriteSphere(vbg, level, 8, center, radius, 4.0, device);
+    }
+
+    // The seams between all the pairs of levels are closed.
+    geometry::TriangleMesh mesh = vbg.ExtractTriangleMesh(3.0f).ToLegacy();
+    ASSERT_GT(mesh.triangles_.size(), 0);
+    EXPECT_TRUE(mesh.IsEdgeManifold(false));
+    EXPECT_TRUE(mesh.IsWatertight());
+    for (const Eigen::Vector3d &vertex : mesh.vertices_) {
+        EXPECT_NEAR((vertex - center).norm(), radius, 0.02);
+    }
+}
+
+TEST_P(MultiResolutionVoxelBlockGridPermuteDevices, InvalidArguments) {
+    const core::Device device = GetParam();
+    // The block resolution 6 does not align the blocks with the cubes of
+    // level 2.
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            0.01, 6, 1000, 3, 1.0, 0.2, device));
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            0.01, 8, 1000, 3, 1.0, 1.0, device));
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"weight"}, {core::Float32}, {{1}}, 0.01, 8, 1000, 3, 1.0, 0.2,
+            device));
+
+    MultiResolutionVoxelBlockGrid vbg({"tsdf", "weight"},
+                                      {core::Float32, core::Float32},
+                                      {{1}, {1}}, 0.01, 8, 1000, 2, 1.0, 0.2,
+                                      device);
+    const Image depth = GetPlaneDepthImage(0, device);
+    std::vector<core::Tensor> block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, GetIntrinsic(), GetExtrinsic(0), 1.0f, 4.0f, 4.0f);
+    EXPECT_ANY_THROW(vbg.Integrate({block_coords[0]}, depth, GetIntrinsic(),
+                                   GetExtrinsic(0), 1.0f, 4.0f, 4.0f));
+    EXPECT_ANY_THROW(vbg.RayCast(block_coords, GetIntrinsic(),
+                                 GetExtrinsic(0), kWidth, kHeight, {"index"}));
+}
+
+}  // namespace tests
+}  // namespace open3d
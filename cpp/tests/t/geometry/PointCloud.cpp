@@ -9,16 +9,20 @@
 
 #include <gmock/gmock.h>
 
+#include <Eigen/Geometry>
 #include <limits>
+#include <numeric>
 
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Random.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -1023,6 +1027,145 @@ TEST_P(PointCloudPermuteDevices, RemoveStatisticalOutliers) {
                     std::get<0>(res)->points_, core::Float64, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, RemoveOutliersChunked) {
+    core::Device device = GetParam();
+    if (device.IsSYCL()) GTEST_SKIP() << "Not Implemented!";
+
+    // A dense cluster inside sparse points. With 1024 neighbors the outlier
+    // removal searches run on chunks of 4096 query points, i.e. on 3 chunks.
+    // The masks must match the ones computed from the unchunked searches of
+    // the neighborhood cache.
+    std::vector<Eigen::Vector3d> points;
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(0.0, 1.0);
+    for (int i = 0; i < 8000; ++i) {
+        points.emplace_back(uniform() * 0.1, uniform() * 0.1, uniform() * 0.1);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        points.emplace_back(uniform(), uniform(), uniform());
+    }
+    const t::geometry::PointCloud pcd(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    points, core::Float64, device));
+    t::geometry::PointCloud pcd_cached = pcd;
+    const int64_t num_points = static_cast<int64_t>(points.size());
+
+    core::Tensor mask = std::get<1>(pcd.RemoveStatisticalOutliers(1024, 1.0));
+    pcd_cached.ComputeNeighborhoodCache(1024);
+    EXPECT_TRUE(mask.AllEqual(
+            std::get<1>(pcd_cached.RemoveStatisticalOutliers(1024, 1.0))));
+    int64_t num_inliers = mask.To(core::Int64).Sum({0}).Item<int64_t>();
+    EXPECT_GT(num_inliers, 0);
+    EXPECT_LT(num_inliers, num_points);
+
+    mask = std::get<1>(pcd.RemoveRadiusOutliers(1024, 0.05));
+    pcd_cached.ComputeNeighborhoodCache(utility::nullopt, 0.05);
+    EXPECT_TRUE(mask.AllEqual(
+            std::get<1>(pcd_cached.RemoveRadiusOutliers(1024, 0.05))));
+    num_inliers = mask.To(core::Int64).Sum({0}).Item<int64_t>();
+    EXPECT_GT(num_inliers, 0);
+    EXPECT_LT(num_inliers, num_points);
+}
+
+TEST_P(PointCloudPermuteDevices, NeighborhoodCache) {
+    core::Device device = GetParam();
+    if (device.IsSYCL()) GTEST_SKIP() << "Not Implemented!";
+
+    data::PCDPointCloud sample_pcd_data;
+    geometry::PointCloud pcd_legacy;
+    io::ReadPointCloud(sample_pcd_data.GetPath(), pcd_legacy);
+    pcd_legacy.normals_.clear();
+
+    auto down_pcd = pcd_legacy.VoxelDownSample(0.05);
+    t::geometry::PointCloud pcd_ref = t::geometry::PointCloud::FromLegacy(
+            *down_pcd, core::Float64, device);
+    t::geometry::PointCloud pcd = pcd_ref.Clone();
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+    EXPECT_ANY_THROW(pcd.GetNeighborhoodCache());
+
+    // Hybrid search.
+    pcd.ComputeNeighborhoodCache(30, 0.1);
+    EXPECT_TRUE(pcd.HasNeighborhoodCache());
+    const t::geometry::NeighborhoodCache &cache = pcd.GetNeighborhoodCache();
+    EXPECT_EQ(cache.GetSearchType(),
+              t::geometry::NeighborhoodCache::SearchType::Hybrid);
+    EXPECT_EQ(cache.GetIndices().GetShape(),
+              core::SizeVector({pcd.GetPointPositions().GetLength(), 30}));
+
+    pcd.EstimateNormals(30, 0.1);
+    pcd_ref.EstimateNormals(30, 0.1);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(pcd_ref.GetPointNormals()));
+
+    EXPECT_TRUE(std::get<1>(pcd.ComputeBoundaryPoints(0.1, 30))
+                        .AllEqual(std::get<1>(
+                                pcd_ref.ComputeBoundaryPoints(0.1, 30))));
+    EXPECT_TRUE(std::get<1>(pcd.RemoveRadiusOutliers(10, 0.1))
+                        .AllEqual(std::get<1>(
+                                pcd_ref.RemoveRadiusOutliers(10, 0.1))));
+
+    // KNN search with more neighbors than needed by RemoveStatisticalOutliers.
+    pcd.ComputeNeighborhoodCache(30);
+    EXPECT_EQ(pcd.GetNeighborhoodCache().GetSearchType(),
+              t::geometry::NeighborhoodCache::SearchType::KNN);
+    EXPECT_TRUE(std::get<1>(pcd.RemoveStatisticalOutliers(20, 2.0))
+                        .AllEqual(std::get<1>(
+                                pcd_ref.RemoveStatisticalOutliers(20, 2.0))));
+
+    // Radius search.
+    pcd.ComputeNeighborhoodCache(utility::nullopt, 0.1);
+    EXPECT_EQ(pcd.GetNeighborhoodCache().GetSearchType(),
+              t::geometry::NeighborhoodCache::SearchType::Radius);
+    EXPECT_EQ(pcd.GetNeighborhoodCache().GetCounts().GetLength(),
+              pcd.GetPointPositions().GetLength() + 1);
+    EXPECT_TRUE(std::get<1>(pcd.RemoveRadiusOutliers(10, 0.1))
+                        .AllEqual(std::get<1>(
+                                pcd_ref.RemoveRadiusOutliers(10, 0.1))));
+
+    // The cache is invalidated when the positions change.
+    pcd.Translate(core::Tensor::Init<double>({1, 0, 0}));
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+
+    pcd.ComputeNeighborhoodCache(30);
+    t::geometry::PointCloud pcd_copy = pcd;
+    EXPECT_TRUE(pcd_copy.HasNeighborhoodCache());
+    pcd_copy.SetPointPositions(pcd.GetPointPositions().Clone());
+    EXPECT_FALSE(pcd_copy.HasNeighborhoodCache());
+    EXPECT_TRUE(pcd.HasNeighborhoodCache());
+    pcd.ClearNeighborhoodCache();
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+
+    // Computing a cache for a shallow copy does not change the original.
+    pcd.ComputeNeighborhoodCache(30);
+    pcd_copy = pcd;
+    pcd_copy.ComputeNeighborhoodCache(utility::nullopt, 0.1);
+    EXPECT_EQ(pcd.GetNeighborhoodCache().GetSearchType(),
+              t::geometry::NeighborhoodCache::SearchType::KNN);
+    EXPECT_EQ(pcd_copy.GetNeighborhoodCache().GetSearchType(),
+              t::geometry::NeighborhoodCache::SearchType::Radius);
+
+    // In-place edits of the shared positions invalidate both caches.
+    core::Tensor positions = pcd_copy.GetPointPositions();
+    positions.Slice(0, 0, 1).Fill(0.0);
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+    EXPECT_FALSE(pcd_copy.HasNeighborhoodCache());
+
+    pcd.ComputeNeighborhoodCache(30);
+    pcd_copy = pcd;
+    pcd.Rotate(core::Tensor::Init<double>({{0, -1, 0}, {1, 0, 0}, {0, 0, 1}},
+                                          device),
+               core::Tensor::Zeros({3}, core::Float64, device));
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+    EXPECT_FALSE(pcd_copy.HasNeighborhoodCache());
+
+    // So do writes through the data pointer.
+    pcd.ComputeNeighborhoodCache(30);
+    const double value = 1.0;
+    core::MemoryManager::MemcpyFromHost(
+            pcd.GetPointPositions().GetDataPtr(), device, &value,
+            sizeof(double));
+    EXPECT_FALSE(pcd.HasNeighborhoodCache());
+}
+
 TEST_P(PointCloudPermuteDevices, RemoveDuplicatedPoints) {
     core::Device device = GetParam();
     if (device.IsSYCL()) GTEST_SKIP() << "Not Implemented!";
@@ -1158,6 +1301,93 @@ TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST_P(PointCloudPermuteDevices, ClusterDBSCANDeterministic) {
+    core::Device device = GetParam();
+
+    // Cluster B (indices 1, 4, 6, 8) has a smaller first core point than
+    // cluster A (indices 3, 5, 7, 9). Point 2 is a border point of both
+    // clusters and point 0 is noise.
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd(
+                core::Tensor::Init<double>({{10.0, 0.0, 0.0},
+                                            {3.3, 0.0, 0.0},
+                                            {1.8, 0.0, 0.0},
+                                            {0.0, 0.0, 0.0},
+                                            {2.7, 0.0, 0.0},
+                                            {0.3, 0.0, 0.0},
+                                            {3.0, 0.0, 0.0},
+                                            {0.6, 0.0, 0.0},
+                                            {3.6, 0.0, 0.0},
+                                            {0.9, 0.0, 0.0}},
+                                           device)
+                        .To(dtype));
+        core::Tensor labels = pcd.ClusterDBSCAN(1.0, 4, false);
+        EXPECT_EQ(labels.GetDevice(), device);
+        EXPECT_EQ(labels.To(core::Device("CPU:0")).ToFlatVector<int>(),
+                  std::vector<int>({-1, 0, 0, 1, 0, 1, 0, 1, 0, 1}));
+    }
+
+    // Points at distance eps are not neighbors.
+    t::geometry::PointCloud pcd_eps(core::Tensor::Init<double>(
+            {{0.0, 0.0, 0.0}, {0.5, 0.0, 0.0}, {1.0, 0.0, 0.0}}, device));
+    EXPECT_EQ(pcd_eps.ClusterDBSCAN(0.5, 2, false)
+                      .To(core::Device("CPU:0"))
+                      .ToFlatVector<int>(),
+              std::vector<int>({-1, -1, -1}));
+
+    // Compare with the sequential cluster expansion on random points.
+    std::vector<Eigen::Vector3d> points(2000);
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(0.0, 1.0);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const double offset = double(i % 4) * 0.5;
+        points[i] = Eigen::Vector3d(uniform() + offset, uniform(),
+                                    uniform() * 0.2);
+    }
+    const double eps = 0.05;
+    const size_t min_points = 5;
+    std::vector<std::vector<int>> nbs(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t j = 0; j < points.size(); ++j) {
+            if ((points[i] - points[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(int(j));
+            }
+        }
+    }
+    std::vector<int> gt_labels(points.size(), -2);
+    int cluster_label = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (gt_labels[i] != -2) continue;
+        if (nbs[i].size() < min_points) {
+            gt_labels[i] = -1;
+            continue;
+        }
+        std::vector<int> queue = {int(i)};
+        gt_labels[i] = cluster_label;
+        while (!queue.empty()) {
+            const int p = queue.back();
+            queue.pop_back();
+            if (nbs[p].size() < min_points) continue;
+            for (int q : nbs[p]) {
+                if (gt_labels[q] < 0) {
+                    if (gt_labels[q] == -2) queue.push_back(q);
+                    gt_labels[q] = cluster_label;
+                }
+            }
+        }
+        ++cluster_label;
+    }
+    EXPECT_GT(cluster_label, 1);
+
+    t::geometry::PointCloud pcd(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    points, core::Float64, device));
+    EXPECT_EQ(pcd.ClusterDBSCAN(eps, min_points, false)
+                      .To(core::Device("CPU:0"))
+                      .ToFlatVector<int>(),
+              gt_labels);
+}
+
 TEST_P(PointCloudPermuteDevices, SegmentPlane) {
     core::Device device = GetParam();
 
@@ -1181,6 +1411,74 @@ TEST_P(PointCloudPermuteDevices, SegmentPlane) {
             0.1, 0.1));
 }
 
+TEST_P(PointCloudPermuteDevices, SegmentPlanes) {
+    core::Device device = GetParam();
+
+    // Half of the points on the plane z = 0.5, 30% on the plane x = 2 and the
+    // rest scattered in a box.
+    std::vector<Eigen::Vector3d> points(10000);
+    std::vector<int> gt_labels(points.size());
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(-1.0, 1.0);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const double u = uniform(), v = uniform();
+        if (i % 10 < 5) {
+            points[i] = Eigen::Vector3d(u, v, 0.5);
+            gt_labels[i] = 0;
+        } else if (i % 10 < 8) {
+            points[i] = Eigen::Vector3d(2.0, u, v);
+            gt_labels[i] = 1;
+        } else {
+            points[i] = Eigen::Vector3d(u * 3.0, v * 3.0, uniform() * 3.0);
+            gt_labels[i] = -1;
+        }
+    }
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        points, dtype, device));
+
+        core::Tensor plane_models, labels;
+        std::tie(plane_models, labels) =
+                pcd.SegmentPlanes(3, 0.01, 3, 1000, 0.99999999, 500);
+        EXPECT_EQ(plane_models.GetDevice(), device);
+        EXPECT_EQ(labels.GetDtype(), core::Int32);
+        ASSERT_EQ(plane_models.GetShape(), core::SizeVector({2, 4}));
+
+        // Planes are only defined up to sign, use the one with d < 0.
+        std::vector<double> planes =
+                plane_models.To(core::Device("CPU:0")).ToFlatVector<double>();
+        for (size_t p = 0; p < 2; ++p) {
+            if (planes[4 * p + 3] > 0) {
+                std::transform(planes.begin() + 4 * p,
+                               planes.begin() + 4 * p + 4,
+                               planes.begin() + 4 * p,
+                               [](double x) { return -x; });
+            }
+        }
+        const std::vector<double> gt_planes = {0, 0, 1, -0.5, 1, 0, 0, -2};
+        for (size_t k = 0; k < gt_planes.size(); ++k) {
+            EXPECT_NEAR(planes[k], gt_planes[k], 1e-4);
+        }
+        const std::vector<int> labels_vec =
+                labels.To(core::Device("CPU:0")).ToFlatVector<int>();
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (gt_labels[i] >= 0) {
+                EXPECT_EQ(labels_vec[i], gt_labels[i]);
+            }
+        }
+
+        // SegmentPlane finds the largest plane.
+        core::Tensor plane_model, inliers;
+        std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 1000);
+        EXPECT_EQ(inliers.GetDtype(), core::Int64);
+        EXPECT_GE(inliers.GetLength(), 5000);
+        plane_model = plane_model.To(core::Device("CPU:0"));
+        EXPECT_NEAR(std::abs(plane_model[2].Item<double>()), 1.0, 1e-4);
+    }
+}
+
 TEST_P(PointCloudPermuteDevices, ComputeConvexHull) {
     core::Device device = GetParam();
 
@@ -1213,7 +1511,7 @@ TEST_P(PointCloudPermuteDevices, ComputeConvexHull) {
     auto point_indices = mesh.GetVertexAttr("point_indices");
     EXPECT_EQ(point_indices.GetDtype(), core::Int32);
     EXPECT_EQ(point_indices.ToFlatVector<int>(),
-              std::vector<int>({2, 3, 0, 1}));
+              std::vector<int>({0, 1, 2, 3}));
     EXPECT_TRUE(mesh.GetVertexPositions().AllEqual(
             pcd.GetPointPositions().IndexGet({point_indices.To(core::Int64)})));
 
@@ -1231,22 +1529,81 @@ TEST_P(PointCloudPermuteDevices, ComputeConvexHull) {
     mesh = pcd.ComputeConvexHull();
     point_indices = mesh.GetVertexAttr("point_indices");
     EXPECT_EQ(point_indices.ToFlatVector<int>(),
-              std::vector<int>({7, 3, 1, 5, 6, 2, 8, 4}));
+              std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8}));
     EXPECT_TRUE(mesh.GetVertexPositions().AllEqual(
             pcd.GetPointPositions().IndexGet({point_indices.To(core::Int64)})));
     ExpectEQ(mesh.GetTriangleIndices().ToFlatVector<int>(),
-             std::vector<int>{1, 0, 2,  //
-                              0, 3, 2,  //
-                              3, 4, 2,  //
-                              4, 5, 2,  //
-                              0, 4, 3,  //
-                              4, 0, 6,  //
-                              7, 1, 2,  //
-                              5, 7, 2,  //
-                              7, 0, 1,  //
-                              0, 7, 6,  //
+             std::vector<int>{4, 2, 6,  //
+                              2, 7, 6,  //
+                              7, 4, 6,  //
+                              2, 1, 3,  //
+                              1, 7, 3,  //
+                              7, 2, 3,  //
+                              1, 4, 5,  //
                               4, 7, 5,  //
-                              7, 4, 6});
+                              7, 1, 5,  //
+                              4, 1, 0,  //
+                              1, 2, 0,  //
+                              2, 4, 0});
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeConvexHullSphere) {
+    core::Device device = GetParam();
+
+    // The first 500 points are on the unit sphere, all of them are hull
+    // vertices. The other points are inside the sphere.
+    std::vector<Eigen::Vector3d> points(20000);
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(-1.0, 1.0);
+    for (size_t i = 0; i < points.size(); ++i) {
+        do {
+            points[i] = Eigen::Vector3d(uniform(), uniform(), uniform());
+        } while (points[i].norm() > 1.0 || points[i].norm() < 0.1);
+        if (i < 500) {
+            points[i].normalize();
+        } else {
+            points[i] *= 0.9;
+        }
+    }
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        points, dtype, device));
+        t::geometry::TriangleMesh mesh = pcd.ComputeConvexHull();
+        EXPECT_EQ(mesh.GetDevice(), device);
+        EXPECT_EQ(mesh.GetVertexPositions().GetDtype(), dtype);
+        std::vector<int> gt_indices(500);
+        std::iota(gt_indices.begin(), gt_indices.end(), 0);
+        EXPECT_EQ(mesh.GetVertexAttr("point_indices").ToFlatVector<int>(),
+                  gt_indices);
+        // A closed triangulation of a sphere has 2 V - 4 triangles.
+        ASSERT_EQ(mesh.GetTriangleIndices().GetLength(), 996);
+
+        // All the triangles face outwards.
+        const std::vector<double> vertices = mesh.GetVertexPositions()
+                                                     .To(core::Float64)
+                                                     .ToFlatVector<double>();
+        const std::vector<int> triangles =
+                mesh.GetTriangleIndices().ToFlatVector<int>();
+        for (size_t t = 0; t < triangles.size(); t += 3) {
+            const Eigen::Map<const Eigen::Vector3d> a(
+                    &vertices[3 * triangles[t]]);
+            const Eigen::Map<const Eigen::Vector3d> b(
+                    &vertices[3 * triangles[t + 1]]);
+            const Eigen::Map<const Eigen::Vector3d> c(
+                    &vertices[3 * triangles[t + 2]]);
+            EXPECT_GT((b - a).cross(c - a).dot(a + b + c), 0);
+        }
+
+        // Joggling keeps the hull vertices of points in general position.
+        mesh = t::geometry::TriangleMesh(pcd.GetPointPositions(),
+                                         core::Tensor({0, 3}, core::Int64,
+                                                      device))
+                       .ComputeConvexHull(true);
+        EXPECT_EQ(mesh.GetVertexAttr("point_indices").ToFlatVector<int>(),
+                  gt_indices);
+    }
 }
 
 }  // namespace tests
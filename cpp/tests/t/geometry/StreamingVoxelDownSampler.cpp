@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2024 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/StreamingVoxelDownSampler.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Random.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class StreamingVoxelDownSamplerPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(StreamingVoxelDownSampler,
+                         StreamingVoxelDownSamplerPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+namespace {
+
+t::geometry::PointCloud CreateRandomPointCloud(int64_t num_points,
+                                               const core::Device &device) {
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(-2.0, 2.0);
+    std::vector<double> points(num_points * 3);
+    std::vector<double> colors(num_points * 3);
+    for (int64_t i = 0; i < num_points * 3; ++i) {
+        points[i] = uniform();
+        colors[i] = 0.25 * (uniform() + 2.0);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Float64, device));
+    pcd.SetPointColors(
+            core::Tensor(colors, {num_points, 3}, core::Float64, device));
+    return pcd;
+}
+
+/// Returns the rows of the positions and colors sorted by position.
+std::vector<std::array<double, 6>> GetSortedRows(
+        const t::geometry::PointCloud &pcd) {
+    const std::vector<double> points =
+            pcd.GetPointPositions().ToFlatVector<double>();
+    const std::vector<double> colors =
+            pcd.GetPointColors().ToFlatVector<double>();
+    std::vector<std::array<double, 6>> rows(points.size() / 3);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = {points[3 * i],     points[3 * i + 1], points[3 * i + 2],
+                   colors[3 * i],     colors[3 * i + 1], colors[3 * i + 2]};
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
+void ExpectSameRows(const t::geometry::PointCloud &pcd,
+                    const t::geometry::PointCloud &pcd_gt) {
+    const auto rows = GetSortedRows(pcd);
+    const auto rows_gt = GetSortedRows(pcd_gt);
+    ASSERT_EQ(rows.size(), rows_gt.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        for (int k = 0; k < 6; ++k) {
+            EXPECT_NEAR(rows[i][k], rows_gt[i][k], 1e-6);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_P(StreamingVoxelDownSamplerPermuteDevices, AddChunk) {
+    const core::Device device = GetParam();
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(5000, device);
+    const t::geometry::PointCloud pcd_gt = pcd.VoxelDownSample(0.5);
+    const int64_t num_points = pcd.GetPointPositions().GetLength();
+
+    // Without and with spilling to disk.
+    for (int64_t max_voxels : {int64_t(1) << 20, int64_t(100)}) {
+        t::geometry::StreamingVoxelDownSampler sampler(0.5, max_voxels, "", 2,
+                                                       device);
+        for (int64_t begin = 0; begin < num_points; begin += 700) {
+            const int64_t end = std::min(num_points, begin + 700);
+            sampler.AddChunk(pcd.SelectByIndex(
+                    core::Tensor::Arange(begin, end, 1, core::Int64, device)));
+        }
+        EXPECT_EQ(sampler.GetNumPoints(), num_points);
+        EXPECT_EQ(sampler.GetNumSpilledTiles() > 0, max_voxels == 100);
+
+        const t::geometry::PointCloud pcd_down = sampler.Extract();
+        EXPECT_EQ(pcd_down.GetDevice(), device);
+        EXPECT_EQ(pcd_down.GetPointPositions().GetDtype(), core::Float64);
+        ExpectSameRows(pcd_down, pcd_gt);
+
+        // Extract() resets the sampler.
+        EXPECT_EQ(sampler.GetNumPoints(), 0);
+        EXPECT_EQ(sampler.GetNumVoxelsInMemory(), 0);
+        EXPECT_EQ(sampler.GetNumSpilledTiles(), 0);
+        EXPECT_TRUE(sampler.Extract().IsEmpty());
+    }
+
+    // Chunks have to match the attributes of the first chunk.
+    t::geometry::StreamingVoxelDownSampler sampler(0.5, 1 << 20, "", 256,
+                                                   device);
+    sampler.AddChunk(pcd);
+    EXPECT_ANY_THROW(sampler.AddChunk(
+            t::geometry::PointCloud(pcd.GetPointPositions())));
+    EXPECT_ANY_THROW(t::geometry::StreamingVoxelDownSampler(0.0));
+}
+
+TEST(StreamingVoxelDownSampler, AddFile) {
+    const t::geometry::PointCloud pcd =
+            CreateRandomPointCloud(3000, core::Device("CPU:0"));
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() +
+            "/streaming_voxel_down_sampler.xyzrgb";
+    ASSERT_TRUE(io::WritePointCloud(file_name, pcd.ToLegacy()));
+
+    t::geometry::StreamingVoxelDownSampler sampler(0.5, 50, "", 2);
+    EXPECT_TRUE(sampler.AddFile(file_name, 500, core::Float64));
+    EXPECT_EQ(sampler.GetNumPoints(), 3000);
+    const t::geometry::PointCloud pcd_down = sampler.Extract();
+
+    geometry::PointCloud pcd_legacy;
+    ASSERT_TRUE(io::ReadPointCloud(file_name, pcd_legacy));
+    ExpectSameRows(pcd_down,
+                   t::geometry::PointCloud::FromLegacy(pcd_legacy,
+                                                       core::Float64)
+                           .VoxelDownSample(0.5));
+    utility::filesystem::RemoveFile(file_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -1517,6 +1517,73 @@ TEST_P(TriangleMeshPermuteDevices, RemoveNonManifoldEdges) {
     EXPECT_TRUE(mesh.GetTriangleAttr("labels").AllClose(expected_labels));
 }
 
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+    if (device.IsSYCL()) GTEST_SKIP() << "Not Implemented!";
+
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::CreateSphere(1.0, 50).To(device);
+    mesh.ComputeVertexNormals();
+    const int64_t num_triangles = mesh.GetTriangleIndices().GetLength();
+    const double volume = mesh.ToLegacy().GetVolume();
+
+    // Partitions with at most 1000 triangles and a single partition.
+    for (int max_partition_triangles : {1000, 65536}) {
+        for (bool preserve_volume : {false, true}) {
+            t::geometry::TriangleMesh simplified =
+                    mesh.SimplifyQuadricDecimation(0.9, preserve_volume,
+                                                   max_partition_triangles);
+            EXPECT_EQ(simplified.GetDevice(), device);
+            EXPECT_EQ(simplified.GetTriangleIndices().GetLength(),
+                      num_triangles / 10);
+            EXPECT_TRUE(simplified.HasVertexNormals());
+            EXPECT_EQ(simplified.GetVertexNormals().GetLength(),
+                      simplified.GetVertexPositions().GetLength());
+
+            // All vertices stay close to the sphere.
+            const core::Tensor positions =
+                    simplified.GetVertexPositions().To(core::Device("CPU:0"));
+            const core::Tensor radii = (positions * positions).Sum({1}).Sqrt();
+            EXPECT_LT((radii - 1).Abs().Max({0}).Item<float>(), 0.02);
+
+            const geometry::TriangleMesh legacy = simplified.ToLegacy();
+            EXPECT_TRUE(legacy.IsEdgeManifold());
+            if (preserve_volume) {
+                EXPECT_NEAR(legacy.GetVolume(), volume, 1e-4);
+            }
+        }
+    }
+}
+
+TEST_P(TriangleMeshPermuteDevices, BooleanOperations) {
+    core::Device device = GetParam();
+    if (device.IsSYCL()) GTEST_SKIP() << "Not Implemented!";
+
+    // Two unit boxes overlapping in [0.5, 1] x [0.5, 1] x [0, 1], so that the
+    // top and bottom faces are coplanar.
+    t::geometry::TriangleMesh box_a =
+            t::geometry::TriangleMesh::CreateBox().To(device);
+    t::geometry::TriangleMesh box_b =
+            t::geometry::TriangleMesh::CreateBox().To(device);
+    box_b.Translate(core::Tensor::Init<float>({0.5, 0.5, 0}, device));
+
+    const std::vector<std::pair<t::geometry::TriangleMesh, double>> results =
+            {{box_a.BooleanUnion(box_b), 1.75},
+             {box_a.BooleanIntersection(box_b), 0.25},
+             {box_a.BooleanDifference(box_b), 0.75},
+             {box_a.BooleanDifference(box_a), 0.0}};
+    for (const auto &result : results) {
+        EXPECT_EQ(result.first.GetDevice(), device);
+        const geometry::TriangleMesh legacy = result.first.ToLegacy();
+        if (result.second > 0) {
+            EXPECT_TRUE(legacy.IsWatertight());
+            EXPECT_NEAR(legacy.GetVolume(), result.second, 1e-6);
+        } else {
+            EXPECT_TRUE(legacy.IsEmpty());
+        }
+    }
+}
+
 TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
     auto mesh_empty = t::geometry::TriangleMesh();
     EXPECT_THROW(mesh_empty.SamplePointsUniformly(100), std::runtime_error);
@@ -1596,5 +1663,41 @@ TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
     }
 }
 
+TEST_P(TriangleMeshPermuteDevices, GetSelfIntersectingTriangles) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh_empty(device);
+    EXPECT_EQ(mesh_empty.GetSelfIntersectingTriangles().GetShape(),
+              core::SizeVector({0, 2}));
+
+    // Triangles 0 and 2 intersect, triangles 0 and 1 share an edge.
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertexPositions(core::Tensor::Init<double>({{0, 0, 0},
+                                                        {0, 1, 0},
+                                                        {1, 0, 0},
+                                                        {1, 1, 0},
+                                                        {0.2, 0.2, -1},
+                                                        {0.2, 0.2, 1},
+                                                        {-1, -1, 0.5}},
+                                                       device));
+    mesh.SetTriangleIndices(core::Tensor::Init<int32_t>(
+            {{0, 1, 2}, {1, 2, 3}, {4, 5, 6}}, device));
+    const core::Tensor pairs = mesh.GetSelfIntersectingTriangles();
+    EXPECT_EQ(pairs.GetDtype(), core::Int64);
+    EXPECT_TRUE(pairs.GetDevice().IsCPU());
+    EXPECT_TRUE(pairs.AllEqual(core::Tensor::Init<int64_t>({{0, 2}})));
+
+    t::geometry::TriangleMesh box =
+            t::geometry::TriangleMesh::CreateBox(1, 1, 1, core::Float32,
+                                                 core::Int64, device);
+    EXPECT_EQ(box.GetSelfIntersectingTriangles().GetLength(), 0);
+    box.Translate(core::Tensor::Init<float>({0, 0, 0.75}, device));
+    // Only triangle 2 of the mesh reaches into the translated box.
+    const core::Tensor box_pairs = box.GetIntersectingTriangles(mesh);
+    EXPECT_GT(box_pairs.GetLength(), 0);
+    EXPECT_TRUE(box_pairs.Slice(1, 1, 2).AllEqual(
+            core::Tensor::Full({box_pairs.GetLength(), 1}, 2, core::Int64)));
+}
+
 }  // namespace tests
 }  // namespace open3d
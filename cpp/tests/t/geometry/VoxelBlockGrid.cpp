@@ -7,6 +7,8 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <map>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -72,17 +74,21 @@ static std::vector<core::HashBackendType> EnumerateBackends(
 }
 
 static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
-                                const core::Dtype &dtype,
+                                const std::vector<core::Dtype> &attr_dtypes,
                                 const core::Device &device,
-                                const int resolution) {
+                                const int resolution,
+                                const int64_t max_resident_blocks = 0) {
     core::Tensor intrinsic = GetIntrinsicTensor();
     std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
 
-    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
-                              {core::Float32, dtype, dtype}, {{1}, {1}, {3}},
-                              3.0 / 512, resolution, 10000, device, backend);
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"}, attr_dtypes,
+                              {{1}, {1}, {3}}, 3.0 / 512, resolution, 10000,
+                              device, backend);
+    if (max_resident_blocks > 0) {
+        vbg.EnablePaging(max_resident_blocks, "", /*page_size=*/1);
+    }
 
     data::SampleRedwoodRGBDImages redwood_data;
     for (size_t i = 0; i < extrinsics.size(); ++i) {
@@ -104,6 +110,15 @@ static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
     return vbg;
 }
 
+static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
+                                const core::Dtype &dtype,
+                                const core::Device &device,
+                                const int resolution,
+                                const int64_t max_resident_blocks = 0) {
+    return Integrate(backend, {core::Float32, dtype, dtype}, device,
+                     resolution, max_resident_blocks);
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, Construct) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -263,6 +278,68 @@ TEST_P(VoxelBlockGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, QuantizedAttributes) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        core::HashMap hashmap = vbg.GetHashMap();
+        const int64_t num_blocks = hashmap.Size();
+        core::Tensor active_indices =
+                hashmap.GetActiveIndices().To(core::Int64);
+        const int64_t num_points =
+                vbg.ExtractPointCloud().GetPointPositions().GetLength();
+        const int64_t num_triangles =
+                vbg.ExtractTriangleMesh().GetTriangleIndices().GetLength();
+
+        // 7 and 6 bytes per voxel instead of 20.
+        for (const auto &attr_dtypes : std::vector<std::vector<core::Dtype>>{
+                     {core::Int16, core::UInt16, core::UInt8},
+                     {core::Int16, core::UInt8, core::UInt8}}) {
+            auto vbg_quantized = Integrate(backend, attr_dtypes, device, 8);
+            core::HashMap hashmap_quantized = vbg_quantized.GetHashMap();
+            EXPECT_EQ(hashmap_quantized.Size(), num_blocks);
+
+            core::Tensor buf_indices, masks;
+            hashmap_quantized.Find(
+                    hashmap.GetKeyTensor().IndexGet({active_indices}),
+                    buf_indices, masks);
+            core::Tensor active_indices_quantized = buf_indices.To(core::Int64);
+
+            // The int16 tsdf is normalized to [-32767, 32767].
+            core::Tensor tsdf = vbg.GetAttribute("tsdf").IndexGet(
+                    {active_indices});
+            core::Tensor tsdf_quantized =
+                    vbg_quantized.GetAttribute("tsdf")
+                            .IndexGet({active_indices_quantized})
+                            .To(core::Float32) /
+                    32767.0;
+            EXPECT_TRUE(tsdf_quantized.AllClose(tsdf, 0, 1e-3));
+            EXPECT_TRUE(vbg_quantized.GetAttribute("weight")
+                                .IndexGet({active_indices_quantized})
+                                .To(core::Float32)
+                                .AllEqual(vbg.GetAttribute("weight").IndexGet(
+                                        {active_indices})));
+
+            EXPECT_NEAR(vbg_quantized.ExtractPointCloud()
+                                .GetPointPositions()
+                                .GetLength(),
+                        num_points, num_points * 0.001);
+            EXPECT_NEAR(vbg_quantized.ExtractTriangleMesh()
+                                .GetTriangleIndices()
+                                .GetLength(),
+                        num_triangles, num_triangles * 0.001);
+        }
+
+        // Unsupported combinations.
+        EXPECT_THROW(Integrate(backend, {core::Int16, core::Float32,
+                                         core::Float32},
+                               device, 8),
+                     std::runtime_error);
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, IO) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -284,6 +361,114 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, Paging) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 8);
+        core::HashMap hashmap = vbg.GetHashMap();
+        const int64_t num_blocks = hashmap.Size();
+
+        // Integrate the same trajectory with a budget of a quarter of the
+        // blocks in memory.
+        auto vbg_paged =
+                Integrate(backend, core::UInt16, device, 8, num_blocks / 4);
+        EXPECT_TRUE(vbg_paged.IsPagingEnabled());
+        EXPECT_GT(vbg_paged.GetNumPagedOutBlocks(), 0);
+        EXPECT_THROW(vbg_paged.Save("tmp.npz"), std::runtime_error);
+
+        // The hash map is shrunk when its capacity exceeds four times the
+        // budget, the initial capacity of 10000 blocks is not kept.
+        const int64_t capacity_paged = vbg_paged.GetHashMap().GetCapacity();
+        EXPECT_LE(capacity_paged,
+                  4 * std::max(num_blocks / 4,
+                               vbg_paged.GetHashMap().Size()));
+        EXPECT_LT(capacity_paged, hashmap.GetCapacity());
+        EXPECT_EQ(vbg_paged.GetAttribute("tsdf").GetLength(), capacity_paged);
+
+        vbg_paged.DisablePaging();
+        EXPECT_FALSE(vbg_paged.IsPagingEnabled());
+        EXPECT_EQ(vbg_paged.GetNumPagedOutBlocks(), 0);
+        core::HashMap hashmap_paged = vbg_paged.GetHashMap();
+        EXPECT_EQ(hashmap_paged.Size(), num_blocks);
+
+        // The blocks must be the same as without paging.
+        core::Tensor active_indices =
+                hashmap.GetActiveIndices().To(core::Int64);
+        core::Tensor buf_indices, masks;
+        hashmap_paged.Find(hashmap.GetKeyTensor().IndexGet({active_indices}),
+                           buf_indices, masks);
+        EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), num_blocks);
+        core::Tensor active_indices_paged = buf_indices.To(core::Int64);
+        for (const std::string attr : {"tsdf", "weight", "color"}) {
+            EXPECT_TRUE(vbg_paged.GetAttribute(attr)
+                                .IndexGet({active_indices_paged})
+                                .AllEqual(vbg.GetAttribute(attr).IndexGet(
+                                        {active_indices})));
+        }
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractTriangleMeshIncremental) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        const int64_t num_blocks = vbg.GetHashMap().Size();
+        EXPECT_EQ(vbg.GetNumDirtyBlocks(), num_blocks);
+
+        // All the blocks are dirty, the chunks form the full mesh.
+        core::Tensor block_coords;
+        std::vector<TriangleMesh> chunks;
+        std::tie(block_coords, chunks) = vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(vbg.GetNumDirtyBlocks(), 0);
+        EXPECT_EQ(block_coords.GetShape(), core::SizeVector({num_blocks, 3}));
+        EXPECT_EQ(int64_t(chunks.size()), num_blocks);
+
+        std::map<std::vector<int>, int64_t> num_triangles;
+        std::vector<int> coords = block_coords.ToFlatVector<int>();
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            num_triangles[{coords[3 * i], coords[3 * i + 1],
+                           coords[3 * i + 2]}] =
+                    chunks[i].GetTriangleIndices().GetLength();
+        }
+
+        std::tie(block_coords, chunks) = vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(block_coords.GetLength(), 0);
+        EXPECT_TRUE(chunks.empty());
+
+        // Integrate the first frame again and patch the chunks.
+        data::SampleRedwoodRGBDImages redwood_data;
+        Image depth =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+                        ->To(device);
+        core::Tensor intrinsic = GetIntrinsicTensor();
+        core::Tensor extrinsic = GetExtrinsicTensors()[0];
+        core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, 1000.0, 3.0, 4.0);
+        vbg.Integrate(frustum_block_coords, depth, intrinsic, extrinsic,
+                      1000.0, 3.0, 4.0);
+        EXPECT_EQ(vbg.GetNumDirtyBlocks(), frustum_block_coords.GetLength());
+
+        std::tie(block_coords, chunks) = vbg.ExtractTriangleMeshIncremental();
+        EXPECT_GE(block_coords.GetLength(), frustum_block_coords.GetLength());
+        coords = block_coords.ToFlatVector<int>();
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            num_triangles[{coords[3 * i], coords[3 * i + 1],
+                           coords[3 * i + 2]}] =
+                    chunks[i].GetTriangleIndices().GetLength();
+        }
+        int64_t num_patched_triangles = 0;
+        for (const auto &it : num_triangles) {
+            num_patched_triangles += it.second;
+        }
+        EXPECT_EQ(num_patched_triangles,
+                  vbg.ExtractTriangleMesh().GetTriangleIndices().GetLength());
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -344,6 +529,54 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, RayCastingEmptySpace) {
+    core::Device device = GetParam();
+
+    // Two fronto-parallel walls at 0.5m and 2m with empty blocks between
+    // them, in an image whose size is not a multiple of the CPU tiles.
+    const int width = 100, height = 75;
+    const int u_edge = 30;
+    auto get_depth = [&](int u) { return u < u_edge ? 0.5f : 2.0f; };
+    std::vector<float> depth_data(width * height);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            depth_data[v * width + u] = get_depth(u);
+        }
+    }
+    Image depth(core::Tensor(depth_data, {height, width, 1}, core::Float32,
+                             device));
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, 50}, {0, 100, 37.5}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device());
+
+    for (auto backend : EnumerateBackends(device, false)) {
+        auto vbg = VoxelBlockGrid({"tsdf", "weight"},
+                                  {core::Float32, core::Float32}, {{1}, {1}},
+                                  0.02, 8, 10000, device, backend);
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, 1.0f, 3.0f, 4.0f);
+        vbg.Integrate(block_coords, depth, intrinsic, extrinsic, 1.0f, 3.0f,
+                      4.0f);
+
+        auto result = vbg.RayCast(block_coords, intrinsic, extrinsic, width,
+                                  height, {"depth"}, 1.0f, 0.1f, 3.0f, 1.0f,
+                                  4.0f);
+        std::vector<float> rendered_depth =
+                result["depth"].ToFlatVector<float>();
+        // The blocks at the image borders and at the edge of the near wall are
+        // not fully observed.
+        const int margin = 8;
+        for (int v = margin; v < height - margin; ++v) {
+            for (int u = margin; u < width - margin; ++u) {
+                if (std::abs(u - u_edge) <= 3) continue;
+                EXPECT_NEAR(rendered_depth[v * width + u], get_depth(u),
+                            0.02);
+            }
+        }
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -0,0 +1,41 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# Copyright (c) 2018-2024 www.open3d.org
+# SPDX-License-Identifier: MIT
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+
+
+def test_create_from_point_cloud():
+    rng = np.random.default_rng(0)
+    points = rng.uniform(-1, 1, size=(500, 3))
+    pcd = o3d.t.geometry.PointCloud(o3d.core.Tensor(points))
+    octree = o3d.t.geometry.LinearOctree.create_from_point_cloud(pcd, 4)
+
+    pcd_legacy = o3d.geometry.PointCloud(o3d.utility.Vector3dVector(points))
+    octree_legacy = o3d.geometry.Octree(max_depth=4)
+    octree_legacy.convert_from_point_cloud(pcd_legacy)
+
+    assert octree.max_depth == 4
+    assert octree.point_indices.shape == (500,)
+    assert octree.num_leaves == octree.level_splits[5].item(
+    ) - octree.level_splits[4].item()
+    octree_from_legacy = o3d.t.geometry.LinearOctree.from_legacy(
+        octree_legacy)
+    np.testing.assert_equal(octree_from_legacy.codes.numpy(),
+                            octree.codes.numpy())
+    np.testing.assert_equal(octree_from_legacy.point_indices.numpy(),
+                            octree.point_indices.numpy())
+
+    # Every point is located in a leaf containing it.
+    leaves = octree.locate_leaves(pcd.point.positions).numpy()
+    for i in [0, 123, 499]:
+        assert i in octree.get_point_indices_of_node(leaves[i]).numpy()
+
+    # The leaves in a box covering the whole octree are all leaves.
+    leaves = octree.find_leaves_in_box(o3d.core.Tensor([-2.0, -2.0, -2.0]),
+                                       o3d.core.Tensor([2.0, 2.0, 2.0]))
+    assert leaves.shape == (octree.num_leaves,)
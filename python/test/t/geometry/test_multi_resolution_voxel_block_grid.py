@@ -0,0 +1,53 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# Copyright (c) 2018-2024 www.open3d.org
+# SPDX-License-Identifier: MIT
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+
+
+def _plane_depth(camera_x, width=320, height=240):
+    # Slanted plane z = 1.2 + 0.82 x seen from (camera_x, 0, 0).
+    u = np.arange(width, dtype=np.float32)
+    depth = (1.2 + 0.82 * camera_x) / (1.0 - 0.82 * (u - 160) / 200.0)
+    return o3d.t.geometry.Image(
+        np.tile(depth.astype(np.float32), (height, 1))[:, :, None])
+
+
+def test_integrate():
+    vbg = o3d.t.geometry.MultiResolutionVoxelBlockGrid(
+        attr_names=("tsdf", "weight"),
+        attr_dtypes=(o3d.core.float32, o3d.core.float32),
+        attr_channels=((1), (1)),
+        voxel_size=0.01,
+        block_resolution=8,
+        block_count=1000,
+        num_levels=3,
+        level_depth=1.0)
+    assert vbg.num_levels == 3
+    np.testing.assert_allclose(vbg.depth_range(1), (0.8, 2.4), rtol=1e-6)
+
+    intrinsic = o3d.core.Tensor([[200, 0, 160], [0, 200, 120], [0, 0, 1]],
+                                dtype=o3d.core.float64)
+    for i in range(4):
+        extrinsic = np.eye(4)
+        extrinsic[0, 3] = -0.02 * i
+        extrinsic = o3d.core.Tensor(extrinsic)
+        depth = _plane_depth(0.02 * i)
+        block_coords = vbg.compute_unique_block_coordinates(
+            depth, intrinsic, extrinsic, 1.0, 4.0, 4.0)
+        assert len(block_coords) == 3
+        vbg.integrate(block_coords, depth, intrinsic, extrinsic, 1.0, 4.0, 4.0)
+    for level in range(3):
+        assert vbg.level(level).hashmap().size() > 0
+
+    result = vbg.ray_cast(block_coords, intrinsic, extrinsic, 320, 240,
+                          ["depth", "normal"], 1.0, 0.1, 4.0, 3.0, 4.0)
+    depth = result["depth"].numpy()
+    assert np.count_nonzero(depth > 0) > 0.9 * depth.size
+
+    mesh = vbg.extract_triangle_mesh(3.0)
+    assert mesh.triangle.indices.shape[0] > 0
@@ -180,6 +180,53 @@ def test_extrude_linear():
     assert ans.line.indices.shape == (1, 2)
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_neighborhood_cache(device):
+    rng = np.random.default_rng(0)
+    points = o3c.Tensor(rng.random((500, 3)), o3c.float64, device)
+    pcd = o3d.t.geometry.PointCloud(points)
+    pcd_ref = pcd.clone()
+
+    assert not pcd.has_neighborhood_cache()
+    pcd.compute_neighborhood_cache(max_nn=20, radius=0.2)
+    assert pcd.has_neighborhood_cache()
+    cache = pcd.get_neighborhood_cache()
+    search_type = o3d.t.geometry.NeighborhoodCache.SearchType
+    assert cache.search_type == search_type.Hybrid
+    assert cache.indices.shape == [500, 20]
+    assert cache.counts.shape == [500]
+
+    pcd.estimate_normals(max_nn=20, radius=0.2)
+    pcd_ref.estimate_normals(max_nn=20, radius=0.2)
+    np.testing.assert_allclose(pcd.point.normals.cpu().numpy(),
+                               pcd_ref.point.normals.cpu().numpy())
+
+    pcd.translate(o3c.Tensor([1.0, 0.0, 0.0]))
+    assert not pcd.has_neighborhood_cache()
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_segment_planes(device):
+    rng = np.random.default_rng(0)
+    uv = rng.uniform(-1, 1, (2000, 2))
+    plane0 = np.c_[uv[:1000], np.full(1000, 0.5)]
+    plane1 = np.c_[np.full(1000, 2.0), uv[1000:]]
+    points = o3c.Tensor(np.r_[plane0, plane1], o3c.float32, device)
+    pcd = o3d.t.geometry.PointCloud(points)
+
+    o3d.utility.random.seed(0)
+    plane_models, labels = pcd.segment_planes(max_planes=3,
+                                              distance_threshold=0.01,
+                                              num_iterations=1000,
+                                              min_inliers=100)
+    assert plane_models.shape == [2, 4]
+    assert labels.dtype == o3c.int32
+    labels = labels.cpu().numpy()
+    assert (labels[:1000] == labels[0]).all()
+    assert (labels[1000:] == labels[1000]).all()
+    assert labels[0] != labels[1000]
+
+
 @pytest.mark.parametrize("device", list_devices(enable_sycl=True))
 def test_pickle(device):
     pcd = o3d.t.geometry.PointCloud(device)
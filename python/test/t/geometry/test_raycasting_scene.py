@@ -242,6 +242,215 @@ def test_list_lots_of_intersections(device):
     _ = scene.list_intersections(rays)
 
 
+@pytest.mark.parametrize("device",
+                         list_devices(enable_cuda=False, enable_sycl=True))
+def test_dynamic_updates(device):
+    cube = o3d.t.geometry.TriangleMesh.create_box().to(device)
+
+    scene = o3d.t.geometry.RaycastingScene(device=device)
+    cube_id = scene.add_triangles(cube, dynamic=True)
+    other_id = scene.add_triangles(cube, dynamic=True)
+    scene.set_geometry_transform(
+        other_id,
+        o3d.core.Tensor([[1, 0, 0, 5], [0, 1, 0, 0], [0, 0, 1, 0],
+                         [0, 0, 0, 1]]))
+
+    rays = o3d.core.Tensor([[0.5, 0.5, -1, 0, 0, 1], [5.5, 0.5, -1, 0, 0, 1]],
+                           dtype=o3d.core.float32,
+                           device=device)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans["geometry_ids"].cpu().numpy(),
+                            [cube_id, other_id])
+    np.testing.assert_allclose(ans["t_hit"].cpu().numpy(), [1, 1])
+    normals = ans["primitive_normals"].cpu().numpy()
+    np.testing.assert_allclose(normals[1], normals[0], atol=1e-6)
+    np.testing.assert_allclose(
+        scene.get_geometry_transform(other_id).numpy()[:3, 3], [5, 0, 0])
+
+    # Rotate the other cube by 180 degrees around the y axis. The ray hits the
+    # top face of the other cube, the normals are in world space.
+    scene.set_geometry_transform(
+        other_id,
+        o3d.core.Tensor([[-1, 0, 0, 6], [0, 1, 0, 0], [0, 0, -1, 0.5],
+                         [0, 0, 0, 1]]))
+    ans = scene.cast_rays(rays)
+    np.testing.assert_allclose(ans["t_hit"].cpu().numpy(), [1, 0.5])
+    np.testing.assert_allclose(ans["primitive_normals"].cpu().numpy()[1],
+                               normals[0],
+                               atol=1e-6)
+    with pytest.raises(RuntimeError):
+        scene.set_geometry_transform(other_id, 2 * o3d.core.Tensor.eye(4))
+
+    # Move the first cube up, the BVH is refitted.
+    offset = o3d.core.Tensor([0, 0, 0.5],
+                             dtype=o3d.core.float32,
+                             device=device)
+    scene.update_vertex_positions(cube_id, cube.vertex.positions + offset)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_allclose(ans["t_hit"].cpu().numpy(), [1.5, 0.5])
+
+    scene.set_geometry_enabled(other_id, False)
+    assert not scene.is_geometry_enabled(other_id)
+    ans = scene.cast_rays(rays)
+    assert ans["geometry_ids"][1].item(
+    ) == o3d.t.geometry.RaycastingScene.INVALID_ID
+    scene.set_geometry_enabled(other_id, True)
+    np.testing.assert_equal(scene.count_intersections(rays).cpu().numpy(),
+                            [2, 2])
+
+    scene.remove_geometry(cube_id)
+    ans = scene.cast_rays(rays)
+    assert ans["geometry_ids"][0].item(
+    ) == o3d.t.geometry.RaycastingScene.INVALID_ID
+    assert ans["geometry_ids"][1].item() == other_id
+    with pytest.raises(RuntimeError):
+        scene.remove_geometry(cube_id)
+
+
+@pytest.mark.parametrize("device",
+                         list_devices(enable_cuda=False, enable_sycl=True))
+def test_static_and_dynamic_geometry(device):
+    cube = o3d.t.geometry.TriangleMesh.create_box().to(device)
+
+    # Static meshes are attached to the scene without instancing and can be
+    # mixed with dynamic meshes.
+    scene = o3d.t.geometry.RaycastingScene(device=device)
+    static_id = scene.add_triangles(cube)
+    dynamic_id = scene.add_triangles(cube, dynamic=True)
+    scene.set_geometry_transform(
+        dynamic_id,
+        o3d.core.Tensor([[1, 0, 0, 5], [0, 1, 0, 0], [0, 0, 1, 0],
+                         [0, 0, 0, 1]]))
+    with pytest.raises(RuntimeError):
+        scene.set_geometry_transform(static_id, o3d.core.Tensor.eye(4))
+    np.testing.assert_equal(scene.get_geometry_transform(static_id).numpy(),
+                            np.eye(4))
+
+    rays = o3d.core.Tensor([[0.5, 0.5, -1, 0, 0, 1], [5.5, 0.5, -1, 0, 0, 1]],
+                           dtype=o3d.core.float32,
+                           device=device)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans["geometry_ids"].cpu().numpy(),
+                            [static_id, dynamic_id])
+    np.testing.assert_allclose(ans["t_hit"].cpu().numpy(), [1, 1])
+    np.testing.assert_allclose(np.abs(ans["primitive_normals"].cpu().numpy()),
+                               [[0, 0, 1], [0, 0, 1]],
+                               atol=1e-6)
+    np.testing.assert_equal(scene.count_intersections(rays).cpu().numpy(),
+                            [2, 2])
+
+    # The vertices of static meshes can be updated, the scene is rebuilt.
+    offset = o3d.core.Tensor([0, 0, 0.5],
+                             dtype=o3d.core.float32,
+                             device=device)
+    scene.update_vertex_positions(static_id, cube.vertex.positions + offset)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_allclose(ans["t_hit"].cpu().numpy(), [1.5, 1])
+
+    scene.set_geometry_enabled(static_id, False)
+    ans = scene.cast_rays(rays)
+    assert ans["geometry_ids"][0].item(
+    ) == o3d.t.geometry.RaycastingScene.INVALID_ID
+    scene.remove_geometry(static_id)
+    with pytest.raises(RuntimeError):
+        scene.is_geometry_enabled(static_id)
+
+
+def test_compute_closest_points_transformed():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    geom_id = scene.add_triangles(vertices, triangles, dynamic=True)
+    # Rotate by 90 degrees around the x axis and move along z.
+    scene.set_geometry_transform(
+        geom_id,
+        o3d.core.Tensor([[1, 0, 0, 0], [0, 0, -1, 0], [0, 1, 0, 2],
+                         [0, 0, 0, 1]]))
+
+    query_points = o3d.core.Tensor([[0.8, -1, 2.1]], dtype=o3d.core.float32)
+    ans = scene.compute_closest_points(query_points)
+
+    assert (geom_id == ans["geometry_ids"]).all()
+    np.testing.assert_allclose(ans["points"].numpy(), [[0.8, 0, 2.1]],
+                               rtol=1e-6,
+                               atol=1e-6)
+    np.testing.assert_allclose(np.abs(ans["primitive_normals"].numpy()),
+                               [[0, 1, 0]],
+                               atol=1e-6)
+
+
+@pytest.mark.parametrize("device",
+                         list_devices(enable_cuda=False, enable_sycl=True))
+def test_render_depth_batch(device):
+    mesh = o3d.t.geometry.TriangleMesh.create_sphere(0.8, 32)
+    scene = o3d.t.geometry.RaycastingScene(device=device)
+    scene.add_triangles(mesh.to(device))
+
+    # Odd image sizes to test partial tiles and ray packets.
+    width, height = 37, 29
+    intrinsic = o3d.core.Tensor([[30, 0, 18], [0, 30, 14], [0, 0, 1]],
+                                dtype=o3d.core.float64)
+    extrinsics = o3d.core.Tensor(
+        [
+            [[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 3], [0, 0, 0, 1]],
+            [[0, 0, -1, 0.1], [0, 1, 0, 0], [1, 0, 0, 3], [0, 0, 0, 1]],
+        ],
+        dtype=o3d.core.float64,
+    )
+
+    ans = scene.render_depth_batch(
+        intrinsic,
+        extrinsics,
+        width,
+        height,
+        output_names=[
+            "t_hit", "geometry_ids", "primitive_ids", "primitive_normals"
+        ])
+    assert sorted(ans.keys()) == [
+        "geometry_ids", "primitive_ids", "primitive_normals", "t_hit"
+    ]
+    assert list(ans["t_hit"].shape) == [2, height, width]
+    assert list(ans["primitive_normals"].shape) == [2, height, width, 3]
+
+    for i in range(2):
+        rays = scene.create_rays_pinhole(intrinsic, extrinsics[i], width,
+                                         height).to(device)
+        ans_gt = scene.cast_rays(rays)
+        t_hit = ans["t_hit"][i].cpu().numpy()
+        t_hit_gt = ans_gt["t_hit"].cpu().numpy()
+        # Rays at the silhouette may differ due to rounding.
+        hit = np.isfinite(t_hit)
+        hit_gt = np.isfinite(t_hit_gt)
+        assert np.count_nonzero(hit != hit_gt) <= 2
+        assert np.count_nonzero(hit) > 0
+        both = hit & hit_gt
+        np.testing.assert_allclose(t_hit[both], t_hit_gt[both], rtol=1e-4)
+        np.testing.assert_equal(ans["geometry_ids"][i].cpu().numpy()[both],
+                                ans_gt["geometry_ids"].cpu().numpy()[both])
+        # Rays through triangle edges may hit either triangle.
+        same = ans["primitive_ids"][i].cpu().numpy() == ans_gt[
+            "primitive_ids"].cpu().numpy()
+        assert np.count_nonzero(both & ~same) <= 0.01 * np.count_nonzero(both)
+        np.testing.assert_allclose(
+            ans["primitive_normals"][i].cpu().numpy()[both & same],
+            ans_gt["primitive_normals"].cpu().numpy()[both & same],
+            atol=1e-4)
+
+    # A single camera and the default output.
+    ans = scene.render_depth_batch(intrinsic, extrinsics[0], width, height)
+    assert list(ans.keys()) == ["t_hit"]
+    assert list(ans["t_hit"].shape) == [1, height, width]
+
+    with pytest.raises(RuntimeError):
+        scene.render_depth_batch(intrinsic,
+                                 extrinsics,
+                                 width,
+                                 height,
+                                 output_names=["points"])
+
+
 def test_compute_closest_points():
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
                                dtype=o3d.core.float32)
@@ -318,6 +527,44 @@ def test_compute_occupancy():
     np.testing.assert_allclose(ans.numpy(), [1.0, 0.0])
 
 
+def test_compute_narrow_band_signed_distance():
+    mesh = o3d.t.geometry.TriangleMesh.create_sphere(0.8, 40)
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(mesh)
+
+    voxel_size = 0.05
+    sdf_trunc = 4 * voxel_size
+    grid = scene.compute_narrow_band_signed_distance(voxel_size)
+
+    # Only blocks near the surface are allocated.
+    num_blocks = grid.hashmap().size()
+    assert 0 < num_blocks < (2 * 1.0 / (8 * voxel_size) + 1)**3
+
+    coords, indices = grid.voxel_coordinates_and_flattened_indices()
+    tsdf = grid.attribute("tsdf").reshape((-1,))[indices].numpy()
+    weight = grid.attribute("weight").reshape((-1,))[indices].numpy()
+    sdf_gt = scene.compute_signed_distance(coords).numpy()
+
+    # All voxels within the band are observed and have the correct tsdf.
+    band = np.abs(sdf_gt) < sdf_trunc
+    assert np.all(weight[band] == 1)
+    assert np.all(weight[~band] == 0)
+    np.testing.assert_allclose(tsdf[band] * sdf_trunc,
+                               sdf_gt[band],
+                               rtol=1e-5,
+                               atol=1e-6)
+
+    # The band must contain the whole surface.
+    surface = grid.extract_triangle_mesh(weight_threshold=0)
+    assert surface.vertex.positions.shape[0] > 0
+    radius = np.linalg.norm(surface.vertex.positions.numpy(), axis=1)
+    np.testing.assert_allclose(radius, 0.8, atol=voxel_size)
+
+    empty_scene = o3d.t.geometry.RaycastingScene()
+    grid = empty_scene.compute_narrow_band_signed_distance(voxel_size)
+    assert grid.hashmap().size() == 0
+
+
 @pytest.mark.parametrize("shape", ([11], [1, 2, 3], [32, 14]))
 def test_output_shapes(shape):
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
@@ -0,0 +1,39 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# Copyright (c) 2018-2024 www.open3d.org
+# SPDX-License-Identifier: MIT
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+
+
+def _sorted_rows(pcd):
+    rows = np.hstack([pcd.point.positions.numpy(), pcd.point.colors.numpy()])
+    return rows[np.lexsort(rows.T[::-1])]
+
+
+def test_add_chunk():
+    rng = np.random.default_rng(0)
+    pcd = o3d.t.geometry.PointCloud(
+        o3d.core.Tensor(rng.uniform(-2, 2, size=(3000, 3))))
+    pcd.point.colors = o3d.core.Tensor(rng.uniform(0, 1, size=(3000, 3)))
+    pcd_gt = pcd.voxel_down_sample(0.5)
+
+    # A small max_voxels spills tiles to disk.
+    for max_voxels in [1 << 20, 100]:
+        sampler = o3d.t.geometry.StreamingVoxelDownSampler(
+            0.5, max_voxels=max_voxels, tile_size=2)
+        for begin in range(0, 3000, 700):
+            indices = np.arange(begin, min(begin + 700, 3000))
+            sampler.add_chunk(pcd.select_by_index(o3d.core.Tensor(indices)))
+        assert sampler.num_points == 3000
+        assert (sampler.num_spilled_tiles > 0) == (max_voxels == 100)
+
+        pcd_down = sampler.extract()
+        np.testing.assert_allclose(_sorted_rows(pcd_down),
+                                   _sorted_rows(pcd_gt),
+                                   atol=1e-6)
+        assert sampler.num_points == 0
+        assert sampler.num_voxels_in_memory == 0
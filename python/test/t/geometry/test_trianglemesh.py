@@ -629,6 +629,43 @@ def test_create_isosurfaces():
     assert mesh.triangle.indices.shape[0] == 9452
 
 
+def test_create_from_point_cloud_poisson_streaming():
+    sphere = o3d.geometry.TriangleMesh.create_sphere(1.0, 40)
+    sphere.compute_vertex_normals()
+    pcd = o3d.geometry.PointCloud(sphere.vertices)
+    pcd.normals = sphere.vertex_normals
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filename = os.path.join(temp_dir, "sphere.ply")
+        o3d.io.write_point_cloud(filename, pcd)
+        mesh = o3d.t.geometry.TriangleMesh.create_from_point_cloud_poisson_streaming(
+            filename, depth=5, max_points_per_tile=1000, n_threads=1)
+
+    radii = np.linalg.norm(mesh.vertex.positions.numpy(), axis=1)
+    assert mesh.triangle.indices.shape[0] > 0
+    assert np.all(np.abs(radii - 1) < 0.15)
+
+
+def test_get_self_intersecting_triangles():
+    mesh = o3d.t.geometry.TriangleMesh(
+        o3c.Tensor([[0, 0, 0], [0, 1, 0], [1, 0, 0], [1, 1, 0],
+                    [0.2, 0.2, -1], [0.2, 0.2, 1], [-1, -1, 0.5]]),
+        o3c.Tensor([[0, 1, 2], [1, 2, 3], [4, 5, 6]]))
+    pairs = mesh.get_self_intersecting_triangles()
+    assert pairs.dtype == o3c.int64
+    np.testing.assert_equal(pairs.numpy(), [[0, 2]])
+
+    sphere = o3d.t.geometry.TriangleMesh.create_sphere(1.0, 20)
+    assert sphere.get_self_intersecting_triangles().shape == (0, 2)
+    pairs = sphere.get_intersecting_triangles(mesh)
+    assert {1, 2} <= set(pairs[:, 1].numpy())
+
+    # The legacy BVH can be reused for several queries.
+    bvh = o3d.geometry.TriangleMeshBVH(sphere.to_legacy())
+    assert not bvh.is_self_intersecting()
+    assert bvh.is_intersecting(o3d.geometry.TriangleMeshBVH(mesh.to_legacy()))
+
+
 def test_simplify_quadric_decimation():
     cube = o3d.t.geometry.TriangleMesh.from_legacy(
         o3d.geometry.TriangleMesh.create_box().subdivide_midpoint(3))
@@ -641,6 +678,17 @@ def test_simplify_quadric_decimation():
     assert simplified.vertex.positions.shape == (8, 3)
     assert simplified.triangle.indices.shape == (12, 3)
 
+    # Decimate in partitions of at most 1000 triangles.
+    sphere = o3d.t.geometry.TriangleMesh.create_sphere(1.0, 50)
+    sphere.compute_vertex_normals()
+    num_triangles = sphere.triangle.indices.shape[0]
+    simplified = sphere.simplify_quadric_decimation(
+        target_reduction=0.9, max_partition_triangles=1000)
+    assert simplified.triangle.indices.shape == (num_triangles // 10, 3)
+    assert simplified.vertex.normals.shape == simplified.vertex.positions.shape
+    radii = np.linalg.norm(simplified.vertex.positions.numpy(), axis=1)
+    np.testing.assert_allclose(radii, 1.0, atol=0.02)
+
 
 def test_boolean_operations():
     box = o3d.geometry.TriangleMesh.create_box()
@@ -651,17 +699,31 @@ def test_boolean_operations():
     assert sphere.vertex.positions.shape == (762, 3)
     assert sphere.triangle.indices.shape == (1520, 3)
 
+    box_volume = box.to_legacy().get_volume()
+    sphere_volume = sphere.to_legacy().get_volume()
+
+    union = box.boolean_union(sphere).to_legacy()
+    assert union.is_watertight()
+    intersection = box.boolean_intersection(sphere).to_legacy()
+    assert intersection.is_watertight()
+    difference = box.boolean_difference(sphere).to_legacy()
+    assert difference.is_watertight()
+
+    # The volume of the sphere inside of the box is one eighth of the sphere.
+    assert intersection.get_volume() == pytest.approx(sphere_volume / 8,
+                                                      rel=1e-2)
+    assert union.get_volume() == pytest.approx(
+        box_volume + sphere_volume - intersection.get_volume())
+    assert difference.get_volume() == pytest.approx(
+        box_volume - intersection.get_volume())
+
+    # Vertex attributes are interpolated along the intersection curves.
+    box.vertex.colors = box.vertex.positions
+    sphere.vertex.colors = sphere.vertex.positions
     ans = box.boolean_union(sphere)
-    assert ans.vertex.positions.shape == (730, 3)
-    assert ans.triangle.indices.shape == (1384, 3)
-
-    ans = box.boolean_intersection(sphere)
-    assert ans.vertex.positions.shape == (154, 3)
-    assert ans.triangle.indices.shape == (232, 3)
-
-    ans = box.boolean_difference(sphere)
-    assert ans.vertex.positions.shape == (160, 3)
-    assert ans.triangle.indices.shape == (244, 3)
+    np.testing.assert_allclose(ans.vertex.colors.numpy(),
+                               ans.vertex.positions.numpy(),
+                               atol=1e-5)
 
 
 def test_hole_filling():